@@ -213,6 +213,53 @@ void CalculateActivationRangeFloat(int32_t activation,
     }
 }
 
+#ifdef HIFI_NNLIB_OPT
+bool GetQuant8ConvParams(const Shape& inputShape,
+                         const Shape& filterShape,
+                         const Shape& biasShape,
+                         const Shape& outputShape,
+                         int32_t activation,
+                         Quant8ConvParams* params) {
+    float real_multiplier = 0.0;
+    if (!GetQuantizedConvolutionMultipler(inputShape, filterShape, biasShape,
+                                          outputShape, &real_multiplier) ||
+            !QuantizeMultiplierSmallerThanOne(real_multiplier, &params->outputMultiplier,
+                                              &params->outputShift)) {
+        return false;
+    }
+    CalculateActivationRangeUint8(activation, outputShape,
+                                  &params->activationMin,
+                                  &params->activationMax);
+    return true;
+}
+
+bool QuantizeMultiplierForKernel(double double_multiplier,
+                                 int32_t* quantized_multiplier,
+                                 int32_t* shift) {
+    if (double_multiplier < 1.) {
+        int32_t right_shift = 0;
+        if (!QuantizeMultiplierSmallerThanOne(double_multiplier, quantized_multiplier,
+                                              &right_shift)) {
+            return false;
+        }
+        *shift = -right_shift;
+    } else {
+        int left_shift = 0;
+        if (double_multiplier == 1.) {
+            // 0.5 in Q31, shifted left once
+            *quantized_multiplier = 1 << 30;
+            left_shift = 1;
+        } else if (!QuantizeMultiplierGreaterThanOne(double_multiplier, quantized_multiplier,
+                                                     &left_shift)) {
+            return false;
+        }
+        *shift = left_shift;
+    }
+    NN_OPS_CHECK(*shift >= -31 && *shift <= 31);
+    return true;
+}
+#endif
+
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift) {
     const double max_input_rescaled = 1.0 * ((1 << input_integer_bits) - 1) *
                                       (1ll << (31 - input_integer_bits)) /
@@ -964,6 +964,9 @@ int validateOperation(ANeuralNetworksOperationType opType,
             if (inputType == OperandType::TENSOR_FLOAT32) {
                 inExpectedTypes = {OperandType::TENSOR_FLOAT32};
                 outExpectedTypes = {OperandType::TENSOR_FLOAT32};
+            } else if (inputType == OperandType::TENSOR_QUANT8_ASYMM) {
+                inExpectedTypes = {OperandType::TENSOR_QUANT8_ASYMM};
+                outExpectedTypes = {OperandType::TENSOR_QUANT8_ASYMM};
             } else {
 #ifndef HIFI_BUILD
                 LOG(ERROR) << "Unsupported input tensor type for operation "
@@ -1306,33 +1309,76 @@ int validateOperation(ANeuralNetworksOperationType opType,
                 logInvalidInOutNumber(23, 4);
                 return ANEURALNETWORKS_BAD_DATA;
             }
-            std::vector<OperandType> inExpectedTypes = {OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::INT32,
-                                                        OperandType::FLOAT32,
-                                                        OperandType::FLOAT32};
-            std::vector<OperandType> outExpectedTypes = {OperandType::TENSOR_FLOAT32,
-                                                         OperandType::TENSOR_FLOAT32,
-                                                         OperandType::TENSOR_FLOAT32,
-                                                         OperandType::TENSOR_FLOAT32};
+            auto inputType = operands[inputIndexes[0]].type;
+            std::vector<OperandType> inExpectedTypes;
+            std::vector<OperandType> outExpectedTypes;
+            if (inputType == OperandType::TENSOR_FLOAT32) {
+                inExpectedTypes = {OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::INT32,
+                                   OperandType::FLOAT32,
+                                   OperandType::FLOAT32};
+                outExpectedTypes = {OperandType::TENSOR_FLOAT32,
+                                    OperandType::TENSOR_FLOAT32,
+                                    OperandType::TENSOR_FLOAT32,
+                                    OperandType::TENSOR_FLOAT32};
+#ifdef HIFI_NNLIB_OPT
+            } else if (inputType == OperandType::TENSOR_QUANT8_ASYMM) {
+                // Quantized LSTM: asym8 activations and weights, int32 biases
+                // and an int16 (Q4.11) cell state held in TENSOR_INT32.
+                inExpectedTypes = {OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::INT32,
+                                   OperandType::FLOAT32,
+                                   OperandType::FLOAT32};
+                outExpectedTypes = {OperandType::TENSOR_INT32,
+                                    OperandType::TENSOR_QUANT8_ASYMM,
+                                    OperandType::TENSOR_INT32,
+                                    OperandType::TENSOR_QUANT8_ASYMM};
+#endif //HIFI_NNLIB_OPT
+            } else {
+#ifndef HIFI_BUILD
+                LOG(ERROR) << "Unsupported input tensor type for operation "
+                           << kOperationNames[opType];
+#endif //HIFI_BUILD
+                return ANEURALNETWORKS_BAD_DATA;
+            }
             return validateOperationOperandTypes(operands,
                                                  inputCount, inputIndexes,
                                                  inExpectedTypes,
@@ -1344,14 +1390,36 @@ int validateOperation(ANeuralNetworksOperationType opType,
                 logInvalidInOutNumber(6, 2);
                 return ANEURALNETWORKS_BAD_DATA;
             }
-            std::vector<OperandType> inExpectedTypes = {OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::TENSOR_FLOAT32,
-                                                        OperandType::INT32};
-            std::vector<OperandType> outExpectedTypes = {OperandType::TENSOR_FLOAT32,
-                                                         OperandType::TENSOR_FLOAT32};
+            auto inputType = operands[inputIndexes[0]].type;
+            std::vector<OperandType> inExpectedTypes;
+            std::vector<OperandType> outExpectedTypes;
+            if (inputType == OperandType::TENSOR_FLOAT32) {
+                inExpectedTypes = {OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::TENSOR_FLOAT32,
+                                   OperandType::INT32};
+                outExpectedTypes = {OperandType::TENSOR_FLOAT32,
+                                    OperandType::TENSOR_FLOAT32};
+#ifdef HIFI_NNLIB_OPT
+            } else if (inputType == OperandType::TENSOR_QUANT8_ASYMM) {
+                inExpectedTypes = {OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::TENSOR_INT32,
+                                   OperandType::TENSOR_QUANT8_ASYMM,
+                                   OperandType::INT32};
+                outExpectedTypes = {OperandType::TENSOR_QUANT8_ASYMM,
+                                    OperandType::TENSOR_QUANT8_ASYMM};
+#endif //HIFI_NNLIB_OPT
+            } else {
+#ifndef HIFI_BUILD
+                LOG(ERROR) << "Unsupported input tensor type for operation "
+                           << kOperationNames[opType];
+#endif //HIFI_BUILD
+                return ANEURALNETWORKS_BAD_DATA;
+            }
             return validateOperationOperandTypes(operands,
                                                  inputCount, inputIndexes,
                                                  inExpectedTypes,
@@ -296,6 +296,58 @@ bool relu6Quant8(const uint8_t* inputData, const Shape& inputShape,
 
 #undef ANDROID_NN_RELUX_QUANT8
 
+#ifdef HIFI_NNLIB_OPT
+// 256-entry tables mapping every asym8 input to its activation output. A
+// table depends only on the input scale and zero point, and a model uses
+// few distinct ones, so tables are built once and kept in a small cache.
+struct Quant8ActivationLut {
+    bool valid;
+    float scale;
+    int32_t offset;
+    uint8_t table[256];
+};
+
+static constexpr int kQuant8LutCacheSize = 4;
+
+// CpuExecutor may run operations on several threads, each keeps its own cache.
+#ifdef NNLIB_PTHREADS
+#define QUANT8_LUT_CACHE static thread_local
+#else
+#define QUANT8_LUT_CACHE static
+#endif
+
+typedef WORD32 (*Quant8LutInitFn)(UWORD8* p_lut, WORD32 zero_point,
+                                  WORD32 input_range_radius,
+                                  WORD32 input_multiplier,
+                                  WORD32 input_left_shift);
+
+static const uint8_t* getQuant8ActivationLut(Quant8ActivationLut* cache,
+                                             int* nextSlot,
+                                             const Shape& inputShape,
+                                             int32_t input_range_radius,
+                                             int32_t input_multiplier,
+                                             int32_t input_left_shift,
+                                             Quant8LutInitFn init) {
+    for (int i = 0; i < kQuant8LutCacheSize; i++) {
+        if (cache[i].valid && cache[i].scale == inputShape.scale &&
+            cache[i].offset == inputShape.offset) {
+            return cache[i].table;
+        }
+    }
+    Quant8ActivationLut* entry = &cache[*nextSlot];
+    *nextSlot = (*nextSlot + 1) % kQuant8LutCacheSize;
+    entry->valid = false;
+    if (init(entry->table, inputShape.offset, input_range_radius,
+             input_multiplier, input_left_shift) != 0) {
+        return nullptr;
+    }
+    entry->scale = inputShape.scale;
+    entry->offset = inputShape.offset;
+    entry->valid = true;
+    return entry->table;
+}
+#endif
+
 bool logisticQuant8(const uint8_t* inputData, const Shape& inputShape,
                     uint8_t* outputData, const Shape& outputShape) {
     if (outputShape.offset != 0 || outputShape.scale != 1.f / 256) {
@@ -328,17 +380,24 @@ bool logisticQuant8(const uint8_t* inputData, const Shape& inputShape,
             input_multiplier, input_left_shift,
             outputData, convertShapeToDims(outputShape));
 #else
+    QUANT8_LUT_CACHE Quant8ActivationLut lutCache[kQuant8LutCacheSize];
+    QUANT8_LUT_CACHE int lutNextSlot = 0;
     int err;
     const int size = RequiredBufferSizeForDims(convertShapeToDims(inputShape));
 
-
-    err = xa_nn_vec_sigmoid_asym8_asym8(outputData, 
-                               inputData, 
-                               inputShape.offset, 
-                               input_range_radius, 
-                               input_multiplier,
-                               input_left_shift, 
-                               size);
+    const uint8_t* lut = getQuant8ActivationLut(lutCache, &lutNextSlot,
+                                                inputShape,
+                                                input_range_radius,
+                                                input_multiplier,
+                                                input_left_shift,
+                                                xa_nn_vec_sigmoid_asym8_asym8_lut_init);
+    if (lut == nullptr) {
+        return false;
+    }
+    err = xa_nn_vec_lut_asym8_asym8(outputData, inputData, lut, size);
+    if (err) {
+        return false;
+    }
 #endif
 
 #ifndef HIFI_WARNINGS
@@ -347,6 +406,61 @@ bool logisticQuant8(const uint8_t* inputData, const Shape& inputShape,
     return true;
 }
 
+bool tanhQuant8(const uint8_t* inputData, const Shape& inputShape,
+                uint8_t* outputData, const Shape& outputShape) {
+    if (outputShape.offset != 128 || outputShape.scale != 1.f / 128) {
+#ifndef HIFI_BUILD
+        LOG(ERROR) << "incorrect scale / offset for output";
+#endif //HIFI_BUILD
+        return false;
+    }
+
+    int numElements = getNumberOfElements(inputShape);
+#ifndef HIFI_NNLIB_OPT
+    for (int i = 0; i < numElements; i++) {
+        const float x = inputShape.scale *
+                (static_cast<int32_t>(inputData[i]) - inputShape.offset);
+        const int32_t y = static_cast<int32_t>(std::round(std::tanh(x) * 128.f)) + 128;
+        outputData[i] = static_cast<uint8_t>(std::min(255, std::max(0, y)));
+    }
+#else
+    static constexpr int kInputIntegerBits = 4;
+
+    const double input_real_multiplier =
+            inputShape.scale *
+            static_cast<double>(1 << (31 - kInputIntegerBits));
+
+    int32_t input_multiplier = 0;
+    int32_t input_left_shift = 0;
+    if (!QuantizeMultiplierGreaterThanOne(input_real_multiplier,
+                                          &input_multiplier,
+                                          &input_left_shift)) {
+        return false;
+    }
+    int32_t input_range_radius =
+            CalculateInputRadius(kInputIntegerBits, input_left_shift);
+
+    QUANT8_LUT_CACHE Quant8ActivationLut lutCache[kQuant8LutCacheSize];
+    QUANT8_LUT_CACHE int lutNextSlot = 0;
+    int err;
+
+    const uint8_t* lut = getQuant8ActivationLut(lutCache, &lutNextSlot,
+                                                inputShape,
+                                                input_range_radius,
+                                                input_multiplier,
+                                                input_left_shift,
+                                                xa_nn_vec_tanh_asym8_asym8_lut_init);
+    if (lut == nullptr) {
+        return false;
+    }
+    err = xa_nn_vec_lut_asym8_asym8(outputData, inputData, lut, numElements);
+    if (err) {
+        return false;
+    }
+#endif
+    return true;
+}
+
 bool softmaxQuant8(const uint8_t* inputData, const Shape& inputShape,
                    const float beta,
 #ifndef HIFI_NNLIB_OPT
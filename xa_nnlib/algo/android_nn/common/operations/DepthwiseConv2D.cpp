@@ -141,7 +141,8 @@ bool depthwiseConvQuant8(const uint8_t* inputData, const Shape& inputShape,
 #ifndef HIFI_NNLIB_OPT
                          uint8_t* outputData, const Shape& outputShape) {
 #else
-                         uint8_t* outputData, const Shape& outputShape, void *p_scratch) {
+                         uint8_t* outputData, const Shape& outputShape, void *p_scratch,
+                         const Quant8ConvParams* params) {
 #endif
 
     ANDROID_NN_DEPTHWISE_CONV_PARAMETERS
@@ -152,16 +153,25 @@ bool depthwiseConvQuant8(const uint8_t* inputData, const Shape& inputShape,
     int32_t output_activation_min = 0;
     int32_t output_activation_max = 0;
 
-
-    if (!GetQuantizedConvolutionMultipler(inputShape, filterShape, biasShape,
-                                          outputShape, &real_multiplier) ||
-            !QuantizeMultiplierSmallerThanOne(real_multiplier, &output_multiplier,
-                                              &output_shift)) {
-        return false;
+#ifdef HIFI_NNLIB_OPT
+    if (params != nullptr) {
+        output_multiplier = params->outputMultiplier;
+        output_shift = params->outputShift;
+        output_activation_min = params->activationMin;
+        output_activation_max = params->activationMax;
+    } else
+#endif
+    {
+        if (!GetQuantizedConvolutionMultipler(inputShape, filterShape, biasShape,
+                                              outputShape, &real_multiplier) ||
+                !QuantizeMultiplierSmallerThanOne(real_multiplier, &output_multiplier,
+                                                  &output_shift)) {
+            return false;
+        }
+        CalculateActivationRangeUint8(activation, outputShape,
+                                      &output_activation_min,
+                                      &output_activation_max);
     }
-    CalculateActivationRangeUint8(activation, outputShape,
-                                  &output_activation_min,
-                                  &output_activation_max);
 
     uint32_t inputOffset = -inputShape.offset;
     uint32_t filterOffset = -filterShape.offset;
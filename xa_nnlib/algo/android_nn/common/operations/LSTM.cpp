@@ -65,6 +65,24 @@ inline const T *GetBuffer(const RunTimeOperandInfo* operand) {
   return reinterpret_cast<const T*>(operand->buffer);
 }
 
+#ifdef HIFI_NNLIB_OPT
+// Fixed scales of the quantized LSTM, as in TensorFlow Lite's quantized
+// LstmCell: input and output state in [-1, 127/128], cell state in Q4.11
+// and gate pre-activations in Q3.12 for the int16 sigmoid/tanh.
+constexpr float kQuant8StateScale = 1.0f / 128.0f;
+constexpr int32_t kQuant8StateZeroPoint = 128;
+constexpr float kQuant8CellStateScale = 1.0f / 2048.0f;
+constexpr int kQuant8GateFracBits = 12;
+
+inline bool ScalesMatch(float a, float b) {
+  return std::abs(a - b) <= 1e-6 * std::min(a, b);
+}
+
+inline int16_t SaturateInt16(int32_t x) {
+  return static_cast<int16_t>(std::min(32767, std::max(-32768, x)));
+}
+#endif
+
 }  // anonymous namespace
 
 LSTMCell::LSTMCell(const Operation& operation,
@@ -315,6 +333,12 @@ bool LSTMCell::Prepare(const Operation &operation,
   if (!CheckInputTensorDimensions(operation, operands, n_input, n_output, n_cell)) {
     return false;
   }
+#ifdef HIFI_NNLIB_OPT
+  const bool is_quant8 = input->type == OperandType::TENSOR_QUANT8_ASYMM;
+  if (is_quant8 && !CheckQuant8Params(operation, operands)) {
+    return false;
+  }
+#endif
 
   // Resize the output and output_state tensors.
   const Shape &inputShape = input->shape();
@@ -379,11 +403,88 @@ bool LSTMCell::Prepare(const Operation &operation,
   scratchShape->type = inputShape.type;
   scratchShape->offset = inputShape.offset;
   scratchShape->scale = inputShape.scale;
+#ifdef HIFI_NNLIB_OPT
+  if (is_quant8) {
+    // The int16 gate buffers fit in half of the int32 scratch.
+    cellStateShape->type = OperandType::TENSOR_INT32;
+    cellStateShape->offset = 0;
+    cellStateShape->scale = kQuant8CellStateScale;
+    scratchShape->type = OperandType::TENSOR_INT32;
+    scratchShape->offset = 0;
+    scratchShape->scale = 0.f;
+  }
+#endif
 
   return true;
 }
 
+#ifdef HIFI_NNLIB_OPT
+bool LSTMCell::CheckQuant8Params(const Operation &operation,
+                                 std::vector<RunTimeOperandInfo> &operands) {
+  // Only the full four gate cell is quantized: no CIFG, peephole or
+  // projection, and tanh as the cell activation.
+  NN_CHECK(!IsNullInput(GetInput(operation, operands, kInputToInputWeightsTensor)));
+  NN_CHECK(IsNullInput(GetInput(operation, operands, kCellToInputWeightsTensor)));
+  NN_CHECK(IsNullInput(GetInput(operation, operands, kCellToForgetWeightsTensor)));
+  NN_CHECK(IsNullInput(GetInput(operation, operands, kCellToOutputWeightsTensor)));
+  NN_CHECK(IsNullInput(GetInput(operation, operands, kProjectionWeightsTensor)));
+  NN_CHECK(IsNullInput(GetInput(operation, operands, kProjectionBiasTensor)));
+  NN_CHECK_EQ(getScalarData<int32_t>(*GetInput(operation, operands, kActivationParam)),
+              lstm_kTfLiteActTanh);
+  NN_CHECK_EQ(SizeOfDimension(GetInput(operation, operands, kRecurrentToOutputWeightsTensor), 1),
+              SizeOfDimension(GetInput(operation, operands, kInputToOutputWeightsTensor), 0));
+
+  const RunTimeOperandInfo *input = GetInput(operation, operands, kInputTensor);
+  const RunTimeOperandInfo *output_state_in =
+      GetInput(operation, operands, kOutputStateInTensor);
+  const RunTimeOperandInfo *cell_state_in =
+      GetInput(operation, operands, kCellStateInTensor);
+  NN_CHECK(ScalesMatch(input->scale, kQuant8StateScale));
+  NN_CHECK_EQ(input->zeroPoint, kQuant8StateZeroPoint);
+  NN_CHECK(ScalesMatch(output_state_in->scale, kQuant8StateScale));
+  NN_CHECK_EQ(output_state_in->zeroPoint, kQuant8StateZeroPoint);
+  NN_CHECK(ScalesMatch(cell_state_in->scale, kQuant8CellStateScale));
+  NN_CHECK_EQ(cell_state_in->zeroPoint, 0);
+#ifndef HIFI_WARNINGS
+  (void)input;
+  (void)output_state_in;
+  (void)cell_state_in;
+#endif
+
+  // All weights share one scale and zero point, so a gate's input and
+  // recurrent products are requantized with one multiplier.
+  const RunTimeOperandInfo *weights =
+      GetInput(operation, operands, kInputToInputWeightsTensor);
+  for (int i = kInputToInputWeightsTensor; i <= kRecurrentToOutputWeightsTensor; i++) {
+    const RunTimeOperandInfo *w = GetInput(operation, operands, i);
+    NN_CHECK(ScalesMatch(w->scale, weights->scale));
+    NN_CHECK_EQ(w->zeroPoint, weights->zeroPoint);
+#ifndef HIFI_WARNINGS
+    (void)w;
+#endif
+  }
+  const float bias_scale = weights->scale * kQuant8StateScale;
+  for (int i = kInputGateBiasTensor; i <= kOutputGateBiasTensor; i++) {
+    const RunTimeOperandInfo *bias = GetInput(operation, operands, i);
+    NN_CHECK(ScalesMatch(bias->scale, bias_scale));
+    NN_CHECK_EQ(bias->zeroPoint, 0);
+#ifndef HIFI_WARNINGS
+    (void)bias;
+#endif
+  }
+#ifndef HIFI_WARNINGS
+  (void)bias_scale;
+#endif
+  return true;
+}
+#endif
+
 bool LSTMCell::Eval() {
+#ifdef HIFI_NNLIB_OPT
+  if (input_->type == OperandType::TENSOR_QUANT8_ASYMM) {
+    return EvalQuant8();
+  }
+#endif
   const uint32_t n_batch = input_->shape().dimensions[0];
   const uint32_t n_input = input_->shape().dimensions[1];
   // n_cell and n_output will be the same size when there is no projection.
@@ -552,164 +653,68 @@ bool LSTMCell::Eval() {
                            GetBuffer<float>(output_state_out_));
 #else
   int b, ret = 0;
-  if (!use_cifg) {
+  if (hybrid_ != nullptr) {
+    if (!EvalHybridGates(input_gate_scratch, forget_gate_scratch, cell_scratch,
+                         output_gate_scratch)) {
+      return false;
+    }
+  } else {
+    if (!use_cifg) {
+      for(b = 0; b < n_batch; b++)
+      {
+        ret = xa_nn_matXvec_f32xf32_f32(
+            input_gate_scratch+b*n_cell,
+            GetBuffer<float>(input_to_input_weights_), GetBuffer<float>(recurrent_to_input_weights_),
+            GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
+            GetBuffer<float>(input_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
+        if(ret)
+          return false;
+      }
+    }
     for(b = 0; b < n_batch; b++)
     {
       ret = xa_nn_matXvec_f32xf32_f32(
-          input_gate_scratch+b*n_cell,
-          GetBuffer<float>(input_to_input_weights_), GetBuffer<float>(recurrent_to_input_weights_),
+          forget_gate_scratch+b*n_cell,
+          GetBuffer<float>(input_to_forget_weights_), GetBuffer<float>(recurrent_to_forget_weights_),
           GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
-          GetBuffer<float>(input_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
+          GetBuffer<float>(forget_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
       if(ret)
         return false;
     }
-  }
-  for(b = 0; b < n_batch; b++)
-  {
-    ret = xa_nn_matXvec_f32xf32_f32(
-        forget_gate_scratch+b*n_cell,
-        GetBuffer<float>(input_to_forget_weights_), GetBuffer<float>(recurrent_to_forget_weights_),
-        GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
-        GetBuffer<float>(forget_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
-    if(ret)
-      return false;
-  }
-  for(b = 0; b < n_batch; b++)
-  {
-    ret = xa_nn_matXvec_f32xf32_f32(
-        cell_scratch+b*n_cell,
-        GetBuffer<float>(input_to_cell_weights_), GetBuffer<float>(recurrent_to_cell_weights_), 
-        GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
-        GetBuffer<float>(cell_bias_), n_cell, n_input, n_output, n_input, n_output);
-    if(ret)
-      return false;
-  }
-  for(b = 0; b < n_batch; b++)
-  {
-    ret = xa_nn_matXvec_f32xf32_f32(
-        output_gate_scratch+b*n_cell,
-        GetBuffer<float>(input_to_output_weights_), GetBuffer<float>(recurrent_to_output_weights_),
-        GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
-        GetBuffer<float>(output_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
-    if(ret)
-      return false;
-  }
-
-  // For each batch and cell: update input gate.
-  if (!use_cifg) {
-    if (use_peephole) {
-      tflite::tensor_utils::VectorBatchVectorCwiseProductAccumulate(
-          GetBuffer<float>(cell_to_input_weights_), n_cell,
-          GetBuffer<float>(cell_state_in_), n_batch, input_gate_scratch);
-    }
-    ret = xa_nn_vec_sigmoid_f32_f32(input_gate_scratch, input_gate_scratch, n_cell * n_batch);
-  }
-
-  // For each batch and cell: update forget gate.
-  if (use_peephole) {
     for(b = 0; b < n_batch; b++)
     {
-      ret = xa_nn_elm_mul_acc_f32xf32_f32(forget_gate_scratch + b * n_cell, 
-          GetBuffer<float>(cell_to_forget_weights_),
-          GetBuffer<float>(cell_state_in_) + b * n_cell, n_cell);
+      ret = xa_nn_matXvec_f32xf32_f32(
+          cell_scratch+b*n_cell,
+          GetBuffer<float>(input_to_cell_weights_), GetBuffer<float>(recurrent_to_cell_weights_), 
+          GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
+          GetBuffer<float>(cell_bias_), n_cell, n_input, n_output, n_input, n_output);
       if(ret)
         return false;
     }
-  }
-  ret = xa_nn_vec_sigmoid_f32_f32(forget_gate_scratch, forget_gate_scratch, n_cell * n_batch);
-
-  // For each batch and cell: update the cell.
-  ret = xa_nn_elm_mul_f32xf32_f32(GetBuffer<float>(cell_state_out_), forget_gate_scratch, 
-      GetBuffer<float>(cell_state_in_), n_batch * n_cell);
-#ifndef HIFI_BUILD
-  switch(params_.activation_) {
-#else
-  switch(static_cast<TfLiteFusedActivation>(params_.activation_)) {
-#endif //HiFi_BUILD
-    case kTfLiteActNone:
-      ret = 0;
-      break;
-    case kTfLiteActRelu:
-      ret = xa_nn_vec_activation_min_max_f32_f32(cell_scratch, cell_scratch,
-          0.0f, std::numeric_limits<float>::max(), n_batch * n_cell);
-      break;
-    case kTfLiteActRelu6:
-      ret = xa_nn_vec_activation_min_max_f32_f32(cell_scratch, cell_scratch,
-          0.0f, 6.0f, n_batch * n_cell);
-      break;
-    case kTfLiteActTanh:
-      ret = xa_nn_vec_tanh_f32_f32(cell_scratch, cell_scratch,
-          n_batch * n_cell);
-      break;
-    case kTfLiteActSigmoid:
-      ret = xa_nn_vec_sigmoid_f32_f32(cell_scratch, cell_scratch,
-          n_batch * n_cell);
-      break;
-    default:
-      ret = -1;
-  }
-  if(ret != 0)
-    return false;
-
-  if (use_cifg) {
-    tflite::tensor_utils::Sub1Vector(forget_gate_scratch, n_batch * n_cell,
-                                     forget_gate_scratch);
-    ret = xa_nn_elm_mul_acc_f32xf32_f32(GetBuffer<float>(cell_state_out_),
-        cell_scratch, forget_gate_scratch , n_batch * n_cell);
-  } else {
-    ret = xa_nn_elm_mul_acc_f32xf32_f32(GetBuffer<float>(cell_state_out_),
-        cell_scratch, input_gate_scratch , n_batch * n_cell);
-  }
-  if (params_.cell_clip_ > 0.0) {
-    ret = xa_nn_vec_activation_min_max_f32_f32(GetBuffer<float>(cell_state_out_),
-        GetBuffer<float>(cell_state_out_), -params_.cell_clip_, params_.cell_clip_, n_batch * n_cell);
-  }
-
-  // For each batch and cell: update the output gate.
-  if (use_peephole) {
     for(b = 0; b < n_batch; b++)
     {
-      ret = xa_nn_elm_mul_acc_f32xf32_f32(output_gate_scratch + b * n_cell, 
-          GetBuffer<float>(cell_to_output_weights_),
-          GetBuffer<float>(cell_state_out_) + b * n_cell, n_cell);
+      ret = xa_nn_matXvec_f32xf32_f32(
+          output_gate_scratch+b*n_cell,
+          GetBuffer<float>(input_to_output_weights_), GetBuffer<float>(recurrent_to_output_weights_),
+          GetBuffer<float>(input_)+b*n_input, GetBuffer<float>(output_state_in_)+b*n_output,
+          GetBuffer<float>(output_gate_bias_), n_cell, n_input, n_output, n_input, n_output);
       if(ret)
         return false;
     }
   }
-  ret = xa_nn_vec_sigmoid_f32_f32(output_gate_scratch, output_gate_scratch, n_batch * n_cell);
 
-#ifndef HIFI_BUILD
-  switch(params_.activation_) {
-#else
-  switch(static_cast<TfLiteFusedActivation>(params_.activation_)) {
-#endif //HiFi_BUILD
-    case kTfLiteActNone:
-      ret = 0;
-      break;
-    case kTfLiteActRelu:
-      ret = xa_nn_vec_activation_min_max_f32_f32(cell_scratch, GetBuffer<float>(cell_state_out_),
-          0.0f, std::numeric_limits<float>::max(), n_batch * n_cell);
-      break;
-    case kTfLiteActRelu6:
-      ret = xa_nn_vec_activation_min_max_f32_f32(cell_scratch, GetBuffer<float>(cell_state_out_),
-          0.0f, 6.0f, n_batch * n_cell);
-      break;
-    case kTfLiteActTanh:
-      ret = xa_nn_vec_tanh_f32_f32(cell_scratch, GetBuffer<float>(cell_state_out_),
-          n_batch * n_cell);
-      break;
-    case kTfLiteActSigmoid:
-      ret = xa_nn_vec_sigmoid_f32_f32(cell_scratch, GetBuffer<float>(cell_state_out_),
-          n_batch * n_cell);
-      break;
-    default:
-      ret = -1;
-  }
+  // Gates, cell state and output in one pass; the output overwrites
+  // output_gate_scratch, which the projection below reads.
+  ret = xa_nn_lstm_cell_update_f32(GetBuffer<float>(cell_state_out_), output_gate_scratch,
+      use_cifg ? NULL : input_gate_scratch, forget_gate_scratch, cell_scratch,
+      output_gate_scratch, GetBuffer<float>(cell_state_in_),
+      (use_peephole && !use_cifg) ? GetBuffer<float>(cell_to_input_weights_) : NULL,
+      use_peephole ? GetBuffer<float>(cell_to_forget_weights_) : NULL,
+      use_peephole ? GetBuffer<float>(cell_to_output_weights_) : NULL,
+      params_.cell_clip_, static_cast<int32_t>(params_.activation_), n_cell, n_batch);
   if(ret != 0)
     return false;
 
-  ret = xa_nn_elm_mul_f32xf32_f32(output_gate_scratch, output_gate_scratch, cell_scratch, n_batch * n_cell);
-
   // For each batch: update the projection and output_state.
   const bool use_projection_weight =
           (projection_weights_->lifetime != OperandLifeTime::NO_VALUE);
@@ -748,5 +753,194 @@ bool LSTMCell::Eval() {
   return true;
 }
 
+#ifdef HIFI_NNLIB_OPT
+bool LSTMCell::EvalQuant8() {
+  const uint32_t n_batch = input_->shape().dimensions[0];
+  const uint32_t n_input = input_->shape().dimensions[1];
+  // n_cell and n_output are the same, there is no projection.
+  const uint32_t n_cell = input_to_output_weights_->shape().dimensions[0];
+  const uint32_t n_output = recurrent_to_output_weights_->shape().dimensions[1];
+  const uint32_t n_elements = n_batch * n_cell;
+
+  // Gate outputs are int16, Q3.12 before and Q0.15 after the activation.
+  int16_t* input_gate_scratch = GetBuffer<int16_t>(scratch_buffer_);
+  int16_t* cell_scratch = input_gate_scratch + n_elements;
+  int16_t* forget_gate_scratch = input_gate_scratch + 2 * n_elements;
+  int16_t* output_gate_scratch = input_gate_scratch + 3 * n_elements;
+
+  int32_t gate_multiplier, gate_shift;
+  if (!QuantizeMultiplierForKernel(static_cast<double>(input_->scale) *
+                                   input_to_input_weights_->scale *
+                                   (1 << kQuant8GateFracBits),
+                                   &gate_multiplier, &gate_shift)) {
+    return false;
+  }
+  const int32_t weights_zero_bias = -input_to_input_weights_->zeroPoint;
+
+  struct {
+    const RunTimeOperandInfo *input_weights;
+    const RunTimeOperandInfo *recurrent_weights;
+    const RunTimeOperandInfo *bias;
+    int16_t *scratch;
+  } gates[] = {
+    {input_to_input_weights_, recurrent_to_input_weights_, input_gate_bias_, input_gate_scratch},
+    {input_to_forget_weights_, recurrent_to_forget_weights_, forget_gate_bias_, forget_gate_scratch},
+    {input_to_cell_weights_, recurrent_to_cell_weights_, cell_bias_, cell_scratch},
+    {input_to_output_weights_, recurrent_to_output_weights_, output_gate_bias_, output_gate_scratch},
+  };
+
+  int ret;
+  for (const auto &gate : gates) {
+    for (uint32_t b = 0; b < n_batch; b++) {
+      ret = xa_nn_matXvec_asym8xasym8_16(
+          gate.scratch + b * n_cell,
+          GetBuffer<uint8_t>(gate.input_weights), GetBuffer<uint8_t>(gate.recurrent_weights),
+          GetBuffer<uint8_t>(input_) + b * n_input,
+          GetBuffer<uint8_t>(output_state_in_) + b * n_output,
+          GetBuffer<int32_t>(gate.bias), n_cell, n_input, n_output, n_input, n_output,
+          weights_zero_bias, weights_zero_bias,
+          -kQuant8StateZeroPoint, -kQuant8StateZeroPoint,
+          gate_multiplier, gate_shift);
+      if(ret)
+        return false;
+    }
+  }
+
+  ret = xa_nn_vec_sigmoid_16_16(input_gate_scratch, input_gate_scratch, n_elements);
+  ret |= xa_nn_vec_sigmoid_16_16(forget_gate_scratch, forget_gate_scratch, n_elements);
+  ret |= xa_nn_vec_sigmoid_16_16(output_gate_scratch, output_gate_scratch, n_elements);
+  ret |= xa_nn_vec_tanh_16_16(cell_scratch, cell_scratch, n_elements);
+  if(ret)
+    return false;
+
+  // new_cell = forget * cell + input * tanh(cell_gate), in Q4.11. The cell
+  // scratch is reused for the Q3.12 input of the output tanh.
+  const int32_t* cell_state_in = GetBuffer<int32_t>(cell_state_in_);
+  int32_t* cell_state_out = GetBuffer<int32_t>(cell_state_out_);
+  int32_t cell_clip = 32767;
+  if (params_.cell_clip_ > 0.0) {
+    cell_clip = std::min(32767, static_cast<int32_t>(
+        std::round(params_.cell_clip_ / kQuant8CellStateScale)));
+  }
+  for (uint32_t i = 0; i < n_elements; i++) {
+    const int32_t cell = SaturateInt16(cell_state_in[i]);
+    int32_t new_cell = ((forget_gate_scratch[i] * cell + (1 << 14)) >> 15) +
+                       ((input_gate_scratch[i] * cell_scratch[i] + (1 << 18)) >> 19);
+    new_cell = std::min(cell_clip, std::max(-cell_clip, new_cell));
+    cell_state_out[i] = new_cell;
+    cell_scratch[i] = SaturateInt16(new_cell << 1);
+  }
+  ret = xa_nn_vec_tanh_16_16(cell_scratch, cell_scratch, n_elements);
+  if(ret)
+    return false;
+
+  // output = output_gate * tanh(new_cell), Q0.30 to asym8 with scale 1/128.
+  uint8_t* output = GetBuffer<uint8_t>(output_);
+  for (uint32_t i = 0; i < n_elements; i++) {
+    const int32_t out = ((output_gate_scratch[i] * cell_scratch[i] + (1 << 22)) >> 23) +
+                        kQuant8StateZeroPoint;
+    output[i] = static_cast<uint8_t>(std::min(255, std::max(0, out)));
+  }
+  memcpy(GetBuffer<uint8_t>(output_state_out_), output, n_batch * n_output);
+
+  return true;
+}
+
+bool LSTMCell::PrepareHybrid(const Operation &operation,
+                             std::vector<RunTimeOperandInfo> &operands,
+                             LSTMHybridWeights *hybrid, int32_t *scratch_size) {
+  static constexpr int kInputWeights[4] = {
+      kInputToInputWeightsTensor, kInputToForgetWeightsTensor,
+      kInputToCellWeightsTensor, kInputToOutputWeightsTensor};
+  static constexpr int kRecurrentWeights[4] = {
+      kRecurrentToInputWeightsTensor, kRecurrentToForgetWeightsTensor,
+      kRecurrentToCellWeightsTensor, kRecurrentToOutputWeightsTensor};
+
+  if (operation.inputs.size() != 23 ||
+      GetInput(operation, operands, kInputTensor)->type != OperandType::TENSOR_FLOAT32) {
+    return false;
+  }
+  const bool use_cifg =
+      GetInput(operation, operands, kInputToInputWeightsTensor)->lifetime ==
+      OperandLifeTime::NO_VALUE;
+
+  for (int gate = use_cifg ? 1 : 0; gate < 4; gate++) {
+    const RunTimeOperandInfo *weights[2] = {
+        GetInput(operation, operands, kInputWeights[gate]),
+        GetInput(operation, operands, kRecurrentWeights[gate])};
+    std::vector<int8_t> *quantized[2] = {
+        &hybrid->input_weights[gate], &hybrid->recurrent_weights[gate]};
+    std::vector<float> *scales[2] = {
+        &hybrid->input_scales[gate], &hybrid->recurrent_scales[gate]};
+    for (int i = 0; i < 2; i++) {
+      if (weights[i]->buffer == nullptr || weights[i]->dimensions.size() != 2 ||
+          weights[i]->type != OperandType::TENSOR_FLOAT32) {
+        return false;
+      }
+      const uint32_t rows = weights[i]->dimensions[0];
+      const uint32_t cols = weights[i]->dimensions[1];
+      const float *w = GetBuffer<float>(weights[i]);
+      quantized[i]->resize(rows * cols);
+      scales[i]->resize(rows);
+      for (uint32_t r = 0; r < rows; r++) {
+        if (xa_nn_quantize_f32_sym8(quantized[i]->data() + r * cols, scales[i]->data() + r,
+                                    w + r * cols, cols) != 0) {
+          return false;
+        }
+      }
+    }
+  }
+  // One batch of the input and of the output state, quantized
+  const uint32_t n_input =
+      GetInput(operation, operands, kInputToOutputWeightsTensor)->dimensions[1];
+  const uint32_t n_output =
+      GetInput(operation, operands, kRecurrentToOutputWeightsTensor)->dimensions[1];
+  *scratch_size = ((n_input + 3) & ~3) + n_output;
+  return true;
+}
+
+// Gate pre-activations from the int8 weights of hybrid_. Each input and
+// output state vector is quantized once and feeds all four gates.
+bool LSTMCell::EvalHybridGates(float *input_gate_scratch, float *forget_gate_scratch,
+                               float *cell_scratch, float *output_gate_scratch) {
+  const uint32_t n_batch = input_->shape().dimensions[0];
+  const uint32_t n_input = input_->shape().dimensions[1];
+  const uint32_t n_cell = input_to_output_weights_->shape().dimensions[0];
+  const uint32_t n_output = recurrent_to_output_weights_->shape().dimensions[1];
+  const bool use_cifg = (input_to_input_weights_->lifetime == OperandLifeTime::NO_VALUE);
+
+  const float *biases[4] = {
+      use_cifg ? nullptr : GetBuffer<float>(input_gate_bias_), GetBuffer<float>(forget_gate_bias_),
+      GetBuffer<float>(cell_bias_), GetBuffer<float>(output_gate_bias_)};
+  float *gates[4] = {input_gate_scratch, forget_gate_scratch, cell_scratch, output_gate_scratch};
+
+  // The recurrent vector starts 4 byte aligned, as the kernel needs
+  int8_t *input_q = hybrid_scratch_;
+  int8_t *output_state_q = input_q + ((n_input + 3) & ~3);
+  for (uint32_t b = 0; b < n_batch; b++) {
+    float input_scale, output_state_scale;
+    if (xa_nn_quantize_f32_sym8(input_q, &input_scale,
+                                GetBuffer<float>(input_) + b * n_input, n_input) != 0 ||
+        xa_nn_quantize_f32_sym8(output_state_q, &output_state_scale,
+                                GetBuffer<float>(output_state_in_) + b * n_output,
+                                n_output) != 0) {
+      return false;
+    }
+    for (int gate = use_cifg ? 1 : 0; gate < 4; gate++) {
+      int ret = xa_nn_matXvec_sym8xsym8_f32(
+          gates[gate] + b * n_cell,
+          hybrid_->input_weights[gate].data(), hybrid_->recurrent_weights[gate].data(),
+          input_q, output_state_q, biases[gate],
+          hybrid_->input_scales[gate].data(), hybrid_->recurrent_scales[gate].data(),
+          input_scale, output_state_scale,
+          n_cell, n_input, n_output, n_input, n_output);
+      if (ret)
+        return false;
+    }
+  }
+  return true;
+}
+#endif
+
 }  // namespace nn
 }  // namespace android
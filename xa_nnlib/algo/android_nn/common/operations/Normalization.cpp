@@ -59,18 +59,15 @@ bool l2normFloat32(const float* inputData, const Shape& inputShape,
             inputData, convertShapeToDims(inputShape),
             outputData, convertShapeToDims(outputShape));
 #else
-    int i, ret;
+    int ret;
     int32_t batches, height, width, depth;
     batches = (int32_t)getSizeOfDimension(inputShape, 0);
     height  = (int32_t)getSizeOfDimension(inputShape, 1);
     width   = (int32_t)getSizeOfDimension(inputShape, 2);
     depth   = (int32_t)getSizeOfDimension(inputShape, 3);
-    for(i = 0; i < batches*height*width; i++)
-    {
-        ret = xa_nn_l2_norm_f32(outputData + i*depth, inputData + i*depth, depth);
-        if(ret)
-            return false;
-    }
+    ret = xa_nn_l2_norm_rows_f32(outputData, inputData, batches*height*width, depth);
+    if(ret)
+        return false;
 #endif
 
     return true;
@@ -78,17 +75,23 @@ bool l2normFloat32(const float* inputData, const Shape& inputShape,
 
 bool l2normQuant8(const uint8_t* inputData, const Shape& inputShape,
                   uint8_t* outputData, const Shape& outputShape) {
-#ifndef HIFI_BUILD
+#ifndef HIFI_NNLIB_OPT
     tflite::reference_ops::L2Normalization(
             inputData, convertShapeToDims(inputShape),
             inputShape.offset,
             outputData, convertShapeToDims(outputShape));
 #else
-    tflite::reference_ops::L2Normalization(
-            inputData, convertShapeToDims(inputShape),
-            inputShape.offset,
-            outputData, convertShapeToDims(outputShape));
-#endif //HiFi_BUILD
+    int ret;
+    int32_t batches, height, width, depth;
+    batches = (int32_t)getSizeOfDimension(inputShape, 0);
+    height  = (int32_t)getSizeOfDimension(inputShape, 1);
+    width   = (int32_t)getSizeOfDimension(inputShape, 2);
+    depth   = (int32_t)getSizeOfDimension(inputShape, 3);
+    ret = xa_nn_l2_norm_rows_asym8(outputData, inputData, -inputShape.offset,
+                                   batches*height*width, depth);
+    if(ret)
+        return false;
+#endif
 
     return true;
 }
@@ -91,42 +91,28 @@ bool averagePoolFloat32(const float* inputData, const Shape& inputShape,
 //    uint32_t out_channels = getSizeOfDimension(outputShape, 3);                 
     ANDROID_NN_POOLING_PARAMETERS_HIFI_BUILD
     int input_channels = getSizeOfDimension(inputShape, 3);
-    int err_f, itr;
+    int err_f;
     int batch_size = (int)getSizeOfDimension(outputShape, 0);
-    const float *ptr_tmp_in;
-    float *ptr_tmp_out;
-
-
-    for(itr=0; itr<batch_size; itr++)
-    {
-       ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
-       ptr_tmp_in  = &inputData[height*width*input_channels*itr];
-
-        err_f =  xa_nn_avgpool_f32(ptr_tmp_out,
-                ptr_tmp_in,
-                height,
-                width,
-                input_channels,
-                filter_height,
-                filter_width,
-                stride_width,
-                stride_height,
-                padding_left,
-                padding_top,
-                outHeight,
-                outWidth,
-                0,
-                0,
-                p_scratch);
-    }
-
-    int total_elements = outHeight * outWidth * input_channels * batch_size;
-    err_f = xa_nn_vec_activation_min_max_f32_f32(outputData,
-                                         (const float *)outputData,
-                                         output_activation_min,
-                                         output_activation_max,
-                                         total_elements
-                                        );
+
+    err_f = xa_nn_avgpool_batch_f32(outputData,
+            inputData,
+            batch_size,
+            height,
+            width,
+            input_channels,
+            filter_height,
+            filter_width,
+            stride_width,
+            stride_height,
+            padding_left,
+            padding_top,
+            outHeight,
+            outWidth,
+            output_activation_min,
+            output_activation_max,
+            0,
+            0,
+            p_scratch);
 #endif
 
     return true;
@@ -162,42 +148,28 @@ bool averagePoolQuant8(const uint8_t* inputData, const Shape& inputShape,
 #else
     ANDROID_NN_POOLING_PARAMETERS_HIFI_BUILD
     int input_channels = getSizeOfDimension(inputShape, 3);
-    int err_f, itr;
+    int err_f;
     int batch_size = (int)getSizeOfDimension(outputShape, 0);
-    uint8_t *ptr_tmp_out;
-    const uint8_t *ptr_tmp_in;  
-
-
-    for(itr=0; itr<batch_size; itr++)
-    {
-       ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
-       ptr_tmp_in  = &inputData[height*width*input_channels*itr];
-
-        err_f =  xa_nn_avgpool_asym8(ptr_tmp_out,
-                ptr_tmp_in,
-                height,
-                width,
-                input_channels,
-                filter_height,
-                filter_width,
-                stride_width,
-                stride_height,
-                padding_left,
-                padding_top,
-                outHeight,
-                outWidth,
-                0,
-                0,
-                p_scratch);
-    }
-    
-    int total_elements = outHeight * outWidth * input_channels * batch_size;
-    err_f = xa_nn_vec_activation_min_max_asym8_asym8(outputData,
-                                           (const uint8_t *)outputData,
-                                           output_activation_min,
-                                           output_activation_max,
-                                           total_elements
-                                          );
+
+    err_f = xa_nn_avgpool_batch_asym8(outputData,
+            inputData,
+            batch_size,
+            height,
+            width,
+            input_channels,
+            filter_height,
+            filter_width,
+            stride_width,
+            stride_height,
+            padding_left,
+            padding_top,
+            outHeight,
+            outWidth,
+            output_activation_min,
+            output_activation_max,
+            0,
+            0,
+            p_scratch);
 #endif
 
     return true;
@@ -261,41 +233,28 @@ bool maxPoolFloat32(const float* inputData, const Shape& inputShape,
 #else
     ANDROID_NN_POOLING_PARAMETERS_HIFI_BUILD
     int input_channels = getSizeOfDimension(inputShape, 3);
-    int err_f, itr;
+    int err_f;
     int batch_size = (int)getSizeOfDimension(outputShape, 0);
-    const float *ptr_tmp_in;
-    float *ptr_tmp_out;
-
-    for(itr=0; itr<batch_size; itr++)
-    {
-       ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
-       ptr_tmp_in  = &inputData[height*width*input_channels*itr];
-
-        err_f =  xa_nn_maxpool_f32(ptr_tmp_out,
-                ptr_tmp_in,
-                height,
-                width,
-                input_channels,
-                filter_height,
-                filter_width,
-                stride_width,
-                stride_height,
-                padding_left,
-                padding_top,
-                outHeight,
-                outWidth,
-                0,
-                0,
-                p_scratch);
-    }
-    
-    int total_elements = outHeight * outWidth * input_channels * batch_size;
-    err_f = xa_nn_vec_activation_min_max_f32_f32(outputData,
-                                         (const float *)outputData,
-                                         output_activation_min,
-                                         output_activation_max,
-                                         total_elements
-                                        );
+
+    err_f = xa_nn_maxpool_batch_f32(outputData,
+            inputData,
+            batch_size,
+            height,
+            width,
+            input_channels,
+            filter_height,
+            filter_width,
+            stride_width,
+            stride_height,
+            padding_left,
+            padding_top,
+            outHeight,
+            outWidth,
+            output_activation_min,
+            output_activation_max,
+            0,
+            0,
+            p_scratch);
 #endif
 
     return true;
@@ -331,41 +290,28 @@ bool maxPoolQuant8(const uint8_t* inputData, const Shape& inputShape,
 #else
     ANDROID_NN_POOLING_PARAMETERS_HIFI_BUILD
     int input_channels = getSizeOfDimension(inputShape, 3);
-    int err_f, itr;
+    int err_f;
     int batch_size = (int)getSizeOfDimension(outputShape, 0);
-    uint8_t *ptr_tmp_out;
-    const uint8_t *ptr_tmp_in;  
-
-    for(itr=0; itr<batch_size; itr++)
-    {
-       ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
-       ptr_tmp_in  = &inputData[height*width*input_channels*itr];
-
-        err_f =  xa_nn_maxpool_asym8(ptr_tmp_out,
-                ptr_tmp_in,
-                height,
-                width,
-                input_channels,
-                filter_height,
-                filter_width,
-                stride_width,
-                stride_height,
-                padding_left,
-                padding_top,
-                outHeight,
-                outWidth,
-                0,
-                0,
-                p_scratch);
-    }
-
-    int total_elements = outHeight * outWidth * input_channels * batch_size;
-    err_f = xa_nn_vec_activation_min_max_asym8_asym8(outputData,
-                                           (const uint8_t *)outputData,
-                                           output_activation_min,
-                                           output_activation_max,
-                                           total_elements
-                                          );
+
+    err_f = xa_nn_maxpool_batch_asym8(outputData,
+            inputData,
+            batch_size,
+            height,
+            width,
+            input_channels,
+            filter_height,
+            filter_width,
+            stride_width,
+            stride_height,
+            padding_left,
+            padding_top,
+            outHeight,
+            outWidth,
+            output_activation_min,
+            output_activation_max,
+            0,
+            0,
+            p_scratch);
 #endif
 
     return true;
@@ -96,6 +96,38 @@ bool RNN::Prepare(const Operation &operation,
 
   const Shape &inputShape = input->shape();
 
+#ifdef HIFI_NNLIB_OPT
+  if (inputShape.type == OperandType::TENSOR_QUANT8_ASYMM) {
+    const RunTimeOperandInfo *hidden_state_in =
+        GetInput(operation, operands, kHiddenStateInTensor);
+    const RunTimeOperandInfo *output = GetOutput(operation, operands, kOutputTensor);
+    const int32_t activation =
+        getScalarData<int32_t>(operands[operation.inputs[kActivationParam]]);
+
+    // Both products are requantized with one multiplier, so they and the
+    // bias must share a scale.
+    const float input_product_scale = input->scale * input_weights->scale;
+    const float recurrent_product_scale =
+        hidden_state_in->scale * recurrent_weights->scale;
+    NN_CHECK(std::abs(input_product_scale - bias->scale) <=
+             1e-6 * std::min(input_product_scale, bias->scale));
+    NN_CHECK(std::abs(input_product_scale - recurrent_product_scale) <=
+             1e-6 * std::min(input_product_scale, recurrent_product_scale));
+    NN_CHECK(activation != kActivationSignBit);
+#ifndef HIFI_WARNINGS
+    (void)activation;
+    (void)input_product_scale;
+    (void)recurrent_product_scale;
+#endif
+
+    // The hidden state is a copy of the output.
+    outputShape->scale = output->scale;
+    outputShape->offset = output->zeroPoint;
+    hiddenStateShape->scale = output->scale;
+    hiddenStateShape->offset = output->zeroPoint;
+  }
+#endif
+
   // Resize state.
   hiddenStateShape->type = inputShape.type;
 #ifndef HIFI_BUILD
@@ -124,6 +156,11 @@ bool RNN::Prepare(const Operation &operation,
 }
 
 bool RNN::Eval() {
+#ifdef HIFI_NNLIB_OPT
+  if (input_->type == OperandType::TENSOR_QUANT8_ASYMM) {
+    return EvalQuant8();
+  }
+#endif
   const float* bias_ptr = reinterpret_cast<float*>(bias_->buffer);
 
   const uint32_t batch_size = input_->shape().dimensions[0];
@@ -219,5 +256,97 @@ bool RNN::Eval() {
   return true;
 }
 
+#ifdef HIFI_NNLIB_OPT
+// Fixed point format of the pre-activation fed to the int16 sigmoid/tanh.
+static constexpr int kQuant8GateFracBits = 12;  // Q3.12
+
+bool RNN::EvalQuant8() {
+  const int32_t* bias_ptr = reinterpret_cast<int32_t*>(bias_->buffer);
+
+  const uint32_t batch_size = input_->shape().dimensions[0];
+  const uint32_t num_units = weights_->shape().dimensions[0];
+  const uint32_t input_size = input_->shape().dimensions[1];
+
+  const bool int16_activation =
+      activation_ == kActivationTanh || activation_ == kActivationSigmoid;
+  const double product_scale = static_cast<double>(input_->scale) * weights_->scale;
+  int32_t out_multiplier, out_shift;
+  int32_t act_multiplier = 0, act_shift = 0;
+  int32_t output_activation_min = 0, output_activation_max = 255;
+  if (int16_activation) {
+    // Accumulators go to Q3.12 for the activation, whose Q0.15 result is
+    // requantized to the output.
+    if (!QuantizeMultiplierForKernel(product_scale * (1 << kQuant8GateFracBits),
+                                     &out_multiplier, &out_shift) ||
+        !QuantizeMultiplierForKernel(1.0 / (32768.0 * output_->scale),
+                                     &act_multiplier, &act_shift)) {
+      return false;
+    }
+  } else {
+    if (!QuantizeMultiplierForKernel(product_scale / output_->scale,
+                                     &out_multiplier, &out_shift)) {
+      return false;
+    }
+    CalculateActivationRangeUint8(activation_, output_->shape(),
+                                  &output_activation_min, &output_activation_max);
+  }
+  std::vector<int16_t> gate(int16_activation ? num_units : 0);
+
+  const uint8_t* input_weights_ptr = reinterpret_cast<uint8_t*>(weights_->buffer);
+  const uint8_t* recurrent_weights_ptr =
+      reinterpret_cast<uint8_t*>(recurrent_weights_->buffer);
+
+  // For each batch
+  for (uint32_t b = 0; b < batch_size; b++) {
+    const uint8_t* input_ptr_batch =
+        reinterpret_cast<uint8_t*>(input_->buffer) + b * input_size;
+    const uint8_t* hidden_state_in_ptr_batch =
+        reinterpret_cast<uint8_t*>(hidden_state_in_->buffer) + b * num_units;
+    uint8_t* output_ptr_batch =
+        reinterpret_cast<uint8_t*>(output_->buffer) + b * num_units;
+    uint8_t* hidden_state_out_ptr_batch =
+        reinterpret_cast<uint8_t*>(hidden_state_out_->buffer) + b * num_units;
+
+    int32_t ret;
+    if (int16_activation) {
+      ret = xa_nn_matXvec_asym8xasym8_16(gate.data(),
+          input_weights_ptr, recurrent_weights_ptr,
+          input_ptr_batch, hidden_state_in_ptr_batch, bias_ptr,
+          num_units, input_size, num_units, input_size, num_units,
+          -weights_->zeroPoint, -recurrent_weights_->zeroPoint,
+          -input_->zeroPoint, -hidden_state_in_->zeroPoint,
+          out_multiplier, out_shift);
+      if(ret != 0)
+        return false;
+      if (activation_ == kActivationTanh) {
+        ret = xa_nn_vec_tanh_16_16(gate.data(), gate.data(), num_units);
+      } else {
+        ret = xa_nn_vec_sigmoid_16_16(gate.data(), gate.data(), num_units);
+      }
+      if(ret != 0)
+        return false;
+      ret = xa_nn_requantize_16_asym8(output_ptr_batch, output_->zeroPoint,
+          act_shift, act_multiplier, gate.data(), num_units);
+    } else {
+      ret = xa_nn_matXvec_asym8xasym8_asym8(output_ptr_batch,
+          input_weights_ptr, recurrent_weights_ptr,
+          input_ptr_batch, hidden_state_in_ptr_batch, bias_ptr,
+          num_units, input_size, num_units, input_size, num_units,
+          -weights_->zeroPoint, -recurrent_weights_->zeroPoint,
+          -input_->zeroPoint, -hidden_state_in_->zeroPoint,
+          out_multiplier, out_shift, output_->zeroPoint);
+      if(ret == 0 && activation_ != kActivationNone)
+        ret = xa_nn_vec_activation_min_max_asym8_asym8(output_ptr_batch, output_ptr_batch,
+            output_activation_min, output_activation_max, num_units);
+    }
+    if(ret != 0)
+      return false;
+    memcpy(hidden_state_out_ptr_batch, output_ptr_batch, num_units*sizeof(uint8_t));
+  }
+
+  return true;
+}
+#endif
+
 }  // namespace nn
 }  // namespace android
@@ -370,10 +370,17 @@ bool dequantizeQuant8ToFloat32(const uint8_t* inputData,
     tflite::reference_ops::Dequantize(inputData, dim,
                                       shape.offset, shape.scale,
                                       outputData, dim);
-#else
+#elif !XCHAL_HAVE_HIFI4_VFPU || !defined HIFI_NNLIB_OPT
     tflite::reference_ops::Dequantize(inputData, dim,
                                       shape.offset, shape.scale,
                                       outputData, dim);
+#else
+    int ret;
+    ret = xa_nn_dequantize_asym8_f32(outputData, inputData,
+                                     -shape.offset, shape.scale,
+                                     getNumberOfElements(shape));
+    if(ret)
+        return false;
 #endif //HiFi_BUILD
     return true;
 }
@@ -466,9 +473,70 @@ bool divFloat32(const float* in1, const Shape& shape1,
     return true;
 }
 
+#ifdef HIFI_NNLIB_OPT
+// Returns true if the reduction axes are exactly height and width of a 4-D
+// NHWC tensor, i.e. MEAN is a global average pool.
+static bool isMeanOverHeightWidth(const Shape& inputShape,
+                                  const int32_t* axis, const Shape& axisShape) {
+    if (getNumberOfDimensions(inputShape) != 4) {
+        return false;
+    }
+    bool hasHeight = false, hasWidth = false;
+    int32_t axisSize = static_cast<int32_t>(getSizeOfDimension(axisShape, 0));
+    for (int32_t i = 0; i < axisSize; i++) {
+        int32_t current = axis[i] < 0 ? axis[i] + 4 : axis[i];
+        if (current == 1) {
+            hasHeight = true;
+        } else if (current == 2) {
+            hasWidth = true;
+        } else {
+            return false;
+        }
+    }
+    return hasHeight && hasWidth;
+}
+#endif
+
 bool meanGeneric(const uint8_t* inputData, const Shape& inputShape,
                  const int32_t* axis, const Shape& axisShape, bool keepDims,
                  uint8_t* outputData, const Shape& outputShape) {
+#ifdef HIFI_NNLIB_OPT
+    if (isMeanOverHeightWidth(inputShape, axis, axisShape)) {
+        int32_t batches  = getSizeOfDimension(inputShape, 0);
+        int32_t height   = getSizeOfDimension(inputShape, 1);
+        int32_t width    = getSizeOfDimension(inputShape, 2);
+        int32_t channels = getSizeOfDimension(inputShape, 3);
+        int32_t ret;
+
+        if (inputShape.type == OperandType::TENSOR_FLOAT32) {
+            ret = xa_nn_global_avgpool_f32(reinterpret_cast<float*>(outputData),
+                                           reinterpret_cast<const float*>(inputData),
+                                           batches, height, width, channels);
+            return (ret == 0);
+        } else if (inputShape.type == OperandType::TENSOR_QUANT8_ASYMM) {
+            double real_multiplier = static_cast<double>(inputShape.scale) /
+                    (static_cast<double>(outputShape.scale) * height * width);
+            int32_t output_multiplier = 0;
+            int32_t output_shift = 0;
+
+            // A single pixel plane with equal scales is a plain copy; leave
+            // it (and any upscaling) to the reference path below.
+            if (real_multiplier < 1.0 &&
+                QuantizeMultiplierSmallerThanOne(real_multiplier,
+                                                 &output_multiplier,
+                                                 &output_shift)) {
+                ret = xa_nn_global_avgpool_asym8(outputData,
+                                                 inputData,
+                                                 batches, height, width, channels,
+                                                 -inputShape.offset,
+                                                 output_multiplier,
+                                                 -output_shift,
+                                                 outputShape.offset);
+                return (ret == 0);
+            }
+        }
+    }
+#endif
     // Creates a temp index to iterate through input data.
     int32_t* scratchBuffer = new int32_t[getNumberOfDimensions(inputShape)];
 
@@ -622,6 +622,47 @@
   /* Add output zero point */ \
   (_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec) = AE_ADD32S(_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec, AE_MOVDA32(out_zero_bias)); \
 
+/*---------------------------------------------------------*/
+/* matmul: vector n starts at p_vec1 + n * vec_offset, the result of row m
+   for vector n goes to p_out[n * out_offset + m * out_stride] */
+#define SETUP_VEC_OFFSET_BATCH_8b(idx_vec) \
+  ae_int16x4 _ae_int16x4_vec_batch_ ##idx_vec  = ZERO16X4; \
+  WORD8 *_WORD8_p_vec_batch_ ##idx_vec  = (WORD8 *)(&p_vec1[(vec_itr + idx_vec) * vec_offset]); \
+
+#define SETUP_VEC_OFFSET_BATCH_16b(idx_vec) \
+  ae_int16x4 _ae_int16x4_vec_batch_ ##idx_vec  = ZERO16X4; \
+  ae_int16x4 *_ae_int16x4_p_vec_batch_ ##idx_vec  = (ae_int16x4 *)(&p_vec1[(vec_itr + idx_vec) * vec_offset]); \
+
+#define SETUP_VEC_OFFSET_BATCH_f32(idx_vec) \
+  xtfloatx2 _xtfloatx2_vec_batch_ ##idx_vec  = (xtfloatx2)0.0f ; \
+  xtfloatx2 *_xtfloatx2_p_vec_batch_ ##idx_vec  = (xtfloatx2 *)(&p_vec1[(vec_itr + idx_vec) * vec_offset]); \
+
+#define SETUP_VEC_OFFSET_BATCH_ASYM8b SETUP_VEC_OFFSET_BATCH_8b
+
+#define MATMUL_OUT(idx_row,idx_vec) \
+  p_out[(vec_itr + idx_vec) * out_offset + (m_itr + idx_row) * out_stride]
+
+#define STORE_ACC_MATMUL_8bx8b_AT_OUT_8b(idx_row,idx_vec) \
+  ae_int32x2 _ae_int32x2_out_ ##idx_row ##_ ##idx_vec = \
+  AE_SLAA32S(AE_ROUND32F64SSYM(AE_SLAA64S(_ae_int64_acc_ ##idx_row ##_ ##idx_vec, acc_shift)), 24); \
+  _ae_int32x2_out_ ##idx_row ##_ ##idx_vec = AE_SLAA32S(_ae_int32x2_out_ ##idx_row ##_ ##idx_vec, -24); \
+  MATMUL_OUT(idx_row,idx_vec) = (WORD8)AE_MOVAD32_L(_ae_int32x2_out_ ##idx_row ##_ ##idx_vec); \
+
+#define STORE_ACC_MATMUL_16bx16b_AT_OUT_16b(idx_row,idx_vec) \
+  ae_int32x2 _ae_int32x2_out_ ##idx_row ##_ ##idx_vec = \
+  AE_SLAA32S(AE_ROUND32F64SSYM(AE_SLAA64S(_ae_int64_acc_ ##idx_row ##_ ##idx_vec, acc_shift)), 16); \
+  _ae_int32x2_out_ ##idx_row ##_ ##idx_vec = AE_SLAA32S(_ae_int32x2_out_ ##idx_row ##_ ##idx_vec, -16); \
+  MATMUL_OUT(idx_row,idx_vec) = (WORD16)AE_MOVAD32_L(_ae_int32x2_out_ ##idx_row ##_ ##idx_vec); \
+
+#define STORE_ACC_MATMUL_ASYM8bxASYM8b_AT_OUT_ASYM8b(idx_row,idx_vec) \
+  _ae_int32x2_acc_ ##idx_row ##_ ##idx_vec = AE_MIN32(AE_MAX32(_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec, AE_MOVDA32(out_activation_min)), AE_MOVDA32(out_activation_max)); \
+  MATMUL_OUT(idx_row,idx_vec) = (UWORD8)AE_MOVAD32_L(_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec); \
+
+#define STORE_ACC_MATMUL_AT_OUT_f32(idx_row,idx_vec) \
+  /*p_out value stored in a tmp pointer to make it inout for ISA */\
+  p_out_tmp = (xtfloat *)&MATMUL_OUT(idx_row,idx_vec); \
+  XT_SSIP(_xtfloat_acc_ ##idx_row ##_ ##idx_vec, p_out_tmp, 0); \
+
 /*---------------------------------------------------------*/
 /* ==================================================================================================== */
 #if (ROW_UNROLL == 1)
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_WORKERS_H__
+#define __XA_NNLIB_WORKERS_H__
+
+/* Reference work splitting for the layer APIs.
+
+   xa_nnlib_run_workers() splits [0, total) into at most num_workers
+   contiguous slices, each a whole number of 'granule' units except for the
+   last, and calls fn(p_ctx, worker, start, count) once per non-empty slice.
+   Built with NNLIB_PTHREADS (make PTHREADS=1) slices 1..n-1 run on their
+   own pthread while slice 0 runs on the calling thread; otherwise, or if a
+   thread cannot be created, the slices run one after the other. Returns 0
+   or the first non-zero value returned by fn. */
+
+#define XA_NNLIB_MAX_WORKERS 8
+
+typedef int (*xa_nnlib_worker_fn_t)(void *p_ctx, int worker, int start, int count);
+
+int xa_nnlib_run_workers(xa_nnlib_worker_fn_t fn,
+                         void *p_ctx,
+                         int num_workers,
+                         int total,
+                         int granule);
+
+#endif /* __XA_NNLIB_WORKERS_H__ */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stddef.h>
+#include "xa_nnlib_workers.h"
+
+#ifdef NNLIB_PTHREADS
+#include <pthread.h>
+#endif
+
+typedef struct _worker_slice_t
+{
+  xa_nnlib_worker_fn_t fn;
+  void *p_ctx;
+  int worker;
+  int start;
+  int count;
+  int err;
+} worker_slice_t;
+
+#ifdef NNLIB_PTHREADS
+static void *worker_thread(void *arg)
+{
+  worker_slice_t *slice = (worker_slice_t *)arg;
+  slice->err = slice->fn(slice->p_ctx, slice->worker, slice->start, slice->count);
+  return NULL;
+}
+#endif
+
+int xa_nnlib_run_workers(xa_nnlib_worker_fn_t fn,
+                         void *p_ctx,
+                         int num_workers,
+                         int total,
+                         int granule)
+{
+  worker_slice_t slices[XA_NNLIB_MAX_WORKERS];
+#ifdef NNLIB_PTHREADS
+  pthread_t threads[XA_NNLIB_MAX_WORKERS];
+  int started[XA_NNLIB_MAX_WORKERS];
+#endif
+  int n_granules, n_slices, end, itr, err = 0;
+
+  if(fn == NULL || total <= 0 || granule <= 0)
+    return -1;
+
+  if(num_workers < 1)
+    num_workers = 1;
+  if(num_workers > XA_NNLIB_MAX_WORKERS)
+    num_workers = XA_NNLIB_MAX_WORKERS;
+
+  /* Granules are spread evenly, slice sizes differ by at most one granule */
+  n_granules = (total + granule - 1) / granule;
+  n_slices = (n_granules < num_workers) ? n_granules : num_workers;
+
+  for(itr = 0; itr < n_slices; itr++)
+  {
+    end = ((itr + 1) * n_granules / n_slices) * granule;
+    slices[itr].fn = fn;
+    slices[itr].p_ctx = p_ctx;
+    slices[itr].worker = itr;
+    slices[itr].start = (itr * n_granules / n_slices) * granule;
+    slices[itr].count = ((end < total) ? end : total) - slices[itr].start;
+    slices[itr].err = 0;
+  }
+
+#ifdef NNLIB_PTHREADS
+  for(itr = 1; itr < n_slices; itr++)
+    started[itr] = (pthread_create(&threads[itr], NULL, worker_thread, &slices[itr]) == 0);
+
+  slices[0].err = fn(p_ctx, 0, slices[0].start, slices[0].count);
+
+  for(itr = 1; itr < n_slices; itr++)
+  {
+    if(started[itr])
+      pthread_join(threads[itr], NULL);
+    else
+      worker_thread(&slices[itr]);
+  }
+#else
+  for(itr = 0; itr < n_slices; itr++)
+    slices[itr].err = fn(p_ctx, itr, slices[itr].start, slices[itr].count);
+#endif
+
+  for(itr = 0; itr < n_slices && !err; itr++)
+    err = slices[itr].err;
+
+  return err;
+}
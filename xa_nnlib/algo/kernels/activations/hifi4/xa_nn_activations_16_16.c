@@ -0,0 +1,206 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Interpolated look-up tables for 16-bit sigmoid and tanh.
+   513 entries sample the function over [-8, 8] in steps of 1/32, in Q0.15.
+   The upper 9 bits of the biased Q3.12 input select the table segment and
+   the lower 7 bits interpolate linearly within it. */
+static const WORD16 sigmoid_q15_tbl[513] =
+{
+        11,     11,     12,     12,     12,     13,     13,     14,     14,     15,     15,     15,
+        16,     16,     17,     18,     18,     19,     19,     20,     21,     21,     22,     23,
+        23,     24,     25,     26,     26,     27,     28,     29,     30,     31,     32,     33,
+        34,     35,     36,     37,     38,     40,     41,     42,     43,     45,     46,     48,
+        49,     51,     52,     54,     56,     57,     59,     61,     63,     65,     67,     69,
+        72,     74,     76,     79,     81,     84,     86,     89,     92,     95,     98,    101,
+       104,    107,    111,    114,    118,    121,    125,    129,    133,    138,    142,    146,
+       151,    156,    161,    166,    171,    176,    182,    188,    194,    200,    206,    213,
+       219,    226,    233,    241,    248,    256,    264,    272,    281,    290,    299,    308,
+       318,    328,    338,    349,    360,    371,    383,    395,    407,    420,    433,    447,
+       461,    475,    490,    505,    521,    537,    554,    572,    589,    608,    627,    646,
+       666,    687,    708,    730,    753,    776,    800,    825,    851,    877,    904,    932,
+       961,    990,   1021,   1052,   1084,   1117,   1152,   1187,   1223,   1260,   1299,   1338,
+      1379,   1421,   1464,   1508,   1554,   1601,   1649,   1699,   1750,   1802,   1856,   1912,
+      1969,   2028,   2088,   2150,   2213,   2279,   2346,   2415,   2486,   2558,   2633,   2710,
+      2789,   2869,   2952,   3037,   3124,   3214,   3306,   3400,   3496,   3595,   3696,   3800,
+      3906,   4015,   4126,   4240,   4357,   4476,   4599,   4723,   4851,   4982,   5115,   5252,
+      5391,   5533,   5678,   5827,   5978,   6132,   6289,   6450,   6613,   6780,   6949,   7122,
+      7297,   7476,   7658,   7843,   8031,   8222,   8416,   8613,   8813,   9015,   9221,   9430,
+      9641,   9855,  10072,  10291,  10513,  10737,  10964,  11193,  11424,  11658,  11894,  12132,
+     12371,  12613,  12856,  13101,  13348,  13595,  13845,  14095,  14347,  14599,  14852,  15107,
+     15361,  15617,  15872,  16128,  16384,  16640,  16896,  17151,  17407,  17661,  17916,  18169,
+     18421,  18673,  18923,  19173,  19420,  19667,  19912,  20155,  20397,  20636,  20874,  21110,
+     21344,  21575,  21804,  22031,  22255,  22477,  22696,  22913,  23127,  23338,  23547,  23753,
+     23955,  24155,  24352,  24546,  24737,  24925,  25110,  25292,  25471,  25646,  25819,  25988,
+     26155,  26318,  26479,  26636,  26790,  26941,  27090,  27235,  27377,  27516,  27653,  27786,
+     27917,  28045,  28169,  28292,  28411,  28528,  28642,  28753,  28862,  28968,  29072,  29173,
+     29272,  29368,  29462,  29554,  29644,  29731,  29816,  29899,  29979,  30058,  30135,  30210,
+     30282,  30353,  30422,  30489,  30555,  30618,  30680,  30740,  30799,  30856,  30912,  30966,
+     31018,  31069,  31119,  31167,  31214,  31260,  31304,  31347,  31389,  31430,  31469,  31508,
+     31545,  31581,  31616,  31651,  31684,  31716,  31747,  31778,  31807,  31836,  31864,  31891,
+     31917,  31943,  31968,  31992,  32015,  32038,  32060,  32081,  32102,  32122,  32141,  32160,
+     32179,  32196,  32214,  32231,  32247,  32263,  32278,  32293,  32307,  32321,  32335,  32348,
+     32361,  32373,  32385,  32397,  32408,  32419,  32430,  32440,  32450,  32460,  32469,  32478,
+     32487,  32496,  32504,  32512,  32520,  32527,  32535,  32542,  32549,  32555,  32562,  32568,
+     32574,  32580,  32586,  32592,  32597,  32602,  32607,  32612,  32617,  32622,  32626,  32630,
+     32635,  32639,  32643,  32647,  32650,  32654,  32657,  32661,  32664,  32667,  32670,  32673,
+     32676,  32679,  32682,  32684,  32687,  32689,  32692,  32694,  32696,  32699,  32701,  32703,
+     32705,  32707,  32709,  32711,  32712,  32714,  32716,  32717,  32719,  32720,  32722,  32723,
+     32725,  32726,  32727,  32728,  32730,  32731,  32732,  32733,  32734,  32735,  32736,  32737,
+     32738,  32739,  32740,  32741,  32742,  32742,  32743,  32744,  32745,  32745,  32746,  32747,
+     32747,  32748,  32749,  32749,  32750,  32750,  32751,  32752,  32752,  32753,  32753,  32753,
+     32754,  32754,  32755,  32755,  32756,  32756,  32756,  32757,  32757
+};
+
+static const WORD16 tanh_q15_tbl[513] =
+{
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32765, -32765,
+    -32765, -32765, -32765, -32764, -32764, -32764, -32764, -32763, -32763, -32763, -32762, -32762,
+    -32762, -32761, -32761, -32760, -32760, -32759, -32759, -32758, -32758, -32757, -32756, -32755,
+    -32755, -32754, -32753, -32752, -32751, -32750, -32749, -32747, -32746, -32745, -32743, -32741,
+    -32740, -32738, -32736, -32734, -32732, -32729, -32727, -32724, -32721, -32718, -32715, -32712,
+    -32708, -32704, -32700, -32696, -32691, -32686, -32681, -32676, -32670, -32663, -32657, -32649,
+    -32642, -32634, -32625, -32616, -32606, -32596, -32584, -32573, -32560, -32547, -32532, -32517,
+    -32501, -32484, -32466, -32447, -32426, -32404, -32381, -32356, -32329, -32301, -32271, -32240,
+    -32206, -32170, -32132, -32091, -32048, -32002, -31953, -31901, -31846, -31788, -31726, -31659,
+    -31589, -31515, -31435, -31351, -31262, -31167, -31067, -30960, -30847, -30727, -30600, -30465,
+    -30322, -30170, -30010, -29840, -29660, -29470, -29268, -29055, -28830, -28592, -28341, -28076,
+    -27797, -27502, -27191, -26864, -26519, -26157, -25776, -25376, -24956, -24516, -24054, -23571,
+    -23066, -22538, -21986, -21411, -20813, -20189, -19542, -18870, -18173, -17452, -16706, -15936,
+    -15143, -14326, -13486, -12625, -11743, -10840,  -9919,  -8980,  -8025,  -7056,  -6073,  -5079,
+     -4075,  -3063,  -2045,  -1024,      0,   1024,   2045,   3063,   4075,   5079,   6073,   7056,
+      8025,   8980,   9919,  10840,  11743,  12625,  13486,  14326,  15143,  15936,  16706,  17452,
+     18173,  18870,  19542,  20189,  20813,  21411,  21986,  22538,  23066,  23571,  24054,  24516,
+     24956,  25376,  25776,  26157,  26519,  26864,  27191,  27502,  27797,  28076,  28341,  28592,
+     28830,  29055,  29268,  29470,  29660,  29840,  30010,  30170,  30322,  30465,  30600,  30727,
+     30847,  30960,  31067,  31167,  31262,  31351,  31435,  31515,  31589,  31659,  31726,  31788,
+     31846,  31901,  31953,  32002,  32048,  32091,  32132,  32170,  32206,  32240,  32271,  32301,
+     32329,  32356,  32381,  32404,  32426,  32447,  32466,  32484,  32501,  32517,  32532,  32547,
+     32560,  32573,  32584,  32596,  32606,  32616,  32625,  32634,  32642,  32649,  32657,  32663,
+     32670,  32676,  32681,  32686,  32691,  32696,  32700,  32704,  32708,  32712,  32715,  32718,
+     32721,  32724,  32727,  32729,  32732,  32734,  32736,  32738,  32740,  32741,  32743,  32745,
+     32746,  32747,  32749,  32750,  32751,  32752,  32753,  32754,  32755,  32755,  32756,  32757,
+     32758,  32758,  32759,  32759,  32760,  32760,  32761,  32761,  32762,  32762,  32762,  32763,
+     32763,  32763,  32764,  32764,  32764,  32764,  32765,  32765,  32765,  32765,  32765,  32766,
+     32766,  32766,  32766,  32766,  32766,  32766,  32766,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767
+};
+
+#define LUT_INTERP_16(y, x, p_tbl){\
+    UWORD32 ux = (UWORD32)((WORD32)(x) + 32768);\
+    WORD32 idx = ux >> 7;\
+    WORD32 frac = ux & 127;\
+    WORD32 y0 = p_tbl[idx];\
+    WORD32 y1 = p_tbl[idx + 1];\
+    y = y0 + ((((y1 - y0) * frac) + 64) >> 7);\
+}
+
+static WORD32 vec_lut_interp_16_16(WORD16 * __restrict__ p_out,
+                      const WORD16 * __restrict__ p_vec,
+                      const WORD16 * __restrict__ p_tbl,
+                            WORD32 vec_length)
+{
+    int i;
+    WORD32 y0, y1;
+
+    for(i = 0; i < (vec_length >> 1); i++)
+    {
+        LUT_INTERP_16(y0, p_vec[2*i],   p_tbl);
+        LUT_INTERP_16(y1, p_vec[2*i+1], p_tbl);
+        p_out[2*i]   = (WORD16)y0;
+        p_out[2*i+1] = (WORD16)y1;
+    }
+
+    if(vec_length & 1)
+    {
+        LUT_INTERP_16(y0, p_vec[vec_length-1], p_tbl);
+        p_out[vec_length-1] = (WORD16)y0;
+    }
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+  Sigmoid / Tanh
+  The functions compute sigmoid and tanh of 16-bit fixed-point inputs in
+  Q3.12 using a 513-entry table with linear interpolation and form outputs
+  in Q0.15 format.
+
+  Precision:
+  16x16  16-bit inputs, 16-bit output. Accuracy: 1 LSB (sigmoid),
+         4 LSB (tanh).
+
+  Input:
+  p_vec[vec_length]   input data, Q3.12
+  vec_length          length of vectors
+  Output:
+  p_out[vec_length]   result, Q0.15
+-------------------------------------------------------------------------*/
+WORD32 xa_nn_vec_sigmoid_16_16(
+    WORD16       * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32       vec_length)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+    return vec_lut_interp_16_16(p_out, p_vec, sigmoid_q15_tbl, vec_length);
+}
+
+WORD32 xa_nn_vec_tanh_16_16(
+    WORD16       * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32       vec_length)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+    return vec_lut_interp_16_16(p_out, p_vec, tanh_q15_tbl, vec_length);
+}
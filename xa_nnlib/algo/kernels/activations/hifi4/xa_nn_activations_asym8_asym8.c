@@ -434,6 +434,92 @@ WORD32 xa_nn_vec_sigmoid_asym8_asym8(UWORD8 *p_out,
     return 0;
 }
 
+/* Fills a 256-entry table with the sigmoid of every possible asym8 input,
+ * for the given input quantization. Parameters are the same as for
+ * xa_nn_vec_sigmoid_asym8_asym8; output is scale 1/256, zero point 0. */
+WORD32 xa_nn_vec_sigmoid_asym8_asym8_lut_init(UWORD8 *p_lut,
+                            WORD32 zero_point,
+                            WORD32 input_range_radius,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift)
+{
+    UWORD8 ramp[256];
+    int i;
+
+    XA_NNLIB_ARG_CHK_PTR(p_lut, -1);
+
+    for(i = 0; i < 256; i++)
+    {
+        ramp[i] = (UWORD8)i;
+    }
+
+    return xa_nn_vec_sigmoid_asym8_asym8(p_lut,
+                                         ramp,
+                                         zero_point,
+                                         input_range_radius,
+                                         input_multiplier,
+                                         input_left_shift,
+                                         256);
+}
+
+/* Fills a 256-entry table with the tanh of every possible asym8 input.
+ * Input parameters describe the input rescaled to Q4.27, as for sigmoid;
+ * output is scale 1/128, zero point 128.
+ * Uses tanh(x) = 2 * sigmoid(2 * x) - 1, which in the output quantization is
+ * exactly sigmoid(2 * x) at scale 1/256, so doubling the input multiplier
+ * and halving the radius reuses the sigmoid path without loss. */
+WORD32 xa_nn_vec_tanh_asym8_asym8_lut_init(UWORD8 *p_lut,
+                            WORD32 zero_point,
+                            WORD32 input_range_radius,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift)
+{
+    XA_NNLIB_ARG_CHK_COND((input_left_shift > 30), -1);
+
+    return xa_nn_vec_sigmoid_asym8_asym8_lut_init(p_lut,
+                                                  zero_point,
+                                                  input_range_radius >> 1,
+                                                  input_multiplier,
+                                                  input_left_shift + 1);
+}
+
+/* Applies a 256-entry table, e.g. from the *_lut_init functions above,
+ * to every element. No alignment requirements. */
+WORD32 xa_nn_vec_lut_asym8_asym8(UWORD8 * __restrict__ p_out,
+                      const UWORD8 * __restrict__ p_vec,
+                      const UWORD8 * __restrict__ p_lut,
+                            WORD32 vec_length)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_lut, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+    int i;
+    UWORD8 a0, a1, a2, a3;
+
+    for(i = 0; i < (vec_length >> 2); i++)
+    {
+        a0 = p_vec[4*i];
+        a1 = p_vec[4*i+1];
+        a2 = p_vec[4*i+2];
+        a3 = p_vec[4*i+3];
+        p_out[4*i]   = p_lut[a0];
+        p_out[4*i+1] = p_lut[a1];
+        p_out[4*i+2] = p_lut[a2];
+        p_out[4*i+3] = p_lut[a3];
+    }
+
+    for(i = (vec_length & ~3); i < vec_length; i++)
+    {
+        p_out[i] = p_lut[p_vec[i]];
+    }
+
+    return 0;
+}
+
 /* 
  * inp: p_vec: 4 byte aligned input pointer
  * out: p_out: no alignment needed for output pointer*/
@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_type_def.h"
+#include "NatureDSP_Signal_math.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+
+/* Elements of one batch row processed per pass, the gate blocks below stay
+ * in local memory between the steps of the cell update */
+#define LSTM_CELL_BLK 64
+
+#define LIMIT_SX2(out, inp, min, max){\
+        out = XT_MAX_SX2(min, inp);\
+        out = XT_MIN_SX2(out, max);\
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_lstm_cell_update_f32,
+             (
+                FLOAT32 *p_cell_state_out,
+                FLOAT32 *p_out,
+                const FLOAT32 *p_input_gate,
+                const FLOAT32 *p_forget_gate,
+                const FLOAT32 *p_cell_gate,
+                const FLOAT32 *p_output_gate,
+                const FLOAT32 *p_cell_state_in,
+                const FLOAT32 *p_cell_to_input,
+                const FLOAT32 *p_cell_to_forget,
+                const FLOAT32 *p_cell_to_output,
+                FLOAT32 cell_clip,
+                WORD32 cell_activation,
+                WORD32 n_cell,
+                WORD32 n_batch
+              )
+           )
+#else
+/* p_y[i] = p_x[i] + p_w[i]*p_c[i], or a copy of p_x when p_w is NULL.
+ * p_y is an aligned local block, the inputs may be unaligned. */
+static inline void peephole_blk(FLOAT32 * __restrict__ p_y,
+                                const FLOAT32 * __restrict__ p_x,
+                                const FLOAT32 * __restrict__ p_w,
+                                const FLOAT32 * __restrict__ p_c,
+                                int n)
+{
+    int i;
+    xtfloatx2 *y = (xtfloatx2 *)p_y;
+    xtfloatx2 *x = (xtfloatx2 *)p_x;
+    xtfloatx2 x1, w1, c1;
+    ae_valign x_a = XT_LASX2PP(x);
+
+    if(p_w == NULL)
+    {
+        for(i = 0; i < n >> 1; i++)
+        {
+            XT_LASX2IP(x1, x_a, x);
+            XT_SSX2IP(x1, y, 2*sizeof(FLOAT32));
+        }
+        if(n & 1)
+        {
+            xtfloat a;
+            XT_LSIP(a, (xtfloat *)x, 0);
+            XT_SSIP(a, (xtfloat *)y, 0);
+        }
+    }
+    else
+    {
+        xtfloatx2 *w = (xtfloatx2 *)p_w;
+        xtfloatx2 *c = (xtfloatx2 *)p_c;
+        ae_valign w_a = XT_LASX2PP(w);
+        ae_valign c_a = XT_LASX2PP(c);
+#pragma concurrent
+        for(i = 0; i < n >> 1; i++)
+        {
+            XT_LASX2IP(x1, x_a, x);
+            XT_LASX2IP(w1, w_a, w);
+            XT_LASX2IP(c1, c_a, c);
+            XT_MADD_SX2(x1, w1, c1);
+            XT_SSX2IP(x1, y, 2*sizeof(FLOAT32));
+        }
+        if(n & 1)
+        {
+            xtfloat a, a1, a2;
+            XT_LSIP(a, (xtfloat *)x, 0);
+            XT_LSIP(a1, (xtfloat *)w, 0);
+            XT_LSIP(a2, (xtfloat *)c, 0);
+            XT_MADD_S(a, a1, a2);
+            XT_SSIP(a, (xtfloat *)y, 0);
+        }
+    }
+}
+
+/* Cell activation of an aligned local block, p_y and p_x must differ */
+static inline void activation_blk(FLOAT32 * __restrict__ p_y,
+                                  const FLOAT32 * __restrict__ p_x,
+                                  WORD32 activation,
+                                  int n)
+{
+    int i;
+    xtfloatx2 *y = (xtfloatx2 *)p_y;
+    xtfloatx2 *x = (xtfloatx2 *)p_x;
+    xtfloatx2 x1, min, max;
+
+    switch(activation)
+    {
+        case XA_NN_LSTM_CELL_ACT_TANH:
+            vec_tanhf(p_y, p_x, n);
+            return;
+        case XA_NN_LSTM_CELL_ACT_SIGMOID:
+            vec_sigmoidf(p_y, p_x, n);
+            return;
+        case XA_NN_LSTM_CELL_ACT_RELU:
+            min = (xtfloatx2)0.0f;
+            max = (xtfloatx2)3.402823466e+38f;
+            break;
+        case XA_NN_LSTM_CELL_ACT_RELU6:
+            min = (xtfloatx2)0.0f;
+            max = (xtfloatx2)6.0f;
+            break;
+        default:
+            /* XA_NN_LSTM_CELL_ACT_NONE */
+            min = (xtfloatx2)-3.402823466e+38f;
+            max = (xtfloatx2)3.402823466e+38f;
+            break;
+    }
+
+    /* Blocks are even except the last one of a row, reading the odd
+     * tail as a pair stays inside the local block */
+#pragma concurrent
+    for(i = 0; i < (n + 1) >> 1; i++)
+    {
+        XT_LSX2IP(x1, x, 2*sizeof(FLOAT32));
+        LIMIT_SX2(x1, x1, min, max);
+        XT_SSX2IP(x1, y, 2*sizeof(FLOAT32));
+    }
+}
+
+WORD32 xa_nn_lstm_cell_update_f32(FLOAT32 * __restrict__ p_cell_state_out,
+                                  FLOAT32 * p_out,
+                                  const FLOAT32 * __restrict__ p_input_gate,
+                                  const FLOAT32 * __restrict__ p_forget_gate,
+                                  const FLOAT32 * __restrict__ p_cell_gate,
+                                  const FLOAT32 * p_output_gate,
+                                  const FLOAT32 * __restrict__ p_cell_state_in,
+                                  const FLOAT32 * __restrict__ p_cell_to_input,
+                                  const FLOAT32 * __restrict__ p_cell_to_forget,
+                                  const FLOAT32 * __restrict__ p_cell_to_output,
+                                  FLOAT32 cell_clip,
+                                  WORD32 cell_activation,
+                                  WORD32 n_cell,
+                                  WORD32 n_batch)
+{
+    FLOAT32 ALIGN(8) x_blk[LSTM_CELL_BLK];
+    FLOAT32 ALIGN(8) i_blk[LSTM_CELL_BLK];
+    FLOAT32 ALIGN(8) f_blk[LSTM_CELL_BLK];
+    FLOAT32 ALIGN(8) g_blk[LSTM_CELL_BLK];
+    FLOAT32 ALIGN(8) c_blk[LSTM_CELL_BLK];
+    const int use_cifg = (p_input_gate == NULL);
+    const int use_clip = (cell_clip > 0.0f);
+    xtfloatx2 clip_max = (xtfloatx2)cell_clip;
+    xtfloatx2 clip_min = (xtfloatx2)-cell_clip;
+    int b, n0, i;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_cell_state_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_forget_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_cell_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_output_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_cell_state_in, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_cell_state_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_forget_gate, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_cell_gate, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_output_gate, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_cell_state_in, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((n_cell <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((n_batch <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((cell_activation != XA_NN_LSTM_CELL_ACT_NONE) &&
+                           (cell_activation != XA_NN_LSTM_CELL_ACT_RELU) &&
+                           (cell_activation != XA_NN_LSTM_CELL_ACT_RELU6) &&
+                           (cell_activation != XA_NN_LSTM_CELL_ACT_TANH) &&
+                           (cell_activation != XA_NN_LSTM_CELL_ACT_SIGMOID)), -1);
+    /* The input gate peephole comes with the input gate */
+    XA_NNLIB_ARG_CHK_COND((use_cifg && p_cell_to_input != NULL), -1);
+
+    for(b = 0; b < n_batch; b++)
+    {
+        for(n0 = 0; n0 < n_cell; n0 += LSTM_CELL_BLK)
+        {
+            const int off = b * n_cell + n0;
+            const int n = (n_cell - n0) < LSTM_CELL_BLK ? (n_cell - n0) : LSTM_CELL_BLK;
+            const FLOAT32 *p_c_in = p_cell_state_in + off;
+
+            /* Forget gate */
+            peephole_blk(x_blk, p_forget_gate + off,
+                p_cell_to_forget ? p_cell_to_forget + n0 : NULL, p_c_in, n);
+            vec_sigmoidf(f_blk, x_blk, n);
+
+            /* Input gate, 1 - forget gate with coupled input and forget gates */
+            if(use_cifg)
+            {
+                xtfloatx2 *f = (xtfloatx2 *)f_blk;
+                xtfloatx2 *y = (xtfloatx2 *)i_blk;
+                xtfloatx2 f1, one = (xtfloatx2)1.0f;
+#pragma concurrent
+                for(i = 0; i < (n + 1) >> 1; i++)
+                {
+                    XT_LSX2IP(f1, f, 2*sizeof(FLOAT32));
+                    f1 = XT_SUB_SX2(one, f1);
+                    XT_SSX2IP(f1, y, 2*sizeof(FLOAT32));
+                }
+            }
+            else
+            {
+                peephole_blk(x_blk, p_input_gate + off,
+                    p_cell_to_input ? p_cell_to_input + n0 : NULL, p_c_in, n);
+                vec_sigmoidf(i_blk, x_blk, n);
+            }
+
+            /* Cell gate */
+            peephole_blk(x_blk, p_cell_gate + off, NULL, NULL, n);
+            activation_blk(g_blk, x_blk, cell_activation, n);
+
+            /* New cell state: forget * cell_in + input * cell gate, clipped */
+            {
+                xtfloatx2 *f = (xtfloatx2 *)f_blk;
+                xtfloatx2 *ig = (xtfloatx2 *)i_blk;
+                xtfloatx2 *g = (xtfloatx2 *)g_blk;
+                xtfloatx2 *c = (xtfloatx2 *)c_blk;
+                xtfloatx2 *c_in = (xtfloatx2 *)p_c_in;
+                xtfloatx2 *c_out = (xtfloatx2 *)(p_cell_state_out + off);
+                xtfloatx2 f1, i1, g1, c1;
+                ae_valign c_in_a = XT_LASX2PP(c_in);
+                ae_valign c_out_a = AE_ZALIGN64();
+#pragma concurrent
+                for(i = 0; i < n >> 1; i++)
+                {
+                    XT_LSX2IP(f1, f, 2*sizeof(FLOAT32));
+                    XT_LSX2IP(i1, ig, 2*sizeof(FLOAT32));
+                    XT_LSX2IP(g1, g, 2*sizeof(FLOAT32));
+                    XT_LASX2IP(c1, c_in_a, c_in);
+                    c1 = XT_MUL_SX2(f1, c1);
+                    XT_MADD_SX2(c1, i1, g1);
+                    if(use_clip)
+                    {
+                        LIMIT_SX2(c1, c1, clip_min, clip_max);
+                    }
+                    XT_SSX2IP(c1, c, 2*sizeof(FLOAT32));
+                    XT_SASX2IP(c1, c_out_a, c_out);
+                }
+                XT_SASX2POSFP(c_out_a, c_out);
+                if(n & 1)
+                {
+                    xtfloat a, a1, a2, a3;
+                    XT_LSIP(a1, (xtfloat *)f, 0);
+                    XT_LSIP(a2, (xtfloat *)ig, 0);
+                    XT_LSIP(a3, (xtfloat *)g, 0);
+                    XT_LSIP(a, (xtfloat *)c_in, 0);
+                    a = XT_MUL_S(a1, a);
+                    XT_MADD_S(a, a2, a3);
+                    if(use_clip)
+                    {
+                        a = XT_MAX_S((xtfloat)-cell_clip, a);
+                        a = XT_MIN_S(a, (xtfloat)cell_clip);
+                    }
+                    XT_SSIP(a, (xtfloat *)c, 0);
+                    XT_SSIP(a, (xtfloat *)c_out, 0);
+                }
+            }
+
+            /* Output gate, the peephole sees the new cell state */
+            peephole_blk(x_blk, p_output_gate + off,
+                p_cell_to_output ? p_cell_to_output + n0 : NULL, c_blk, n);
+            vec_sigmoidf(f_blk, x_blk, n);
+
+            /* Output: output gate * activation(cell state). p_out may be
+             * p_output_gate, this block of it has been consumed above. */
+            activation_blk(g_blk, c_blk, cell_activation, n);
+            {
+                xtfloatx2 *o = (xtfloatx2 *)f_blk;
+                xtfloatx2 *g = (xtfloatx2 *)g_blk;
+                xtfloatx2 *out = (xtfloatx2 *)(p_out + off);
+                xtfloatx2 o1, g1;
+                ae_valign out_a = AE_ZALIGN64();
+#pragma concurrent
+                for(i = 0; i < n >> 1; i++)
+                {
+                    XT_LSX2IP(o1, o, 2*sizeof(FLOAT32));
+                    XT_LSX2IP(g1, g, 2*sizeof(FLOAT32));
+                    o1 = XT_MUL_SX2(o1, g1);
+                    XT_SASX2IP(o1, out_a, out);
+                }
+                XT_SASX2POSFP(out_a, out);
+                if(n & 1)
+                {
+                    xtfloat a1, a2;
+                    XT_LSIP(a1, (xtfloat *)o, 0);
+                    XT_LSIP(a2, (xtfloat *)g, 0);
+                    a1 = XT_MUL_S(a1, a2);
+                    XT_SSIP(a1, (xtfloat *)out, 0);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+#endif /* !HAVE_VFPU */
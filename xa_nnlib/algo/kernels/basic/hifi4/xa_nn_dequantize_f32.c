@@ -0,0 +1,167 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_basic_state.h"
+#include "xa_nnlib_kernels_api.h"
+
+#define DEQUANTIZE_STORE_16X4(out, out_a, x, scale){\
+    ae_int32x2 x32, x10;\
+    xtfloatx2 y32, y10;\
+    x32 = AE_SEXT32X2D16_32(x);\
+    x10 = AE_SEXT32X2D16_10(x);\
+    y32 = XT_MUL_SX2(XT_FLOAT_SX2(x32, 0), scale);\
+    y10 = XT_MUL_SX2(XT_FLOAT_SX2(x10, 0), scale);\
+    XT_SASX2IP(y32, out_a, out);\
+    XT_SASX2IP(y10, out_a, out);\
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_dequantize_asym8_f32,
+             (
+                FLOAT32 *p_out,
+                const UWORD8 *p_inp,
+                WORD32 inp_zero_bias,
+                FLOAT32 scale,
+                WORD32 num_elm
+              )
+           )
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_dequantize_16_f32,
+             (
+                FLOAT32 *p_out,
+                const WORD16 *p_inp,
+                FLOAT32 scale,
+                WORD32 num_elm
+              )
+           )
+#else
+/* p_out[i] = scale * (p_inp[i] + inp_zero_bias) */
+WORD32 xa_nn_dequantize_asym8_f32(FLOAT32 * __restrict__ p_out,
+                            const UWORD8 * __restrict__ p_inp,
+                                  WORD32 inp_zero_bias,
+                                  FLOAT32 scale,
+                                  WORD32 num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -255) || (inp_zero_bias > 0)), -1);
+
+    int i;
+    WORD8 *p_i = (WORD8 *)p_inp;
+    xtfloatx2 *out = (xtfloatx2 *)p_out;
+    ae_valign out_a = AE_ZALIGN64();
+    ae_int16x4 x, zero_bias;
+    xtfloatx2 scale2 = (xtfloatx2)scale;
+
+    zero_bias = AE_MOVDA16(inp_zero_bias);
+
+    if((((unsigned)p_i)&3) == 0)
+    {
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_L8X4F_IP(x, p_i, 4*sizeof(WORD8));
+            x = AE_MOVINT16X4_FROMINT64(AE_SRLI64(AE_MOVINT64_FROMINT16X4(x), 8));
+            x = AE_ADD16(x, zero_bias);
+            DEQUANTIZE_STORE_16X4(out, out_a, x, scale2)
+        }
+    }
+    else
+    {
+        ae_int16x4 i_a;
+
+        PRIME_8X4U(p_i, i_a);
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_LA8X4U_IP(x, i_a, p_i);
+            x = AE_ADD16(x, zero_bias);
+            DEQUANTIZE_STORE_16X4(out, out_a, x, scale2)
+        }
+    }
+    XT_SASX2POSFP(out_a, out);
+
+    // Remainder Loop
+    {
+        const UWORD8 *p_i_rem = (const UWORD8 *)p_i;
+        FLOAT32 *p_o_rem = (FLOAT32 *)out;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            p_o_rem[i] = scale * (FLOAT32)((WORD32)p_i_rem[i] + inp_zero_bias);
+        }
+    }
+
+    return 0;
+}
+
+/* p_out[i] = scale * p_inp[i], symmetric 16-bit input */
+WORD32 xa_nn_dequantize_16_f32(FLOAT32 * __restrict__ p_out,
+                         const WORD16 * __restrict__ p_inp,
+                               FLOAT32 scale,
+                               WORD32 num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+
+    int i;
+    ae_int16x4 *p_i = (ae_int16x4 *)p_inp;
+    xtfloatx2 *out = (xtfloatx2 *)p_out;
+    ae_valign inp_a = AE_LA64_PP(p_i);
+    ae_valign out_a = AE_ZALIGN64();
+    ae_int16x4 x;
+    xtfloatx2 scale2 = (xtfloatx2)scale;
+
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        AE_LA16X4_IP(x, inp_a, p_i);
+        DEQUANTIZE_STORE_16X4(out, out_a, x, scale2)
+    }
+    XT_SASX2POSFP(out_a, out);
+
+    // Remainder Loop
+    {
+        const WORD16 *p_i_rem = (const WORD16 *)p_i;
+        FLOAT32 *p_o_rem = (FLOAT32 *)out;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            p_o_rem[i] = scale * (FLOAT32)p_i_rem[i];
+        }
+    }
+
+    return 0;
+}
+#endif
@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_basic_state.h"
+#include "xa_nnlib_kernels_api.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_quantize_f32_asym8,
+             (
+                UWORD8 *p_out,
+                const FLOAT32 *p_inp,
+                FLOAT32 scale,
+                WORD32 out_zero_bias,
+                WORD32 num_elm
+              )
+           )
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_quantize_f32_16,
+             (
+                WORD16 *p_out,
+                const FLOAT32 *p_inp,
+                FLOAT32 scale,
+                WORD32 num_elm
+              )
+           )
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_quantize_f32_sym8,
+             (
+                WORD8 *p_out,
+                FLOAT32 *p_scale,
+                const FLOAT32 *p_inp,
+                WORD32 num_elm
+              )
+           )
+#else
+/* p_out[i] = clamp(round(p_inp[i] / scale) + out_zero_bias, 0, 255)
+ * Division is done as multiplication with the reciprocal of scale, so
+ * inputs exactly halfway between two levels may round either way. */
+WORD32 xa_nn_quantize_f32_asym8(UWORD8 * __restrict__ p_out,
+                          const FLOAT32 * __restrict__ p_inp,
+                                FLOAT32 scale,
+                                WORD32 out_zero_bias,
+                                WORD32 num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((scale <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_zero_bias < 0) || (out_zero_bias > 255)), -1);
+
+    int i;
+    UWORD8 *out = p_out;
+    xtfloatx2 *inp = (xtfloatx2 *)p_inp;
+    ae_valign inp_a = XT_LASX2PP(inp);
+    xtfloatx2 x0, x1;
+    ae_int32x2 r0, r1, c0, c1;
+    FLOAT32 inv_scale = 1.0f / scale;
+    xtfloatx2 inv_scale2 = (xtfloatx2)inv_scale;
+    ae_int32x2 zero_bias = AE_MOVDA32(out_zero_bias);
+    ae_int32x2 min = AE_ZERO32();
+    ae_int32x2 max = AE_MOVDA32(255);
+
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        XT_LASX2IP(x0, inp_a, inp);
+        XT_LASX2IP(x1, inp_a, inp);
+
+        r0 = XT_ROUND_SX2(XT_MUL_SX2(x0, inv_scale2), 0);
+        r1 = XT_ROUND_SX2(XT_MUL_SX2(x1, inv_scale2), 0);
+
+        r0 = AE_ADD32S(r0, zero_bias);
+        r1 = AE_ADD32S(r1, zero_bias);
+
+        CLAMP_VAL(c0, r0, min, max)
+        CLAMP_VAL(c1, r1, min, max)
+
+        STORE_8X4_FROM_32X4(out, c0, c1)
+    }
+
+    // Remainder Loop
+    {
+        const FLOAT32 *p_i_rem = (const FLOAT32 *)inp;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            int y = XT_ROUND_S(XT_MUL_S(p_i_rem[i], inv_scale), 0) + out_zero_bias;
+            LIMIT(y, 0, 255)
+            *out++ = (UWORD8)y;
+        }
+    }
+
+    return 0;
+}
+
+/* p_out[i] = saturate16(round(p_inp[i] / scale)), symmetric 16-bit output */
+WORD32 xa_nn_quantize_f32_16(WORD16 * __restrict__ p_out,
+                       const FLOAT32 * __restrict__ p_inp,
+                             FLOAT32 scale,
+                             WORD32 num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((scale <= 0), -1);
+
+    int i;
+    ae_int16x4 *out = (ae_int16x4 *)p_out;
+    xtfloatx2 *inp = (xtfloatx2 *)p_inp;
+    ae_valign inp_a = XT_LASX2PP(inp);
+    ae_valign out_a = AE_ZALIGN64();
+    xtfloatx2 x0, x1;
+    ae_int32x2 r0, r1;
+    ae_int16x4 y;
+    FLOAT32 inv_scale = 1.0f / scale;
+    xtfloatx2 inv_scale2 = (xtfloatx2)inv_scale;
+
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        XT_LASX2IP(x0, inp_a, inp);
+        XT_LASX2IP(x1, inp_a, inp);
+
+        r0 = XT_ROUND_SX2(XT_MUL_SX2(x0, inv_scale2), 0);
+        r1 = XT_ROUND_SX2(XT_MUL_SX2(x1, inv_scale2), 0);
+
+        y = AE_SAT16X4(r0, r1);
+        AE_SA16X4_IP(y, out_a, out);
+    }
+    AE_SA64POS_FP(out_a, out);
+
+    // Remainder Loop
+    {
+        const FLOAT32 *p_i_rem = (const FLOAT32 *)inp;
+        WORD16 *p_o_rem = (WORD16 *)out;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            int v = XT_ROUND_S(XT_MUL_S(p_i_rem[i], inv_scale), 0);
+            LIMIT(v, -32768, 32767)
+            p_o_rem[i] = (WORD16)v;
+        }
+    }
+
+    return 0;
+}
+
+/* Symmetric 8-bit quantization with the scale taken from the data:
+ * *p_scale = max(|p_inp[i]|) / 127, p_out[i] = round(p_inp[i] / *p_scale).
+ * All zero input gives *p_scale = 0 and zero output. */
+WORD32 xa_nn_quantize_f32_sym8(WORD8 * __restrict__ p_out,
+                               FLOAT32 * __restrict__ p_scale,
+                         const FLOAT32 * __restrict__ p_inp,
+                               WORD32 num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scale, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_scale, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+
+    int i;
+    WORD8 *out = p_out;
+    xtfloatx2 *inp = (xtfloatx2 *)p_inp;
+    ae_valign inp_a = XT_LASX2PP(inp);
+    xtfloatx2 x0, x1, max_abs2 = (xtfloatx2)0.0f;
+    ae_int32x2 r0, r1, c0, c1;
+    ae_int32x2 min = AE_MOVDA32(-127);
+    ae_int32x2 max = AE_MOVDA32(127);
+    xtfloat max_abs;
+
+    /* Range of the input */
+    for(i = 0; i < (num_elm >> 1); i++)
+    {
+        XT_LASX2IP(x0, inp_a, inp);
+        max_abs2 = XT_MAX_SX2(max_abs2, XT_ABS_SX2(x0));
+    }
+    max_abs = XT_MAX_S(XT_HIGH_S(max_abs2), XT_LOW_S(max_abs2));
+    if(num_elm & 1)
+    {
+        max_abs = XT_MAX_S(max_abs, XT_ABS_S(p_inp[num_elm - 1]));
+    }
+
+    if(max_abs == 0.0f)
+    {
+        *p_scale = 0.0f;
+        for(i = 0; i < num_elm; i++)
+        {
+            p_out[i] = 0;
+        }
+        return 0;
+    }
+    *p_scale = max_abs / 127.0f;
+
+    FLOAT32 inv_scale = 127.0f / max_abs;
+    xtfloatx2 inv_scale2 = (xtfloatx2)inv_scale;
+
+    inp = (xtfloatx2 *)p_inp;
+    inp_a = XT_LASX2PP(inp);
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        XT_LASX2IP(x0, inp_a, inp);
+        XT_LASX2IP(x1, inp_a, inp);
+
+        r0 = XT_ROUND_SX2(XT_MUL_SX2(x0, inv_scale2), 0);
+        r1 = XT_ROUND_SX2(XT_MUL_SX2(x1, inv_scale2), 0);
+
+        CLAMP_VAL(c0, r0, min, max)
+        CLAMP_VAL(c1, r1, min, max)
+
+        STORE_8X4_FROM_32X4(out, c0, c1)
+    }
+
+    // Remainder Loop
+    {
+        const FLOAT32 *p_i_rem = (const FLOAT32 *)inp;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            int y = XT_ROUND_S(XT_MUL_S(p_i_rem[i], inv_scale), 0);
+            LIMIT(y, -127, 127)
+            *out++ = (WORD8)y;
+        }
+    }
+
+    return 0;
+}
+#endif
@@ -0,0 +1,274 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_basic_state.h"
+
+/* Rescaling uses the out_multiplier (Q31) / out_shift (left shift, negative
+ * for right shift) convention of xa_nn_elm_add_asym8xasym8_asym8. The product
+ * is kept in 64 bits before shifting, so out_shift may be positive when the
+ * input scale is larger than the output scale. */
+
+WORD32 xa_nn_requantize_asym8_asym8(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   UWORD8 * __restrict__ p_inp,
+                            WORD32  inp_zero_bias,
+                            WORD32  num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_zero_bias < 0) || (out_zero_bias > 255)), -1);
+    XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -255) || (inp_zero_bias > 0)), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+    int i;
+    UWORD8 *out = p_out;
+    WORD8 *p_i = (WORD8 *)p_inp;
+    ae_int16x4 x, zero_bias16;
+    ae_int32x2 v32, v10, raw32, raw10, c32, c10;
+    ae_int32x2 multiplier = AE_MOVDA32(out_multiplier);
+    ae_int32x2 op_zero_bias = AE_MOVDA32(out_zero_bias);
+    ae_int32x2 min = AE_ZERO32();
+    ae_int32x2 max = AE_MOVDA32(255);
+
+    zero_bias16 = AE_MOVDA16(inp_zero_bias);
+
+    if((((unsigned)p_i)&3) == 0)
+    {
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_L8X4F_IP(x, p_i, 4*sizeof(WORD8));
+            x = AE_MOVINT16X4_FROMINT64(AE_SRLI64(AE_MOVINT64_FROMINT16X4(x), 8));
+            x = AE_ADD16(x, zero_bias16);
+
+            v32 = AE_SEXT32X2D16_32(x);
+            v10 = AE_SEXT32X2D16_10(x);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw10, v10, multiplier, out_shift)
+            raw32 = AE_ADD32S(raw32, op_zero_bias);
+            raw10 = AE_ADD32S(raw10, op_zero_bias);
+
+            CLAMP_VAL(c32, raw32, min, max)
+            CLAMP_VAL(c10, raw10, min, max)
+
+            STORE_8X4_FROM_32X4(out, c32, c10)
+        }
+    }
+    else
+    {
+        ae_int16x4 i_a;
+
+        PRIME_8X4U(p_i, i_a);
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_LA8X4U_IP(x, i_a, p_i);
+            x = AE_ADD16(x, zero_bias16);
+
+            v32 = AE_SEXT32X2D16_32(x);
+            v10 = AE_SEXT32X2D16_10(x);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw10, v10, multiplier, out_shift)
+            raw32 = AE_ADD32S(raw32, op_zero_bias);
+            raw10 = AE_ADD32S(raw10, op_zero_bias);
+
+            CLAMP_VAL(c32, raw32, min, max)
+            CLAMP_VAL(c10, raw10, min, max)
+
+            STORE_8X4_FROM_32X4(out, c32, c10)
+        }
+    }
+
+    // Remainder Loop
+    for(i = 0; i < (num_elm & 3); i++)
+    {
+        v32 = AE_MOVDA32((WORD32)*((UWORD8 *)p_i + i) + inp_zero_bias);
+
+        MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+        raw32 = AE_ADD32S(raw32, op_zero_bias);
+        CLAMP_VAL(c32, raw32, min, max)
+
+        *out++ = (UWORD8)AE_MOVAD32_H(c32);
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_requantize_asym8_16(WORD16 * __restrict__ p_out,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   UWORD8 * __restrict__ p_inp,
+                            WORD32  inp_zero_bias,
+                            WORD32  num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -255) || (inp_zero_bias > 0)), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+    int i;
+    ae_int16x4 *out = (ae_int16x4 *)p_out;
+    ae_valign out_a = AE_ZALIGN64();
+    WORD8 *p_i = (WORD8 *)p_inp;
+    ae_int16x4 x, y, zero_bias16;
+    ae_int32x2 v32, v10, raw32, raw10;
+    ae_int32x2 multiplier = AE_MOVDA32(out_multiplier);
+
+    zero_bias16 = AE_MOVDA16(inp_zero_bias);
+
+    if((((unsigned)p_i)&3) == 0)
+    {
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_L8X4F_IP(x, p_i, 4*sizeof(WORD8));
+            x = AE_MOVINT16X4_FROMINT64(AE_SRLI64(AE_MOVINT64_FROMINT16X4(x), 8));
+            x = AE_ADD16(x, zero_bias16);
+
+            v32 = AE_SEXT32X2D16_32(x);
+            v10 = AE_SEXT32X2D16_10(x);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw10, v10, multiplier, out_shift)
+
+            y = AE_SAT16X4(raw32, raw10);
+            AE_SA16X4_IP(y, out_a, out);
+        }
+    }
+    else
+    {
+        ae_int16x4 i_a;
+
+        PRIME_8X4U(p_i, i_a);
+        for(i = 0; i < (num_elm >> 2); i++)
+        {
+            AE_LA8X4U_IP(x, i_a, p_i);
+            x = AE_ADD16(x, zero_bias16);
+
+            v32 = AE_SEXT32X2D16_32(x);
+            v10 = AE_SEXT32X2D16_10(x);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw10, v10, multiplier, out_shift)
+
+            y = AE_SAT16X4(raw32, raw10);
+            AE_SA16X4_IP(y, out_a, out);
+        }
+    }
+    AE_SA64POS_FP(out_a, out);
+
+    // Remainder Loop
+    {
+        WORD16 *p_o_rem = (WORD16 *)out;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            v32 = AE_MOVDA32((WORD32)*((UWORD8 *)p_i + i) + inp_zero_bias);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            y = AE_SAT16X4(raw32, raw32);
+
+            p_o_rem[i] = (WORD16)AE_MOVAD16_0(y);
+        }
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_requantize_16_asym8(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   WORD16 * __restrict__ p_inp,
+                            WORD32  num_elm)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_zero_bias < 0) || (out_zero_bias > 255)), -1);
+    XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+    int i;
+    UWORD8 *out = p_out;
+    ae_int16x4 *p_i = (ae_int16x4 *)p_inp;
+    ae_valign inp_a = AE_LA64_PP(p_i);
+    ae_int16x4 x;
+    ae_int32x2 v32, v10, raw32, raw10, c32, c10;
+    ae_int32x2 multiplier = AE_MOVDA32(out_multiplier);
+    ae_int32x2 op_zero_bias = AE_MOVDA32(out_zero_bias);
+    ae_int32x2 min = AE_ZERO32();
+    ae_int32x2 max = AE_MOVDA32(255);
+
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        AE_LA16X4_IP(x, inp_a, p_i);
+
+        v32 = AE_SEXT32X2D16_32(x);
+        v10 = AE_SEXT32X2D16_10(x);
+
+        MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+        MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw10, v10, multiplier, out_shift)
+        raw32 = AE_ADD32S(raw32, op_zero_bias);
+        raw10 = AE_ADD32S(raw10, op_zero_bias);
+
+        CLAMP_VAL(c32, raw32, min, max)
+        CLAMP_VAL(c10, raw10, min, max)
+
+        STORE_8X4_FROM_32X4(out, c32, c10)
+    }
+
+    // Remainder Loop
+    {
+        const WORD16 *p_i_rem = (const WORD16 *)p_i;
+
+        for(i = 0; i < (num_elm & 3); i++)
+        {
+            v32 = AE_MOVDA32((WORD32)p_i_rem[i]);
+
+            MultiplyByQuantizedMultiplierSmallerThanOneExp_NEW(raw32, v32, multiplier, out_shift)
+            raw32 = AE_ADD32S(raw32, op_zero_bias);
+            CLAMP_VAL(c32, raw32, min, max)
+
+            *out++ = (UWORD8)AE_MOVAD32_H(c32);
+        }
+    }
+
+    return 0;
+}
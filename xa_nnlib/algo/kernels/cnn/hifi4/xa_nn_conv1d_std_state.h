@@ -24,6 +24,19 @@
 
 #include "xa_nn_conv2d_std_state.h"
 
+typedef struct _xa_nn_conv1d_std_stream_state_t{
+  xa_nn_conv_state_t conv_state;
+  WORD32 kernel_height;
+  WORD32 input_width;
+  WORD32 input_channels;
+  WORD32 y_stride;
+  WORD32 input_precision;
+  WORD32 input_bytewidth;
+  WORD32 input_channelsXwidth_pad;
+  WORD32 pad_val;
+  WORD32 rows_to_next_out;    /* Input rows still needed for the next output row */
+} xa_nn_conv1d_std_stream_state_t;
+
 VOID xa_nn_conv1d_std_init_state(
     VOID *p_handle,
     VOID *p_kernel,
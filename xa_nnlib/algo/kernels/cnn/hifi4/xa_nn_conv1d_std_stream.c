@@ -0,0 +1,407 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include <string.h>
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv1d_std_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Streaming conv1d keeps the last kernel_height input rows in a circular
+   buffer that persists across calls. Each call appends new input rows and
+   computes only the output rows whose receptive field has just been
+   completed, so a model input window that slides by one row per step costs
+   one output row instead of out_height rows. */
+
+static WORD32 conv1d_std_stream_precision(
+    WORD32 input_precision,
+    WORD32 *p_input_size,
+    WORD32 *p_align_size)
+{
+  switch(input_precision)
+  {
+    case 8:
+      *p_input_size = sizeof(WORD8);
+      *p_align_size = ALIGNMENT>>1;
+      break;
+    case 16:
+      *p_input_size = sizeof(WORD16);
+      *p_align_size = ALIGNMENT>>1;
+      break;
+    case -1:
+      *p_input_size = sizeof(WORD32);
+      *p_align_size = ALIGNMENT>>2;
+      break;
+    case -3:
+      *p_input_size = sizeof(UWORD8);
+      *p_align_size = ALIGNMENT>>1;
+      break;
+    default:
+      return -1;
+      break;
+  }
+  return 0;
+}
+
+WORD32 xa_nn_conv1d_std_stream_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+
+  WORD32 mem_req = 0;
+  WORD32 input_size;
+  WORD32 align_size;
+
+  XA_NNLIB_CHK_COND((conv1d_std_stream_precision(input_precision, &input_size, &align_size) != 0), -1);
+
+  mem_req += PADDED_SIZE(sizeof(xa_nn_conv1d_std_stream_state_t), ALIGNMENT);
+
+  // Computing circular buffer size
+  WORD32 input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, align_size);
+  mem_req += kernel_height * input_channelsXwidth_pad * input_size;
+  mem_req += BUS_WIDTH;
+
+  return mem_req;
+}
+
+WORD32 xa_nn_conv1d_std_stream_init(
+    VOID *p_handle,
+    VOID *p_kernel,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 input_zero_bias,
+    WORD32 input_precision)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_handle, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_handle, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -255 || input_zero_bias > 0), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding >= kernel_height), -1);
+
+  WORD32 input_size;
+  WORD32 align_size;
+  XA_NNLIB_ARG_CHK_COND((conv1d_std_stream_precision(input_precision, &input_size, &align_size) != 0), -1);
+
+  WORD8 *p_mem = (WORD8 *)p_handle;
+  xa_nn_conv1d_std_stream_state_t *p_state = (xa_nn_conv1d_std_stream_state_t *)p_mem;
+
+  p_state->kernel_height = kernel_height;
+  p_state->input_width = input_width;
+  p_state->input_channels = input_channels;
+  p_state->y_stride = y_stride;
+  p_state->input_precision = input_precision;
+  p_state->input_bytewidth = input_size;
+  p_state->input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, align_size);
+  /* Only asym8 input pads with its zero point, every other type pads with 0 */
+  p_state->pad_val = (input_precision == -3) ? -input_zero_bias : 0;
+  /* First output needs (kernel_height - y_padding) real rows, the padding rows
+     are already in the buffer */
+  p_state->rows_to_next_out = kernel_height - y_padding;
+
+  p_mem += sizeof(xa_nn_conv1d_std_stream_state_t);
+  p_mem = ALIGNED_ADDR(p_mem, ALIGNMENT);
+
+  if(((UWORD32)p_kernel & BUS_WIDTH_MASK) == ((UWORD32)p_mem & BUS_WIDTH_MASK))
+  {
+    p_mem += BUS_WIDTH; /* Add a offset to avoid banking stall */
+  }
+
+  WORD32 cir_buf_size_bytes = kernel_height * p_state->input_channelsXwidth_pad * input_size;
+
+  p_state->conv_state.cir_buf.p_begin = p_mem;
+  p_state->conv_state.cir_buf.p_curr = p_mem;
+  p_state->conv_state.cir_buf.p_end = p_mem + cir_buf_size_bytes;
+
+  /* Every slot starts out as padding, so it does not matter which of them
+     are treated as the y_padding rows */
+  memset(p_mem, (UWORD8)p_state->pad_val, cir_buf_size_bytes);
+
+  return 0;
+}
+
+/* Copies one input row over the oldest row of the circular buffer and
+   returns 1 when that completes the receptive field of a new output row.
+   p_curr always points to the oldest row, i.e. the first element of the
+   vector that matXvec has to consume. */
+static WORD32 conv1d_std_stream_add_row(
+    xa_nn_conv1d_std_stream_state_t *p_state,
+    const VOID *p_inp)
+{
+  WORD32 row_bytes = p_state->input_channels * p_state->input_width * p_state->input_bytewidth;
+  WORD32 row_bytes_pad = p_state->input_channelsXwidth_pad * p_state->input_bytewidth;
+  WORD8 *p_dst = (WORD8 *)p_state->conv_state.cir_buf.p_curr;
+
+  memcpy(p_dst, p_inp, row_bytes);
+  memset(&p_dst[row_bytes], (UWORD8)p_state->pad_val, row_bytes_pad - row_bytes);
+  AE_ADDCIRC16X4_XC(p_state->conv_state.cir_buf.p_curr, row_bytes_pad);
+
+  p_state->rows_to_next_out--;
+  if(p_state->rows_to_next_out == 0)
+  {
+    p_state->rows_to_next_out = p_state->y_stride;
+    return 1;
+  }
+  return 0;
+}
+
+#define CONV1D_STD_STREAM_CHK(precision) \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_handle, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_handle, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((n_rows < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  p_state = (xa_nn_conv1d_std_stream_state_t *)p_handle; \
+  XA_NNLIB_ARG_CHK_COND((p_state->input_precision != (precision)), -1); \
+  row_elms = p_state->input_channels * p_state->input_width; \
+  cols = p_state->input_channelsXwidth_pad * p_state->kernel_height; \
+  AE_SETCBEGIN0(p_state->conv_state.cir_buf.p_begin); \
+  AE_SETCEND0(p_state->conv_state.cir_buf.p_end);
+
+WORD32 xa_nn_conv1d_std_stream_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle)
+{
+  xa_nn_conv1d_std_stream_state_t *p_state;
+  WORD32 i, row_elms, cols, out_rows = 0;
+
+  CONV1D_STD_STREAM_CHK(16)
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+
+  for(i=0;i<n_rows;i++)
+  {
+    if(conv1d_std_stream_add_row(p_state, &p_inp[i*row_elms]))
+    {
+      xa_nn_matXvec_8x16_16_circ_nb
+        (&p_out[out_rows*out_channels] /* output */
+         ,p_kernel /* mat: rows x cols */
+         ,p_state->conv_state.cir_buf.p_curr /* vec: cols */
+         ,p_bias /* bias */
+         ,out_channels /* rows */
+         ,cols /* cols */
+         ,1 /* out_offset */
+         ,bias_shift
+         ,acc_shift
+        );
+      out_rows++;
+    }
+  }
+
+  return out_rows;
+}
+
+WORD32 xa_nn_conv1d_std_stream_8x8(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle)
+{
+  xa_nn_conv1d_std_stream_state_t *p_state;
+  WORD32 i, row_elms, cols, out_rows = 0;
+
+  CONV1D_STD_STREAM_CHK(8)
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+
+  for(i=0;i<n_rows;i++)
+  {
+    if(conv1d_std_stream_add_row(p_state, &p_inp[i*row_elms]))
+    {
+      xa_nn_matXvec_8x8_8_circ_nb
+        (&p_out[out_rows*out_channels] /* output */
+         ,p_kernel /* mat: rows x cols */
+         ,p_state->conv_state.cir_buf.p_curr /* vec: cols */
+         ,p_bias /* bias */
+         ,out_channels /* rows */
+         ,cols /* cols */
+         ,1 /* out_offset */
+         ,bias_shift
+         ,acc_shift
+        );
+      out_rows++;
+    }
+  }
+
+  return out_rows;
+}
+
+WORD32 xa_nn_conv1d_std_stream_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle)
+{
+  xa_nn_conv1d_std_stream_state_t *p_state;
+  WORD32 i, row_elms, cols, out_rows = 0;
+
+  CONV1D_STD_STREAM_CHK(16)
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+
+  for(i=0;i<n_rows;i++)
+  {
+    if(conv1d_std_stream_add_row(p_state, &p_inp[i*row_elms]))
+    {
+      xa_nn_matXvec_16x16_16_circ_nb
+        (&p_out[out_rows*out_channels] /* output */
+         ,p_kernel /* mat: rows x cols */
+         ,p_state->conv_state.cir_buf.p_curr /* vec: cols */
+         ,p_bias /* bias */
+         ,out_channels /* rows */
+         ,cols /* cols */
+         ,1 /* out_offset */
+         ,bias_shift
+         ,acc_shift
+        );
+      out_rows++;
+    }
+  }
+
+  return out_rows;
+}
+
+WORD32 xa_nn_conv1d_std_stream_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    UWORD8* __restrict__ p_kernel,
+    WORD32* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 input_zero_bias,
+    WORD32 kernel_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_handle)
+{
+  xa_nn_conv1d_std_stream_state_t *p_state;
+  WORD32 i, row_elms, cols, out_rows = 0;
+
+  CONV1D_STD_STREAM_CHK(-3)
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias != -p_state->pad_val), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_zero_bias < -255 || kernel_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+
+  for(i=0;i<n_rows;i++)
+  {
+    if(conv1d_std_stream_add_row(p_state, &p_inp[i*row_elms]))
+    {
+      xa_nn_matXvec_asym8xasym8_asym8_circ_nb
+        (&p_out[out_rows*out_channels] /* output */
+         ,p_kernel /* mat: rows x cols */
+         ,p_state->conv_state.cir_buf.p_curr /* vec: cols */
+         ,p_bias /* bias */
+         ,out_channels /* rows */
+         ,cols /* cols */
+         ,1 /* out_stride */
+         ,input_zero_bias
+         ,kernel_zero_bias
+         ,out_multiplier
+         ,out_shift
+         ,out_zero_bias
+        );
+      out_rows++;
+    }
+  }
+
+  return out_rows;
+}
+
+#if HAVE_VFPU
+WORD32 xa_nn_conv1d_std_stream_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    VOID *p_handle)
+{
+  xa_nn_conv1d_std_stream_state_t *p_state;
+  WORD32 i, row_elms, cols, out_rows = 0;
+
+  CONV1D_STD_STREAM_CHK(-1)
+
+  for(i=0;i<n_rows;i++)
+  {
+    if(conv1d_std_stream_add_row(p_state, &p_inp[i*row_elms]))
+    {
+      xa_nn_matXvec_f32_circ_nb
+        (&p_out[out_rows*out_channels] /* output */
+         ,p_kernel /* mat: rows x cols */
+         ,p_state->conv_state.cir_buf.p_curr /* vec: cols */
+         ,p_bias /* bias */
+         ,out_channels /* rows */
+         ,cols /* cols */
+         ,1 /* out_offset */
+        );
+      out_rows++;
+    }
+  }
+
+  return out_rows;
+}
+#endif /* HAVE_VFPU */
@@ -51,6 +51,8 @@ static inline void conv2d_nchw_asym8xasym8_hf4_convmul
  ,WORD32  out_multiplier
  ,WORD32  out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_activation_min
+ ,WORD32  out_activation_max
  ,pWORD32 __restrict__ p_scratch /* Scratch: [Block] [1:             (actual_out_height): (out_width)] */
  )
 {
@@ -167,7 +169,7 @@ static inline void conv2d_nchw_asym8xasym8_hf4_convmul
             accu_int64_0 = AE_SRAA64(accu_int64_0, right_shift);
             accu_int32_0 = AE_ROUND32F64SSYM(accu_int64_0);
             accu_int32_0 = AE_ADD32S(accu_int32_0, AE_MOVDA32X2(out_zero_bias, out_zero_bias));
-            accu_int32_0 = AE_MAX32(AE_MIN32(accu_int32_0, AE_MOVDA32(255)), AE_ZERO32());
+            accu_int32_0 = AE_MAX32(AE_MIN32(accu_int32_0, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
 
             out_ptr[(j * out_stride)] = (UWORD8)AE_MOVAD32_L(accu_int32_0);
         }
@@ -196,6 +198,8 @@ static void xa_nn_conv2d_depthwise_nchw_asym8xasym8
  ,WORD32  out_multiplier
  ,WORD32  out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_activation_min
+ ,WORD32  out_activation_max
 ,WORD32  out_data_format
 ,pVOID p_scratch
 )
@@ -300,6 +304,8 @@ static void xa_nn_conv2d_depthwise_nchw_asym8xasym8
                      ,out_multiplier
                      ,out_shift
                      ,out_zero_bias
+                     ,out_activation_min
+                     ,out_activation_max
                      ,p_scratch
                     );
             }
@@ -347,6 +353,8 @@ static void xa_nn_conv2d_depthwise_nchw_asym8xasym8
                  ,out_multiplier
                  ,out_shift
                  ,out_zero_bias
+                 ,out_activation_min
+                 ,out_activation_max
                  ,p_scratch
                 );
         }
@@ -371,6 +379,8 @@ static inline void conv2d_nhwc_asym8xasym8
  ,WORD32  out_multiplier
  ,WORD32  out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_activation_min
+ ,WORD32  out_activation_max
  ,pWORD32 __restrict__ p_scratch
  )
 {
@@ -440,8 +450,8 @@ static inline void conv2d_nhwc_asym8xasym8
             MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_acc1, out_multiplier, left_shift, right_shift);
             d_acc0 = AE_ADD32S(d_acc0, AE_MOVDA32(out_zero_bias));
             d_acc1 = AE_ADD32S(d_acc1, AE_MOVDA32(out_zero_bias));
-            d_acc0 = AE_MAX32(AE_MIN32(d_acc0, AE_MOVDA32(255)), AE_ZERO32());
-            d_acc1 = AE_MAX32(AE_MIN32(d_acc1, AE_MOVDA32(255)), AE_ZERO32());
+            d_acc0 = AE_MAX32(AE_MIN32(d_acc0, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
+            d_acc1 = AE_MAX32(AE_MIN32(d_acc1, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
 
             d_acc16x4 = AE_SAT16X4(d_acc0, d_acc1);
 #pragma no_unroll
@@ -457,8 +467,8 @@ static inline void conv2d_nhwc_asym8xasym8
             MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_acc3, out_multiplier, left_shift, right_shift);
             d_acc2 = AE_ADD32S(d_acc2, AE_MOVDA32(out_zero_bias));
             d_acc3 = AE_ADD32S(d_acc3, AE_MOVDA32(out_zero_bias));
-            d_acc2 = AE_MAX32(AE_MIN32(d_acc2, AE_MOVDA32(255)), AE_ZERO32());
-            d_acc3 = AE_MAX32(AE_MIN32(d_acc3, AE_MOVDA32(255)), AE_ZERO32());
+            d_acc2 = AE_MAX32(AE_MIN32(d_acc2, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
+            d_acc3 = AE_MAX32(AE_MIN32(d_acc3, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
 
             d_acc16x4 = AE_SAT16X4(d_acc2, d_acc3);
 #pragma no_unroll
@@ -507,8 +517,8 @@ static inline void conv2d_nhwc_asym8xasym8
             MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_acc1, out_multiplier, left_shift, right_shift);
             d_acc0 = AE_ADD32S(d_acc0, AE_MOVDA32(out_zero_bias));
             d_acc1 = AE_ADD32S(d_acc1, AE_MOVDA32(out_zero_bias));
-            d_acc0 = AE_MAX32(AE_MIN32(d_acc0, AE_MOVDA32(255)), AE_ZERO32());
-            d_acc1 = AE_MAX32(AE_MIN32(d_acc1, AE_MOVDA32(255)), AE_ZERO32());
+            d_acc0 = AE_MAX32(AE_MIN32(d_acc0, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
+            d_acc1 = AE_MAX32(AE_MIN32(d_acc1, AE_MOVDA32(out_activation_max)), AE_MOVDA32(out_activation_min));
 
             d_acc16x4 = AE_SAT16X4(d_acc0, d_acc1);
 #pragma no_unroll
@@ -543,6 +553,8 @@ static void xa_nn_conv2d_depthwise_nhwc_asym8xasym8
  ,WORD32  out_multiplier
  ,WORD32  out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_activation_min
+ ,WORD32  out_activation_max
 ,WORD32  out_data_format
 ,pVOID p_scratch
 )
@@ -638,12 +650,14 @@ static void xa_nn_conv2d_depthwise_nhwc_asym8xasym8
              ,out_multiplier
              ,out_shift
              ,out_zero_bias
+             ,out_activation_min
+             ,out_activation_max
              ,p_scratch
             );
     }
 }
 
-WORD32 xa_nn_conv2d_depthwise_asym8xasym8
+WORD32 xa_nn_conv2d_depthwise_asym8xasym8_act
 (pUWORD8 __restrict__ p_out
  ,const UWORD8 *__restrict__ p_kernel
  ,const UWORD8 *__restrict__ p_inp
@@ -665,6 +679,8 @@ WORD32 xa_nn_conv2d_depthwise_asym8xasym8
  ,WORD32  out_multiplier
  ,WORD32  out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_activation_min
+ ,WORD32  out_activation_max
 ,WORD32  inp_data_format
 ,WORD32  out_data_format
 ,pVOID p_scratch)
@@ -694,6 +710,7 @@ WORD32 xa_nn_conv2d_depthwise_asym8xasym8
     XA_NNLIB_ARG_CHK_COND((input_zero_bias > 0 || input_zero_bias < -255), -1);
     XA_NNLIB_ARG_CHK_COND((kernel_zero_bias > 0 || kernel_zero_bias < -255), -1);
     XA_NNLIB_ARG_CHK_COND((out_shift>31), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_min < 0 || out_activation_min > out_activation_max || out_activation_max > 255), -1);
     XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
     XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
     /* Implementation dependent checks */
@@ -724,6 +741,8 @@ WORD32 xa_nn_conv2d_depthwise_asym8xasym8
              ,out_multiplier
              ,out_shift
              ,out_zero_bias
+             ,out_activation_min
+             ,out_activation_max
              ,out_data_format
              ,p_scratch);
     }
@@ -751,8 +770,44 @@ WORD32 xa_nn_conv2d_depthwise_asym8xasym8
              ,out_multiplier
              ,out_shift
              ,out_zero_bias
+             ,out_activation_min
+             ,out_activation_max
              ,out_data_format
              ,p_scratch);
     }
     return 0;
 }
+
+
+WORD32 xa_nn_conv2d_depthwise_asym8xasym8
+(pUWORD8 __restrict__ p_out
+ ,const UWORD8 *__restrict__ p_kernel
+ ,const UWORD8 *__restrict__ p_inp
+ ,const WORD32 *__restrict__ p_bias
+ ,WORD32  input_height
+ ,WORD32  input_width
+ ,WORD32  input_channels
+ ,WORD32  kernel_height
+ ,WORD32  kernel_width
+ ,WORD32  channels_multiplier
+ ,WORD32  x_stride
+ ,WORD32  y_stride
+ ,WORD32  x_padding
+ ,WORD32  y_padding
+ ,WORD32  out_height
+ ,WORD32  out_width
+ ,WORD32  input_zero_bias
+ ,WORD32  kernel_zero_bias
+ ,WORD32  out_multiplier
+ ,WORD32  out_shift
+ ,WORD32  out_zero_bias
+,WORD32  inp_data_format
+,WORD32  out_data_format
+,pVOID p_scratch)
+{
+    return xa_nn_conv2d_depthwise_asym8xasym8_act(p_out, p_kernel, p_inp, p_bias,
+        input_height, input_width, input_channels, kernel_height, kernel_width,
+        channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+        input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias,
+        0, 255, inp_data_format, out_data_format, p_scratch);
+}
@@ -25,6 +25,7 @@
 #include "xa_nn_conv2d_depthwise_state.h"
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include <math.h>
 
 #if !HAVE_VFPU
 DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_depthwise_f32,(
@@ -47,6 +48,28 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_depthwise_f32,(
             WORD32  inp_data_format,
             WORD32  out_data_format,
             pVOID p_scratch))
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_depthwise_f32_act,(
+            FLOAT32* __restrict__ p_out,
+            const FLOAT32* __restrict__ p_kernel,
+            const FLOAT32* __restrict__ p_inp,
+            const FLOAT32* __restrict__ p_bias,
+            WORD32  input_height,
+            WORD32  input_width,
+            WORD32  input_channels,
+            WORD32  kernel_height,
+            WORD32  kernel_width,
+            WORD32  channels_multiplier,
+            WORD32  x_stride,
+            WORD32  y_stride,
+            WORD32  x_padding,
+            WORD32  y_padding,
+            WORD32  out_height,
+            WORD32  out_width,
+            FLOAT32 out_activation_min,
+            FLOAT32 out_activation_max,
+            WORD32  inp_data_format,
+            WORD32  out_data_format,
+            pVOID p_scratch))
 #else /* #if !HAVE_VFPU */
 static void convolve_nchw_f32(
         FLOAT32*  __restrict__ p_out,
@@ -61,6 +84,8 @@ static void convolve_nchw_f32(
         WORD32  out_height,
         WORD32  out_width,
         WORD32  out_stride,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         pVOID   p_scratch)
 {
     int itr_oh, itr_ow, itr_kh, itr_kw;
@@ -143,7 +168,9 @@ static void convolve_nchw_f32(
         float *ptr_out1 = (float *)p_scratch;
         for(itr_ow = 0; itr_ow < out_width; itr_ow++)
         {
-            p_out[itr_oh*out_width*out_stride+itr_ow*out_stride] = ptr_out1[itr_ow*x_stride] + p_bias[0];
+            xtfloat out = XT_ADD_S(ptr_out1[itr_ow*x_stride], p_bias[0]);
+            out = XT_MIN_S(XT_MAX_S(out, out_activation_min), out_activation_max);
+            p_out[itr_oh*out_width*out_stride+itr_ow*out_stride] = out;
         }
     }
 }
@@ -165,6 +192,8 @@ static void xa_nn_conv2d_depthwise_nchw_f32(
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         WORD32  out_data_format,
         pVOID p_scratch)
 {
@@ -251,6 +280,8 @@ static void xa_nn_conv2d_depthwise_nchw_f32(
                             circ_out_height,
                             out_width,
                             input_channels*channels_multiplier,
+                            out_activation_min,
+                            out_activation_max,
                             p_scratch);
                 }
             }
@@ -286,6 +317,8 @@ static void xa_nn_conv2d_depthwise_nchw_f32(
                     (out_height-itr_oh),
                     out_width,
                     input_channels*channels_multiplier,
+                    out_activation_min,
+                    out_activation_max,
                     p_scratch);
         }
     }
@@ -303,7 +336,9 @@ static inline void conv2d_nhwc_f32(
         int out_width,
         int out_channels,
         int x_stride,
-        int y_stride)
+        int y_stride,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max)
 {
     WORD32 out_channels_pad;
     WORD32 i, itr_oh, itr_ch, itr_kh, itr_kw;
@@ -315,6 +350,8 @@ static inline void conv2d_nhwc_f32(
     ae_valign bias_a;
     xtfloatx2 d_acc0, d_acc1, d_bias0;
     xtfloatx2 d_acc2, d_acc3, d_bias1;
+    xtfloatx2 d_min = (xtfloatx2)out_activation_min;
+    xtfloatx2 d_max = (xtfloatx2)out_activation_max;
 
     out_channels_pad = (out_channels + 1)&(~1);
 
@@ -362,6 +399,10 @@ static inline void conv2d_nhwc_f32(
             XT_LASX2IP(d_bias1, bias_a, pt_bias);
             d_acc2 = XT_ADD_SX2(d_acc2, d_bias1);
             d_acc3 = XT_ADD_SX2(d_acc3, d_bias1);
+            d_acc0 = XT_MIN_SX2(XT_MAX_SX2(d_min, d_acc0), d_max);
+            d_acc1 = XT_MIN_SX2(XT_MAX_SX2(d_min, d_acc1), d_max);
+            d_acc2 = XT_MIN_SX2(XT_MAX_SX2(d_min, d_acc2), d_max);
+            d_acc3 = XT_MIN_SX2(XT_MAX_SX2(d_min, d_acc3), d_max);
 
 #pragma no_unroll
             for(i = 0; i < XT_MIN(out_channels-itr_ch, 4); i++)
@@ -401,6 +442,7 @@ static inline void conv2d_nhwc_f32(
             }
             XT_LASX2IP(d_bias0, bias_a, pt_bias);
             d_acc0 = XT_ADD_SX2(d_acc0, d_bias0);
+            d_acc0 = XT_MIN_SX2(XT_MAX_SX2(d_min, d_acc0), d_max);
 
 #pragma no_unroll
             for(i = 0; i < XT_MIN(out_channels-itr_ch, 2); i++)
@@ -429,6 +471,8 @@ static void xa_nn_conv2d_depthwise_nhwc_f32(
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         WORD32  out_data_format,
         pVOID p_scratch)
 {
@@ -513,11 +557,13 @@ static void xa_nn_conv2d_depthwise_nhwc_f32(
                 out_width,
                 (input_channels * channels_multiplier),
                 x_stride,
-                y_stride);
+                y_stride,
+                out_activation_min,
+                out_activation_max);
     }
 }
 
-WORD32 xa_nn_conv2d_depthwise_f32(
+WORD32 xa_nn_conv2d_depthwise_f32_act(
         FLOAT32* __restrict__ p_out,
         const FLOAT32* __restrict__ p_kernel,
         const FLOAT32* __restrict__ p_inp,
@@ -534,6 +580,8 @@ WORD32 xa_nn_conv2d_depthwise_f32(
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         WORD32  inp_data_format,
         WORD32  out_data_format,
         pVOID p_scratch)
@@ -560,6 +608,7 @@ WORD32 xa_nn_conv2d_depthwise_f32(
     XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
     XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_min > out_activation_max), -1);
     XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
     XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
     /* Implementation dependent checks */
@@ -585,6 +634,8 @@ WORD32 xa_nn_conv2d_depthwise_f32(
                 y_padding,
                 out_height,
                 out_width,
+                out_activation_min,
+                out_activation_max,
                 out_data_format,
                 p_scratch);
     }
@@ -607,9 +658,37 @@ WORD32 xa_nn_conv2d_depthwise_f32(
                 y_padding,
                 out_height,
                 out_width,
+                out_activation_min,
+                out_activation_max,
                 out_data_format,
                 p_scratch);
     }
     return 0;
 }
+WORD32 xa_nn_conv2d_depthwise_f32(
+        FLOAT32* __restrict__ p_out,
+        const FLOAT32* __restrict__ p_kernel,
+        const FLOAT32* __restrict__ p_inp,
+        const FLOAT32* __restrict__ p_bias,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  channels_multiplier,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        pVOID p_scratch)
+{
+    return xa_nn_conv2d_depthwise_f32_act(p_out, p_kernel, p_inp, p_bias,
+        input_height, input_width, input_channels, kernel_height, kernel_width,
+        channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+        -INFINITY, INFINITY, inp_data_format, out_data_format, p_scratch);
+}
 #endif /* #if !HAVE_VFPU */
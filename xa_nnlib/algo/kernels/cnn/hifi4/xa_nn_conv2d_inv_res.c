@@ -0,0 +1,167 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_inv_res_state.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+#define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
+
+/* Scratch is laid out as depthwise scratch, expanded rows and depthwise
+ * output, each part starting ALIGNMENT aligned. The projection stores straight
+ * to the output, the residual add is done in its store. */
+static WORD32 xa_nn_conv2d_inv_res_part_sizes
+(WORD32 *p_size
+ ,WORD32 *p_max_rows
+ ,WORD32 *p_max_inp_rows
+ ,WORD32 input_width
+ ,WORD32 expand_channels
+ ,WORD32 out_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 out_height
+ ,WORD32 out_width
+ ,WORD32 precision
+ )
+{
+    WORD32 bytewidth;
+    WORD32 max_rows, max_inp_rows;
+
+    switch (precision)
+    {
+        case -1: /* For f32 */
+            bytewidth = sizeof(FLOAT32);
+            break;
+        case -3: /* For asym8 */
+            bytewidth = sizeof(UWORD8);
+            break;
+        default:
+            return -1;
+    }
+
+    max_rows = (out_height < INV_RES_BAND_ROWS) ? out_height : INV_RES_BAND_ROWS;
+    max_inp_rows = (max_rows - 1) * y_stride + kernel_height;
+
+    p_size[0] = xa_nn_conv2d_depthwise_getsize
+        (max_inp_rows
+         ,input_width
+         ,expand_channels
+         ,kernel_height
+         ,kernel_width
+         ,1
+         ,x_stride
+         ,y_stride
+         ,x_padding
+         ,0
+         ,max_rows
+         ,out_width
+         ,precision
+         ,0
+        );
+    if (0 > p_size[0])
+    {
+        return -1;
+    }
+    p_size[0] = ALIGNED_SIZE(p_size[0], ALIGNMENT);
+    p_size[1] = ALIGNED_SIZE(max_inp_rows * input_width * expand_channels * bytewidth, ALIGNMENT);
+    p_size[2] = ALIGNED_SIZE(max_rows * out_width * expand_channels * bytewidth, ALIGNMENT);
+
+    *p_max_rows = max_rows;
+    *p_max_inp_rows = max_inp_rows;
+    return 0;
+}
+
+WORD32 xa_nn_conv2d_inv_res_getsize
+(WORD32 input_width
+ ,WORD32 expand_channels
+ ,WORD32 out_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 out_height
+ ,WORD32 out_width
+ ,WORD32 precision
+ )
+{
+    XA_NNLIB_CHK_COND((input_width <= 0), -1);
+    XA_NNLIB_CHK_COND((expand_channels <= 0), -1);
+    XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+    XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_CHK_COND((x_stride <= 0 || y_stride <= 0), -1);
+    XA_NNLIB_CHK_COND((x_padding < 0), -1);
+    XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+
+    WORD32 size[3];
+    WORD32 max_rows, max_inp_rows;
+
+    if (0 != xa_nn_conv2d_inv_res_part_sizes(size, &max_rows, &max_inp_rows
+                ,input_width, expand_channels, out_channels
+                ,kernel_height, kernel_width, x_stride, y_stride, x_padding
+                ,out_height, out_width, precision))
+    {
+        return -1;
+    }
+
+    return size[0] + size[1] + size[2];
+}
+
+WORD32 xa_nn_conv2d_inv_res_init
+(xa_nn_inv_res_band_t *p_band
+ ,pVOID p_scratch
+ ,WORD32 input_width
+ ,WORD32 expand_channels
+ ,WORD32 out_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 out_height
+ ,WORD32 out_width
+ ,WORD32 precision
+ )
+{
+    WORD32 size[3];
+    pWORD8 p_mem = (pWORD8)p_scratch;
+
+    if (0 != xa_nn_conv2d_inv_res_part_sizes(size, &p_band->max_rows, &p_band->max_inp_rows
+                ,input_width, expand_channels, out_channels
+                ,kernel_height, kernel_width, x_stride, y_stride, x_padding
+                ,out_height, out_width, precision))
+    {
+        return -1;
+    }
+
+    p_band->p_dw_scratch = p_mem;
+    p_mem += size[0];
+    p_band->p_expand = p_mem;
+    p_mem += size[1];
+    p_band->p_dw_out = p_mem;
+
+    return 0;
+}
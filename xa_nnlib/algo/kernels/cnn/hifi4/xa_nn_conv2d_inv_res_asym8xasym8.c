@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_inv_res_state.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+WORD32 xa_nn_conv2d_inv_res_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    const UWORD8* __restrict__ p_expand_kernel,
+    const WORD32* __restrict__ p_expand_bias,
+    const UWORD8* __restrict__ p_dw_kernel,
+    const WORD32* __restrict__ p_dw_bias,
+    const UWORD8* __restrict__ p_project_kernel,
+    const WORD32* __restrict__ p_project_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  expand_channels,
+    WORD32  out_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    const xa_nn_inv_res_stage_asym8_t *p_expand,
+    const xa_nn_inv_res_stage_asym8_t *p_dw,
+    const xa_nn_inv_res_stage_asym8_t *p_project,
+    const xa_nn_inv_res_residual_asym8_t *p_residual,
+    pVOID p_scratch)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_dw_kernel, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_dw_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_project_kernel, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_project_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_dw, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_project, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    if(p_expand_kernel != NULL)
+    {
+        XA_NNLIB_ARG_CHK_PTR(p_expand_bias, -1);
+        XA_NNLIB_ARG_CHK_PTR(p_expand, -1);
+        XA_NNLIB_ARG_CHK_ALIGN(p_expand_kernel, (ALIGNMENT>>1), -1);
+    }
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_dw_kernel, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_project_kernel, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0 || expand_channels <= 0 || out_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_zero_bias > 0 || input_zero_bias < -255), -1);
+    XA_NNLIB_ARG_CHK_COND((p_expand_kernel == NULL && expand_channels != input_channels), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((input_channels&3) != 0 || (expand_channels&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
+    XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+    /* Residual add needs the block to preserve the input shape */
+    XA_NNLIB_ARG_CHK_COND((p_residual != NULL &&
+                (x_stride != 1 || y_stride != 1 ||
+                 out_height != input_height || out_width != input_width ||
+                 out_channels != input_channels)), -1);
+
+    xa_nn_inv_res_band_t band;
+    WORD32 ret;
+
+    ret = xa_nn_conv2d_inv_res_init(&band
+            ,p_scratch
+            ,input_width
+            ,expand_channels
+            ,out_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,out_height
+            ,out_width
+            ,-3
+            );
+    if(ret < 0)
+        return ret;
+
+    UWORD8 *p_exp_rows = (UWORD8 *)band.p_expand;
+    UWORD8 *p_dw_out = (UWORD8 *)band.p_dw_out;
+    WORD32 row_size = input_width * expand_channels;
+    /* Rows above and below the input hold the zero point of the expanded tensor */
+    WORD32 pad_val = (p_expand_kernel != NULL) ? p_expand->out_zero_bias : -input_zero_bias;
+    WORD32 prev_first = 0, prev_rows = 0;
+    WORD32 out_row;
+
+    for(out_row = 0; out_row < out_height; out_row += band.max_rows)
+    {
+        WORD32 rows = XT_MIN(band.max_rows, out_height - out_row);
+        WORD32 band_inp_rows = (rows - 1) * y_stride + kernel_height;
+        /* Input row held in expanded row 0 of this band, negative inside top padding */
+        WORD32 first = out_row * y_stride - y_padding;
+        WORD32 row = 0, valid_start, valid_end;
+        UWORD8 *p_band_out;
+
+        /* Rows shared with the previous band are already expanded */
+        if(prev_rows > 0 && prev_first + prev_rows > first)
+        {
+            row = prev_first + prev_rows - first;
+            memmove(p_exp_rows, p_exp_rows + (first - prev_first) * row_size, row * row_size);
+        }
+
+        valid_start = XT_MIN(XT_MAX(row, -first), band_inp_rows);
+        valid_end = XT_MAX(XT_MIN(band_inp_rows, input_height - first), valid_start);
+
+        if(valid_start > row)
+        {
+            memset(p_exp_rows + row * row_size, pad_val, (valid_start - row) * row_size);
+        }
+        if(valid_end > valid_start)
+        {
+            const UWORD8 *p_src = p_inp + (first + valid_start) * input_width * input_channels;
+            UWORD8 *p_dst = p_exp_rows + valid_start * row_size;
+            if(p_expand_kernel != NULL)
+            {
+                ret = xa_nn_matmul_asym8xasym8_asym8
+                    (p_dst
+                     ,p_expand_kernel
+                     ,p_src
+                     ,p_expand_bias
+                     ,expand_channels
+                     ,input_channels
+                     ,input_channels
+                     ,(valid_end - valid_start) * input_width
+                     ,input_channels
+                     ,expand_channels
+                     ,1
+                     ,p_expand->kernel_zero_bias
+                     ,input_zero_bias
+                     ,p_expand->out_multiplier
+                     ,p_expand->out_shift
+                     ,p_expand->out_zero_bias
+                     ,p_expand->out_activation_min
+                     ,p_expand->out_activation_max
+                    );
+                if(ret < 0)
+                    return ret;
+            }
+            else
+            {
+                memcpy(p_dst, p_src, (valid_end - valid_start) * row_size);
+            }
+        }
+        if(band_inp_rows > valid_end)
+        {
+            memset(p_exp_rows + valid_end * row_size, pad_val, (band_inp_rows - valid_end) * row_size);
+        }
+
+        /* Depthwise activation is applied in the depthwise store */
+        ret = xa_nn_conv2d_depthwise_asym8xasym8_act
+            (p_dw_out
+             ,p_dw_kernel
+             ,p_exp_rows
+             ,p_dw_bias
+             ,band_inp_rows
+             ,input_width
+             ,expand_channels
+             ,kernel_height
+             ,kernel_width
+             ,1
+             ,x_stride
+             ,y_stride
+             ,x_padding
+             ,0
+             ,rows
+             ,out_width
+             ,-pad_val
+             ,p_dw->kernel_zero_bias
+             ,p_dw->out_multiplier
+             ,p_dw->out_shift
+             ,p_dw->out_zero_bias
+             ,p_dw->out_activation_min
+             ,p_dw->out_activation_max
+             ,0
+             ,0
+             ,band.p_dw_scratch
+            );
+        if(ret < 0)
+            return ret;
+
+        p_band_out = p_out + out_row * out_width * out_channels;
+        if(p_residual != NULL)
+        {
+            /* Residual add is done in the projection store */
+            ret = xa_nn_matmul_asym8xasym8_asym8_residual
+                (p_band_out
+                 ,p_project_kernel
+                 ,p_dw_out
+                 ,p_project_bias
+                 ,out_channels
+                 ,expand_channels
+                 ,expand_channels
+                 ,rows * out_width
+                 ,expand_channels
+                 ,out_channels
+                 ,1
+                 ,p_project->kernel_zero_bias
+                 ,-p_dw->out_zero_bias
+                 ,p_project->out_multiplier
+                 ,p_project->out_shift
+                 ,p_project->out_zero_bias
+                 ,p_project->out_activation_min
+                 ,p_project->out_activation_max
+                 ,p_inp + out_row * input_width * input_channels
+                 ,input_zero_bias
+                 ,p_residual
+                );
+        }
+        else
+        {
+            ret = xa_nn_matmul_asym8xasym8_asym8
+                (p_band_out
+                 ,p_project_kernel
+                 ,p_dw_out
+                 ,p_project_bias
+                 ,out_channels
+                 ,expand_channels
+                 ,expand_channels
+                 ,rows * out_width
+                 ,expand_channels
+                 ,out_channels
+                 ,1
+                 ,p_project->kernel_zero_bias
+                 ,-p_dw->out_zero_bias
+                 ,p_project->out_multiplier
+                 ,p_project->out_shift
+                 ,p_project->out_zero_bias
+                 ,p_project->out_activation_min
+                 ,p_project->out_activation_max
+                );
+        }
+        if(ret < 0)
+            return ret;
+
+        prev_first = first;
+        prev_rows = band_inp_rows;
+    }
+
+    return 0;
+}
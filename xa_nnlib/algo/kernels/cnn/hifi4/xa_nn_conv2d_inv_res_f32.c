@@ -0,0 +1,292 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "common_fpu.h"
+#include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_inv_res_state.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_inv_res_f32,(
+            FLOAT32* __restrict__ p_out,
+            const FLOAT32* __restrict__ p_inp,
+            const FLOAT32* __restrict__ p_expand_kernel,
+            const FLOAT32* __restrict__ p_expand_bias,
+            const FLOAT32* __restrict__ p_dw_kernel,
+            const FLOAT32* __restrict__ p_dw_bias,
+            const FLOAT32* __restrict__ p_project_kernel,
+            const FLOAT32* __restrict__ p_project_bias,
+            WORD32  input_height,
+            WORD32  input_width,
+            WORD32  input_channels,
+            WORD32  expand_channels,
+            WORD32  out_channels,
+            WORD32  kernel_height,
+            WORD32  kernel_width,
+            WORD32  x_stride,
+            WORD32  y_stride,
+            WORD32  x_padding,
+            WORD32  y_padding,
+            WORD32  out_height,
+            WORD32  out_width,
+            FLOAT32 expand_activation_min,
+            FLOAT32 expand_activation_max,
+            FLOAT32 dw_activation_min,
+            FLOAT32 dw_activation_max,
+            WORD32  residual,
+            pVOID p_scratch))
+#else /* #if !HAVE_VFPU */
+WORD32 xa_nn_conv2d_inv_res_f32(
+        FLOAT32* __restrict__ p_out,
+        const FLOAT32* __restrict__ p_inp,
+        const FLOAT32* __restrict__ p_expand_kernel,
+        const FLOAT32* __restrict__ p_expand_bias,
+        const FLOAT32* __restrict__ p_dw_kernel,
+        const FLOAT32* __restrict__ p_dw_bias,
+        const FLOAT32* __restrict__ p_project_kernel,
+        const FLOAT32* __restrict__ p_project_bias,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  expand_channels,
+        WORD32  out_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        FLOAT32 expand_activation_min,
+        FLOAT32 expand_activation_max,
+        FLOAT32 dw_activation_min,
+        FLOAT32 dw_activation_max,
+        WORD32  residual,
+        pVOID p_scratch)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_dw_kernel, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_dw_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_project_kernel, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_project_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    if(p_expand_kernel != NULL)
+    {
+        XA_NNLIB_ARG_CHK_PTR(p_expand_bias, -1);
+        XA_NNLIB_ARG_CHK_ALIGN(p_expand_kernel, ALIGNMENT, -1);
+    }
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_dw_kernel, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_project_kernel, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0 || expand_channels <= 0 || out_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((expand_activation_min > expand_activation_max), -1);
+    XA_NNLIB_ARG_CHK_COND((dw_activation_min > dw_activation_max), -1);
+    XA_NNLIB_ARG_CHK_COND((p_expand_kernel == NULL && expand_channels != input_channels), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((input_channels&3) != 0 || (expand_channels&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
+    XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+    /* Residual add needs the block to preserve the input shape */
+    XA_NNLIB_ARG_CHK_COND((residual != 0 &&
+                (x_stride != 1 || y_stride != 1 ||
+                 out_height != input_height || out_width != input_width ||
+                 out_channels != input_channels)), -1);
+
+    xa_nn_inv_res_band_t band;
+    WORD32 ret;
+
+    ret = xa_nn_conv2d_inv_res_init(&band
+            ,p_scratch
+            ,input_width
+            ,expand_channels
+            ,out_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,out_height
+            ,out_width
+            ,-1
+            );
+    if(ret < 0)
+        return ret;
+
+    FLOAT32 *p_exp_rows = (FLOAT32 *)band.p_expand;
+    FLOAT32 *p_dw_out = (FLOAT32 *)band.p_dw_out;
+    WORD32 row_size = input_width * expand_channels;
+    WORD32 prev_first = 0, prev_rows = 0;
+    WORD32 out_row;
+
+    for(out_row = 0; out_row < out_height; out_row += band.max_rows)
+    {
+        WORD32 rows = XT_MIN(band.max_rows, out_height - out_row);
+        WORD32 band_inp_rows = (rows - 1) * y_stride + kernel_height;
+        /* Input row held in expanded row 0 of this band, negative inside top padding */
+        WORD32 first = out_row * y_stride - y_padding;
+        WORD32 row = 0, valid_start, valid_end;
+        FLOAT32 *p_band_out;
+
+        /* Rows shared with the previous band are already expanded */
+        if(prev_rows > 0 && prev_first + prev_rows > first)
+        {
+            row = prev_first + prev_rows - first;
+            memmove(p_exp_rows, p_exp_rows + (first - prev_first) * row_size, row * row_size * sizeof(FLOAT32));
+        }
+
+        valid_start = XT_MIN(XT_MAX(row, -first), band_inp_rows);
+        valid_end = XT_MAX(XT_MIN(band_inp_rows, input_height - first), valid_start);
+
+        /* Padding rows are zero after the expand activation */
+        if(valid_start > row)
+        {
+            memset(p_exp_rows + row * row_size, 0, (valid_start - row) * row_size * sizeof(FLOAT32));
+        }
+        if(valid_end > valid_start)
+        {
+            const FLOAT32 *p_src = p_inp + (first + valid_start) * input_width * input_channels;
+            FLOAT32 *p_dst = p_exp_rows + valid_start * row_size;
+            WORD32 num_pix = (valid_end - valid_start) * input_width;
+            if(p_expand_kernel != NULL)
+            {
+                ret = xa_nn_matmul_f32xf32_f32
+                    (p_dst
+                     ,p_expand_kernel
+                     ,p_src
+                     ,p_expand_bias
+                     ,expand_channels
+                     ,input_channels
+                     ,input_channels
+                     ,num_pix
+                     ,input_channels
+                     ,expand_channels
+                     ,1
+                    );
+                if(ret < 0)
+                    return ret;
+                ret = xa_nn_vec_activation_min_max_f32_f32
+                    (p_dst
+                     ,p_dst
+                     ,expand_activation_min
+                     ,expand_activation_max
+                     ,num_pix * expand_channels
+                    );
+                if(ret < 0)
+                    return ret;
+            }
+            else
+            {
+                memcpy(p_dst, p_src, num_pix * expand_channels * sizeof(FLOAT32));
+            }
+        }
+        if(band_inp_rows > valid_end)
+        {
+            memset(p_exp_rows + valid_end * row_size, 0, (band_inp_rows - valid_end) * row_size * sizeof(FLOAT32));
+        }
+
+        /* Depthwise activation is applied in the depthwise store */
+        ret = xa_nn_conv2d_depthwise_f32_act
+            (p_dw_out
+             ,p_dw_kernel
+             ,p_exp_rows
+             ,p_dw_bias
+             ,band_inp_rows
+             ,input_width
+             ,expand_channels
+             ,kernel_height
+             ,kernel_width
+             ,1
+             ,x_stride
+             ,y_stride
+             ,x_padding
+             ,0
+             ,rows
+             ,out_width
+             ,dw_activation_min
+             ,dw_activation_max
+             ,0
+             ,0
+             ,band.p_dw_scratch
+            );
+        if(ret < 0)
+            return ret;
+
+        /* Projection is linear, the residual add is done in its store */
+        p_band_out = p_out + out_row * out_width * out_channels;
+        if(residual != 0)
+        {
+            ret = xa_nn_matmul_f32xf32_f32_residual
+                (p_band_out
+                 ,p_project_kernel
+                 ,p_dw_out
+                 ,p_project_bias
+                 ,out_channels
+                 ,expand_channels
+                 ,expand_channels
+                 ,rows * out_width
+                 ,expand_channels
+                 ,out_channels
+                 ,1
+                 ,p_inp + out_row * input_width * input_channels
+                );
+        }
+        else
+        {
+            ret = xa_nn_matmul_f32xf32_f32
+                (p_band_out
+                 ,p_project_kernel
+                 ,p_dw_out
+                 ,p_project_bias
+                 ,out_channels
+                 ,expand_channels
+                 ,expand_channels
+                 ,rows * out_width
+                 ,expand_channels
+                 ,out_channels
+                 ,1
+                );
+        }
+        if(ret < 0)
+            return ret;
+
+        prev_first = first;
+        prev_rows = band_inp_rows;
+    }
+
+    return 0;
+}
+#endif /* #if !HAVE_VFPU */
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NN_CONV2D_INV_RES_STATE_H__
+#define __XA_NN_CONV2D_INV_RES_STATE_H__
+
+/* Output rows produced per band. Only the expanded rows feeding one band are
+ * kept in scratch, the full expanded tensor is never materialized. */
+#define INV_RES_BAND_ROWS 4
+
+typedef struct _xa_nn_inv_res_band_t
+{
+    pVOID p_dw_scratch;     /* depthwise scratch for one band */
+    pVOID p_expand;         /* expanded rows: max_inp_rows x input_width x expand_channels */
+    pVOID p_dw_out;         /* depthwise output: max_rows x out_width x expand_channels */
+    WORD32 max_rows;        /* output rows per band */
+    WORD32 max_inp_rows;    /* input rows needed for max_rows output rows */
+} xa_nn_inv_res_band_t;
+
+WORD32 xa_nn_conv2d_inv_res_init
+(xa_nn_inv_res_band_t *p_band
+ ,pVOID p_scratch
+ ,WORD32 input_width
+ ,WORD32 expand_channels
+ ,WORD32 out_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 out_height
+ ,WORD32 out_width
+ ,WORD32 precision
+ );
+
+#endif /* #ifndef __XA_NN_CONV2D_INV_RES_STATE_H__ */
@@ -56,71 +56,30 @@ WORD32 xa_nn_conv2d_pointwise_8x8
   XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  XA_NNLIB_ARG_CHK_COND((out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
   /* Implementation dependent checks */
   XA_NNLIB_ARG_CHK_COND(((input_channels&3) != 0), -1);
 
-  int itr_oc = 0;
-  int itr_rppi = 0;
-  int itr_row = 0;
-  int total_rows = 0;
-  int trailing_loop_rows = 0;
+  /* Kernel rows are the output channels, every pixel of the input is one
+     vector, so each loaded kernel row is reused across a block of pixels
+     and each pixel across a block of output channels */
+  WORD32 out_plane_size = input_height * input_width;
+  WORD32 out_offset = (out_data_format == 0) ? out_channels : 1;
+  WORD32 out_stride = (out_data_format == 0) ? 1 : out_plane_size;
 
-#define ROWS_PROCESSED_PER_ITR 32
-
-  /* A local array to copy a bias value */
-  WORD8 bias[ROWS_PROCESSED_PER_ITR];
-
-  total_rows = (input_height * input_width);
-  trailing_loop_rows = (total_rows % ROWS_PROCESSED_PER_ITR);
-
-  for (itr_oc = 0; itr_oc < out_channels; itr_oc++)
-  {
-    for (itr_rppi = 0; itr_rppi < ROWS_PROCESSED_PER_ITR; itr_rppi++)
-    {
-      bias[itr_rppi] = p_bias[itr_oc];
-    }
-
-    for (itr_row = 0; itr_row < (total_rows - trailing_loop_rows); itr_row += ROWS_PROCESSED_PER_ITR)
-    {
-      xa_nn_matXvec_8x8_8
-        (&p_out[(itr_oc * input_height * input_width) + itr_row]
-         ,&p_inp[itr_row * input_channels]
-         ,NULL
-         ,&p_kernel[itr_oc * input_channels]
-         ,NULL
-         ,bias
-         ,ROWS_PROCESSED_PER_ITR
-         ,input_channels
-         ,0
-         ,input_channels
-         ,0
-         ,acc_shift
-         ,bias_shift
-        );
-    }
-    /* Traling loop */
-    if (trailing_loop_rows)
-    {
-      xa_nn_matXvec_8x8_8
-        (&p_out[(itr_oc * input_height * input_width) + (total_rows - trailing_loop_rows)]
-         ,&p_inp[(total_rows - trailing_loop_rows) * input_channels]
-         ,NULL
-         ,&p_kernel[itr_oc * input_channels]
-         ,NULL
-         ,bias
-         ,trailing_loop_rows
-         ,input_channels
-         ,0
-         ,input_channels
-         ,0
-         ,acc_shift
-         ,bias_shift
-        );
-    }
-  }
-
-#undef ROWS_PROCESSED_PER_ITR
-
-  return 0;
+  return xa_nn_matmul_8x8_8
+    (p_out
+     ,p_kernel
+     ,p_inp
+     ,p_bias
+     ,out_channels
+     ,input_channels
+     ,input_channels
+     ,acc_shift
+     ,bias_shift
+     ,out_plane_size
+     ,input_channels
+     ,out_offset
+     ,out_stride
+    );
 }
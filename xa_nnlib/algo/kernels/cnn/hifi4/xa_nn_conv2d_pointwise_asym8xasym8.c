@@ -27,7 +27,7 @@
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
 
-WORD32 xa_nn_conv2d_pointwise_asym8xasym8(
+WORD32 xa_nn_conv2d_pointwise_asym8xasym8_act(
     UWORD8* __restrict__ p_out,
     UWORD8* __restrict__ p_kernel,
     UWORD8* __restrict__ p_inp,
@@ -41,6 +41,8 @@ WORD32 xa_nn_conv2d_pointwise_asym8xasym8(
     WORD32  out_multiplier,
     WORD32  out_shift,
     WORD32  out_zero_bias,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
     WORD32  out_data_format)
 {
     /* NULL pointer checks */
@@ -60,67 +62,57 @@ WORD32 xa_nn_conv2d_pointwise_asym8xasym8(
     XA_NNLIB_ARG_CHK_COND((kernel_zero_bias < -255 || kernel_zero_bias > 0), -1);
     XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
     XA_NNLIB_ARG_CHK_COND((out_zero_bias > 255 || out_zero_bias < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_min < 0 || out_activation_min > out_activation_max || out_activation_max > 255), -1);
     XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
     /* Implementation dependent checks */
     XA_NNLIB_ARG_CHK_COND(((input_channels&3) != 0), -1);
 
-#define ROWS_PROCESSED_PER_ITR    32
-    UWORD8 *pt_out[1], *pt_vec[1], *pt_inp;
-    WORD32 pt_bias[ROWS_PROCESSED_PER_ITR];
-    int i, j, ret, out_plane_size;
-    out_plane_size = input_height*input_width;
-    for(i = 0; i < out_channels; i++)
-    {
-        ae_int32x2 *ptx2_bias = (ae_int32x2 *)pt_bias;
-        ae_int32x2 bias_val = AE_MOVDA32(p_bias[i]);
-        for(j = 0; j < (ROWS_PROCESSED_PER_ITR>>1); j++)
-        {
-            ptx2_bias[j] = bias_val;
-        }
-        pt_vec[0] = &p_kernel[i*input_channels];
-        for(j = 0; j < (out_plane_size&(~(ROWS_PROCESSED_PER_ITR-1))); j+= ROWS_PROCESSED_PER_ITR)
-        {
-            pt_inp = &p_inp[j*input_channels];
-            pt_out[0] = &p_out[i*input_height*input_width+j];
-            ret = xa_nn_matXvec_batch_asym8xasym8_asym8(pt_out
-                                                       ,pt_inp
-                                                       ,pt_vec
-                                                       ,pt_bias
-                                                       ,ROWS_PROCESSED_PER_ITR
-                                                       ,input_channels
-                                                       ,input_channels
-                                                       ,1
-                                                       ,input_zero_bias
-                                                       ,kernel_zero_bias
-                                                       ,out_multiplier
-                                                       ,out_shift
-                                                       ,out_zero_bias
-                                                       );
-            if(ret<0)
-                return ret;
-        }
-        if(j < out_plane_size)
-        {
-            pt_inp = &p_inp[j*input_channels];
-            pt_out[0] = &p_out[i*input_height*input_width+j];
-            ret = xa_nn_matXvec_batch_asym8xasym8_asym8(pt_out
-                                                       ,pt_inp
-                                                       ,pt_vec
-                                                       ,pt_bias
-                                                       ,(input_height*input_width-j)
-                                                       ,input_channels
-                                                       ,input_channels
-                                                       ,1
-                                                       ,input_zero_bias
-                                                       ,kernel_zero_bias
-                                                       ,out_multiplier
-                                                       ,out_shift
-                                                       ,out_zero_bias
-                                                       );
-            if(ret<0)
-                return ret;
-        }
-    }
-    return 0;
+    /* Output channels x pixels through the blocked matmul, requantization
+       and the activation clamp happen before each tile is stored */
+    WORD32 out_plane_size = input_height*input_width;
+    WORD32 out_offset = (out_data_format == 0) ? out_channels : 1;
+    WORD32 out_stride = (out_data_format == 0) ? 1 : out_plane_size;
+
+    return xa_nn_matmul_asym8xasym8_asym8(p_out
+                                          ,p_kernel
+                                          ,p_inp
+                                          ,p_bias
+                                          ,out_channels
+                                          ,input_channels
+                                          ,input_channels
+                                          ,out_plane_size
+                                          ,input_channels
+                                          ,out_offset
+                                          ,out_stride
+                                          ,kernel_zero_bias
+                                          ,input_zero_bias
+                                          ,out_multiplier
+                                          ,out_shift
+                                          ,out_zero_bias
+                                          ,out_activation_min
+                                          ,out_activation_max
+                                          );
 }
+
+WORD32 xa_nn_conv2d_pointwise_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    UWORD8* __restrict__ p_kernel,
+    UWORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32  kernel_zero_bias,
+    WORD32  out_multiplier,
+    WORD32  out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format)
+{
+    return xa_nn_conv2d_pointwise_asym8xasym8_act(p_out, p_kernel, p_inp, p_bias,
+        input_height, input_width, input_channels, out_channels,
+        input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias,
+        0, 255, out_data_format);
+}
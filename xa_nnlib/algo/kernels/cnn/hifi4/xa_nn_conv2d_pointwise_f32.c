@@ -64,57 +64,26 @@ WORD32 xa_nn_conv2d_pointwise_f32(
     XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
     /* Implementation dependent checks */
     XA_NNLIB_ARG_CHK_COND(((input_channels&3) != 0), -1);
 
-#define ROWS_PROCESSED_PER_ITR    32
-    FLOAT32 *pt_out[1], *pt_vec[1], *pt_inp;
-    FLOAT32 pt_bias[ROWS_PROCESSED_PER_ITR];
-    int i, j, ret, out_plane_size;
-    out_plane_size = input_height*input_width;
-    for(i = 0; i < out_channels; i++)
-    {
-        xtfloatx2 *ptx2_bias = (xtfloatx2 *)pt_bias;
-        xtfloatx2 bias_val = p_bias[i];
-        for(j = 0; j < (ROWS_PROCESSED_PER_ITR>>1); j++)
-        {
-            ptx2_bias[j] = bias_val;
-        }
-        pt_vec[0] = &p_kernel[i*input_channels];
-        for(j = 0; j < (out_plane_size&(~(ROWS_PROCESSED_PER_ITR-1))); j+= ROWS_PROCESSED_PER_ITR)
-        {
-            pt_inp = &p_inp[j*input_channels];
-            pt_out[0] = &p_out[i*input_height*input_width+j];
-            ret = xa_nn_matXvec_batch_f32xf32_f32(pt_out
-                                                  ,pt_inp
-                                                  ,pt_vec
-                                                  ,pt_bias
-                                                  ,ROWS_PROCESSED_PER_ITR
-                                                  ,input_channels
-                                                  ,input_channels
-                                                  ,1
-                                                  );
-            if(ret<0)
-                return ret;
-        }
-        if(j < out_plane_size)
-        {
-            pt_inp = &p_inp[j*input_channels];
-            pt_out[0] = &p_out[i*input_height*input_width+j];
-            ret = xa_nn_matXvec_batch_f32xf32_f32(pt_out
-                                                ,pt_inp
-                                                ,pt_vec
-                                                ,pt_bias
-                                                ,(input_height*input_width-j)
-                                                ,input_channels
-                                                ,input_channels
-                                                ,1
-                                                );
-            if(ret<0)
-                return ret;
-        }
-    }
-    return 0;
+    /* Output channels x pixels through the blocked matmul */
+    WORD32 out_plane_size = input_height*input_width;
+    WORD32 out_offset = (out_data_format == 0) ? out_channels : 1;
+    WORD32 out_stride = (out_data_format == 0) ? 1 : out_plane_size;
+
+    return xa_nn_matmul_f32xf32_f32(p_out
+                                    ,p_kernel
+                                    ,p_inp
+                                    ,p_bias
+                                    ,out_channels
+                                    ,input_channels
+                                    ,input_channels
+                                    ,out_plane_size
+                                    ,input_channels
+                                    ,out_offset
+                                    ,out_stride
+                                    );
 }
 #endif /* #if !HAVE_VFPU */
@@ -106,7 +106,7 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad; 
 }
 
-WORD32 xa_nn_conv2d_std_8x8(
+static WORD32 conv2d_std_8x8_channels(
     WORD8* __restrict__ p_out,
     WORD8* __restrict__ p_inp,
     WORD8* __restrict__ p_kernel,
@@ -126,6 +126,8 @@ WORD32 xa_nn_conv2d_std_8x8(
     WORD32 bias_shift,
     WORD32 acc_shift,
     WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
     VOID *p_scratch)
 {
    /* NULL pointer checks */
@@ -153,6 +155,8 @@ WORD32 xa_nn_conv2d_std_8x8(
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channel_start < 0 || (out_channel_start & 3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channel_count <= 0 || out_channel_start + out_channel_count > out_channels), -1);
 
   WORD32 j;
   WORD32 input_bytewidth = 1;
@@ -167,6 +171,11 @@ WORD32 xa_nn_conv2d_std_8x8(
 
   WORD32 x_padding_var = x_padding;
   WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>1));
+
+  /* Output offsets above are for all out_channels, only the requested range is computed */
+  p_kernel += out_channel_start * input_channels_pad * kernel_width * kernel_height;
+  p_bias += out_channel_start;
+  p_out += out_channel_start * out_channels_offset;
   
   // Limit effective bias_shift and acc_shift to [-63 ... 63]
   // +16 to conform with 8bit left shifts of 8bit kernel and input loads
@@ -182,7 +191,7 @@ WORD32 xa_nn_conv2d_std_8x8(
   WORD32 out_width_over_x_pad = 0;
   if(x_padding_var >= kernel_width)
   {
-    out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, bias_shift, acc_shift);
+    out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channel_count, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, bias_shift, acc_shift);
     x_padding_var -= out_width_over_x_pad * x_stride;
   }
   
@@ -194,7 +203,7 @@ WORD32 xa_nn_conv2d_std_8x8(
   x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
   if(x_r_pad >= kernel_width)
   {
-    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, bias_shift, acc_shift);
+    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channel_count, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, bias_shift, acc_shift);
   }
 
 
@@ -230,7 +239,7 @@ WORD32 xa_nn_conv2d_std_8x8(
        ,out_height /* rows */
        ,input_channels_pad * kernel_width * kernel_height /* cols */
        ,input_channels_pad * kernel_width * y_stride/* row_offset */
-       ,out_channels /* vec_count */
+       ,out_channel_count /* vec_count */
        ,input_channels_pad * kernel_width * kernel_height /* vec_offset */
        ,out_channels_offset /* out_col_offset */
        ,out_height_offset /* out_row_offset */
@@ -244,3 +253,67 @@ WORD32 xa_nn_conv2d_std_8x8(
   return 0;
 }
 
+WORD32 xa_nn_conv2d_std_8x8(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_8x8_channels(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels,
+      kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width,
+      bias_shift, acc_shift, out_data_format,
+      0, out_channels, p_scratch);
+}
+
+WORD32 xa_nn_conv2d_std_range_8x8(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_scratch)
+{
+  return conv2d_std_8x8_channels(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels,
+      kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width,
+      bias_shift, acc_shift, out_data_format,
+      out_channel_start, out_channel_count, p_scratch);
+}
+
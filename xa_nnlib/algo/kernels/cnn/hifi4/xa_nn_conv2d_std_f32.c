@@ -46,6 +46,27 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_f32,(
     WORD32 out_width,
     WORD32 out_data_format,
     VOID *p_handle))
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_range_f32,(
+    FLOAT32 *p_out,
+    const FLOAT32 *p_inp,
+    const FLOAT32 *p_kernel,
+    const FLOAT32 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_handle))
 #else /* #if !HAVE_VFPU */
 
 static WORD32 conv_x_left_pad(
@@ -110,7 +131,7 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad; 
 }
 
-WORD32 xa_nn_conv2d_std_f32(
+static WORD32 conv2d_std_f32_channels(
     FLOAT32* __restrict__ p_out,
     const FLOAT32* __restrict__ p_inp,
     const FLOAT32* __restrict__ p_kernel,
@@ -128,6 +149,8 @@ WORD32 xa_nn_conv2d_std_f32(
     WORD32 out_height,
     WORD32 out_width,
     WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
     VOID *p_scratch)
 {
   /* NULL pointer checks */
@@ -153,6 +176,8 @@ WORD32 xa_nn_conv2d_std_f32(
   XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
   XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channel_start < 0 || (out_channel_start & 3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channel_count <= 0 || out_channel_start + out_channel_count > out_channels), -1);
 
   WORD32 j;
   WORD32 input_bytewidth = sizeof(*p_inp);
@@ -168,11 +193,16 @@ WORD32 xa_nn_conv2d_std_f32(
   WORD32 x_padding_var = x_padding;
   WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>2));
 
+  /* Output offsets above are for all out_channels, only the requested range is computed */
+  p_kernel += out_channel_start * input_channels_pad * kernel_width * kernel_height;
+  p_bias += out_channel_start;
+  p_out += out_channel_start * out_channels_offset;
+
   /* When kernel convolves over x-left pad region only */
   WORD32 out_width_over_x_pad = 0;
   if(x_padding_var >= kernel_width)
   {
-    out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
+    out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channel_count, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
     x_padding_var -= out_width_over_x_pad * x_stride;
   }
   
@@ -184,7 +214,7 @@ WORD32 xa_nn_conv2d_std_f32(
   x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
   if(x_r_pad >= kernel_width)
   {
-    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
+    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channel_count, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
   }
 
   /* When kernel convolves over input region */
@@ -218,7 +248,7 @@ WORD32 xa_nn_conv2d_std_f32(
        ,out_height /* rows */
        ,input_channels_pad * kernel_width * kernel_height /* cols */
        ,input_channels_pad * kernel_width * y_stride/* row_offset */
-       ,out_channels /* vec_count */
+       ,out_channel_count /* vec_count */
        ,input_channels_pad * kernel_width * kernel_height /* vec_offset */
        ,out_channels_offset /* out_col_offset */
        ,out_height_offset /* out_row_offset */
@@ -229,5 +259,65 @@ WORD32 xa_nn_conv2d_std_f32(
 
   return 0;
 }
+
+WORD32 xa_nn_conv2d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_f32_channels(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels,
+      kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width,
+      out_data_format,
+      0, out_channels, p_scratch);
+}
+
+WORD32 xa_nn_conv2d_std_range_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_scratch)
+{
+  return conv2d_std_f32_channels(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels,
+      kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width,
+      out_data_format,
+      out_channel_start, out_channel_count, p_scratch);
+}
 #endif /* #if !HAVE_VFPU */
 
@@ -36,6 +36,17 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_f32,
      ,WORD32  out_depth
     )
     )
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_sym8xf32_f32,
+    (FLOAT32 *__restrict__ p_out
+     ,const WORD8 *__restrict__ p_weight
+     ,const FLOAT32 *__restrict__ p_weight_scale
+     ,const FLOAT32 *__restrict__ p_inp
+     ,const FLOAT32 *__restrict__ p_bias
+     ,WORD32  weight_depth
+     ,WORD32  out_depth
+     ,pVOID   p_scratch
+    )
+    )
 #else /* #if !HAVE_VFPU */
 WORD32 xa_nn_fully_connected_f32
   (FLOAT32 *__restrict__ p_out
@@ -75,6 +86,55 @@ WORD32 xa_nn_fully_connected_f32
     );
   return ret;
 }
+
+/* Hybrid fully connected: int8 weights with per output channel scales,
+ * float input quantized on the fly into p_scratch
+ * (xa_nn_matXvec_sym8xf32_f32_getsize(weight_depth, 0) bytes) */
+WORD32 xa_nn_fully_connected_sym8xf32_f32
+  (FLOAT32 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const FLOAT32 *__restrict__ p_weight_scale
+   ,const FLOAT32 *__restrict__ p_inp
+   ,const FLOAT32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,pVOID   p_scratch
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight_scale, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_weight_scale, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sym8xf32_f32
+    (p_out
+     ,p_weight
+     ,0
+     ,p_inp
+     ,0
+     ,p_bias
+     ,p_weight_scale
+     ,0
+     ,out_depth
+     ,weight_depth
+     ,0
+     ,weight_depth
+     ,0
+     ,p_scratch
+    );
+  return ret;
+}
 #endif /* #if !HAVE_VFPU */
 
 WORD32 xa_nn_fully_connected_16x16_16
@@ -149,8 +209,6 @@ WORD32 xa_nn_fully_connected_8x16_16
   XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((weight_depth&3) != 0), -1);
 
   WORD32 ret = 0;
   ret = xa_nn_matXvec_8x16_16
@@ -196,8 +254,6 @@ WORD32 xa_nn_fully_connected_8x8_8
   XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((weight_depth&3) != 0), -1);
 
   WORD32 ret = 0;
   ret = xa_nn_matXvec_8x8_8
@@ -218,6 +274,55 @@ WORD32 xa_nn_fully_connected_8x8_8
   return ret;
 }
 
+/* xa_nn_fully_connected_8x8_8 with the matXvec row unroll picked by the
+   caller, e.g. once at prepare time with xa_nn_matXvec_unroll_select() */
+WORD32 xa_nn_fully_connected_8x8_8_unroll
+  (pWORD8 __restrict__ p_out
+   ,pWORD8  __restrict__ p_weight
+   ,pWORD8 __restrict__ p_inp
+   ,pWORD8 __restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  acc_shift
+   ,WORD32  bias_shift
+   ,WORD32  unroll
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_weight, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_8x8_8_unroll
+    (p_out
+     ,p_weight
+     ,0
+     ,p_inp
+     ,0
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,0
+     ,weight_depth
+     ,0
+     ,acc_shift
+     ,bias_shift
+     ,unroll
+    );
+  return ret;
+}
+
 #ifdef NNLIB_V2
 WORD32 xa_nn_fully_connected_asym8xasym8_asym8
   (UWORD8 *__restrict__ p_out
@@ -281,5 +386,85 @@ WORD32 xa_nn_fully_connected_asym8xasym8_asym8
     );
   return ret;
 }
+
+WORD32 xa_nn_fully_connected_sparse_1x4_8x8_8
+  (pWORD8 __restrict__ p_out
+   ,const WORD8 *__restrict__ p_blk_val
+   ,const UWORD16 *__restrict__ p_blk_col
+   ,const WORD32 *__restrict__ p_row_ptr
+   ,pWORD8 __restrict__ p_inp
+   ,pWORD8 __restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  acc_shift
+   ,WORD32  bias_shift
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sparse_1x4_8x8_8
+    (p_out
+     ,p_blk_val
+     ,p_blk_col
+     ,p_row_ptr
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,acc_shift
+     ,bias_shift
+    );
+  return ret;
+}
+
+WORD32 xa_nn_fully_connected_sparse_1x4_asym8xasym8_asym8
+  (UWORD8 *__restrict__ p_out
+   ,const UWORD8 *__restrict__ p_blk_val
+   ,const UWORD16 *__restrict__ p_blk_col
+   ,const WORD32 *__restrict__ p_row_ptr
+   ,const UWORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sparse_1x4_asym8xasym8_asym8
+    (p_out
+     ,p_blk_val
+     ,p_blk_col
+     ,p_row_ptr
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,weight_zero_bias
+     ,input_zero_bias
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
 #endif /* NNLIB_V2 */
 
@@ -24,6 +24,7 @@
 #include <xa_nnlib_kernels_api.h>
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
 
 WORD32 xa_nn_matXvec_8x16_16(
          WORD16 * __restrict__ p_out,           /* output */         
@@ -56,9 +57,6 @@ WORD32 xa_nn_matXvec_8x16_16(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -69,15 +67,16 @@ WORD32 xa_nn_matXvec_8x16_16(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -94,7 +93,11 @@ WORD32 xa_nn_matXvec_8x16_16(
 
   ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD16, WORD16);
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -212,9 +215,6 @@ WORD32 xa_nn_matXvec_8x16_32(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -225,15 +225,16 @@ WORD32 xa_nn_matXvec_8x16_32(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -250,7 +251,11 @@ WORD32 xa_nn_matXvec_8x16_32(
 
   ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD16, WORD32);
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -368,9 +373,6 @@ WORD32 xa_nn_matXvec_8x16_64(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -381,15 +383,16 @@ WORD32 xa_nn_matXvec_8x16_64(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -404,7 +407,11 @@ WORD32 xa_nn_matXvec_8x16_64(
 #define SETUP_BIAS              SETUP_BIAS_16b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_16b_ACC_FOR_8bx16b
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -526,9 +533,6 @@ WORD32 xa_nn_matXvec_8x16_16_tanh(
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_precision != 16 && bias_precision != 64), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -539,15 +543,16 @@ WORD32 xa_nn_matXvec_8x16_16_tanh(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -569,7 +574,11 @@ WORD32 xa_nn_matXvec_8x16_16_tanh(
       {
 #define SETUP_BIAS              SETUP_BIAS_16b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_16b_ACC_FOR_8bx16b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -647,7 +656,11 @@ WORD32 xa_nn_matXvec_8x16_16_tanh(
       {
 #define SETUP_BIAS              SETUP_BIAS_64b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_64b_ACC_FOR_8bx16b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -774,9 +787,6 @@ WORD32 xa_nn_matXvec_8x16_16_sigmoid(
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_precision != 16 && bias_precision != 64), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -787,15 +797,16 @@ WORD32 xa_nn_matXvec_8x16_16_sigmoid(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -817,7 +828,11 @@ WORD32 xa_nn_matXvec_8x16_16_sigmoid(
       {
 #define SETUP_BIAS              SETUP_BIAS_16b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_16b_ACC_FOR_8bx16b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -895,7 +910,11 @@ WORD32 xa_nn_matXvec_8x16_16_sigmoid(
       {
 #define SETUP_BIAS              SETUP_BIAS_64b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_64b_ACC_FOR_8bx16b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -30,6 +30,7 @@
     #endif
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
 
 /*----------------------------Main function---------------------------------*/
 
@@ -72,9 +73,6 @@ WORD32 xa_nn_matXvec_batch_8x16_64(
     XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
     XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
     /* Iterators used in for loops */
     int m_itr, c_itr, vec_itr;
@@ -98,7 +96,14 @@ WORD32 xa_nn_matXvec_batch_8x16_64(
     #define UNROLL_ROW_STORE_ACC                STORE_ACC_BATCH_ROW_8bx16b_AT_OUT_64b
     #define UNROLL_STORE_ACC_BATCH              STORE_ACC_BATCH_8bx16b_AT_OUT_64b
 
-    if(rows > ROW_UNROLL)
+    if(((cols1 | row_stride1) & 3) != 0)
+    {
+        /* Rows that are not 4 byte aligned or not a multiple of 4 long,
+           4 rows at a time against every vector with unaligned loads */
+        MATXVEC_BATCH_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_16b, MAC_ROW_UNALIGNED_8b_16b,
+                                     MATXVEC_VEC_BATCH, MATXVEC_NO_ADJUST);
+    }
+    else if(rows > ROW_UNROLL)
     {
         if(vec_count > VEC_UNROLL)
         {
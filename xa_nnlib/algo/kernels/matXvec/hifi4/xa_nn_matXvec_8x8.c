@@ -24,6 +24,7 @@
 #include <xa_nnlib_kernels_api.h>
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
 
 WORD32 xa_nn_matXvec_8x8_8(
          WORD8 * __restrict__ p_out,           /* output */         
@@ -54,9 +55,6 @@ WORD32 xa_nn_matXvec_8x8_8(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -67,15 +65,16 @@ WORD32 xa_nn_matXvec_8x8_8(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
@@ -93,7 +92,11 @@ WORD32 xa_nn_matXvec_8x8_8(
 
   ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD16);
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -209,9 +212,6 @@ WORD32 xa_nn_matXvec_8x8_16(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -222,15 +222,16 @@ WORD32 xa_nn_matXvec_8x8_16(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -247,7 +248,11 @@ WORD32 xa_nn_matXvec_8x8_16(
 
   ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD16);
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -363,9 +368,6 @@ WORD32 xa_nn_matXvec_8x8_32(
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -376,15 +378,16 @@ WORD32 xa_nn_matXvec_8x8_32(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -401,7 +404,11 @@ WORD32 xa_nn_matXvec_8x8_32(
 
   ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD32);
 
-  if (p_mat2 && p_vec2)
+  if(unaligned_rows)
+  {
+    MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+  }
+  else if (p_mat2 && p_vec2)
   {
     /* All four pointers are non-null */
     SETUP_BIAS;
@@ -523,9 +530,6 @@ WORD32 xa_nn_matXvec_8x8_8_tanh(
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_precision != 8 && bias_precision != 32), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -536,15 +540,16 @@ WORD32 xa_nn_matXvec_8x8_8_tanh(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -566,7 +571,11 @@ WORD32 xa_nn_matXvec_8x8_8_tanh(
       {
 #define SETUP_BIAS              SETUP_BIAS_8b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_8b_ACC_FOR_8bx8b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -644,7 +653,11 @@ WORD32 xa_nn_matXvec_8x8_8_tanh(
       {
 #define SETUP_BIAS              SETUP_BIAS_32b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_32b_ACC_FOR_8bx8b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -771,9 +784,6 @@ WORD32 xa_nn_matXvec_8x8_8_sigmoid(
   XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((bias_precision != 8 && bias_precision != 32), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   if(p_mat2 != NULL)
   {
@@ -784,15 +794,16 @@ WORD32 xa_nn_matXvec_8x8_8_sigmoid(
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
     XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
-    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
   }
 
   /* Iterators used in for loops */
   int m_itr, c_itr;
   /* Assign initial value so this value will be used in trailing loop */
   m_itr = 0;
+  /* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+     row by row path with unaligned loads */
+  int unaligned_rows = (((cols1 | row_stride1) & 3) != 0) ||
+                       ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0));
 
 #define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
 #define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
@@ -814,7 +825,11 @@ WORD32 xa_nn_matXvec_8x8_8_sigmoid(
       {
 #define SETUP_BIAS              SETUP_BIAS_8b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_8b_ACC_FOR_8bx8b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
@@ -892,7 +907,11 @@ WORD32 xa_nn_matXvec_8x8_8_sigmoid(
       {
 #define SETUP_BIAS              SETUP_BIAS_32b
 #define UNROLL_ADD_BIAS_ACC     ADD_BIAS_32b_ACC_FOR_8bx8b
-        if (p_mat2 && p_vec2)
+        if(unaligned_rows)
+        {
+          MATXVEC_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b);
+        }
+        else if (p_mat2 && p_vec2)
         {
           /* All four pointers are non-null */
           SETUP_BIAS;
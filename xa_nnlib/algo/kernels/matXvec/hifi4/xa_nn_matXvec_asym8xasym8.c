@@ -32,6 +32,7 @@
 
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
 
 WORD32 xa_nn_matXvec_asym8xasym8_asym8(
     UWORD8 * __restrict__ p_out,
@@ -210,56 +211,6 @@ WORD32 xa_nn_matXvec_asym8xasym8_asym8(
     inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
     inp = AE_ROUND32X2F64SSYM(AE_SRAA64(AE_CVT64F32_H(inp), right_shift), AE_SRAA64(AE_CVT64F32_L(inp), right_shift));
 
-#define PRIME_8X4F(p_char, tmp) \
-    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
-    rs_##p_char = 0; \
-    ls_##p_char = 64; \
-    tmp = AE_ZERO16(); \
-    while(((unsigned int)p_char + offset_##p_char) & 3) {\
-        ae_int16x4 tmp2 = AE_MOVDA16(((short)*(p_char+offset_##p_char)) << 8); \
-        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
-        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
-        tmp = AE_OR16(tmp, tmp2); \
-        rs_##p_char += 16;  \
-        ls_##p_char -= 16; \
-        offset_##p_char++; \
-    }\
-    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
-
-#define PRIME_8X4U(p_char, tmp) \
-    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
-    rs_##p_char = 0; \
-    ls_##p_char = 64; \
-    tmp = AE_ZERO16(); \
-    while(((unsigned int)p_char + offset_##p_char) & 3) {\
-        ae_int16x4 tmp2 = AE_MOVDA16(*(((const UWORD8 *)p_char)+offset_##p_char)); \
-        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
-        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
-        tmp = AE_OR16(tmp, tmp2); \
-        rs_##p_char += 16;  \
-        ls_##p_char -= 16; \
-        offset_##p_char++; \
-    }\
-    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
-
-#define AE_LA8X4F_IP(d, a, p) { \
-    ae_int16x4 d_tmp, d_tmp2; \
-    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
-    p += 4; \
-    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p)); \
-    d = AE_OR16(a, d_tmp2); \
-    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p)); \
-}
-
-#define AE_LA8X4U_IP(d, a, p) { \
-    ae_int16x4 d_tmp, d_tmp2; \
-    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
-    p += 4; \
-    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p+8)); \
-    d = AE_OR16(a, d_tmp2); \
-    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p-8)); \
-}
-
     int left_shift, right_shift;
     const WORD8 *p_mat1_0;
     const WORD8 *p_mat1_1;
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
+
+/* As xa_nn_matXvec_asym8xasym8_asym8, but the requantized sum is saturated
+ * to 16 bits instead of being offset by a zero point and clamped to 8 bits.
+ * out_multiplier/out_shift select the fixed point format of the output, e.g.
+ * Q3.12 to feed xa_nn_vec_sigmoid_16_16/xa_nn_vec_tanh_16_16 directly. */
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_ROUND32X2F64SSYM(AE_SRAA64(AE_CVT64F32_H(inp), right_shift), AE_SRAA64(AE_CVT64F32_L(inp), right_shift));
+
+#define SAT16_X2(inp) \
+    inp = AE_MAX32(AE_MIN32(inp, AE_MOVDA32(32767)), AE_MOVDA32(-32768));
+
+/* Accumulates two rows of p_mat times p_vec into d_acc0/d_acc1 */
+static inline void dot2_asym8xasym8(
+    ae_int64 *d_acc0,
+    ae_int64 *d_acc1,
+    const UWORD8 *p_mat,
+    const UWORD8 *p_vec,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias)
+{
+  const WORD8 *p_mat_0 = (const WORD8 *)p_mat;
+  const WORD8 *p_mat_1 = (const WORD8 *)(p_mat+row_stride);
+  const WORD8 *p_vec_0 = (const WORD8 *)p_vec;
+  ae_int16x4 mat_0_a, mat_1_a, vec_0_a;
+  ae_int16x4 dm0, dm1, dv0;
+  ae_int32x2 dm0_32, dv0_32;
+  ae_int64 acc0 = *d_acc0, acc1 = *d_acc1;
+  int n, k;
+
+  PRIME_8X4U(p_mat_0, mat_0_a);
+  PRIME_8X4U(p_mat_1, mat_1_a);
+  PRIME_8X4U(p_vec_0, vec_0_a);
+
+  for (n = 0; n < (cols>>2); n++)
+  {
+    AE_LA8X4U_IP(dm0, mat_0_a, p_mat_0);
+    AE_LA8X4U_IP(dm1, mat_1_a, p_mat_1);
+    AE_LA8X4U_IP(dv0, vec_0_a, p_vec_0);
+
+    dm0 = AE_ADD16(dm0, AE_MOVDA16(mat_zero_bias));
+    dm1 = AE_ADD16(dm1, AE_MOVDA16(mat_zero_bias));
+    dv0 = AE_ADD16(dv0, AE_MOVDA16(vec_zero_bias));
+
+    AE_MULAAAAQ16(acc0, dm0, dv0);
+    AE_MULAAAAQ16(acc1, dm1, dv0);
+  }
+
+  for(k = 0; k < (cols&3); k++)
+  {
+    dm0_32 = AE_MOVDA32X2(*(((const UWORD8 *)p_mat_0)+k), *(((const UWORD8 *)p_mat_1)+k));
+    dv0_32 = AE_MOVDA32(*(((const UWORD8 *)p_vec_0)+k));
+
+    dm0_32 = AE_ADD32(dm0_32, AE_MOVDA32(mat_zero_bias));
+    dv0_32 = AE_ADD32(dv0_32, AE_MOVDA32(vec_zero_bias));
+
+    AE_MULA32_HL(acc0, dm0_32, dv0_32);
+    AE_MULA32_LL(acc1, dm0_32, dv0_32);
+  }
+  *d_acc0 = acc0;
+  *d_acc1 = acc1;
+}
+
+/* Accumulates one row of p_mat times p_vec into d_acc0 */
+static inline void dot1_asym8xasym8(
+    ae_int64 *d_acc0,
+    const UWORD8 *p_mat,
+    const UWORD8 *p_vec,
+    WORD32 cols,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias)
+{
+  const WORD8 *p_mat_0 = (const WORD8 *)p_mat;
+  const WORD8 *p_vec_0 = (const WORD8 *)p_vec;
+  ae_int16x4 mat_0_a, vec_0_a;
+  ae_int16x4 dm0, dv0;
+  ae_int32x2 dm0_32, dv0_32;
+  ae_int64 acc0 = *d_acc0;
+  int n, k;
+
+  PRIME_8X4U(p_mat_0, mat_0_a);
+  PRIME_8X4U(p_vec_0, vec_0_a);
+
+  for (n = 0; n < (cols>>2); n++)
+  {
+    AE_LA8X4U_IP(dm0, mat_0_a, p_mat_0);
+    AE_LA8X4U_IP(dv0, vec_0_a, p_vec_0);
+
+    dm0 = AE_ADD16(dm0, AE_MOVDA16(mat_zero_bias));
+    dv0 = AE_ADD16(dv0, AE_MOVDA16(vec_zero_bias));
+
+    AE_MULAAAAQ16(acc0, dm0, dv0);
+  }
+
+  for(k = 0; k < (cols&3); k++)
+  {
+    dm0_32 = AE_MOVDA32(*(((const UWORD8 *)p_mat_0)+k));
+    dv0_32 = AE_MOVDA32(*(((const UWORD8 *)p_vec_0)+k));
+
+    dm0_32 = AE_ADD32(dm0_32, AE_MOVDA32(mat_zero_bias));
+    dv0_32 = AE_ADD32(dv0_32, AE_MOVDA32(vec_zero_bias));
+
+    AE_MULA32_LL(acc0, dm0_32, dv0_32);
+  }
+  *d_acc0 = acc0;
+}
+
+WORD32 xa_nn_matXvec_asym8xasym8_16(
+    WORD16 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_mat2,
+    const UWORD8 * __restrict__ p_vec1,
+    const UWORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -255 || mat1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -255 || vec1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+    XA_NNLIB_ARG_CHK_COND((mat2_zero_bias < -255 || mat2_zero_bias > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((vec2_zero_bias < -255 || vec2_zero_bias > 0), -1);
+  }
+
+  int m;
+  int left_shift, right_shift;
+  ae_int64 d_acc0, d_acc1;
+  ae_int32x2 d_acc0_32;
+
+  left_shift = out_shift<0?0:out_shift;
+  right_shift = out_shift>0?0:-out_shift;
+
+  for (m = 0; m < (rows-1); m+=2)
+  {
+    d_acc0 = d_acc1 = AE_ZERO64();
+    dot2_asym8xasym8(&d_acc0, &d_acc1, p_mat1+(m*row_stride1), p_vec1,
+        cols1, row_stride1, mat1_zero_bias, vec1_zero_bias);
+    if(p_mat2 != NULL)
+    {
+      dot2_asym8xasym8(&d_acc0, &d_acc1, p_mat2+(m*row_stride2), p_vec2,
+          cols2, row_stride2, mat2_zero_bias, vec2_zero_bias);
+    }
+    d_acc0_32 = AE_TRUNCA32X2F64S(d_acc0, d_acc1, 32);
+
+    /* Add bias */
+    d_acc0_32 = AE_ADD32S(d_acc0_32, AE_MOVDA32X2(p_bias[m], p_bias[m+1]));
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_acc0_32, out_multiplier, left_shift, right_shift);
+    SAT16_X2(d_acc0_32);
+    p_out[m] = (WORD16)AE_MOVAD32_H(d_acc0_32);
+    p_out[m+1] = (WORD16)AE_MOVAD32_L(d_acc0_32);
+  }
+
+  /* Compute last (rows%2) output element */
+  for (; m < rows; m++)
+  {
+    d_acc0 = AE_ZERO64();
+    dot1_asym8xasym8(&d_acc0, p_mat1+(m*row_stride1), p_vec1,
+        cols1, mat1_zero_bias, vec1_zero_bias);
+    if(p_mat2 != NULL)
+    {
+      dot1_asym8xasym8(&d_acc0, p_mat2+(m*row_stride2), p_vec2,
+          cols2, mat2_zero_bias, vec2_zero_bias);
+    }
+    d_acc0_32 = AE_TRUNCA32X2F64S(d_acc0, d_acc0, 32);
+
+    /* Add bias */
+    d_acc0_32 = AE_ADD32S(d_acc0_32, AE_MOVDA32(p_bias[m]));
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_acc0_32, out_multiplier, left_shift, right_shift);
+    SAT16_X2(d_acc0_32);
+    p_out[m] = (WORD16)AE_MOVAD32_L(d_acc0_32);
+  }
+
+  return 0;
+}
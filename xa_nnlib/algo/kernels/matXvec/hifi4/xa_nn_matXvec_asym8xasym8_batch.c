@@ -32,6 +32,7 @@
 
 #include "xa_nnlib_common_macros.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
 
 WORD32 xa_nn_matXvec_batch_asym8xasym8_asym8(
     UWORD8 ** __restrict__ p_out,
@@ -77,9 +78,6 @@ WORD32 xa_nn_matXvec_batch_asym8xasym8_asym8(
   XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -255 || vec1_zero_bias > 0), -1);
   XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
-  /* Implementation dependent checks */
-  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
 
   /* Iterators used in for loops */
   int m_itr, c_itr, vec_itr;
@@ -108,84 +106,94 @@ WORD32 xa_nn_matXvec_batch_asym8xasym8_asym8(
   left_shift = out_shift<0?0:out_shift;
   right_shift = out_shift>0?0:-out_shift;
 
-  for(vec_itr = 0; vec_itr < (vec_count & ~(VEC_UNROLL-1)); vec_itr+=VEC_UNROLL)
+  if(((cols1 | row_stride1) & 3) != 0)
   {
-    SETUP_BIAS;
-    for(m_itr = 0; m_itr < (rows & ~(ROW_UNROLL-1)); m_itr += ROW_UNROLL)
+    /* Rows that are not 4 byte aligned or not a multiple of 4 long,
+       4 rows at a time against every vector with unaligned loads */
+    MATXVEC_BATCH_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_ASYM8b_ZB, MAC_ROW_UNALIGNED_ASYM8b_ZB,
+                                 MATXVEC_VEC_BATCH, UNROLL_ADJUST_ACC_BATCH);
+  }
+  else
+  {
+    for(vec_itr = 0; vec_itr < (vec_count & ~(VEC_UNROLL-1)); vec_itr+=VEC_UNROLL)
     {
-      SETUP_ACC_BATCH;
-      SETUP_VEC_BATCH;
-      SETUP_MAT1;
-
-      for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+      SETUP_BIAS;
+      for(m_itr = 0; m_itr < (rows & ~(ROW_UNROLL-1)); m_itr += ROW_UNROLL)
       {
-        LOAD_VEC_BATCH;
-        LOAD_MAT1;
-        KERNEL_MAT1_VEC_BATCH;
-      }
+        SETUP_ACC_BATCH;
+        SETUP_VEC_BATCH;
+        SETUP_MAT1;
 
-      ADD_BIAS_ACC_BATCH;
-      ADJUST_ACC_BATCH;
-      STORE_ACC_BATCH;
-    }
+        for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+        {
+          LOAD_VEC_BATCH;
+          LOAD_MAT1;
+          KERNEL_MAT1_VEC_BATCH;
+        }
 
-    for(; m_itr < rows; m_itr++)
-    {
-      UNROLL_ROW_SETUP_ACC_BATCH(0);
-      SETUP_VEC_BATCH;
-      UNROLL_SETUP_MAT1(0);
+        ADD_BIAS_ACC_BATCH;
+        ADJUST_ACC_BATCH;
+        STORE_ACC_BATCH;
+      }
 
-      for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+      for(; m_itr < rows; m_itr++)
       {
-          LOAD_VEC_BATCH;
-          UNROLL_LOAD_ROW_MAT1(0);
-          UNROLL_ROW_KERNEL_MAT1_VEC_BATCH(0);
+        UNROLL_ROW_SETUP_ACC_BATCH(0);
+        SETUP_VEC_BATCH;
+        UNROLL_SETUP_MAT1(0);
+
+        for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+        {
+            LOAD_VEC_BATCH;
+            UNROLL_LOAD_ROW_MAT1(0);
+            UNROLL_ROW_KERNEL_MAT1_VEC_BATCH(0);
+        }
+
+        UNROLL_ROW_ADD_BIAS_ACC(0);
+        UNROLL_ROW_ADJUST_ACC(0);
+        UNROLL_ROW_STORE_ACC(0);
       }
-
-      UNROLL_ROW_ADD_BIAS_ACC(0);
-      UNROLL_ROW_ADJUST_ACC(0);
-      UNROLL_ROW_STORE_ACC(0);
     }
-  }
-  /* Tail loop for vec unroll */
-  for(; vec_itr < vec_count; vec_itr++)
-  {
-    SETUP_BIAS;
-    for(m_itr = 0; m_itr < (rows & ~(ROW_UNROLL-1)); m_itr += ROW_UNROLL)
+    /* Tail loop for vec unroll */
+    for(; vec_itr < vec_count; vec_itr++)
     {
-      SETUP_ACC_BATCH_TAIL;
-      UNROLL_SETUP_VEC_BATCH(0);
-      SETUP_MAT1;
-
-      for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+      SETUP_BIAS;
+      for(m_itr = 0; m_itr < (rows & ~(ROW_UNROLL-1)); m_itr += ROW_UNROLL)
       {
-        UNROLL_LOAD_VEC_BATCH(0);
-        LOAD_MAT1;
-        KERNEL_MAT1_VEC_BATCH_TAIL;
-      }
+        SETUP_ACC_BATCH_TAIL;
+        UNROLL_SETUP_VEC_BATCH(0);
+        SETUP_MAT1;
 
-      ADD_BIAS_ACC_BATCH_TAIL;
-      ADJUST_ACC_BATCH_TAIL;
-      STORE_ACC_BATCH_TAIL;
-    }
+        for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+        {
+          UNROLL_LOAD_VEC_BATCH(0);
+          LOAD_MAT1;
+          KERNEL_MAT1_VEC_BATCH_TAIL;
+        }
 
-    for(; m_itr < rows; m_itr++)
-    {
-      UNROLL_SETUP_ACC_BATCH(0,0);
-      UNROLL_SETUP_VEC_BATCH(0);
-      UNROLL_SETUP_MAT1(0);
+        ADD_BIAS_ACC_BATCH_TAIL;
+        ADJUST_ACC_BATCH_TAIL;
+        STORE_ACC_BATCH_TAIL;
+      }
 
-      for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+      for(; m_itr < rows; m_itr++)
       {
-          UNROLL_LOAD_VEC_BATCH(0);
-          UNROLL_LOAD_ROW_MAT1(0);
-          UNROLL_KERNEL_MAT1_VEC_BATCH(0,0);
+        UNROLL_SETUP_ACC_BATCH(0,0);
+        UNROLL_SETUP_VEC_BATCH(0);
+        UNROLL_SETUP_MAT1(0);
+
+        for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+        {
+            UNROLL_LOAD_VEC_BATCH(0);
+            UNROLL_LOAD_ROW_MAT1(0);
+            UNROLL_KERNEL_MAT1_VEC_BATCH(0,0);
+        }
+
+        LOAD_BIAS;
+        UNROLL_ADD_BIAS_ACC_BATCH(0,0);
+        UNROLL_ADJUST_ACC_BATCH(0,0);
+        UNROLL_STORE_ACC_BATCH(0,0);
       }
-
-      LOAD_BIAS;
-      UNROLL_ADD_BIAS_ACC_BATCH(0,0);
-      UNROLL_ADJUST_ACC_BATCH(0,0);
-      UNROLL_STORE_ACC_BATCH(0,0);
     }
   }
 
@@ -0,0 +1,316 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+    #ifdef ROW_UNROLL
+        #undef ROW_UNROLL
+        #define ROW_UNROLL 4
+    #else
+    #define ROW_UNROLL 4
+    #endif
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_batch_unroll.h"
+
+/* Batch matXvec kernels with a selectable row / vector unroll, see
+   MATXVEC_DEFINE_VARIANTS for the instantiated combinations. */
+
+static WORD32 unroll_is_supported(WORD32 unroll)
+{
+  WORD32 ru = XA_NN_MATXVEC_UNROLL_ROWS(unroll);
+  WORD32 vu = XA_NN_MATXVEC_UNROLL_VECS(unroll);
+
+  return (ru == 1 || ru == 2 || ru == 4 || ru == 8) &&
+         (vu == 1 || vu == 2 || vu == 4) &&
+         (ru * vu <= 8);
+}
+
+WORD32 xa_nn_matXvec_unroll_select(
+         const xa_nn_matXvec_unroll_entry_t *p_table,
+         WORD32 num_entries,
+         WORD32 mat_precision,
+         WORD32 vec_precision,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 vec_count)
+{
+  int i, ru, vu;
+
+  for(i = 0; p_table != NULL && i < num_entries; i++)
+  {
+    const xa_nn_matXvec_unroll_entry_t *p_entry = &p_table[i];
+    if(p_entry->mat_precision == mat_precision &&
+       p_entry->vec_precision == vec_precision &&
+       (p_entry->max_rows == 0 || rows <= p_entry->max_rows) &&
+       (p_entry->max_cols == 0 || cols1 <= p_entry->max_cols) &&
+       (p_entry->max_vec_count == 0 || vec_count <= p_entry->max_vec_count) &&
+       unroll_is_supported(p_entry->unroll))
+    {
+      return p_entry->unroll;
+    }
+  }
+
+  /* No table entry: every vector in a block reuses the loaded matrix row, so
+     take as many vectors as there are and spend the remaining accumulators
+     on rows, but not more rows than the matrix has */
+  vu = (vec_count >= 4) ? 4 : (vec_count >= 2) ? 2 : 1;
+  ru = 8 / vu;
+  while(ru > 1 && ru > rows)
+  {
+    ru >>= 1;
+  }
+  return XA_NN_MATXVEC_UNROLL(ru, vu);
+}
+
+/*------------------------------- 8x8_32 -----------------------------------*/
+
+#define UNROLL_SETUP_ACC_BATCH              SETUP_ACC_BATCH_FOR_8bx8b
+#define UNROLL_SETUP_MAT1                   SETUP_MAT1_8b
+#define UNROLL_SETUP_VEC_BATCH              SETUP_VEC_BATCH_8b
+#define SETUP_BIAS                          SETUP_BIAS_8b
+#define UNROLL_LOAD_VEC_BATCH               LOAD_VEC_BATCH_8b
+#define UNROLL_LOAD_ROW_MAT1                LOAD_ROW_MAT1_8b
+#define LOAD_BIAS                           LOAD_BIAS_8b_FOR_8bx8b
+#define UNROLL_KERNEL_MAT1_VEC_BATCH        KERNEL_MAT1_VEC_BATCH_8b_8b
+#define UNROLL_ADD_BIAS_ACC_BATCH           ADD_BIAS_BATCH_8b_ACC_FOR_8bx8b
+#define UNROLL_STORE_ACC_BATCH              STORE_ACC_BATCH_8bx8b_AT_OUT_32b
+
+MATXVEC_DEFINE_VARIANTS(xa_nn_matXvec_batch_8x8_32, WORD32, WORD8, WORD8, WORD8)
+
+WORD32 xa_nn_matXvec_batch_8x8_32_unroll(
+         WORD32 ** __restrict__ p_out,
+         WORD8 *  __restrict__ p_mat1,
+         WORD8 ** __restrict__ p_vec1,
+         WORD8 *  __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 vec_count,
+         WORD32 unroll)
+{
+    int i;
+    /* Unaligned rows take the row by row path of the regular kernel */
+    if(((cols1 | row_stride1) & 3) != 0)
+    {
+      return xa_nn_matXvec_batch_8x8_32(p_out, p_mat1, p_vec1, p_bias,
+          rows, cols1, row_stride1, acc_shift, bias_shift, vec_count);
+    }
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_PTR(p_out[i], -1);
+      XA_NNLIB_ARG_CHK_PTR(p_vec1[i], -1);
+    }
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32 *), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD8 *), -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_ALIGN(p_out[i], sizeof(WORD32), -1);
+      XA_NNLIB_ARG_CHK_ALIGN(p_vec1[i], (ALIGNMENT>>1), -1);
+    }
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+
+    if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+    {
+      unroll = xa_nn_matXvec_unroll_select(NULL, 0, 8, 8, rows, cols1, vec_count);
+    }
+
+    ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD32);
+
+    MATXVEC_CALL_VARIANT(xa_nn_matXvec_batch_8x8_32, unroll);
+
+    return 0;
+}
+
+#undef UNROLL_SETUP_ACC_BATCH
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_VEC_BATCH
+#undef SETUP_BIAS
+#undef UNROLL_LOAD_VEC_BATCH
+#undef UNROLL_LOAD_ROW_MAT1
+#undef LOAD_BIAS
+#undef UNROLL_KERNEL_MAT1_VEC_BATCH
+#undef UNROLL_ADD_BIAS_ACC_BATCH
+#undef UNROLL_STORE_ACC_BATCH
+
+/*------------------------------- 8x16_64 ----------------------------------*/
+
+#define UNROLL_SETUP_ACC_BATCH              SETUP_ACC_BATCH_FOR_8bx16b
+#define UNROLL_SETUP_MAT1                   SETUP_MAT1_8b
+#define UNROLL_SETUP_VEC_BATCH              SETUP_VEC_BATCH_16b
+#define SETUP_BIAS                          SETUP_BIAS_16b
+#define UNROLL_LOAD_VEC_BATCH               LOAD_VEC_BATCH_16b
+#define UNROLL_LOAD_ROW_MAT1                LOAD_ROW_MAT1_8b
+#define LOAD_BIAS                           LOAD_BIAS_16b_FOR_8bx16b
+#define UNROLL_KERNEL_MAT1_VEC_BATCH        KERNEL_MAT1_VEC_BATCH_8b_16b
+#define UNROLL_ADD_BIAS_ACC_BATCH           ADD_BIAS_BATCH_16b_ACC_FOR_8bx16b
+#define UNROLL_STORE_ACC_BATCH              STORE_ACC_BATCH_8bx16b_AT_OUT_64b
+
+MATXVEC_DEFINE_VARIANTS(xa_nn_matXvec_batch_8x16_64, WORD64, WORD8, WORD16, WORD16)
+
+WORD32 xa_nn_matXvec_batch_8x16_64_unroll(
+         WORD64 ** __restrict__ p_out,
+         WORD8 *  __restrict__ p_mat1,
+         WORD16 ** __restrict__ p_vec1,
+         WORD16 *  __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 vec_count,
+         WORD32 unroll)
+{
+    int i;
+    /* Unaligned rows take the row by row path of the regular kernel */
+    if(((cols1 | row_stride1) & 3) != 0)
+    {
+      return xa_nn_matXvec_batch_8x16_64(p_out, p_mat1, p_vec1, p_bias,
+          rows, cols1, row_stride1, acc_shift, bias_shift, vec_count);
+    }
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_PTR(p_out[i], -1);
+      XA_NNLIB_ARG_CHK_PTR(p_vec1[i], -1);
+    }
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD64 *), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16 *), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_ALIGN(p_out[i], sizeof(WORD64), -1);
+      XA_NNLIB_ARG_CHK_ALIGN(p_vec1[i], ALIGNMENT, -1);
+    }
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+
+    if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+    {
+      unroll = xa_nn_matXvec_unroll_select(NULL, 0, 8, 16, rows, cols1, vec_count);
+    }
+
+    MATXVEC_CALL_VARIANT(xa_nn_matXvec_batch_8x16_64, unroll);
+
+    return 0;
+}
+
+#undef UNROLL_SETUP_ACC_BATCH
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_VEC_BATCH
+#undef SETUP_BIAS
+#undef UNROLL_LOAD_VEC_BATCH
+#undef UNROLL_LOAD_ROW_MAT1
+#undef LOAD_BIAS
+#undef UNROLL_KERNEL_MAT1_VEC_BATCH
+#undef UNROLL_ADD_BIAS_ACC_BATCH
+#undef UNROLL_STORE_ACC_BATCH
+
+/*------------------------------- 16x16_64 ---------------------------------*/
+
+#define UNROLL_SETUP_ACC_BATCH              SETUP_ACC_BATCH_FOR_16bx16b
+#define UNROLL_SETUP_MAT1                   SETUP_MAT1_16b
+#define UNROLL_SETUP_VEC_BATCH              SETUP_VEC_BATCH_16b
+#define SETUP_BIAS                          SETUP_BIAS_16b
+#define UNROLL_LOAD_VEC_BATCH               LOAD_VEC_BATCH_16b
+#define UNROLL_LOAD_ROW_MAT1                LOAD_ROW_MAT1_16b
+#define LOAD_BIAS                           LOAD_BIAS_16b_FOR_16bx16b
+#define UNROLL_KERNEL_MAT1_VEC_BATCH        KERNEL_MAT1_VEC_BATCH_16b_16b
+#define UNROLL_ADD_BIAS_ACC_BATCH           ADD_BIAS_BATCH_16b_ACC_FOR_16bx16b
+#define UNROLL_STORE_ACC_BATCH              STORE_ACC_BATCH_16bx16b_AT_OUT_64b
+
+MATXVEC_DEFINE_VARIANTS(xa_nn_matXvec_batch_16x16_64, WORD64, WORD16, WORD16, WORD16)
+
+WORD32 xa_nn_matXvec_batch_16x16_64_unroll(
+         WORD64 ** __restrict__ p_out,
+         WORD16 *  __restrict__ p_mat1,
+         WORD16 ** __restrict__ p_vec1,
+         WORD16 *  __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 vec_count,
+         WORD32 unroll)
+{
+    int i;
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_PTR(p_out[i], -1);
+      XA_NNLIB_ARG_CHK_PTR(p_vec1[i], -1);
+    }
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD64 *), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16 *), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+    for(i = 0; i < vec_count; i++)
+    {
+      XA_NNLIB_ARG_CHK_ALIGN(p_out[i], sizeof(WORD64), -1);
+      XA_NNLIB_ARG_CHK_ALIGN(p_vec1[i], ALIGNMENT, -1);
+    }
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+    if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+    {
+      unroll = xa_nn_matXvec_unroll_select(NULL, 0, 16, 16, rows, cols1, vec_count);
+    }
+
+    MATXVEC_CALL_VARIANT(xa_nn_matXvec_batch_16x16_64, unroll);
+
+    return 0;
+}
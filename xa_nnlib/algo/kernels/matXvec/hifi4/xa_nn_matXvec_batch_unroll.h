@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NN_MATXVEC_BATCH_UNROLL_H__
+#define __XA_NN_MATXVEC_BATCH_UNROLL_H__
+
+/* Building blocks for batch matXvec kernels with a configurable number of
+   rows (1, 2, 4, 8) and vectors (1, 2, 4) per block. They expand to the
+   UNROLL_* and SETUP_BIAS/LOAD_BIAS bindings in effect where
+   MATXVEC_DEFINE_VARIANTS is used, so one file can instantiate several
+   precisions by rebinding in between. Rows must be 4 byte aligned and a
+   multiple of 4 long. */
+
+#define MXV_ROWS_1(M, a) M(0, a)
+#define MXV_ROWS_2(M, a) MXV_ROWS_1(M, a) M(1, a)
+#define MXV_ROWS_4(M, a) MXV_ROWS_2(M, a) M(2, a) M(3, a)
+#define MXV_ROWS_8(M, a) MXV_ROWS_4(M, a) M(4, a) M(5, a) M(6, a) M(7, a)
+#define MXV_ROWS_(n, M, a) MXV_ROWS_##n(M, a)
+#define MXV_ROWS(n, M, a) MXV_ROWS_(n, M, a)
+
+#define MXV_VECS_1(M, r) M(r, 0);
+#define MXV_VECS_2(M, r) MXV_VECS_1(M, r) M(r, 1);
+#define MXV_VECS_4(M, r) MXV_VECS_2(M, r) M(r, 2); M(r, 3);
+#define MXV_VECS_(n, M, r) MXV_VECS_##n(M, r)
+#define MXV_VECS(n, M, r) MXV_VECS_(n, M, r)
+
+#define MXV_VEC_1(M) M(0);
+#define MXV_VEC_2(M) MXV_VEC_1(M) M(1);
+#define MXV_VEC_4(M) MXV_VEC_2(M) M(2); M(3);
+#define MXV_VEC_(n, M) MXV_VEC_##n(M)
+#define MXV_VEC(n, M) MXV_VEC_(n, M)
+
+/* One row of a block with 'vu' accumulators */
+#define MXV_ROW_SETUP_ACC(r, vu)  MXV_VECS(vu, UNROLL_SETUP_ACC_BATCH, r)
+#define MXV_ROW_SETUP_MAT1(r, vu) UNROLL_SETUP_MAT1(r);
+#define MXV_ROW_KERNEL(r, vu)     UNROLL_LOAD_ROW_MAT1(r); MXV_VECS(vu, UNROLL_KERNEL_MAT1_VEC_BATCH, r)
+#define MXV_ROW_ADD_BIAS(r, vu)   LOAD_BIAS; MXV_VECS(vu, UNROLL_ADD_BIAS_ACC_BATCH, r)
+#define MXV_ROW_STORE(r, vu)      MXV_VECS(vu, UNROLL_STORE_ACC_BATCH, r)
+
+/* Inner loop trip count, one UNROLL_LOAD_* step each */
+#ifndef MXV_INNER_ITERATIONS
+#define MXV_INNER_ITERATIONS (cols1 >> 2)
+#endif
+
+/* 'ru' rows x 'vu' vectors starting at row m_itr, vector vec_itr */
+#define MXV_BLOCK(ru, vu) \
+{ \
+  MXV_ROWS(ru, MXV_ROW_SETUP_ACC, vu) \
+  MXV_VEC(vu, UNROLL_SETUP_VEC_BATCH) \
+  MXV_ROWS(ru, MXV_ROW_SETUP_MAT1, vu) \
+  for(c_itr = 0; c_itr < MXV_INNER_ITERATIONS; c_itr++) \
+  { \
+    MXV_VEC(vu, UNROLL_LOAD_VEC_BATCH) \
+    MXV_ROWS(ru, MXV_ROW_KERNEL, vu) \
+  } \
+  MXV_ROWS(ru, MXV_ROW_ADD_BIAS, vu) \
+  MXV_ROWS(ru, MXV_ROW_STORE, vu) \
+}
+
+/* All rows x vectors in blocks of 'ru' x 'vu', remaining rows and vectors
+   one at a time; needs int m_itr, c_itr, vec_itr */
+#define MXV_LOOPS(ru, vu) \
+  for(vec_itr = 0; vec_itr < (vec_count & ~(vu-1)); vec_itr += vu) \
+  { \
+    SETUP_BIAS; \
+    for(m_itr = 0; m_itr < (rows & ~(ru-1)); m_itr += ru) \
+      MXV_BLOCK(ru, vu) \
+    for(; m_itr < rows; m_itr++) \
+      MXV_BLOCK(1, vu) \
+  } \
+  /* Tail loop for vec unroll */ \
+  for(; vec_itr < vec_count; vec_itr++) \
+  { \
+    SETUP_BIAS; \
+    for(m_itr = 0; m_itr < (rows & ~(ru-1)); m_itr += ru) \
+      MXV_BLOCK(ru, 1) \
+    for(; m_itr < rows; m_itr++) \
+      MXV_BLOCK(1, 1) \
+  }
+
+/* static void name_r<ru>v<vu>(), same arguments as the regular batch
+   kernel, shifts already adjusted by the caller */
+#define MATXVEC_DEFINE_VARIANT(name, ru, vu, out_t, mat_t, vec_t, bias_t) \
+static void name##_r##ru##v##vu( \
+    out_t ** __restrict__ p_out, \
+    mat_t *  __restrict__ p_mat1, \
+    vec_t ** __restrict__ p_vec1, \
+    bias_t * __restrict__ p_bias, \
+    WORD32 rows, \
+    WORD32 cols1, \
+    WORD32 row_stride1, \
+    WORD32 acc_shift, \
+    WORD32 bias_shift, \
+    WORD32 vec_count) \
+{ \
+  int m_itr, c_itr, vec_itr; \
+  MXV_LOOPS(ru, vu) \
+}
+
+/* Combinations with at most 8 accumulators, more spill on HiFi4 */
+#define MATXVEC_DEFINE_VARIANTS(name, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 1, 1, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 1, 2, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 1, 4, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 2, 1, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 2, 2, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 2, 4, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 4, 1, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 4, 2, out_t, mat_t, vec_t, bias_t) \
+  MATXVEC_DEFINE_VARIANT(name, 8, 1, out_t, mat_t, vec_t, bias_t)
+
+/* Block used by the matmul kernels: every loaded matrix row feeds 4
+   columns, 2 rows keep the accumulator count at 8 */
+#define MATMUL_ROW_UNROLL 2
+#define MATMUL_VEC_UNROLL 4
+
+/* Output layout check of the matmul kernels: every (row, vector) result
+   needs its own element, so one of out_offset / out_stride has to step
+   over the whole extent of the other */
+#define MATMUL_CHK_OUT_LAYOUT(rows, vec_count, out_offset, out_stride) \
+  XA_NNLIB_ARG_CHK_COND(((out_offset) < 0 || (out_stride) < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((rows) > 1 && (out_stride) == 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((vec_count) > 1 && (out_offset) == 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((rows) > 1 && (vec_count) > 1 && \
+                         (out_offset) < (rows) * (out_stride) && \
+                         (out_stride) < (vec_count) * (out_offset)), -1);
+
+#define MATXVEC_VARIANT_CASE(name, ru, vu) \
+  case XA_NN_MATXVEC_UNROLL(ru, vu): \
+    name##_r##ru##v##vu(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, acc_shift, bias_shift, vec_count); \
+    break;
+
+/* Calls the variant selected by 'unroll', returns -1 for an unsupported one */
+#define MATXVEC_CALL_VARIANT(name, unroll) \
+  switch(unroll) \
+  { \
+    MATXVEC_VARIANT_CASE(name, 1, 1) \
+    MATXVEC_VARIANT_CASE(name, 1, 2) \
+    MATXVEC_VARIANT_CASE(name, 1, 4) \
+    MATXVEC_VARIANT_CASE(name, 2, 1) \
+    MATXVEC_VARIANT_CASE(name, 2, 2) \
+    MATXVEC_VARIANT_CASE(name, 2, 4) \
+    MATXVEC_VARIANT_CASE(name, 4, 1) \
+    MATXVEC_VARIANT_CASE(name, 4, 2) \
+    MATXVEC_VARIANT_CASE(name, 8, 1) \
+    default: \
+      return -1; \
+  }
+
+/* Single vector kernels: 'ru' rows of mat1 x vec1 plus, when given, mat2 x
+   vec2 per block, with the UNROLL_* / SETUP_VEC* / LOAD_VEC* bindings of
+   the regular matXvec kernels */
+#define MXV1_ROW_SETUP_ACC(r, a)  UNROLL_SETUP_ACC(r);
+#define MXV1_ROW_SETUP_MAT1(r, a) UNROLL_SETUP_MAT1(r);
+#define MXV1_ROW_SETUP_MAT2(r, a) UNROLL_SETUP_MAT2(r);
+#define MXV1_ROW_KERNEL1(r, a)    UNROLL_KERNEL_MAT1_VEC1(r);
+#define MXV1_ROW_KERNEL2(r, a)    UNROLL_KERNEL_MAT2_VEC2(r);
+#define MXV1_ROW_ADD_BIAS(r, a)   UNROLL_ADD_BIAS_ACC(r);
+#define MXV1_ROW_STORE(r, a)      UNROLL_STORE_ACC(r);
+
+#define MXV1_BLOCK(ru) \
+{ \
+  MXV_ROWS(ru, MXV1_ROW_SETUP_ACC, 0) \
+  { \
+    SETUP_VEC1; \
+    MXV_ROWS(ru, MXV1_ROW_SETUP_MAT1, 0) \
+    for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++) \
+    { \
+      LOAD_VEC1; \
+      MXV_ROWS(ru, MXV1_ROW_KERNEL1, 0) \
+    } \
+  } \
+  if(p_mat2 && p_vec2) \
+  { \
+    SETUP_VEC2; \
+    MXV_ROWS(ru, MXV1_ROW_SETUP_MAT2, 0) \
+    for(c_itr = 0; c_itr < (cols2 >> 2); c_itr++) \
+    { \
+      LOAD_VEC2; \
+      MXV_ROWS(ru, MXV1_ROW_KERNEL2, 0) \
+    } \
+  } \
+  MXV_ROWS(ru, MXV1_ROW_ADD_BIAS, 0) \
+  MXV_ROWS(ru, MXV1_ROW_STORE, 0) \
+}
+
+/* static void name_r<ru>(), arguments of the regular kernel with the bias
+   as VOID * and p_scratch always present, shifts already adjusted */
+#define MATXVEC_DEFINE_ROW_VARIANT(name, ru, out_t, mat_t, vec_t) \
+static void name##_r##ru( \
+    out_t * __restrict__ p_out, \
+    mat_t * __restrict__ p_mat1, \
+    mat_t * __restrict__ p_mat2, \
+    vec_t * __restrict__ p_vec1, \
+    vec_t * __restrict__ p_vec2, \
+    VOID  * __restrict__ p_bias, \
+    WORD32 rows, \
+    WORD32 cols1, \
+    WORD32 cols2, \
+    WORD32 row_stride1, \
+    WORD32 row_stride2, \
+    WORD32 acc_shift, \
+    WORD32 bias_shift, \
+    VOID  * __restrict__ p_scratch) \
+{ \
+  int m_itr, c_itr; \
+  SETUP_BIAS; \
+  for(m_itr = 0; m_itr < (rows & ~(ru-1)); m_itr += ru) \
+    MXV1_BLOCK(ru) \
+  for(; m_itr < rows; m_itr++) \
+    MXV1_BLOCK(1) \
+}
+
+#define MATXVEC_DEFINE_ROW_VARIANTS(name, out_t, mat_t, vec_t) \
+  MATXVEC_DEFINE_ROW_VARIANT(name, 1, out_t, mat_t, vec_t) \
+  MATXVEC_DEFINE_ROW_VARIANT(name, 2, out_t, mat_t, vec_t) \
+  MATXVEC_DEFINE_ROW_VARIANT(name, 4, out_t, mat_t, vec_t) \
+  MATXVEC_DEFINE_ROW_VARIANT(name, 8, out_t, mat_t, vec_t)
+
+#define MATXVEC_ROW_VARIANT_CASE(name, ru, scratch) \
+  case XA_NN_MATXVEC_UNROLL(ru, 1): \
+    name##_r##ru(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, \
+                 row_stride1, row_stride2, acc_shift, bias_shift, scratch); \
+    break;
+
+/* Calls the single vector variant selected by 'unroll', returns -1 for an
+   unsupported one */
+#define MATXVEC_CALL_ROW_VARIANT(name, unroll, scratch) \
+  switch(unroll) \
+  { \
+    MATXVEC_ROW_VARIANT_CASE(name, 1, scratch) \
+    MATXVEC_ROW_VARIANT_CASE(name, 2, scratch) \
+    MATXVEC_ROW_VARIANT_CASE(name, 4, scratch) \
+    MATXVEC_ROW_VARIANT_CASE(name, 8, scratch) \
+    default: \
+      return -1; \
+  }
+
+#endif /* __XA_NN_MATXVEC_BATCH_UNROLL_H__ */
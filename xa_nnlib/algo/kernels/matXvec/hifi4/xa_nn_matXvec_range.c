@@ -0,0 +1,485 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Row range entry points of the matXvec kernels.
+
+   Each one computes rows [row_start, row_start + row_count) of the full
+   'rows' x 1 result by offsetting the matrices, bias, output and scratch
+   to row_start and running the base kernel over row_count rows. All other
+   arguments, including the pointers, describe the full problem, so
+   disjoint ranges of one call can run concurrently with the same p_scratch.
+   row_start must be a multiple of 4 to keep the kernel alignment. */
+
+#define CHK_ROW_RANGE(rows, row_start, row_count)                               \
+  XA_NNLIB_ARG_CHK_COND((row_start < 0 || (row_start & 3) != 0), -1);           \
+  XA_NNLIB_ARG_CHK_COND((row_count <= 0 || row_start + row_count > rows), -1);
+
+/* p_mat2 is optional for the base kernels */
+#define MAT2_AT_ROW(p_mat2, row_start, row_stride2) \
+  ((p_mat2) != NULL ? (p_mat2) + (row_start) * (row_stride2) : NULL)
+
+WORD32 xa_nn_matXvec_range_16x16_16_sigmoid(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_16x16_16_sigmoid(p_out + row_start,
+                                        p_mat1 + row_start * row_stride1,
+                                        MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                        p_vec1,
+                                        p_vec2,
+                                        (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+                                        row_count,
+                                        cols1,
+                                        cols2,
+                                        row_stride1,
+                                        row_stride2,
+                                        acc_shift,
+                                        bias_shift,
+                                        bias_precision,
+                                        (WORD32 *)p_scratch + row_start);
+}
+
+WORD32 xa_nn_matXvec_range_16x16_16_tanh(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_16x16_16_tanh(p_out + row_start,
+                                     p_mat1 + row_start * row_stride1,
+                                     MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                     p_vec1,
+                                     p_vec2,
+                                     (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+                                     row_count,
+                                     cols1,
+                                     cols2,
+                                     row_stride1,
+                                     row_stride2,
+                                     acc_shift,
+                                     bias_shift,
+                                     bias_precision,
+                                     (WORD32 *)p_scratch + row_start);
+}
+
+WORD32 xa_nn_matXvec_range_8x16_16_sigmoid(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_8x16_16_sigmoid(p_out + row_start,
+                                       p_mat1 + row_start * row_stride1,
+                                       MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                       p_vec1,
+                                       p_vec2,
+                                       (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+                                       row_count,
+                                       cols1,
+                                       cols2,
+                                       row_stride1,
+                                       row_stride2,
+                                       acc_shift,
+                                       bias_shift,
+                                       bias_precision,
+                                       (WORD32 *)p_scratch + row_start);
+}
+
+WORD32 xa_nn_matXvec_range_8x16_16_tanh(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_8x16_16_tanh(p_out + row_start,
+                                    p_mat1 + row_start * row_stride1,
+                                    MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                    p_vec1,
+                                    p_vec2,
+                                    (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+                                    row_count,
+                                    cols1,
+                                    cols2,
+                                    row_stride1,
+                                    row_stride2,
+                                    acc_shift,
+                                    bias_shift,
+                                    bias_precision,
+                                    (WORD32 *)p_scratch + row_start);
+}
+
+WORD32 xa_nn_matXvec_range_16x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count,
+         WORD32 unroll)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_16x16_16_sigmoid_unroll(p_out + row_start,
+      p_mat1 + row_start * row_stride1,
+      MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+      p_vec1,
+      p_vec2,
+      (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+      row_count,
+      cols1,
+      cols2,
+      row_stride1,
+      row_stride2,
+      acc_shift,
+      bias_shift,
+      bias_precision,
+      (WORD32 *)p_scratch + row_start,
+      unroll);
+}
+
+WORD32 xa_nn_matXvec_range_16x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count,
+         WORD32 unroll)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_16x16_16_tanh_unroll(p_out + row_start,
+      p_mat1 + row_start * row_stride1,
+      MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+      p_vec1,
+      p_vec2,
+      (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+      row_count,
+      cols1,
+      cols2,
+      row_stride1,
+      row_stride2,
+      acc_shift,
+      bias_shift,
+      bias_precision,
+      (WORD32 *)p_scratch + row_start,
+      unroll);
+}
+
+WORD32 xa_nn_matXvec_range_8x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count,
+         WORD32 unroll)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_8x16_16_sigmoid_unroll(p_out + row_start,
+      p_mat1 + row_start * row_stride1,
+      MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+      p_vec1,
+      p_vec2,
+      (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+      row_count,
+      cols1,
+      cols2,
+      row_stride1,
+      row_stride2,
+      acc_shift,
+      bias_shift,
+      bias_precision,
+      (WORD32 *)p_scratch + row_start,
+      unroll);
+}
+
+WORD32 xa_nn_matXvec_range_8x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 row_start,
+         WORD32 row_count,
+         WORD32 unroll)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_8x16_16_tanh_unroll(p_out + row_start,
+      p_mat1 + row_start * row_stride1,
+      MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+      p_vec1,
+      p_vec2,
+      (WORD8 *)p_bias + row_start * (bias_precision >> 3),
+      row_count,
+      cols1,
+      cols2,
+      row_stride1,
+      row_stride2,
+      acc_shift,
+      bias_shift,
+      bias_precision,
+      (WORD32 *)p_scratch + row_start,
+      unroll);
+}
+
+WORD32 xa_nn_matXvec_range_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_mat2,
+    const UWORD8 * __restrict__ p_vec1,
+    const UWORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 row_start,
+    WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_asym8xasym8_asym8(p_out + row_start,
+                                         p_mat1 + row_start * row_stride1,
+                                         MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                         p_vec1,
+                                         p_vec2,
+                                         p_bias + row_start,
+                                         row_count,
+                                         cols1,
+                                         cols2,
+                                         row_stride1,
+                                         row_stride2,
+                                         mat1_zero_bias,
+                                         mat2_zero_bias,
+                                         vec1_zero_bias,
+                                         vec2_zero_bias,
+                                         out_multiplier,
+                                         out_shift,
+                                         out_zero_bias);
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matXvec_range_f32xf32_f32,(
+    FLOAT32  *  p_out,
+    const FLOAT32  *  p_mat1,
+    const FLOAT32  *  p_mat2,
+    const FLOAT32  *  p_vec1,
+    const FLOAT32  *  p_vec2,
+    const FLOAT32  *  p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 row_start,
+    WORD32 row_count))
+#else
+WORD32 xa_nn_matXvec_range_f32xf32_f32(
+       FLOAT32  * __restrict__ p_out,
+       const FLOAT32  * __restrict__ p_mat1,
+       const FLOAT32  * __restrict__ p_mat2,
+       const FLOAT32  * __restrict__ p_vec1,
+       const FLOAT32  * __restrict__ p_vec2,
+       const FLOAT32  * __restrict__ p_bias,
+       WORD32 rows,
+       WORD32 cols1,
+       WORD32 cols2,
+       WORD32 row_stride1,
+       WORD32 row_stride2,
+       WORD32 row_start,
+       WORD32 row_count)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  CHK_ROW_RANGE(rows, row_start, row_count);
+
+  return xa_nn_matXvec_f32xf32_f32(p_out + row_start,
+                                   p_mat1 + row_start * row_stride1,
+                                   MAT2_AT_ROW(p_mat2, row_start, row_stride2),
+                                   p_vec1,
+                                   p_vec2,
+                                   p_bias + row_start,
+                                   row_count,
+                                   cols1,
+                                   cols2,
+                                   row_stride1,
+                                   row_stride2);
+}
+#endif /* HAVE_VFPU */
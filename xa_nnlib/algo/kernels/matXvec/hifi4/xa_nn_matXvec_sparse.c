@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Block-sparse matXvec with 1x4 weight blocks. Each row keeps only the
+ * groups of 4 consecutive columns (starting at a multiple of 4) that hold a
+ * non-zero weight, stored CSR style:
+ *   p_blk_val : the 4 weights of every kept block, row after row
+ *   p_blk_col : column of each kept block divided by 4
+ *   p_row_ptr : rows + 1 entries, row r owns blocks p_row_ptr[r] ..
+ *               p_row_ptr[r+1] - 1
+ * A block is one 4-lane AE_MULAAAAQ16, so the inner loop keeps the SIMD
+ * width of the dense kernels while both the MACs and the weight bytes read
+ * scale with the block density. */
+
+/* Load 4 asym8 values and add the zero bias, as LOAD_ROW_MAT1_ASYM8b */
+#define LOAD_ASYM8X4_ADD_ZB(out, ptr, zero_bias) \
+  out = AE_L8X4F_I((WORD8 *)(ptr), 0); \
+  out = AE_MOVF16X4_FROMF64(AE_SRLI64(AE_MOVF64_FROMF16X4(out), 8)); \
+  out = AE_ADD16(out, zero_bias);
+
+WORD32 xa_nn_matXvec_sparse_1x4_8x8_8(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_blk_val,
+    const UWORD16 * __restrict__ p_blk_col,
+    const WORD32 * __restrict__ p_row_ptr,
+    const WORD8 * __restrict__ p_vec,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blk_val, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blk_col, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_row_ptr, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_blk_val, 4*sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_blk_col, sizeof(UWORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_row_ptr, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, 4*sizeof(WORD8), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_row_ptr[0] != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+
+  int m_itr, b_itr;
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD16);
+  SETUP_BIAS_8b;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    SETUP_ACC_FOR_8bx8b(0);
+    ae_int64 acc_1 = ZERO64;
+    ae_int16x4 mat_0, mat_1, vec_0, vec_1;
+    WORD32 num_blk = p_row_ptr[m_itr + 1] - p_row_ptr[m_itr];
+    WORD8 *p_mat = (WORD8 *)&p_blk_val[4 * p_row_ptr[m_itr]];
+    const UWORD16 *p_col = &p_blk_col[p_row_ptr[m_itr]];
+
+    /* Two blocks per iteration into independent accumulators */
+    for(b_itr = 0; b_itr < (num_blk >> 1); b_itr++)
+    {
+      AE_L8X4F_IP(mat_0, p_mat, INCREMENT_IN_BYTES_FOR_WORD8X4);
+      AE_L8X4F_IP(mat_1, p_mat, INCREMENT_IN_BYTES_FOR_WORD8X4);
+      vec_0 = AE_L8X4F_I((WORD8 *)&p_vec[p_col[0] << 2], 0);
+      vec_1 = AE_L8X4F_I((WORD8 *)&p_vec[p_col[1] << 2], 0);
+      p_col += 2;
+      AE_MULAAAAQ16(_ae_int64_acc_0, vec_0, mat_0);
+      AE_MULAAAAQ16(acc_1, vec_1, mat_1);
+    }
+    if(num_blk & 1)
+    {
+      AE_L8X4F_IP(mat_0, p_mat, INCREMENT_IN_BYTES_FOR_WORD8X4);
+      vec_0 = AE_L8X4F_I((WORD8 *)&p_vec[p_col[0] << 2], 0);
+      AE_MULAAAAQ16(_ae_int64_acc_0, vec_0, mat_0);
+    }
+    _ae_int64_acc_0 = AE_ADD64S(_ae_int64_acc_0, acc_1);
+
+    ADD_BIAS_8b_ACC_FOR_8bx8b(0);
+    STORE_ACC_8bx8b_AT_OUT_8b(0);
+  }
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sparse_1x4_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_blk_val,
+    const UWORD16 * __restrict__ p_blk_col,
+    const WORD32 * __restrict__ p_row_ptr,
+    const UWORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blk_val, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blk_col, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_row_ptr, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_blk_val, 4*sizeof(UWORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_blk_col, sizeof(UWORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_row_ptr, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, 4*sizeof(UWORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_row_ptr[0] != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((mat_zero_bias < -255 || mat_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_zero_bias < -255 || vec_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+
+  int m_itr, b_itr;
+  /* Shifts to match with Tensorflow */
+  int left_shift, right_shift;
+  left_shift = out_shift<0?0:out_shift;
+  right_shift = out_shift>0?0:-out_shift;
+  ae_int16x4 mat_zb = AE_MOVDA16(mat_zero_bias);
+  ae_int16x4 vec_zb = AE_MOVDA16(vec_zero_bias);
+
+  SETUP_BIAS_ASYM8b;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    SETUP_ACC_FOR_ASYM8bxASYM8b(0);
+    ae_int64 acc_1 = ZERO64;
+    ae_int16x4 mat_0, mat_1, vec_0, vec_1;
+    WORD32 num_blk = p_row_ptr[m_itr + 1] - p_row_ptr[m_itr];
+    const UWORD8 *p_mat = &p_blk_val[4 * p_row_ptr[m_itr]];
+    const UWORD16 *p_col = &p_blk_col[p_row_ptr[m_itr]];
+
+    for(b_itr = 0; b_itr < (num_blk >> 1); b_itr++)
+    {
+      LOAD_ASYM8X4_ADD_ZB(mat_0, p_mat, mat_zb);
+      LOAD_ASYM8X4_ADD_ZB(mat_1, p_mat + 4, mat_zb);
+      LOAD_ASYM8X4_ADD_ZB(vec_0, &p_vec[p_col[0] << 2], vec_zb);
+      LOAD_ASYM8X4_ADD_ZB(vec_1, &p_vec[p_col[1] << 2], vec_zb);
+      p_mat += 8;
+      p_col += 2;
+      AE_MULAAAAQ16(_ae_int64_acc_0, vec_0, mat_0);
+      AE_MULAAAAQ16(acc_1, vec_1, mat_1);
+    }
+    if(num_blk & 1)
+    {
+      LOAD_ASYM8X4_ADD_ZB(mat_0, p_mat, mat_zb);
+      LOAD_ASYM8X4_ADD_ZB(vec_0, &p_vec[p_col[0] << 2], vec_zb);
+      AE_MULAAAAQ16(_ae_int64_acc_0, vec_0, mat_0);
+    }
+    _ae_int64_acc_0 = AE_ADD64S(_ae_int64_acc_0, acc_1);
+
+    ADD_BIAS_ASYM8b_ACC_FOR_ASYM8bxASYM8b(0);
+    ADJUST_ACC_ASYM8b(0);
+    STORE_ACC_ASYM8bxASYM8b_AT_OUT_ASYM8b(0);
+  }
+  return 0;
+}
+
+/* Dense to 1x4 block-sparse conversion, done once on the host or at model
+ * load. Works on raw bytes: zero_value is the byte that encodes a zero
+ * weight (0 for sym8, the weight zero point for asym8). A block is dropped
+ * when all its bytes equal zero_value; the columns past cols in the last
+ * block of a row are filled with zero_value. */
+static int is_zero_blk_1x4(const UWORD8 *p_row, WORD32 col, WORD32 cols, UWORD8 zero_value)
+{
+  int k;
+  for(k = col; k < col + 4 && k < cols; k++)
+  {
+    if(p_row[k] != zero_value)
+      return 0;
+  }
+  return 1;
+}
+
+WORD32 xa_nn_sparse_1x4_count_blocks_8(
+    const UWORD8 * __restrict__ p_dense,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 zero_value)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_dense, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+  XA_NNLIB_ARG_CHK_COND((zero_value < -128 || zero_value > 255), -1);
+
+  int m_itr, c_itr;
+  WORD32 num_blk = 0;
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const UWORD8 *p_row = &p_dense[m_itr * row_stride];
+    for(c_itr = 0; c_itr < cols; c_itr += 4)
+    {
+      if(!is_zero_blk_1x4(p_row, c_itr, cols, (UWORD8)zero_value))
+        num_blk++;
+    }
+  }
+  return num_blk;
+}
+
+WORD32 xa_nn_sparse_1x4_from_dense_8(
+    UWORD8 * __restrict__ p_blk_val,
+    UWORD16 * __restrict__ p_blk_col,
+    WORD32 * __restrict__ p_row_ptr,
+    const UWORD8 * __restrict__ p_dense,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 zero_value)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_blk_val, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blk_col, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_row_ptr, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dense, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_blk_col, sizeof(UWORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_row_ptr, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols > 4 * 65536), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+  XA_NNLIB_ARG_CHK_COND((zero_value < -128 || zero_value > 255), -1);
+
+  int m_itr, c_itr, k;
+  WORD32 num_blk = 0;
+  p_row_ptr[0] = 0;
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const UWORD8 *p_row = &p_dense[m_itr * row_stride];
+    for(c_itr = 0; c_itr < cols; c_itr += 4)
+    {
+      if(is_zero_blk_1x4(p_row, c_itr, cols, (UWORD8)zero_value))
+        continue;
+      for(k = 0; k < 4; k++)
+      {
+        p_blk_val[4 * num_blk + k] = (c_itr + k < cols) ? p_row[c_itr + k] : (UWORD8)zero_value;
+      }
+      p_blk_col[num_blk] = (UWORD16)(c_itr >> 2);
+      num_blk++;
+    }
+    p_row_ptr[m_itr + 1] = num_blk;
+  }
+  return 0;
+}
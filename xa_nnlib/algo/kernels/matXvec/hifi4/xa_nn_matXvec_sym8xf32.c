@@ -0,0 +1,273 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
+
+/* Hybrid matXvec: symmetric int8 weights with one float scale per row and
+ * float activations. The vectors are quantized to symmetric int8 once per
+ * call (or once by the caller for several matrices), the dot products run
+ * in 8x8 integer MACs and each row sum is scaled back to float:
+ *   p_out[r] = p_bias[r] + mat1_scale[r] * vec1_scale * dot(mat1[r], vec1)
+ *                        + mat2_scale[r] * vec2_scale * dot(mat2[r], vec2)
+ * Weights take a quarter of the bytes of xa_nn_matXvec_f32xf32_f32. */
+
+#define ALIGN_4(x) (((x) + 3) & ~3)
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_matXvec_sym8xsym8_f32,
+             (
+                FLOAT32 *p_out,
+                const WORD8 *p_mat1,
+                const WORD8 *p_mat2,
+                const WORD8 *p_vec1,
+                const WORD8 *p_vec2,
+                const FLOAT32 *p_bias,
+                const FLOAT32 *p_mat1_scale,
+                const FLOAT32 *p_mat2_scale,
+                FLOAT32 vec1_scale,
+                FLOAT32 vec2_scale,
+                WORD32 rows,
+                WORD32 cols1,
+                WORD32 cols2,
+                WORD32 row_stride1,
+                WORD32 row_stride2
+              )
+           )
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_matXvec_sym8xf32_f32,
+             (
+                FLOAT32 *p_out,
+                const WORD8 *p_mat1,
+                const WORD8 *p_mat2,
+                const FLOAT32 *p_vec1,
+                const FLOAT32 *p_vec2,
+                const FLOAT32 *p_bias,
+                const FLOAT32 *p_mat1_scale,
+                const FLOAT32 *p_mat2_scale,
+                WORD32 rows,
+                WORD32 cols1,
+                WORD32 cols2,
+                WORD32 row_stride1,
+                WORD32 row_stride2,
+                pVOID p_scratch
+              )
+           )
+#else
+WORD32 xa_nn_matXvec_sym8xsym8_f32(
+    FLOAT32 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_vec2,
+    const FLOAT32 * __restrict__ p_bias,
+    const FLOAT32 * __restrict__ p_mat1_scale,
+    const FLOAT32 * __restrict__ p_mat2_scale,
+    FLOAT32 vec1_scale,
+    FLOAT32 vec2_scale,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1_scale, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, 4, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1_scale, sizeof(FLOAT32), -1);
+  if(p_bias)
+  {
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+  }
+  if(p_mat2 && p_vec2)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_mat2_scale, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, 4, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2_scale, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+  }
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+
+  const int use_mat2 = (p_mat2 && p_vec2);
+  int m_itr;
+
+  /* Four rows per iteration share every vector load; their sums are
+   * scaled and biased two rows at a time in float */
+  xtfloatx2 vec1_scale_x2 = (xtfloatx2)vec1_scale;
+  xtfloatx2 vec2_scale_x2 = (xtfloatx2)vec2_scale;
+  xtfloatx2 *p_s1 = (xtfloatx2 *)p_mat1_scale;
+  xtfloatx2 *p_s2 = (xtfloatx2 *)p_mat2_scale;
+  xtfloatx2 *p_b = (xtfloatx2 *)p_bias;
+  xtfloatx2 *p_o = (xtfloatx2 *)p_out;
+  ae_valign s1_a, s2_a = AE_ZALIGN64(), b_a = AE_ZALIGN64();
+  ae_valign out_a = AE_ZALIGN64();
+
+  s1_a = XT_LASX2PP(p_s1);
+  if(use_mat2)
+  {
+    s2_a = XT_LASX2PP(p_s2);
+  }
+  if(p_bias)
+  {
+    b_a = XT_LASX2PP(p_b);
+  }
+
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+  {
+    ae_int64 acc0, acc1, acc2, acc3;
+    xtfloatx2 dot01, dot23, scale01, scale23, out01, out23;
+
+    if(p_bias)
+    {
+      XT_LASX2IP(out01, b_a, p_b);
+      XT_LASX2IP(out23, b_a, p_b);
+    }
+    else
+    {
+      out01 = out23 = (xtfloatx2)0.0f;
+    }
+
+    /* Products come out of the 8x8 MACs scaled by 2^16 */
+    acc0 = acc1 = acc2 = acc3 = AE_ZERO64();
+    MAC_4ROWS_UNALIGNED_8b_8b(acc0, acc1, acc2, acc3,
+        &p_mat1[m_itr*row_stride1], row_stride1, p_vec1, cols1);
+    dot01 = XT_FLOAT_SX2(AE_TRUNCA32X2F64S(acc0, acc1, 16), 0);
+    dot23 = XT_FLOAT_SX2(AE_TRUNCA32X2F64S(acc2, acc3, 16), 0);
+    XT_LASX2IP(scale01, s1_a, p_s1);
+    XT_LASX2IP(scale23, s1_a, p_s1);
+    XT_MADD_SX2(out01, dot01, XT_MUL_SX2(scale01, vec1_scale_x2));
+    XT_MADD_SX2(out23, dot23, XT_MUL_SX2(scale23, vec1_scale_x2));
+
+    if(use_mat2)
+    {
+      acc0 = acc1 = acc2 = acc3 = AE_ZERO64();
+      MAC_4ROWS_UNALIGNED_8b_8b(acc0, acc1, acc2, acc3,
+          &p_mat2[m_itr*row_stride2], row_stride2, p_vec2, cols2);
+      dot01 = XT_FLOAT_SX2(AE_TRUNCA32X2F64S(acc0, acc1, 16), 0);
+      dot23 = XT_FLOAT_SX2(AE_TRUNCA32X2F64S(acc2, acc3, 16), 0);
+      XT_LASX2IP(scale01, s2_a, p_s2);
+      XT_LASX2IP(scale23, s2_a, p_s2);
+      XT_MADD_SX2(out01, dot01, XT_MUL_SX2(scale01, vec2_scale_x2));
+      XT_MADD_SX2(out23, dot23, XT_MUL_SX2(scale23, vec2_scale_x2));
+    }
+
+    XT_SASX2IP(out01, out_a, p_o);
+    XT_SASX2IP(out23, out_a, p_o);
+  }
+  XT_SASX2POSFP(out_a, p_o);
+
+  for(; m_itr < rows; m_itr++)
+  {
+    ae_int64 acc1 = AE_ZERO64();
+    ae_int64 acc2 = AE_ZERO64();
+    ae_int32x2 dot;
+    xtfloatx2 dot_f;
+    xtfloat out;
+
+    MAC_ROW_UNALIGNED_8b_8b(acc1, &p_mat1[m_itr*row_stride1], p_vec1, cols1);
+    if(use_mat2)
+    {
+      MAC_ROW_UNALIGNED_8b_8b(acc2, &p_mat2[m_itr*row_stride2], p_vec2, cols2);
+    }
+    dot = AE_TRUNCA32X2F64S(acc1, acc2, 16);
+    dot_f = XT_FLOAT_SX2(dot, 0);
+
+    out = p_bias ? p_bias[m_itr] : 0.0f;
+    XT_MADD_S(out, XT_HIGH_S(dot_f), p_mat1_scale[m_itr] * vec1_scale);
+    if(use_mat2)
+    {
+      XT_MADD_S(out, XT_LOW_S(dot_f), p_mat2_scale[m_itr] * vec2_scale);
+    }
+    p_out[m_itr] = out;
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym8xf32_f32(
+    FLOAT32 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const FLOAT32 * __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_vec2,
+    const FLOAT32 * __restrict__ p_bias,
+    const FLOAT32 * __restrict__ p_mat1_scale,
+    const FLOAT32 * __restrict__ p_mat2_scale,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    pVOID p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, 4, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+
+  const int use_mat2 = (p_mat2 && p_vec2);
+  WORD8 *p_vec1_q = (WORD8 *)p_scratch;
+  WORD8 *p_vec2_q = NULL;
+  FLOAT32 vec1_scale, vec2_scale = 0.0f;
+  WORD32 ret;
+
+  ret = xa_nn_quantize_f32_sym8(p_vec1_q, &vec1_scale, p_vec1, cols1);
+  if(ret != 0)
+    return ret;
+  if(use_mat2)
+  {
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    p_vec2_q = p_vec1_q + ALIGN_4(cols1);
+    ret = xa_nn_quantize_f32_sym8(p_vec2_q, &vec2_scale, p_vec2, cols2);
+    if(ret != 0)
+      return ret;
+  }
+
+  return xa_nn_matXvec_sym8xsym8_f32(p_out, p_mat1, use_mat2 ? p_mat2 : NULL,
+      p_vec1_q, p_vec2_q, p_bias, p_mat1_scale, p_mat2_scale,
+      vec1_scale, vec2_scale, rows, cols1, cols2, row_stride1, row_stride2);
+}
+#endif /* !HAVE_VFPU */
+
+WORD32 xa_nn_matXvec_sym8xf32_f32_getsize(WORD32 cols1, WORD32 cols2)
+{
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols2 < 0), -1);
+  return ALIGN_4(cols1) + ALIGN_4(cols2);
+}
@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+
+#ifndef __XA_NN_MATXVEC_UNALIGNED_H__
+#define __XA_NN_MATXVEC_UNALIGNED_H__
+
+/* HiFi4 has no aligning load for 8 bit data, PRIME_8X4x/AE_LA8X4x_IP emulate
+   one: the bytes before the first 4 byte boundary are collected in the
+   alignment register 'tmp', every AE_LA8X4x_IP then does one aligned
+   AE_L8X4F_I and merges it with the register. 'p' must be a plain pointer
+   variable (offset_p, ls_p, rs_p are declared by the prime) and is advanced
+   by 4 per load, so the bytes left after the last load start at p.
+   The F variants give AE_L8X4F layout (byte << 8), the U variants give the
+   unsigned byte in the low 8 bits of each lane. */
+#define PRIME_8X4F(p_char, tmp) \
+    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
+    rs_##p_char = 0; \
+    ls_##p_char = 64; \
+    tmp = AE_ZERO16(); \
+    while(((unsigned int)p_char + offset_##p_char) & 3) {\
+        ae_int16x4 tmp2 = AE_MOVDA16(((short)*(p_char+offset_##p_char)) << 8); \
+        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
+        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
+        tmp = AE_OR16(tmp, tmp2); \
+        rs_##p_char += 16;  \
+        ls_##p_char -= 16; \
+        offset_##p_char++; \
+    }\
+    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
+
+#define PRIME_8X4U(p_char, tmp) \
+    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
+    rs_##p_char = 0; \
+    ls_##p_char = 64; \
+    tmp = AE_ZERO16(); \
+    while(((unsigned int)p_char + offset_##p_char) & 3) {\
+        ae_int16x4 tmp2 = AE_MOVDA16(*(((const UWORD8 *)p_char)+offset_##p_char)); \
+        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
+        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
+        tmp = AE_OR16(tmp, tmp2); \
+        rs_##p_char += 16;  \
+        ls_##p_char -= 16; \
+        offset_##p_char++; \
+    }\
+    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
+
+#define AE_LA8X4F_IP(d, a, p) { \
+    ae_int16x4 d_tmp, d_tmp2; \
+    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
+    p += 4; \
+    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p)); \
+    d = AE_OR16(a, d_tmp2); \
+    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p)); \
+}
+
+#define AE_LA8X4U_IP(d, a, p) { \
+    ae_int16x4 d_tmp, d_tmp2; \
+    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
+    p += 4; \
+    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p+8)); \
+    d = AE_OR16(a, d_tmp2); \
+    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p-8)); \
+}
+
+/* acc += row . vec for an 8 bit matrix row at any address and an aligned
+   vector (4 bytes for 8 bit, 8 bytes for 16 bit), cols need not be a
+   multiple of 4. The row goes through the U variant and is moved up by one
+   byte to get AE_L8X4F layout. Products are on the same scale as
+   KERNEL_MAT1_VEC1_8b_8b / _8b_16b / _ASYM8b_ASYM8b so the result can go
+   through the usual ADD_BIAS and STORE macros. */
+#define MAC_ROW_UNALIGNED_8b_8b(acc, p_row, p_vec, cols) \
+{ \
+  WORD8 *p_row_u = (WORD8 *)(p_row); \
+  WORD8 *p_vec_u = (WORD8 *)(p_vec); \
+  ae_int16x4 row_u_a, d_row_u, d_vec_u; \
+  int c_u; \
+  PRIME_8X4U(p_row_u, row_u_a); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_LA8X4U_IP(d_row_u, row_u_a, p_row_u); \
+    d_row_u = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(d_row_u), 8)); \
+    AE_L8X4F_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_WORD8X4); \
+    AE_MULAAAAQ16(acc, d_vec_u, d_row_u); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    AE_MULA32_LL(acc, AE_MOVDA32(((WORD32)p_vec_u[c_u]) << 8), AE_MOVDA32(((WORD32)p_row_u[c_u]) << 8)); \
+  } \
+}
+
+#define MAC_ROW_UNALIGNED_8b_16b(acc, p_row, p_vec, cols) \
+{ \
+  WORD8 *p_row_u = (WORD8 *)(p_row); \
+  ae_int16x4 *p_vec_u = (ae_int16x4 *)(p_vec); \
+  ae_int16x4 row_u_a, d_row_u, d_vec_u; \
+  int c_u; \
+  PRIME_8X4U(p_row_u, row_u_a); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_LA8X4U_IP(d_row_u, row_u_a, p_row_u); \
+    d_row_u = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(d_row_u), 8)); \
+    AE_L16X4_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_INT16X4); \
+    AE_MULAAAAQ16(acc, d_vec_u, d_row_u); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    AE_MULA32_LL(acc, AE_MOVDA32(((WORD16 *)p_vec_u)[c_u]), AE_MOVDA32(((WORD32)p_row_u[c_u]) << 8)); \
+  } \
+}
+
+#define MAC_ROW_UNALIGNED_ASYM8b_ASYM8b(acc, p_row, p_vec, cols, row_zero_bias, vec_zero_bias) \
+{ \
+  WORD8 *p_row_u = (WORD8 *)(p_row); \
+  WORD8 *p_vec_u = (WORD8 *)(p_vec); \
+  ae_int16x4 row_u_a, d_row_u, d_vec_u; \
+  int c_u; \
+  PRIME_8X4U(p_row_u, row_u_a); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_LA8X4U_IP(d_row_u, row_u_a, p_row_u); \
+    AE_L8X4F_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_WORD8X4); \
+    d_vec_u = AE_MOVF16X4_FROMF64(AE_SRLI64(AE_MOVF64_FROMF16X4(d_vec_u), 8)); \
+    d_row_u = AE_ADD16(d_row_u, AE_MOVDA16(row_zero_bias)); \
+    d_vec_u = AE_ADD16(d_vec_u, AE_MOVDA16(vec_zero_bias)); \
+    AE_MULAAAAQ16(acc, d_vec_u, d_row_u); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    AE_MULA32_LL(acc, AE_MOVDA32(((UWORD8 *)p_vec_u)[c_u] + (vec_zero_bias)), \
+                      AE_MOVDA32(((UWORD8 *)p_row_u)[c_u] + (row_zero_bias))); \
+  } \
+}
+
+/* Four rows of the same matrix against one vector, rows are row_stride
+   bytes apart and each gets its own alignment register and accumulator so
+   the vector is loaded once per 4 columns. Same arithmetic as four
+   MAC_ROW_UNALIGNED_* calls. */
+#define LOAD_ROW_UNALIGNED_8b(d, a, p) \
+  AE_LA8X4U_IP(d, a, p); \
+  d = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(d), 8));
+
+#define MAC_4ROWS_UNALIGNED_8b_8b(acc0, acc1, acc2, acc3, p_row, row_stride, p_vec, cols) \
+{ \
+  WORD8 *p_r0 = (WORD8 *)(p_row); \
+  WORD8 *p_r1 = p_r0 + (row_stride); \
+  WORD8 *p_r2 = p_r1 + (row_stride); \
+  WORD8 *p_r3 = p_r2 + (row_stride); \
+  WORD8 *p_vec_u = (WORD8 *)(p_vec); \
+  ae_int16x4 a_r0, a_r1, a_r2, a_r3; \
+  ae_int16x4 d_r0, d_r1, d_r2, d_r3, d_vec_u; \
+  int c_u; \
+  PRIME_8X4U(p_r0, a_r0); \
+  PRIME_8X4U(p_r1, a_r1); \
+  PRIME_8X4U(p_r2, a_r2); \
+  PRIME_8X4U(p_r3, a_r3); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_L8X4F_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_WORD8X4); \
+    LOAD_ROW_UNALIGNED_8b(d_r0, a_r0, p_r0); \
+    LOAD_ROW_UNALIGNED_8b(d_r1, a_r1, p_r1); \
+    LOAD_ROW_UNALIGNED_8b(d_r2, a_r2, p_r2); \
+    LOAD_ROW_UNALIGNED_8b(d_r3, a_r3, p_r3); \
+    AE_MULAAAAQ16(acc0, d_vec_u, d_r0); \
+    AE_MULAAAAQ16(acc1, d_vec_u, d_r1); \
+    AE_MULAAAAQ16(acc2, d_vec_u, d_r2); \
+    AE_MULAAAAQ16(acc3, d_vec_u, d_r3); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    ae_int32x2 v_u = AE_MOVDA32(((WORD32)p_vec_u[c_u]) << 8); \
+    AE_MULA32_LL(acc0, v_u, AE_MOVDA32(((WORD32)p_r0[c_u]) << 8)); \
+    AE_MULA32_LL(acc1, v_u, AE_MOVDA32(((WORD32)p_r1[c_u]) << 8)); \
+    AE_MULA32_LL(acc2, v_u, AE_MOVDA32(((WORD32)p_r2[c_u]) << 8)); \
+    AE_MULA32_LL(acc3, v_u, AE_MOVDA32(((WORD32)p_r3[c_u]) << 8)); \
+  } \
+}
+
+#define MAC_4ROWS_UNALIGNED_8b_16b(acc0, acc1, acc2, acc3, p_row, row_stride, p_vec, cols) \
+{ \
+  WORD8 *p_r0 = (WORD8 *)(p_row); \
+  WORD8 *p_r1 = p_r0 + (row_stride); \
+  WORD8 *p_r2 = p_r1 + (row_stride); \
+  WORD8 *p_r3 = p_r2 + (row_stride); \
+  ae_int16x4 *p_vec_u = (ae_int16x4 *)(p_vec); \
+  ae_int16x4 a_r0, a_r1, a_r2, a_r3; \
+  ae_int16x4 d_r0, d_r1, d_r2, d_r3, d_vec_u; \
+  int c_u; \
+  PRIME_8X4U(p_r0, a_r0); \
+  PRIME_8X4U(p_r1, a_r1); \
+  PRIME_8X4U(p_r2, a_r2); \
+  PRIME_8X4U(p_r3, a_r3); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_L16X4_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_INT16X4); \
+    LOAD_ROW_UNALIGNED_8b(d_r0, a_r0, p_r0); \
+    LOAD_ROW_UNALIGNED_8b(d_r1, a_r1, p_r1); \
+    LOAD_ROW_UNALIGNED_8b(d_r2, a_r2, p_r2); \
+    LOAD_ROW_UNALIGNED_8b(d_r3, a_r3, p_r3); \
+    AE_MULAAAAQ16(acc0, d_vec_u, d_r0); \
+    AE_MULAAAAQ16(acc1, d_vec_u, d_r1); \
+    AE_MULAAAAQ16(acc2, d_vec_u, d_r2); \
+    AE_MULAAAAQ16(acc3, d_vec_u, d_r3); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    ae_int32x2 v_u = AE_MOVDA32(((WORD16 *)p_vec_u)[c_u]); \
+    AE_MULA32_LL(acc0, v_u, AE_MOVDA32(((WORD32)p_r0[c_u]) << 8)); \
+    AE_MULA32_LL(acc1, v_u, AE_MOVDA32(((WORD32)p_r1[c_u]) << 8)); \
+    AE_MULA32_LL(acc2, v_u, AE_MOVDA32(((WORD32)p_r2[c_u]) << 8)); \
+    AE_MULA32_LL(acc3, v_u, AE_MOVDA32(((WORD32)p_r3[c_u]) << 8)); \
+  } \
+}
+
+#define MAC_4ROWS_UNALIGNED_ASYM8b_ASYM8b(acc0, acc1, acc2, acc3, p_row, row_stride, p_vec, cols, row_zero_bias, vec_zero_bias) \
+{ \
+  WORD8 *p_r0 = (WORD8 *)(p_row); \
+  WORD8 *p_r1 = p_r0 + (row_stride); \
+  WORD8 *p_r2 = p_r1 + (row_stride); \
+  WORD8 *p_r3 = p_r2 + (row_stride); \
+  WORD8 *p_vec_u = (WORD8 *)(p_vec); \
+  ae_int16x4 a_r0, a_r1, a_r2, a_r3; \
+  ae_int16x4 d_r0, d_r1, d_r2, d_r3, d_vec_u; \
+  ae_int16x4 row_zb_u = AE_MOVDA16(row_zero_bias); \
+  int c_u; \
+  PRIME_8X4U(p_r0, a_r0); \
+  PRIME_8X4U(p_r1, a_r1); \
+  PRIME_8X4U(p_r2, a_r2); \
+  PRIME_8X4U(p_r3, a_r3); \
+  for(c_u = 0; c_u < ((cols) >> 2); c_u++) \
+  { \
+    AE_L8X4F_IP(d_vec_u, p_vec_u, INCREMENT_IN_BYTES_FOR_WORD8X4); \
+    d_vec_u = AE_MOVF16X4_FROMF64(AE_SRLI64(AE_MOVF64_FROMF16X4(d_vec_u), 8)); \
+    d_vec_u = AE_ADD16(d_vec_u, AE_MOVDA16(vec_zero_bias)); \
+    AE_LA8X4U_IP(d_r0, a_r0, p_r0); \
+    AE_LA8X4U_IP(d_r1, a_r1, p_r1); \
+    AE_LA8X4U_IP(d_r2, a_r2, p_r2); \
+    AE_LA8X4U_IP(d_r3, a_r3, p_r3); \
+    AE_MULAAAAQ16(acc0, d_vec_u, AE_ADD16(d_r0, row_zb_u)); \
+    AE_MULAAAAQ16(acc1, d_vec_u, AE_ADD16(d_r1, row_zb_u)); \
+    AE_MULAAAAQ16(acc2, d_vec_u, AE_ADD16(d_r2, row_zb_u)); \
+    AE_MULAAAAQ16(acc3, d_vec_u, AE_ADD16(d_r3, row_zb_u)); \
+  } \
+  for(c_u = 0; c_u < ((cols) & 3); c_u++) \
+  { \
+    ae_int32x2 v_u = AE_MOVDA32(((UWORD8 *)p_vec_u)[c_u] + (vec_zero_bias)); \
+    AE_MULA32_LL(acc0, v_u, AE_MOVDA32(((UWORD8 *)p_r0)[c_u] + (row_zero_bias))); \
+    AE_MULA32_LL(acc1, v_u, AE_MOVDA32(((UWORD8 *)p_r1)[c_u] + (row_zero_bias))); \
+    AE_MULA32_LL(acc2, v_u, AE_MOVDA32(((UWORD8 *)p_r2)[c_u] + (row_zero_bias))); \
+    AE_MULA32_LL(acc3, v_u, AE_MOVDA32(((UWORD8 *)p_r3)[c_u] + (row_zero_bias))); \
+  } \
+}
+
+/* Path for matXvec kernels whose matrix rows are not 4 byte aligned or not
+   a multiple of 4 long. Rows go in groups of 4 through MAC_4ROWS, the rest
+   one at a time through MAC_ROW. Accumulator, bias and store come from the
+   UNROLL_* macros bound by the kernel, so the output is the same as the
+   unrolled path would give. */
+#define MATXVEC_ROWS_UNALIGNED(MAC_4ROWS, MAC_ROW) \
+  SETUP_BIAS; \
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4) \
+  { \
+    UNROLL_SETUP_ACC(0); UNROLL_SETUP_ACC(1); \
+    UNROLL_SETUP_ACC(2); UNROLL_SETUP_ACC(3); \
+    MAC_4ROWS(_ae_int64_acc_0, _ae_int64_acc_1, _ae_int64_acc_2, _ae_int64_acc_3, \
+              &p_mat1[m_itr*row_stride1], row_stride1, p_vec1, cols1); \
+    if(p_mat2 && p_vec2) \
+    { \
+      MAC_4ROWS(_ae_int64_acc_0, _ae_int64_acc_1, _ae_int64_acc_2, _ae_int64_acc_3, \
+                &p_mat2[m_itr*row_stride2], row_stride2, p_vec2, cols2); \
+    } \
+    UNROLL_ADD_BIAS_ACC(0); UNROLL_STORE_ACC(0); \
+    UNROLL_ADD_BIAS_ACC(1); UNROLL_STORE_ACC(1); \
+    UNROLL_ADD_BIAS_ACC(2); UNROLL_STORE_ACC(2); \
+    UNROLL_ADD_BIAS_ACC(3); UNROLL_STORE_ACC(3); \
+  } \
+  for(; m_itr < rows; m_itr++) \
+  { \
+    UNROLL_SETUP_ACC(0); \
+    MAC_ROW(_ae_int64_acc_0, &p_mat1[m_itr*row_stride1], p_vec1, cols1); \
+    if(p_mat2 && p_vec2) \
+    { \
+      MAC_ROW(_ae_int64_acc_0, &p_mat2[m_itr*row_stride2], p_vec2, cols2); \
+    } \
+    UNROLL_ADD_BIAS_ACC(0); UNROLL_STORE_ACC(0); \
+  }
+
+/* Batch and matmul form of the above: each block of 4 rows stays the
+   current one while every vector goes through it, so the rows are streamed
+   once per vector but their bias is loaded only once. VEC(v) gives the
+   address of vector v and ADJUST(r,v) the requantize step of kernels that
+   have one (MATXVEC_NO_ADJUST otherwise). UNROLL_*_BATCH and LOAD_BIAS are
+   bound by the kernel as for MXV_LOOPS. */
+#define MATXVEC_NO_ADJUST(idx_row, idx_vec)
+#define MATXVEC_VEC_BATCH(idx_vec)    p_vec1[idx_vec]
+#define MATXVEC_VEC_MATMUL(idx_vec)   &p_vec1[(idx_vec)*vec_offset]
+
+#define MATXVEC_BATCH_STORE_ROW_UNALIGNED(idx_row, ADJUST) \
+  _ae_int64_sat_bias = _ae_int64_bias_ ##idx_row; \
+  UNROLL_ADD_BIAS_ACC_BATCH(idx_row,0); \
+  ADJUST(idx_row,0); \
+  UNROLL_STORE_ACC_BATCH(idx_row,0);
+
+#define MATXVEC_BATCH_ROWS_UNALIGNED(MAC_4ROWS, MAC_ROW, VEC, ADJUST) \
+  SETUP_BIAS; \
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4) \
+  { \
+    ae_int64 _ae_int64_bias_0, _ae_int64_bias_1, _ae_int64_bias_2, _ae_int64_bias_3; \
+    LOAD_BIAS; _ae_int64_bias_0 = _ae_int64_sat_bias; \
+    LOAD_BIAS; _ae_int64_bias_1 = _ae_int64_sat_bias; \
+    LOAD_BIAS; _ae_int64_bias_2 = _ae_int64_sat_bias; \
+    LOAD_BIAS; _ae_int64_bias_3 = _ae_int64_sat_bias; \
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++) \
+    { \
+      UNROLL_SETUP_ACC_BATCH(0,0); UNROLL_SETUP_ACC_BATCH(1,0); \
+      UNROLL_SETUP_ACC_BATCH(2,0); UNROLL_SETUP_ACC_BATCH(3,0); \
+      MAC_4ROWS(_ae_int64_acc_0_0, _ae_int64_acc_1_0, _ae_int64_acc_2_0, _ae_int64_acc_3_0, \
+                &p_mat1[m_itr*row_stride1], row_stride1, VEC(vec_itr), cols1); \
+      MATXVEC_BATCH_STORE_ROW_UNALIGNED(0, ADJUST); \
+      MATXVEC_BATCH_STORE_ROW_UNALIGNED(1, ADJUST); \
+      MATXVEC_BATCH_STORE_ROW_UNALIGNED(2, ADJUST); \
+      MATXVEC_BATCH_STORE_ROW_UNALIGNED(3, ADJUST); \
+    } \
+  } \
+  for(; m_itr < rows; m_itr++) \
+  { \
+    LOAD_BIAS; \
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++) \
+    { \
+      UNROLL_SETUP_ACC_BATCH(0,0); \
+      MAC_ROW(_ae_int64_acc_0_0, &p_mat1[m_itr*row_stride1], VEC(vec_itr), cols1); \
+      UNROLL_ADD_BIAS_ACC_BATCH(0,0); \
+      ADJUST(0,0); \
+      UNROLL_STORE_ACC_BATCH(0,0); \
+    } \
+  }
+
+/* The asym8 kernels name their zero biases mat1_zero_bias / vec1_zero_bias */
+#define MAC_4ROWS_UNALIGNED_ASYM8b_ZB(acc0, acc1, acc2, acc3, p_row, row_stride, p_vec, cols) \
+  MAC_4ROWS_UNALIGNED_ASYM8b_ASYM8b(acc0, acc1, acc2, acc3, p_row, row_stride, p_vec, cols, \
+                                    mat1_zero_bias, vec1_zero_bias)
+#define MAC_ROW_UNALIGNED_ASYM8b_ZB(acc, p_row, p_vec, cols) \
+  MAC_ROW_UNALIGNED_ASYM8b_ASYM8b(acc, p_row, p_vec, cols, mat1_zero_bias, vec1_zero_bias)
+
+#endif /* __XA_NN_MATXVEC_UNALIGNED_H__ */
@@ -0,0 +1,485 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_batch_unroll.h"
+
+/* Single vector matXvec kernels with a selectable row unroll, see
+   MATXVEC_DEFINE_ROW_VARIANTS for the instantiated combinations. */
+
+/* AUTO resolves to the rows of the batch selection for one vector */
+static WORD32 row_unroll_select(WORD32 mat_precision, WORD32 vec_precision,
+                                WORD32 rows, WORD32 cols1)
+{
+  WORD32 unroll = xa_nn_matXvec_unroll_select(NULL, 0, mat_precision, vec_precision, rows, cols1, 1);
+  return XA_NN_MATXVEC_UNROLL(XA_NN_MATXVEC_UNROLL_ROWS(unroll), 1);
+}
+
+/*------------------------- 16x16, 32b to scratch --------------------------*/
+
+#define UNROLL_SETUP_ACC        SETUP_ACC_FOR_16bx16b
+#define UNROLL_SETUP_MAT1       SETUP_MAT1_16b
+#define UNROLL_SETUP_MAT2       SETUP_MAT2_16b
+#define UNROLL_KERNEL_MAT1_VEC1 KERNEL_MAT1_VEC1_16b_16b
+#define UNROLL_KERNEL_MAT2_VEC2 KERNEL_MAT2_VEC2_16b_16b
+#define UNROLL_STORE_ACC        STORE_ACC_16bx16b_AT_SCRATCH_32b
+#define SETUP_VEC1              SETUP_VEC1_16b
+#define SETUP_VEC2              SETUP_VEC2_16b
+#define LOAD_VEC1               LOAD_VEC1_16b
+#define LOAD_VEC2               LOAD_VEC2_16b
+
+#define SETUP_BIAS              SETUP_BIAS_16b
+#define UNROLL_ADD_BIAS_ACC     ADD_BIAS_16b_ACC_FOR_16bx16b
+MATXVEC_DEFINE_ROW_VARIANTS(matXvec_16x16_scratch_b16, WORD16, WORD16, WORD16)
+#undef SETUP_BIAS
+#undef UNROLL_ADD_BIAS_ACC
+
+#define SETUP_BIAS              SETUP_BIAS_64b
+#define UNROLL_ADD_BIAS_ACC     ADD_BIAS_64b_ACC_FOR_16bx16b
+MATXVEC_DEFINE_ROW_VARIANTS(matXvec_16x16_scratch_b64, WORD16, WORD16, WORD16)
+#undef SETUP_BIAS
+#undef UNROLL_ADD_BIAS_ACC
+
+#undef UNROLL_SETUP_ACC
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_MAT2
+#undef UNROLL_KERNEL_MAT1_VEC1
+#undef UNROLL_KERNEL_MAT2_VEC2
+#undef UNROLL_STORE_ACC
+#undef SETUP_VEC1
+#undef SETUP_VEC2
+#undef LOAD_VEC1
+#undef LOAD_VEC2
+
+/* Pre-activation result of xa_nn_matXvec_16x16_16_sigmoid / _tanh in
+   p_scratch */
+static WORD32 matXvec_16x16_scratch_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_precision != 16 && bias_precision != 64), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
+  }
+
+  if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+  {
+    unroll = row_unroll_select(16, 16, rows, cols1);
+  }
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD16, WORD16, WORD32);
+
+  if(bias_precision == 64)
+  {
+    MATXVEC_CALL_ROW_VARIANT(matXvec_16x16_scratch_b64, unroll, p_scratch);
+  }
+  else
+  {
+    MATXVEC_CALL_ROW_VARIANT(matXvec_16x16_scratch_b16, unroll, p_scratch);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_16x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  WORD32 ret = matXvec_16x16_scratch_unroll(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+      rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+      bias_precision, p_scratch, unroll);
+  if(ret != 0)
+    return ret;
+
+  xa_nn_vec_sigmoid_32_16((pWORD16) p_out, (pWORD32) p_scratch, rows);
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_16x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD16 * __restrict__ p_mat1,
+         WORD16 * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  WORD32 ret = matXvec_16x16_scratch_unroll(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+      rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+      bias_precision, p_scratch, unroll);
+  if(ret != 0)
+    return ret;
+
+  xa_nn_vec_tanh_32_16((pWORD16) p_out, (pWORD32) p_scratch, rows);
+
+  return 0;
+}
+
+/*-------------------------- 8x16, 32b to scratch --------------------------*/
+
+#define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx16b
+#define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
+#define UNROLL_SETUP_MAT2       SETUP_MAT2_8b
+#define UNROLL_KERNEL_MAT1_VEC1 KERNEL_MAT1_VEC1_8b_16b
+#define UNROLL_KERNEL_MAT2_VEC2 KERNEL_MAT2_VEC2_8b_16b
+#define UNROLL_STORE_ACC        STORE_ACC_8bx16b_AT_SCRATCH_32b
+#define SETUP_VEC1              SETUP_VEC1_16b
+#define SETUP_VEC2              SETUP_VEC2_16b
+#define LOAD_VEC1               LOAD_VEC1_16b
+#define LOAD_VEC2               LOAD_VEC2_16b
+
+#define SETUP_BIAS              SETUP_BIAS_16b
+#define UNROLL_ADD_BIAS_ACC     ADD_BIAS_16b_ACC_FOR_8bx16b
+MATXVEC_DEFINE_ROW_VARIANTS(matXvec_8x16_scratch_b16, WORD16, WORD8, WORD16)
+#undef SETUP_BIAS
+#undef UNROLL_ADD_BIAS_ACC
+
+#define SETUP_BIAS              SETUP_BIAS_64b
+#define UNROLL_ADD_BIAS_ACC     ADD_BIAS_64b_ACC_FOR_8bx16b
+MATXVEC_DEFINE_ROW_VARIANTS(matXvec_8x16_scratch_b64, WORD16, WORD8, WORD16)
+#undef SETUP_BIAS
+#undef UNROLL_ADD_BIAS_ACC
+
+#undef UNROLL_SETUP_ACC
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_MAT2
+#undef UNROLL_KERNEL_MAT1_VEC1
+#undef UNROLL_KERNEL_MAT2_VEC2
+#undef UNROLL_STORE_ACC
+#undef SETUP_VEC1
+#undef SETUP_VEC2
+#undef LOAD_VEC1
+#undef LOAD_VEC2
+
+/* Rows that are not 4 byte aligned or not a multiple of 4 long take the
+   unaligned path of the regular kernel */
+#define UNALIGNED_ROWS_8b \
+  ((((cols1 | row_stride1) & 3) != 0) || \
+   ((p_mat2 != NULL) && (((cols2 | row_stride2) & 3) != 0)))
+
+/* Pre-activation result of xa_nn_matXvec_8x16_16_sigmoid / _tanh in
+   p_scratch, rows must be aligned */
+static WORD32 matXvec_8x16_scratch_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_precision != 16 && bias_precision != 64), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+  }
+
+  if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+  {
+    unroll = row_unroll_select(8, 16, rows, cols1);
+  }
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD16, WORD32);
+
+  if(bias_precision == 64)
+  {
+    MATXVEC_CALL_ROW_VARIANT(matXvec_8x16_scratch_b64, unroll, p_scratch);
+  }
+  else
+  {
+    MATXVEC_CALL_ROW_VARIANT(matXvec_8x16_scratch_b16, unroll, p_scratch);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_8x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  WORD32 ret;
+
+  if(UNALIGNED_ROWS_8b)
+  {
+    return xa_nn_matXvec_8x16_16_sigmoid(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+        rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+        bias_precision, p_scratch);
+  }
+
+  ret = matXvec_8x16_scratch_unroll(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+      rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+      bias_precision, p_scratch, unroll);
+  if(ret != 0)
+    return ret;
+
+  xa_nn_vec_sigmoid_32_16((pWORD16) p_out, (pWORD32) p_scratch, rows);
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_8x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,
+         WORD8  * __restrict__ p_mat1,
+         WORD8  * __restrict__ p_mat2,
+         WORD16 * __restrict__ p_vec1,
+         WORD16 * __restrict__ p_vec2,
+         VOID   * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 bias_precision,
+         VOID   * __restrict__ p_scratch,
+         WORD32 unroll)
+{
+  WORD32 ret;
+
+  if(UNALIGNED_ROWS_8b)
+  {
+    return xa_nn_matXvec_8x16_16_tanh(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+        rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+        bias_precision, p_scratch);
+  }
+
+  ret = matXvec_8x16_scratch_unroll(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+      rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift,
+      bias_precision, p_scratch, unroll);
+  if(ret != 0)
+    return ret;
+
+  xa_nn_vec_tanh_32_16((pWORD16) p_out, (pWORD32) p_scratch, rows);
+
+  return 0;
+}
+
+/*---------------------------------- 8x8_8 ---------------------------------*/
+
+#define UNROLL_SETUP_ACC        SETUP_ACC_FOR_8bx8b
+#define UNROLL_SETUP_MAT1       SETUP_MAT1_8b
+#define UNROLL_SETUP_MAT2       SETUP_MAT2_8b
+#define UNROLL_KERNEL_MAT1_VEC1 KERNEL_MAT1_VEC1_8b_8b
+#define UNROLL_KERNEL_MAT2_VEC2 KERNEL_MAT2_VEC2_8b_8b
+#define UNROLL_STORE_ACC        STORE_ACC_8bx8b_AT_OUT_8b
+#define SETUP_VEC1              SETUP_VEC1_8b
+#define SETUP_VEC2              SETUP_VEC2_8b
+#define LOAD_VEC1               LOAD_VEC1_8b
+#define LOAD_VEC2               LOAD_VEC2_8b
+#define SETUP_BIAS              SETUP_BIAS_8b
+#define UNROLL_ADD_BIAS_ACC     ADD_BIAS_8b_ACC_FOR_8bx8b
+
+MATXVEC_DEFINE_ROW_VARIANTS(xa_nn_matXvec_8x8_8, WORD8, WORD8, WORD8)
+
+WORD32 xa_nn_matXvec_8x8_8_unroll(
+         WORD8 * __restrict__ p_out,
+         WORD8 * __restrict__ p_mat1,
+         WORD8 * __restrict__ p_mat2,
+         WORD8 * __restrict__ p_vec1,
+         WORD8 * __restrict__ p_vec2,
+         WORD8 * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 cols2,
+         WORD32 row_stride1,
+         WORD32 row_stride2,
+         WORD32 acc_shift,
+         WORD32 bias_shift,
+         WORD32 unroll)
+{
+  if(UNALIGNED_ROWS_8b)
+  {
+    return xa_nn_matXvec_8x8_8(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias,
+        rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift);
+  }
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, (ALIGNMENT>>1), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, (ALIGNMENT>>1), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+  }
+
+  if(unroll == XA_NN_MATXVEC_UNROLL_AUTO)
+  {
+    unroll = row_unroll_select(8, 8, rows, cols1);
+  }
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD16);
+
+  MATXVEC_CALL_ROW_VARIANT(xa_nn_matXvec_8x8_8, unroll, NULL);
+
+  return 0;
+}
+
+#undef UNROLL_SETUP_ACC
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_MAT2
+#undef UNROLL_KERNEL_MAT1_VEC1
+#undef UNROLL_KERNEL_MAT2_VEC2
+#undef UNROLL_STORE_ACC
+#undef SETUP_VEC1
+#undef SETUP_VEC2
+#undef LOAD_VEC1
+#undef LOAD_VEC2
+#undef SETUP_BIAS
+#undef UNROLL_ADD_BIAS_ACC
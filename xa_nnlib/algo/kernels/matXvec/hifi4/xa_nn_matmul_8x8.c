@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+    #ifdef ROW_UNROLL
+        #undef ROW_UNROLL
+        #define ROW_UNROLL 4
+    #else
+    #define ROW_UNROLL 4
+    #endif
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
+#include "xa_nn_matXvec_batch_unroll.h"
+
+/*----------------------------Main function---------------------------------*/
+
+WORD32 xa_nn_matmul_8x8_8(
+         WORD8 * __restrict__ p_out,            /* output: vec_count x rows */
+         const WORD8 * __restrict__ p_mat1,     /* matrix1: rows x cols1 */
+         const WORD8 * __restrict__ p_vec1,     /* vectors: vec_count x cols1 */
+         const WORD8 * __restrict__ p_bias,     /* bias: rows x 1 */
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,                    /* row stride for matrix1 */
+         WORD32 acc_shift,                      /* out accumulator shift amount */
+         WORD32 bias_shift,                     /* bias shift amount */
+         WORD32 vec_count,
+         WORD32 vec_offset,                     /* offset from one vector to the next */
+         WORD32 out_offset,                     /* offset from one output vector to the next */
+         WORD32 out_stride)                     /* offset from one output row to the next */
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, (ALIGNMENT>>1), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_offset < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+    MATMUL_CHK_OUT_LAYOUT(rows, vec_count, out_offset, out_stride);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((vec_offset&3) != 0), -1);
+
+    /* Iterators used in for loops */
+    int m_itr, c_itr, vec_itr;
+
+    #define UNROLL_SETUP_ACC_BATCH              SETUP_ACC_BATCH_FOR_8bx8b
+    #define UNROLL_SETUP_MAT1                   SETUP_MAT1_8b
+    #define UNROLL_SETUP_VEC_BATCH              SETUP_VEC_OFFSET_BATCH_8b
+    #define SETUP_BIAS                          SETUP_BIAS_8b
+    #define UNROLL_LOAD_VEC_BATCH               LOAD_VEC_BATCH_8b
+    #define UNROLL_LOAD_ROW_MAT1                LOAD_ROW_MAT1_8b
+    #define LOAD_BIAS                           LOAD_BIAS_8b_FOR_8bx8b
+    #define UNROLL_KERNEL_MAT1_VEC_BATCH        KERNEL_MAT1_VEC_BATCH_8b_8b
+    #define UNROLL_ADD_BIAS_ACC_BATCH           ADD_BIAS_BATCH_8b_ACC_FOR_8bx8b
+    #define UNROLL_STORE_ACC_BATCH              STORE_ACC_MATMUL_8bx8b_AT_OUT_8b
+
+    ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD8, WORD8);
+
+    if(((cols1 | row_stride1) & 3) != 0)
+    {
+        /* Rows that are not 4 byte aligned or not a multiple of 4 long,
+           4 rows at a time against every vector with unaligned loads */
+        MATXVEC_BATCH_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_8b_8b, MAC_ROW_UNALIGNED_8b_8b,
+                                     MATXVEC_VEC_MATMUL, MATXVEC_NO_ADJUST);
+    }
+    else
+    {
+        MXV_LOOPS(MATMUL_ROW_UNROLL, MATMUL_VEC_UNROLL)
+    }
+
+    #undef UNROLL_SETUP_ACC_BATCH
+    #undef UNROLL_SETUP_MAT1
+    #undef UNROLL_SETUP_VEC_BATCH
+    #undef SETUP_BIAS
+    #undef UNROLL_LOAD_VEC_BATCH
+    #undef UNROLL_LOAD_ROW_MAT1
+    #undef LOAD_BIAS
+    #undef UNROLL_KERNEL_MAT1_VEC_BATCH
+    #undef UNROLL_ADD_BIAS_ACC_BATCH
+    #undef UNROLL_STORE_ACC_BATCH
+
+    return 0;
+}
@@ -0,0 +1,266 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+
+#ifdef ROW_UNROLL
+#undef ROW_UNROLL
+#endif
+#define ROW_UNROLL  4
+
+#define GET_SUM_BY_MULTIPLY
+
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_matXvec_unaligned.h"
+#include "xa_nn_matXvec_batch_unroll.h"
+
+/* Residual add of xa_nn_elm_add_asym8xasym8_asym8, done on the clamped
+   result before it is stored. The residual element sits at the same position
+   in p_res as the result does in p_out. */
+#define MULTIPLY_BY_QUANTIZED_MULTIPLIER_X1(out, inp, multiplier, lsh) \
+  out = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+  out = AE_ROUND32F64SSYM(AE_SLAA64S(AE_SLAI64(AE_MOVINT64_FROMINT32X2(out), 32), lsh));
+
+#define MATMUL_RES(idx_row,idx_vec) \
+  p_res[(vec_itr + idx_vec) * out_offset + (m_itr + idx_row) * out_stride]
+
+#define STORE_ACC_MATMUL_ASYM8bxASYM8b_ADD_RES_AT_OUT_ASYM8b(idx_row,idx_vec) \
+  _ae_int32x2_acc_ ##idx_row ##_ ##idx_vec = AE_MIN32(AE_MAX32(_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec, AE_MOVDA32(out_activation_min)), AE_MOVDA32(out_activation_max)); \
+  { \
+    ae_int32x2 _ae_int32x2_res1, _ae_int32x2_res2; \
+    _ae_int32x2_res1 = AE_SUB32(_ae_int32x2_acc_ ##idx_row ##_ ##idx_vec, AE_MOVDA32(out_zero_bias)); \
+    _ae_int32x2_res2 = AE_ADD32(AE_MOVDA32((WORD32)MATMUL_RES(idx_row,idx_vec)), AE_MOVDA32(res_zero_bias)); \
+    _ae_int32x2_res1 = AE_SLAA32S(_ae_int32x2_res1, add_left_shift); \
+    _ae_int32x2_res2 = AE_SLAA32S(_ae_int32x2_res2, add_left_shift); \
+    MULTIPLY_BY_QUANTIZED_MULTIPLIER_X1(_ae_int32x2_res1, _ae_int32x2_res1, add_inp1_multiplier, add_inp1_left_shift); \
+    MULTIPLY_BY_QUANTIZED_MULTIPLIER_X1(_ae_int32x2_res2, _ae_int32x2_res2, add_inp2_multiplier, add_inp2_left_shift); \
+    _ae_int32x2_res1 = AE_ADD32S(_ae_int32x2_res1, _ae_int32x2_res2); \
+    MULTIPLY_BY_QUANTIZED_MULTIPLIER_X1(_ae_int32x2_res1, _ae_int32x2_res1, add_out_multiplier, add_out_left_shift); \
+    _ae_int32x2_res1 = AE_ADD32S(_ae_int32x2_res1, AE_MOVDA32(add_out_zero_bias)); \
+    _ae_int32x2_res1 = AE_MIN32(AE_MAX32(_ae_int32x2_res1, AE_MOVDA32(add_activation_min)), AE_MOVDA32(add_activation_max)); \
+    MATMUL_OUT(idx_row,idx_vec) = (UWORD8)AE_MOVAD32_L(_ae_int32x2_res1); \
+  }
+
+static WORD32 matmul_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const UWORD8 * __restrict__ p_res,
+    WORD32 res_zero_bias,
+    const xa_nn_inv_res_residual_asym8_t *p_add)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset < 0), -1);
+  MATMUL_CHK_OUT_LAYOUT(rows, vec_count, out_offset, out_stride);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -255 || mat1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -255 || vec1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < 0 || out_activation_min > out_activation_max || out_activation_max > 255), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((vec_offset&3) != 0), -1);
+
+  /* Iterators used in for loops */
+  int m_itr, c_itr, vec_itr;
+  /* Shifts to match with Tensorflow */
+  int left_shift, right_shift;
+  /* Residual add parameters, unused without p_res */
+  WORD32 add_out_zero_bias = 0, add_out_left_shift = 0, add_out_multiplier = 0;
+  WORD32 add_activation_min = 0, add_activation_max = 255;
+  WORD32 add_inp1_left_shift = 0, add_inp1_multiplier = 0;
+  WORD32 add_inp2_left_shift = 0, add_inp2_multiplier = 0;
+  WORD32 add_left_shift = 0;
+
+  if(p_res != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_add, -1);
+    XA_NNLIB_ARG_CHK_COND((res_zero_bias < -255 || res_zero_bias > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->out_zero_bias < 0 || p_add->out_zero_bias > 255), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->out_left_shift < -31 || p_add->out_left_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->inp1_left_shift < -31 || p_add->inp1_left_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->inp2_left_shift < -31 || p_add->inp2_left_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->left_shift < 0 || p_add->left_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->out_multiplier < 0 || p_add->inp1_multiplier < 0 || p_add->inp2_multiplier < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_add->out_activation_min < 0 || p_add->out_activation_min > p_add->out_activation_max || p_add->out_activation_max > 255), -1);
+    add_out_zero_bias = p_add->out_zero_bias;
+    add_out_left_shift = p_add->out_left_shift;
+    add_out_multiplier = p_add->out_multiplier;
+    add_activation_min = p_add->out_activation_min;
+    add_activation_max = p_add->out_activation_max;
+    add_inp1_left_shift = p_add->inp1_left_shift;
+    add_inp1_multiplier = p_add->inp1_multiplier;
+    add_inp2_left_shift = p_add->inp2_left_shift;
+    add_inp2_multiplier = p_add->inp2_multiplier;
+    add_left_shift = p_add->left_shift;
+  }
+
+/* Requantize and store in one step, MXV_BLOCK has no separate adjust stage */
+#define ADJUST_AND_STORE_ACC_MATMUL_ASYM8b(idx_row,idx_vec) \
+  ADJUST_ACC_BATCH_ASYM8b(idx_row,idx_vec); \
+  STORE_ACC_MATMUL_ASYM8bxASYM8b_AT_OUT_ASYM8b(idx_row,idx_vec)
+
+#define ADJUST_AND_STORE_RES_ACC_MATMUL_ASYM8b(idx_row,idx_vec) \
+  ADJUST_ACC_BATCH_ASYM8b(idx_row,idx_vec); \
+  STORE_ACC_MATMUL_ASYM8bxASYM8b_ADD_RES_AT_OUT_ASYM8b(idx_row,idx_vec)
+
+#define UNROLL_SETUP_ACC_BATCH                  SETUP_ACC_BATCH_FOR_ASYM8bxASYM8b
+#define UNROLL_SETUP_MAT1                       SETUP_MAT1_ASYM8b
+#define UNROLL_SETUP_VEC_BATCH                  SETUP_VEC_OFFSET_BATCH_ASYM8b
+#define SETUP_BIAS                              SETUP_BIAS_ASYM8b
+#define UNROLL_LOAD_VEC_BATCH                   LOAD_VEC_BATCH_ASYM8b
+#define UNROLL_LOAD_ROW_MAT1                    LOAD_ROW_MAT1_ASYM8b
+#define LOAD_BIAS                               LOAD_BIAS_ASYM8b
+#define UNROLL_KERNEL_MAT1_VEC_BATCH            KERNEL_MAT1_VEC_BATCH_ASYM8b_ASYM8b
+#define UNROLL_ADD_BIAS_ACC_BATCH               ADD_BIAS_BATCH_ASYM8b_ACC_FOR_ASYM8bxASYM8b
+
+/* Both store variants run the same loops */
+#define MATMUL_ASYM8b_LOOPS \
+  if(((cols1 | row_stride1) & 3) != 0) \
+  { \
+    /* Rows that are not 4 byte aligned or not a multiple of 4 long, \
+       4 rows at a time against every vector with unaligned loads */ \
+    MATXVEC_BATCH_ROWS_UNALIGNED(MAC_4ROWS_UNALIGNED_ASYM8b_ZB, MAC_ROW_UNALIGNED_ASYM8b_ZB, \
+                                 MATXVEC_VEC_MATMUL, MATXVEC_NO_ADJUST); \
+  } \
+  else \
+  { \
+    MXV_LOOPS(MATMUL_ROW_UNROLL, MATMUL_VEC_UNROLL) \
+  }
+
+  left_shift = out_shift<0?0:out_shift;
+  right_shift = out_shift>0?0:-out_shift;
+
+  if(p_res == NULL)
+  {
+#define UNROLL_STORE_ACC_BATCH                  ADJUST_AND_STORE_ACC_MATMUL_ASYM8b
+    MATMUL_ASYM8b_LOOPS
+#undef UNROLL_STORE_ACC_BATCH
+  }
+  else
+  {
+#define UNROLL_STORE_ACC_BATCH                  ADJUST_AND_STORE_RES_ACC_MATMUL_ASYM8b
+    MATMUL_ASYM8b_LOOPS
+#undef UNROLL_STORE_ACC_BATCH
+  }
+
+/* Undefining the defined macro to make them available for reuse */
+#undef MATMUL_ASYM8b_LOOPS
+#undef ADJUST_AND_STORE_ACC_MATMUL_ASYM8b
+#undef ADJUST_AND_STORE_RES_ACC_MATMUL_ASYM8b
+#undef UNROLL_SETUP_ACC_BATCH
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_VEC_BATCH
+#undef SETUP_BIAS
+#undef UNROLL_LOAD_VEC_BATCH
+#undef UNROLL_LOAD_ROW_MAT1
+#undef LOAD_BIAS
+#undef UNROLL_KERNEL_MAT1_VEC_BATCH
+#undef UNROLL_ADD_BIAS_ACC_BATCH
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max)
+{
+  return matmul_asym8xasym8_asym8(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias,
+      out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max,
+      NULL, 0, NULL);
+}
+
+WORD32 xa_nn_matmul_asym8xasym8_asym8_residual(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const UWORD8 * __restrict__ p_res,
+    WORD32 res_zero_bias,
+    const xa_nn_inv_res_residual_asym8_t *p_add)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_res, -1);
+  return matmul_asym8xasym8_asym8(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias,
+      out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max,
+      p_res, res_zero_bias, p_add);
+}
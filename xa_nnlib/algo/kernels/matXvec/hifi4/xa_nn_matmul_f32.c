@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "xtensa/tie/xt_hifi2.h"
+#include <xa_nnlib_kernels_api.h>
+    #ifdef ROW_UNROLL
+        #undef ROW_UNROLL
+        #define ROW_UNROLL 4
+    #else
+    #define ROW_UNROLL 4
+    #endif
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+/* One xtfloatx2 load per row / vector per iteration */
+#define MXV_INNER_ITERATIONS (cols1 >> 1)
+#include "xa_nn_matXvec_batch_unroll.h"
+
+/*----------------------------Main function---------------------------------*/
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matmul_f32xf32_f32,(
+    FLOAT32 * __restrict__ p_out,
+    const FLOAT32 * __restrict__ p_mat1,
+    const FLOAT32 * __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride))
+
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matmul_f32xf32_f32_residual,(
+    FLOAT32 * __restrict__ p_out,
+    const FLOAT32 * __restrict__ p_mat1,
+    const FLOAT32 * __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    const FLOAT32 * __restrict__ p_res))
+
+#else
+/* The residual element sits at the same position in p_res as the result
+   does in p_out, it is added after the bias */
+#define MATMUL_RES(idx_row,idx_vec) \
+  p_res[(vec_itr + idx_vec) * out_offset + (m_itr + idx_row) * out_stride]
+
+#define STORE_ACC_MATMUL_ADD_RES_AT_OUT_f32(idx_row,idx_vec) \
+  _xtfloat_acc_ ##idx_row ##_ ##idx_vec = XT_ADD_S(_xtfloat_acc_ ##idx_row ##_ ##idx_vec, MATMUL_RES(idx_row,idx_vec)); \
+  STORE_ACC_MATMUL_AT_OUT_f32(idx_row,idx_vec)
+
+static WORD32 matmul_f32xf32_f32(
+         FLOAT32 * __restrict__ p_out,          /* output: vec_count x rows */
+         const FLOAT32 * __restrict__ p_mat1,   /* matrix1: rows x cols1 */
+         const FLOAT32 * __restrict__ p_vec1,   /* vectors: vec_count x cols1 */
+         const FLOAT32 * __restrict__ p_bias,   /* bias: rows x 1 */
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,                    /* row stride for matrix1 */
+         WORD32 vec_count,
+         WORD32 vec_offset,                     /* offset from one vector to the next */
+         WORD32 out_offset,                     /* offset from one output vector to the next */
+         WORD32 out_stride,                     /* offset from one output row to the next */
+         const FLOAT32 * __restrict__ p_res)    /* residual, laid out as p_out, or NULL */
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+    if(p_res != NULL)
+    {
+        XA_NNLIB_ARG_CHK_ALIGN(p_res, sizeof(FLOAT32), -1);
+    }
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_offset < 0), -1);
+    MATMUL_CHK_OUT_LAYOUT(rows, vec_count, out_offset, out_stride);
+
+    /* Iterators used in for loops */
+    int m_itr, c_itr, vec_itr;
+    xtfloat* p_out_tmp;
+
+    #define UNROLL_SETUP_ACC_BATCH              SETUP_ACC_BATCH_FOR_f32
+    #define UNROLL_SETUP_MAT1                   SETUP_MAT1_f32
+    #define UNROLL_SETUP_VEC_BATCH              SETUP_VEC_OFFSET_BATCH_f32
+    #define SETUP_BIAS                          SETUP_BIAS_f32
+    #define UNROLL_LOAD_VEC_BATCH               LOAD_VEC_BATCH_f32
+    #define UNROLL_LOAD_ROW_MAT1                LOAD_ROW_MAT1_f32
+    #define LOAD_BIAS                           LOAD_BIAS_f32
+    #define UNROLL_KERNEL_MAT1_VEC_BATCH        KERNEL_MAT1_VEC_BATCH_f32
+    #define UNROLL_ADD_BIAS_ACC_BATCH           ADD_BIAS_BATCH_ACC_FOR_f32
+
+    if(((cols1 | row_stride1 | vec_offset) & 1) == 0 &&
+       ((((unsigned)p_mat1) & 7) == 0) && ((((unsigned)p_vec1) & 7) == 0))
+    {
+        if(p_res == NULL)
+        {
+    #define UNROLL_STORE_ACC_BATCH              STORE_ACC_MATMUL_AT_OUT_f32
+            MXV_LOOPS(MATMUL_ROW_UNROLL, MATMUL_VEC_UNROLL)
+    #undef UNROLL_STORE_ACC_BATCH
+        }
+        else
+        {
+    #define UNROLL_STORE_ACC_BATCH              STORE_ACC_MATMUL_ADD_RES_AT_OUT_f32
+            MXV_LOOPS(MATMUL_ROW_UNROLL, MATMUL_VEC_UNROLL)
+    #undef UNROLL_STORE_ACC_BATCH
+        }
+    }
+    else
+    {
+        /* Rows or vectors not 8 byte aligned, one element at a time */
+        for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+        {
+            for(m_itr = 0; m_itr < rows; m_itr++)
+            {
+                const FLOAT32 *p_row = &p_mat1[m_itr*row_stride1];
+                const FLOAT32 *p_vec = &p_vec1[vec_itr*vec_offset];
+                xtfloat acc = (xtfloat)0.0f;
+                for(c_itr = 0; c_itr < cols1; c_itr++)
+                {
+                    XT_MADD_S(acc, p_row[c_itr], p_vec[c_itr]);
+                }
+                acc = XT_ADD_S(acc, p_bias[m_itr]);
+                if(p_res != NULL)
+                {
+                    acc = XT_ADD_S(acc, MATMUL_RES(0,0));
+                }
+                p_out_tmp = (xtfloat *)&MATMUL_OUT(0,0);
+                XT_SSIP(acc, p_out_tmp, 0);
+            }
+        }
+    }
+
+    #undef UNROLL_SETUP_ACC_BATCH
+    #undef UNROLL_SETUP_MAT1
+    #undef UNROLL_SETUP_VEC_BATCH
+    #undef SETUP_BIAS
+    #undef UNROLL_LOAD_VEC_BATCH
+    #undef UNROLL_LOAD_ROW_MAT1
+    #undef LOAD_BIAS
+    #undef UNROLL_KERNEL_MAT1_VEC_BATCH
+    #undef UNROLL_ADD_BIAS_ACC_BATCH
+
+    return 0;
+}
+
+WORD32 xa_nn_matmul_f32xf32_f32(
+         FLOAT32 * __restrict__ p_out,
+         const FLOAT32 * __restrict__ p_mat1,
+         const FLOAT32 * __restrict__ p_vec1,
+         const FLOAT32 * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 vec_count,
+         WORD32 vec_offset,
+         WORD32 out_offset,
+         WORD32 out_stride)
+{
+    return matmul_f32xf32_f32(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+        vec_count, vec_offset, out_offset, out_stride, NULL);
+}
+
+WORD32 xa_nn_matmul_f32xf32_f32_residual(
+         FLOAT32 * __restrict__ p_out,
+         const FLOAT32 * __restrict__ p_mat1,
+         const FLOAT32 * __restrict__ p_vec1,
+         const FLOAT32 * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 vec_count,
+         WORD32 vec_offset,
+         WORD32 out_offset,
+         WORD32 out_stride,
+         const FLOAT32 * __restrict__ p_res)
+{
+    XA_NNLIB_ARG_CHK_PTR(p_res, -1);
+    return matmul_f32xf32_f32(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+        vec_count, vec_offset, out_offset, out_stride, p_res);
+}
+#endif /* !HAVE_VFPU */
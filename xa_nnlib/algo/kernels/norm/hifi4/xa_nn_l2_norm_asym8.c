@@ -0,0 +1,373 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+
+#define MultiplyByQuantizedMultiplierSmallerThanOneExp(prod, val, multiplier, lsh) {\
+    ae_int64 temp64_h, temp64_l;\
+    prod = AE_MULFP32X2RAS(val, multiplier);\
+    temp64_h = AE_MOVINT64_FROMINT32X2(AE_SEL32_HH(prod, ZERO));\
+    temp64_l = AE_MOVINT64_FROMINT32X2(AE_SEL32_LL(prod, ZERO));\
+    temp64_h = AE_SLAA64S(temp64_h, lsh);\
+    temp64_l = AE_SLAA64S(temp64_l, lsh);\
+    prod = AE_ROUND32X2F64SSYM(temp64_h, temp64_l);\
+}
+
+#define CLAMP_VAL(out, val, min, max){\
+    ae_int32x2 temp_max;\
+    temp_max = AE_MAX32(min, val);\
+    out = AE_MIN32(temp_max, max);\
+}
+
+#define STORE_8X4_FROM_32X4(out_ptr, val12, val34){\
+    int o1, o2, o3, o4;\
+    o1 = AE_MOVAD32_H(val12);\
+    o2 = AE_MOVAD32_L(val12);\
+    o3 = AE_MOVAD32_H(val34);\
+    o4 = AE_MOVAD32_L(val34);\
+    *out_ptr++ = (UWORD8)o1;\
+    *out_ptr++ = (UWORD8)o2;\
+    *out_ptr++ = (UWORD8)o3;\
+    *out_ptr++ = (UWORD8)o4;\
+}
+
+/* HiFi4 has no aligning load for 8 bit data, the bytes before the first 4
+ * byte boundary are collected in the alignment register 'tmp' and every
+ * AE_LA8X4U_IP merges one aligned AE_L8X4F_I with it. Gives the unsigned
+ * byte in the low 8 bits of each lane. */
+#define PRIME_8X4U(p_char, tmp) \
+    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
+    rs_##p_char = 0; \
+    ls_##p_char = 64; \
+    tmp = AE_ZERO16(); \
+    while(((unsigned int)p_char + offset_##p_char) & 3) {\
+        ae_int16x4 tmp2 = AE_MOVDA16(*(((const UWORD8 *)p_char)+offset_##p_char)); \
+        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
+        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
+        tmp = AE_OR16(tmp, tmp2); \
+        rs_##p_char += 16;  \
+        ls_##p_char -= 16; \
+        offset_##p_char++; \
+    }\
+    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
+
+#define AE_LA8X4U_IP(d, a, p) { \
+    ae_int16x4 d_tmp, d_tmp2; \
+    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
+    p += 4; \
+    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p+8)); \
+    d = AE_OR16(a, d_tmp2); \
+    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p-8)); \
+}
+
+/* Loads 4 asym8 values (any alignment) and applies zero bias */
+#define LOAD_ASYM8X4_ZB(d, a, p) {\
+    AE_LA8X4U_IP(d, a, p);\
+    d = AE_ADD16(d, zero_bias);\
+}
+
+/* Output of quantized L2 normalization is in Q0.7 with zero point 128 */
+#define L2_NORM_ASYM8_OUT_ZERO_POINT 128
+#define L2_NORM_ASYM8_OUT_LSH 7
+
+/* Fixed point constants of the inverse square root Newton-Raphson iteration,
+ * F3 is Q3.28 and F0 is Q0.31 */
+static const int F3_ONE = (1 << 28);
+static const int F3_THREE_BY_TWO = (1 << 28) + (1 << 27);
+static const int F0_HALF_SQRT_2 = 1518500250;
+
+/* Number of Newton-Raphson iterations starting from the guess x = 1 */
+#define INV_SQRT_NR_ITERATIONS 5
+
+/* Brings the squared norm into [2^27, 2^29) by even shifts, returns the
+ * right shift to be applied on the inverse square root and the half of the
+ * normalized input in Q3.28 */
+static WORD32 inv_sqrt_normalize(WORD32 input, WORD32 *p_half_input)
+{
+    WORD32 shift = 11;
+    WORD32 left_shift_bit_pairs;
+
+    while(input >= (1 << 29))
+    {
+        input /= 4;
+        shift++;
+    }
+    left_shift_bit_pairs = (NSA(input) >> 1) - 1;
+    shift -= left_shift_bit_pairs;
+    input <<= 2*left_shift_bit_pairs;
+    /* Rounding halving of input >> 1 */
+    input = input >> 1;
+    *p_half_input = (input >> 1) + (input & 1);
+
+    return shift;
+}
+
+/* Inverse square root multipliers of two rows at once (one per lane), bit
+ * exact with GetInvSqrtQuantizedMultiplier of the TFLite reference since all
+ * the intermediate products stay non-negative */
+#define INV_SQRT_MULTIPLIER_32X2(mult, half_input) {\
+    ae_int32x2 x, x2, x3, t1, t2;\
+    int itr;\
+    x = AE_MOVDA32(F3_ONE);\
+    for(itr = 0; itr < INV_SQRT_NR_ITERATIONS; itr++)\
+    {\
+        x2 = AE_MULFP32X2RAS(x, x);\
+        x3 = AE_MULFP32X2RAS(x2, x);\
+        x3 = AE_SLAI32S(x3, 6);\
+        t1 = AE_MULFP32X2RAS(AE_MOVDA32(F3_THREE_BY_TWO), x);\
+        t2 = AE_MULFP32X2RAS(half_input, x3);\
+        x = AE_SLAI32S(AE_SUB32(t1, t2), 3);\
+    }\
+    mult = AE_MULFP32X2RAS(x, AE_MOVDA32(F0_HALF_SQRT_2));\
+}
+
+/* Squared sums of two rows, interleaved so the loads and multiplies of one
+ * row hide the latencies of the other */
+static void l2_norm_energy2_asym8(WORD32 *p_energy0,
+                                  WORD32 *p_energy1,
+                                  const UWORD8 *p_row0,
+                                  const UWORD8 *p_row1,
+                                  WORD32 inp_zero_bias,
+                                  WORD32 depth)
+{
+    int i;
+    WORD32 diff0, diff1, energy0, energy1;
+    ae_int64 acc0 = AE_ZERO64(), acc1 = AE_ZERO64();
+    ae_int16x4 d0, d1, d0_a, d1_a, zero_bias = AE_MOVDA16(inp_zero_bias);
+    WORD8 *p_in0 = (WORD8 *)p_row0;
+    WORD8 *p_in1 = (WORD8 *)p_row1;
+
+    PRIME_8X4U(p_in0, d0_a);
+    PRIME_8X4U(p_in1, d1_a);
+    for(i = 0; i < (depth >> 2); i++)
+    {
+        LOAD_ASYM8X4_ZB(d0, d0_a, p_in0);
+        LOAD_ASYM8X4_ZB(d1, d1_a, p_in1);
+        AE_MULAAAAQ16(acc0, d0, d0);
+        AE_MULAAAAQ16(acc1, d1, d1);
+    }
+    energy0 = AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(acc0));
+    energy1 = AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(acc1));
+    for(i <<= 2; i < depth; i++)
+    {
+        diff0 = (WORD32)p_row0[i] + inp_zero_bias;
+        diff1 = (WORD32)p_row1[i] + inp_zero_bias;
+        energy0 += diff0*diff0;
+        energy1 += diff1*diff1;
+    }
+    *p_energy0 = energy0;
+    *p_energy1 = energy1;
+}
+
+/* Scales one row by its inverse norm multiplier */
+static void l2_norm_scale_asym8(UWORD8 *p_out,
+                                const UWORD8 *p_row,
+                                WORD32 inp_zero_bias,
+                                ae_int32x2 mult,
+                                WORD32 lsh,
+                                WORD32 depth)
+{
+    int i;
+    ae_int16x4 d, d_a, zero_bias = AE_MOVDA16(inp_zero_bias);
+    ae_int32x2 d32, d10, out32, out10;
+    ae_int32x2 ZERO = AE_ZERO32();
+    ae_int32x2 out_zero_point = AE_MOVDA32(L2_NORM_ASYM8_OUT_ZERO_POINT);
+    ae_int32x2 min_255 = AE_ZERO32();
+    ae_int32x2 max_255 = AE_MOVDA32(255);
+    WORD8 *p_in = (WORD8 *)p_row;
+    UWORD8 *p_o = p_out;
+
+    PRIME_8X4U(p_in, d_a);
+    for(i = 0; i < (depth >> 2); i++)
+    {
+        LOAD_ASYM8X4_ZB(d, d_a, p_in);
+        d32 = AE_SLAI32(AE_SEXT32X2D16_32(d), L2_NORM_ASYM8_OUT_LSH);
+        d10 = AE_SLAI32(AE_SEXT32X2D16_10(d), L2_NORM_ASYM8_OUT_LSH);
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out32, d32, mult, lsh)
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out10, d10, mult, lsh)
+        out32 = AE_ADD32S(out32, out_zero_point);
+        out10 = AE_ADD32S(out10, out_zero_point);
+        CLAMP_VAL(out32, out32, min_255, max_255)
+        CLAMP_VAL(out10, out10, min_255, max_255)
+        STORE_8X4_FROM_32X4(p_o, out32, out10)
+    }
+    for(i <<= 2; i < depth; i++)
+    {
+        d32 = AE_MOVDA32(((WORD32)p_row[i] + inp_zero_bias) << L2_NORM_ASYM8_OUT_LSH);
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out32, d32, mult, lsh)
+        out32 = AE_ADD32S(out32, out_zero_point);
+        CLAMP_VAL(out32, out32, min_255, max_255)
+        *p_o++ = (UWORD8)AE_MOVAD32_H(out32);
+    }
+}
+
+/* Scales two rows by their inverse norm multipliers, interleaved like
+ * l2_norm_energy2_asym8 */
+static void l2_norm_scale2_asym8(UWORD8 *p_out0,
+                                 UWORD8 *p_out1,
+                                 const UWORD8 *p_row0,
+                                 const UWORD8 *p_row1,
+                                 WORD32 inp_zero_bias,
+                                 ae_int32x2 mult0,
+                                 ae_int32x2 mult1,
+                                 WORD32 lsh0,
+                                 WORD32 lsh1,
+                                 WORD32 depth)
+{
+    int i;
+    ae_int16x4 d0, d1, d0_a, d1_a, zero_bias = AE_MOVDA16(inp_zero_bias);
+    ae_int32x2 d32, d10, out0_32, out0_10, out1_32, out1_10;
+    ae_int32x2 ZERO = AE_ZERO32();
+    ae_int32x2 out_zero_point = AE_MOVDA32(L2_NORM_ASYM8_OUT_ZERO_POINT);
+    ae_int32x2 min_255 = AE_ZERO32();
+    ae_int32x2 max_255 = AE_MOVDA32(255);
+    WORD8 *p_in0 = (WORD8 *)p_row0;
+    WORD8 *p_in1 = (WORD8 *)p_row1;
+    UWORD8 *p_o0 = p_out0;
+    UWORD8 *p_o1 = p_out1;
+
+    PRIME_8X4U(p_in0, d0_a);
+    PRIME_8X4U(p_in1, d1_a);
+    for(i = 0; i < (depth >> 2); i++)
+    {
+        LOAD_ASYM8X4_ZB(d0, d0_a, p_in0);
+        LOAD_ASYM8X4_ZB(d1, d1_a, p_in1);
+        d32 = AE_SLAI32(AE_SEXT32X2D16_32(d0), L2_NORM_ASYM8_OUT_LSH);
+        d10 = AE_SLAI32(AE_SEXT32X2D16_10(d0), L2_NORM_ASYM8_OUT_LSH);
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out0_32, d32, mult0, lsh0)
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out0_10, d10, mult0, lsh0)
+        d32 = AE_SLAI32(AE_SEXT32X2D16_32(d1), L2_NORM_ASYM8_OUT_LSH);
+        d10 = AE_SLAI32(AE_SEXT32X2D16_10(d1), L2_NORM_ASYM8_OUT_LSH);
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out1_32, d32, mult1, lsh1)
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out1_10, d10, mult1, lsh1)
+        out0_32 = AE_ADD32S(out0_32, out_zero_point);
+        out0_10 = AE_ADD32S(out0_10, out_zero_point);
+        out1_32 = AE_ADD32S(out1_32, out_zero_point);
+        out1_10 = AE_ADD32S(out1_10, out_zero_point);
+        CLAMP_VAL(out0_32, out0_32, min_255, max_255)
+        CLAMP_VAL(out0_10, out0_10, min_255, max_255)
+        CLAMP_VAL(out1_32, out1_32, min_255, max_255)
+        CLAMP_VAL(out1_10, out1_10, min_255, max_255)
+        STORE_8X4_FROM_32X4(p_o0, out0_32, out0_10)
+        STORE_8X4_FROM_32X4(p_o1, out1_32, out1_10)
+    }
+    for(i <<= 2; i < depth; i++)
+    {
+        d32 = AE_MOVDA32(((WORD32)p_row0[i] + inp_zero_bias) << L2_NORM_ASYM8_OUT_LSH);
+        d10 = AE_MOVDA32(((WORD32)p_row1[i] + inp_zero_bias) << L2_NORM_ASYM8_OUT_LSH);
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out0_32, d32, mult0, lsh0)
+        MultiplyByQuantizedMultiplierSmallerThanOneExp(out1_32, d10, mult1, lsh1)
+        out0_32 = AE_ADD32S(out0_32, out_zero_point);
+        out1_32 = AE_ADD32S(out1_32, out_zero_point);
+        CLAMP_VAL(out0_32, out0_32, min_255, max_255)
+        CLAMP_VAL(out1_32, out1_32, min_255, max_255)
+        *p_o0++ = (UWORD8)AE_MOVAD32_H(out0_32);
+        *p_o1++ = (UWORD8)AE_MOVAD32_H(out1_32);
+    }
+}
+
+/* Quantized L2 normalization of 'rows' consecutive vectors of 'depth'
+ * elements each. Rows are processed in pairs: the squared sums and the
+ * scaling of the two rows run interleaved, and their inverse square roots
+ * are computed together in the two lanes of one register. Output is asym8 with scale 1/128 and
+ * zero point 128 as mandated by the NN API. */
+WORD32 xa_nn_l2_norm_rows_asym8(UWORD8 * __restrict__ p_out,
+                                const UWORD8 * __restrict__ p_inp,
+                                WORD32 inp_zero_bias,
+                                WORD32 rows,
+                                WORD32 depth)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((depth <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -255) || (inp_zero_bias > 0)), -1);
+
+    int row;
+    WORD32 energy0, energy1;
+    WORD32 half_input0, half_input1;
+    WORD32 shift0, shift1;
+    WORD32 mult0, mult1;
+    ae_int32x2 half_input, mult;
+
+    for(row = 0; row < rows; row += 2)
+    {
+        const UWORD8 *p_row0 = p_inp + row*depth;
+        const UWORD8 *p_row1 = p_row0 + depth;
+
+        /* With odd number of rows, last pair duplicates the last row */
+        if(row + 1 >= rows)
+        {
+            p_row1 = p_row0;
+        }
+        l2_norm_energy2_asym8(&energy0, &energy1, p_row0, p_row1, inp_zero_bias, depth);
+
+        /* Constant rows have no direction, output zero point for them */
+        shift0 = shift1 = 0;
+        half_input0 = half_input1 = 0;
+        if(energy0 > 0)
+        {
+            shift0 = inv_sqrt_normalize(energy0, &half_input0);
+        }
+        if(energy1 > 0)
+        {
+            shift1 = inv_sqrt_normalize(energy1, &half_input1);
+        }
+
+        half_input = AE_MOVDA32X2(half_input0, half_input1);
+        INV_SQRT_MULTIPLIER_32X2(mult, half_input);
+        mult0 = (energy0 > 0) ? AE_MOVAD32_H(mult) : 0;
+        mult1 = (energy1 > 0) ? AE_MOVAD32_L(mult) : 0;
+
+        /* A negative shift is folded into the multiplier. Small energies
+         * would overflow int32 there, so the shift saturates. */
+        if(shift0 < 0)
+        {
+            mult0 = AE_MOVAD32_H(AE_SLAA32S(AE_MOVDA32(mult0), -shift0));
+            shift0 = 0;
+        }
+        if(shift1 < 0)
+        {
+            mult1 = AE_MOVAD32_H(AE_SLAA32S(AE_MOVDA32(mult1), -shift1));
+            shift1 = 0;
+        }
+
+        if(row + 1 < rows)
+        {
+            l2_norm_scale2_asym8(p_out + row*depth, p_out + (row + 1)*depth,
+                                 p_row0, p_row1, inp_zero_bias,
+                                 AE_MOVDA32(mult0), AE_MOVDA32(mult1),
+                                 -shift0, -shift1, depth);
+        }
+        else
+        {
+            l2_norm_scale_asym8(p_out + row*depth, p_row0, inp_zero_bias,
+                                AE_MOVDA32(mult0), -shift0, depth);
+        }
+    }
+
+    return 0;
+}
@@ -34,6 +34,15 @@ DISCARD_FUN_FOR_NONVOID_RETURN(
                 WORD32 num_elm
               )
            )
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_l2_norm_rows_f32,
+             (
+                FLOAT32 *p_out, 
+                const FLOAT32 *p_inp, 
+                WORD32 rows,
+                WORD32 depth
+              )
+           )
 #else
 WORD32 xa_nn_l2_norm_f32(FLOAT32 * __restrict__ p_out,
                          const FLOAT32 * __restrict__ p_inp,
@@ -94,4 +103,169 @@ WORD32 xa_nn_l2_norm_f32(FLOAT32 * __restrict__ p_out,
 
     return 0;
 }
+
+/* Number of Newton-Raphson iterations applied on top of the bit-level
+ * reciprocal square root estimate, each one roughly doubles the number of
+ * correct bits (3 iterations are enough for full single precision) */
+#define RSQRT_NR_ITERATIONS 3
+
+/* Reciprocal square root of both lanes of _x, _y = 1/sqrt(_x) */
+#define RSQRT_SX2(_y, _x) \
+{ \
+    ae_int32x2 _seed; \
+    xtfloatx2 _half_x, _yy, _nr; \
+    int _itr; \
+    _seed = XT_AE_MOVINT32X2_FROMXTFLOATX2(_x); \
+    _seed = AE_SUB32(AE_MOVDA32(0x5f3759df), AE_SRAI32(_seed, 1)); \
+    _y = XT_AE_MOVXTFLOATX2_FROMINT32X2(_seed); \
+    _half_x = XT_MUL_SX2(_x, XT_CONST_S(3)); \
+    for(_itr = 0; _itr < RSQRT_NR_ITERATIONS; _itr++) \
+    { \
+        _yy = XT_MUL_SX2(_y, _y); \
+        _nr = (xtfloatx2)1.5f; \
+        XT_MSUB_SX2(_nr, _half_x, _yy); \
+        _y = XT_MUL_SX2(_y, _nr); \
+    } \
+}
+
+/* Normalizes 'rows' consecutive vectors of 'depth' elements each. Two rows
+ * are processed per pass so that the energies of both rows sit in the two
+ * lanes of one register, and their inverse norms are computed together
+ * with a Newton-refined reciprocal square root instead of a sqrt and a
+ * divide per element. */
+WORD32 xa_nn_l2_norm_rows_f32(FLOAT32 * __restrict__ p_out,
+                              const FLOAT32 * __restrict__ p_inp,
+                              WORD32 rows,
+                              WORD32 depth)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((depth <= 0), -1);
+
+    int i, row;
+    xtfloatx2 *pt_inp0, *pt_inp1;
+    xtfloatx2 *pt_out0, *pt_out1;
+    ae_valign inp0_a, inp1_a, out0_a, out1_a;
+    xtfloatx2 d_inp0, d_inp1, d_out0, d_out1;
+    xtfloatx2 eneg0, eneg1, enegx2, inv_normx2, inv_norm0, inv_norm1;
+    xtfloat d_inp, d_out;
+
+    for(row = 0; row < (rows & ~1); row += 2)
+    {
+        const FLOAT32 *p_row0 = p_inp + row*depth;
+        const FLOAT32 *p_row1 = p_row0 + depth;
+
+        /* Calculate energy (squared sum) of both rows */
+        pt_inp0 = (xtfloatx2 *)p_row0;
+        pt_inp1 = (xtfloatx2 *)p_row1;
+        inp0_a = XT_LASX2PP(pt_inp0);
+        inp1_a = XT_LASX2PP(pt_inp1);
+        eneg0 = XT_CONST_S(0);
+        eneg1 = XT_CONST_S(0);
+        for(i = 0; i < depth>>1; i++)
+        {
+            XT_LASX2IP(d_inp0, inp0_a, pt_inp0);
+            XT_LASX2IP(d_inp1, inp1_a, pt_inp1);
+            XT_MADD_SX2(eneg0, d_inp0, d_inp0);
+            XT_MADD_SX2(eneg1, d_inp1, d_inp1);
+        }
+        eneg0 = XT_ADD_SX2(eneg0, XT_SEL32_LH_SX2(eneg0, eneg0));
+        eneg1 = XT_ADD_SX2(eneg1, XT_SEL32_LH_SX2(eneg1, eneg1));
+        /* Row 0 energy in high lane, row 1 energy in low lane */
+        enegx2 = XT_SEL32_HL_SX2(eneg0, eneg1);
+        // Remainder Loop
+        if (depth & 1)
+        {
+            d_inp0 = XT_AE_MOVXTFLOATX2_FROMINT32X2(AE_MOVDA32X2(
+                        XT_RFR(XT_LSI((xtfloat *)pt_inp0, 0)),
+                        XT_RFR(XT_LSI((xtfloat *)pt_inp1, 0))));
+            XT_MADD_SX2(enegx2, d_inp0, d_inp0);
+        }
+
+        RSQRT_SX2(inv_normx2, enegx2);
+        inv_norm0 = XT_SEL32_HH_SX2(inv_normx2, inv_normx2);
+        inv_norm1 = XT_SEL32_LL_SX2(inv_normx2, inv_normx2);
+
+        /* Scale both rows by their inverse norm */
+        pt_inp0 = (xtfloatx2 *)p_row0;
+        pt_inp1 = (xtfloatx2 *)p_row1;
+        pt_out0 = (xtfloatx2 *)(p_out + row*depth);
+        pt_out1 = (xtfloatx2 *)(p_out + (row + 1)*depth);
+        inp0_a = XT_LASX2PP(pt_inp0);
+        inp1_a = XT_LASX2PP(pt_inp1);
+        out0_a = AE_ZALIGN64();
+        out1_a = AE_ZALIGN64();
+        for(i = 0; i < depth>>1; i++)
+        {
+            XT_LASX2IP(d_inp0, inp0_a, pt_inp0);
+            XT_LASX2IP(d_inp1, inp1_a, pt_inp1);
+            d_out0 = XT_MUL_SX2(d_inp0, inv_norm0);
+            d_out1 = XT_MUL_SX2(d_inp1, inv_norm1);
+            XT_SASX2IP(d_out0, out0_a, pt_out0);
+            XT_SASX2IP(d_out1, out1_a, pt_out1);
+        }
+        XT_SASX2POSFP(out0_a, pt_out0);
+        XT_SASX2POSFP(out1_a, pt_out1);
+        // Remainder Loop
+        if (depth & 1)
+        {
+            d_inp = XT_LSI((xtfloat *)pt_inp0, 0);
+            d_out = XT_MUL_S(d_inp, XT_HIGH_S(inv_normx2));
+            XT_SSI(d_out, (xtfloat *)pt_out0, 0);
+            d_inp = XT_LSI((xtfloat *)pt_inp1, 0);
+            d_out = XT_MUL_S(d_inp, XT_LOW_S(inv_normx2));
+            XT_SSI(d_out, (xtfloat *)pt_out1, 0);
+        }
+    }
+
+    /* Last row when the number of rows is odd */
+    if(rows & 1)
+    {
+        pt_inp0 = (xtfloatx2 *)(p_inp + row*depth);
+        pt_out0 = (xtfloatx2 *)(p_out + row*depth);
+
+        inp0_a = XT_LASX2PP(pt_inp0);
+        eneg0 = XT_CONST_S(0);
+        for(i = 0; i < depth>>1; i++)
+        {
+            XT_LASX2IP(d_inp0, inp0_a, pt_inp0);
+            XT_MADD_SX2(eneg0, d_inp0, d_inp0);
+        }
+        eneg0 = XT_ADD_SX2(eneg0, XT_SEL32_LH_SX2(eneg0, eneg0));
+        // Remainder Loop
+        if (depth & 1)
+        {
+            d_inp0 = XT_AE_MOVXTFLOATX2_FROMINT32X2(AE_MOVDA32(XT_RFR(XT_LSI((xtfloat *)pt_inp0, 0))));
+            XT_MADD_SX2(eneg0, d_inp0, d_inp0);
+        }
+
+        RSQRT_SX2(inv_norm0, eneg0);
+
+        pt_inp0 = (xtfloatx2 *)(p_inp + row*depth);
+        inp0_a = XT_LASX2PP(pt_inp0);
+        out0_a = AE_ZALIGN64();
+        for(i = 0; i < depth>>1; i++)
+        {
+            XT_LASX2IP(d_inp0, inp0_a, pt_inp0);
+            d_out0 = XT_MUL_SX2(d_inp0, inv_norm0);
+            XT_SASX2IP(d_out0, out0_a, pt_out0);
+        }
+        XT_SASX2POSFP(out0_a, pt_out0);
+        // Remainder Loop
+        if (depth & 1)
+        {
+            d_inp = XT_LSI((xtfloat *)pt_inp0, 0);
+            d_out = XT_MUL_S(d_inp, XT_LOW_S(inv_norm0));
+            XT_SSI(d_out, (xtfloat *)pt_out0, 0);
+        }
+    }
+
+    return 0;
+}
 #endif
@@ -40,9 +40,13 @@ static void avgpool_asym8_hw(
     WORD32  y_padding,
     WORD32  out_height,
     WORD32  out_width,
-    pVOID   p_scratch_in)
+    pVOID   p_scratch_in,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max)
 {
     WORD32 *p_scratch = (WORD32 *)(p_scratch_in);
+    ae_int32x2 act_min = AE_MOVDA32(out_activation_min);
+    ae_int32x2 act_max = AE_MOVDA32(out_activation_max);
 
     int itr_oh, itr_ow;
     int left_pad_aligned, right_pad, total_out_width, scratch_width;
@@ -296,12 +300,14 @@ static void avgpool_asym8_hw(
             so 1 left shift is possible without overflow */
             d_tmp32 = AE_TRUNCI32X2F64S(d_tmp, d_tmp, 1);
             d_tmp32 = AE_MULFP32X2RS(d_out1, d_tmp32);
+            d_tmp32 = AE_MAX32(d_tmp32, act_min);
+            d_tmp32 = AE_MIN32(d_tmp32, act_max);
             p_out[itr_oh*out_width+itr_ow] = (UWORD8)AE_MOVAD32_L(AE_SRAI32(d_tmp32, 0));
         }
     }
 }
 
-WORD32 xa_nn_avgpool_asym8(
+static void avgpool_asym8_single_batch(
         UWORD8* __restrict__ p_out,
 const   UWORD8* __restrict__ p_inp,
         WORD32  input_height,
@@ -315,34 +321,11 @@ const   UWORD8* __restrict__ p_inp,
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
-        WORD32  inp_data_format,
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
         WORD32  out_data_format,
         VOID    *p_scratch)
 {
-    /* NULL pointer checks */
-    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-    /* Pointer alignment checks */
-    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD8), -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD8), -1);
-    /* Basic Parameter checks */
-    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND((kernel_height > 256), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_width > 256), -1);
-    
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
-    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
-
-    // Different I/O data formats (not supported!)
-    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
-
     if((input_channels == 1) || (out_data_format == 1))
     {
         xa_nn_avgpool_init(-3,
@@ -400,6 +383,8 @@ const   UWORD8* __restrict__ p_inp,
                     ,out_height
                     ,out_width
                     ,p_tmp_out
+                    ,out_activation_min
+                    ,out_activation_max
                     );
         }
     }
@@ -481,7 +466,9 @@ const   UWORD8* __restrict__ p_inp,
                     ,p_s
                     ,(void *)p_zeros_mem
                     ,p_den_height
-                    ,p_den_width);
+                    ,p_den_width
+                    ,out_activation_min
+                    ,out_activation_max);
         }
         else
         {
@@ -501,11 +488,128 @@ const   UWORD8* __restrict__ p_inp,
                     ,p_s
                     ,(void *)p_zeros_mem
                     ,p_den_height
-                    ,p_den_width);
+                    ,p_den_width
+                    ,out_activation_min
+                    ,out_activation_max);
         }
     }
+}
 
-    return 0;
+WORD32 xa_nn_avgpool_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID    *p_scratch)
+{
+    return xa_nn_avgpool_batch_asym8(p_out
+            ,p_inp
+            ,1
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,0
+            ,255
+            ,inp_data_format
+            ,out_data_format
+            ,p_scratch);
 }
 
+WORD32 xa_nn_avgpool_batch_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID    *p_scratch)
+{
+    int itr_b;
+    WORD32 inp_batch_size, out_batch_size;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD8), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD8), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_min < 0 || out_activation_min > 255), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 255), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND((kernel_height > 256), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > 256), -1);
+    
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+
+    // Different I/O data formats (not supported!)
+    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
+
+    inp_batch_size = input_height * input_width * input_channels;
+    out_batch_size = out_height * out_width * input_channels;
 
+    /* Scratch is re-initialized for every batch, so the size given by
+     * xa_nn_avgpool_getsize for a single batch is sufficient */
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        avgpool_asym8_single_batch(&p_out[itr_b * out_batch_size]
+                ,&p_inp[itr_b * inp_batch_size]
+                ,input_height
+                ,input_width
+                ,input_channels
+                ,kernel_height
+                ,kernel_width
+                ,x_stride
+                ,y_stride
+                ,x_padding
+                ,y_padding
+                ,out_height
+                ,out_width
+                ,out_activation_min
+                ,out_activation_max
+                ,out_data_format
+                ,p_scratch);
+    }
+
+    return 0;
+}
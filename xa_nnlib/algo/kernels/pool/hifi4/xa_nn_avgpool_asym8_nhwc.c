@@ -44,7 +44,9 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width))
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max))
 
 DISCARD_FUN_FOR_NONVOID_RETURN(void, xa_nn_avgpool_asym8_hwc_16,(
         UWORD8* __restrict__ p_out,
@@ -63,7 +65,9 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width))
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max))
 
 #else /* #if !HAVE_VFPU */
 
@@ -156,7 +160,9 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width)
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max)
 {
     WORD16 *p_scratch = (WORD16 *)(p_scratch_in);
 
@@ -175,6 +181,11 @@ const   UWORD8* __restrict__ p_inp,
     int i;
     WORD16 *p_dst_pad;
 
+    /* Fused activation: outputs are clamped before being stored */
+    ae_int32x2 act_min = AE_MOVDA32(out_activation_min);
+    ae_int32x2 act_max = AE_MOVDA32(out_activation_max);
+    WORD32 zero_out = XT_MIN(out_activation_max, XT_MAX(out_activation_min, 0));
+
     plane_size = input_width * input_channels;
 
     for(itr_oh = 0; itr_oh < out_height; itr_oh++)
@@ -493,6 +504,8 @@ const   UWORD8* __restrict__ p_inp,
                 {
                     d_out1 = AE_MOVDA32(p_out1[i]);
                     d_tmp32 = AE_MULFP32X2RS(d_out1, d_tmp32hw);
+                    d_tmp32 = AE_MAX32(d_tmp32, act_min);
+                    d_tmp32 = AE_MIN32(d_tmp32, act_max);
                     p_out_temp[i] = (UWORD8)AE_MOVAD32_L(AE_SRAI32(d_tmp32, 0));
                 }
             }
@@ -501,7 +514,7 @@ const   UWORD8* __restrict__ p_inp,
                 /* If there is no valid input present, fill the output with zeros*/
                 for(i = 0; i < input_channels; i++)
                 {
-                    p_out_temp[i] = (UWORD8)0x0;
+                    p_out_temp[i] = (UWORD8)zero_out;
                 }
             }
         }
@@ -525,7 +538,9 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width)
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max)
 {
     WORD16 *p_scratch = (WORD16 *)(p_scratch_in);
 
@@ -543,6 +558,11 @@ const   UWORD8* __restrict__ p_inp,
     ae_int16x4 i1_la, i2_la, i3_la;
     WORD32 *p_dst_pad;
 
+    /* Fused activation: outputs are clamped before being stored */
+    ae_int32x2 act_min = AE_MOVDA32(out_activation_min);
+    ae_int32x2 act_max = AE_MOVDA32(out_activation_max);
+    WORD32 zero_out = XT_MIN(out_activation_max, XT_MAX(out_activation_min, 0));
+
     plane_size = input_width * input_channels;
     for(itr_oh = 0; itr_oh < out_height; itr_oh++)
     {
@@ -810,6 +830,8 @@ const   UWORD8* __restrict__ p_inp,
                 {
                     d_out1 = AE_MOVDA32(p_out1[i]);
                     d_tmp32 = AE_MULFP32X2RS(d_out1, d_tmp32hw);
+                    d_tmp32 = AE_MAX32(d_tmp32, act_min);
+                    d_tmp32 = AE_MIN32(d_tmp32, act_max);
                     p_out_temp[i] = (UWORD8)AE_MOVAD32_L(AE_SRAI32(d_tmp32, 0));
                 }
             }
@@ -818,7 +840,7 @@ const   UWORD8* __restrict__ p_inp,
                 /* If there is no valid input present, fill the output with zeros*/
                 for(i = 0; i < input_channels; i++)
                 {
-                    p_out_temp[i] = (UWORD8)0x0;
+                    p_out_temp[i] = (UWORD8)zero_out;
                 }
             }
         }
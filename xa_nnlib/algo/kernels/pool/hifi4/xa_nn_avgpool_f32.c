@@ -24,6 +24,7 @@
 #include "xa_nnlib_kernels_api.h"
 #include "xa_nn_avgpool_state.h"
 #include "xa_nnlib_err_chk.h"
+#include <math.h>
 
 #if !HAVE_VFPU
 DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_avgpool_f32,(
@@ -45,6 +46,27 @@ const FLOAT32* __restrict__ p_inp,
 #endif
     WORD32  out_data_format,
     VOID *handle))
+
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_avgpool_batch_f32,(
+    FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+    WORD32  batches,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    FLOAT32 out_activation_min,
+    FLOAT32 out_activation_max,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    VOID *p_scratch))
 #else /* #if !HAVE_VFPU */
 static void avgpool_f32_hw(
     FLOAT32* __restrict__ p_out,
@@ -61,7 +83,9 @@ static void avgpool_f32_hw(
     WORD32  out_width,
     WORD32  out_plane_size,
     WORD32  not_last_channel,
-    pVOID   p_scratch_in)
+    pVOID   p_scratch_in,
+    FLOAT32 out_activation_min,
+    FLOAT32 out_activation_max)
 {
     FLOAT32 *p_scratch = (FLOAT32 *)(p_scratch_in);
 
@@ -254,13 +278,15 @@ static void avgpool_f32_hw(
         };
 
         FLOAT32 *ptr_out1 = (FLOAT32 *)((FLOAT32 *)p_scratch + total_out_width);
-        FLOAT32 den_inv;
+        FLOAT32 den_inv, out;
         if(not_last_channel)
         {
             for(itr_ow = 0; itr_ow < out_width; itr_ow++)
             {
                 den_inv = p_out[itr_oh*out_width+itr_ow];
-                p_out[itr_oh*out_width+itr_ow] = XT_MUL_S(ptr_out1[itr_ow*x_stride], den_inv);
+                out = XT_MUL_S(ptr_out1[itr_ow*x_stride], den_inv);
+                out = XT_MAX_S(out, out_activation_min);
+                p_out[itr_oh*out_width+itr_ow] = XT_MIN_S(out, out_activation_max);
                 /* store 1/den for next channel */
                 p_out[out_plane_size + itr_oh*out_width+itr_ow] = den_inv;
             }
@@ -270,13 +296,15 @@ static void avgpool_f32_hw(
             for(itr_ow = 0; itr_ow < out_width; itr_ow++)
             {
                 den_inv = p_out[itr_oh*out_width+itr_ow];
-                p_out[itr_oh*out_width+itr_ow] = XT_MUL_S(ptr_out1[itr_ow*x_stride], den_inv);
+                out = XT_MUL_S(ptr_out1[itr_ow*x_stride], den_inv);
+                out = XT_MAX_S(out, out_activation_min);
+                p_out[itr_oh*out_width+itr_ow] = XT_MIN_S(out, out_activation_max);
             }
         }
     }
 }
 
-WORD32 xa_nn_avgpool_f32(
+static void avgpool_f32_single_batch(
         FLOAT32* __restrict__ p_out,
 const   FLOAT32* __restrict__ p_inp,
         WORD32  input_height,
@@ -290,34 +318,11 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
-#ifdef NNLIB_V2
-        WORD32  inp_data_format,
-#endif
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         WORD32  out_data_format,
         VOID *p_scratch)
 {
-    /* NULL pointer checks */
-    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-    /* Pointer alignment checks */
-    XA_NNLIB_ARG_CHK_ALIGN(p_out, 4, -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_inp, 4, -1);
-    /* Basic Parameter checks */
-    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
-#ifdef NNLIB_V2
-    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
-
-    // Different I/O formats (not supported!)
-    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
-#endif
-
     if((input_channels == 1) || (out_data_format == 1))
     {
         xa_nn_avgpool_init(-1,
@@ -375,6 +380,8 @@ const   FLOAT32* __restrict__ p_inp,
                     ,out_height*out_width
                     ,(input_channels-itr_ic-1)
                     ,p_tmp_out
+                    ,out_activation_min
+                    ,out_activation_max
                     );
         }
     }
@@ -437,8 +444,129 @@ const   FLOAT32* __restrict__ p_inp,
                 ,out_width
                 ,p_scratch_aligned
                 ,p_zeros_mem
-                ,p_den);
+                ,p_den
+                ,out_activation_min
+                ,out_activation_max);
     }
+}
+
+WORD32 xa_nn_avgpool_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+#ifdef NNLIB_V2
+        WORD32  inp_data_format,
+#endif
+        WORD32  out_data_format,
+        VOID *p_scratch)
+{
+    return xa_nn_avgpool_batch_f32(p_out
+            ,p_inp
+            ,1
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,-INFINITY
+            ,INFINITY
+#ifdef NNLIB_V2
+            ,inp_data_format
+#else
+            ,out_data_format
+#endif
+            ,out_data_format
+            ,p_scratch);
+}
+
+WORD32 xa_nn_avgpool_batch_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID *p_scratch)
+{
+    int itr_b;
+    WORD32 inp_batch_size, out_batch_size;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, 4, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, 4, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+
+    // Different I/O formats (not supported!)
+    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
+
+    inp_batch_size = input_height * input_width * input_channels;
+    out_batch_size = out_height * out_width * input_channels;
+
+    /* Scratch is re-initialized for every batch, so the size given by
+     * xa_nn_avgpool_getsize for a single batch is sufficient */
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        avgpool_f32_single_batch(&p_out[itr_b * out_batch_size]
+                ,&p_inp[itr_b * inp_batch_size]
+                ,input_height
+                ,input_width
+                ,input_channels
+                ,kernel_height
+                ,kernel_width
+                ,x_stride
+                ,y_stride
+                ,x_padding
+                ,y_padding
+                ,out_height
+                ,out_width
+                ,out_activation_min
+                ,out_activation_max
+                ,out_data_format
+                ,p_scratch);
+    }
+
     return 0;
 }
 #endif /* #if !HAVE_VFPU */
@@ -43,7 +43,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   out_width,
         pVOID    p_scratch_in,
         FLOAT32  *p_zeros_mem,
-        FLOAT32  *p_den))
+        FLOAT32  *p_den,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max))
 #else /* #if !HAVE_VFPU */
 
 #define INCR_N_PLANE(ptr, n, plane_size) \
@@ -96,7 +98,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   out_width,
         pVOID    p_scratch_in,
         FLOAT32  *p_zeros_mem,
-        FLOAT32  *p_den)
+        FLOAT32  *p_den,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max)
 {
     FLOAT32 *p_scratch = (FLOAT32 *)(p_scratch_in);
 
@@ -109,6 +113,9 @@ const   FLOAT32* __restrict__ p_inp,
     int i;
     FLOAT32 *p_dst_pad, *p_rec_den;
 
+    /* Fused activation: outputs are clamped before being stored */
+    xtfloat zero_out = XT_MIN_S(XT_MAX_S(0.0f, out_activation_min), out_activation_max);
+
     plane_size = input_width * input_channels;
 
     for(itr_oh = 0; itr_oh < out_height; itr_oh++)
@@ -308,6 +315,8 @@ const   FLOAT32* __restrict__ p_inp,
 
                     i1 = p_dst_pad[i];
                     out = i1 * recip_den_s;
+                    out = XT_MAX_S(out, out_activation_min);
+                    out = XT_MIN_S(out, out_activation_max);
                     p_dst_pad[i] = out;
                 }
             }
@@ -317,7 +326,7 @@ const   FLOAT32* __restrict__ p_inp,
                 p_dst_pad = (FLOAT32 *)p_dst;
                 for(i = 0; i < input_channels; i++)
                 {
-                    p_dst_pad[i] = 0;
+                    p_dst_pad[i] = zero_out;
                 }
             }
         }
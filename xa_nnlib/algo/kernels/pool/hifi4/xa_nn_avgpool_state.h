@@ -69,7 +69,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   out_width,
         pVOID    p_scratch_in,
         FLOAT32  *p_zeros_mem,
-        FLOAT32  *p_den);
+        FLOAT32  *p_den,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max);
 
 void xa_nn_avgpool_asym8_hwc_16(
         UWORD8* __restrict__ p_out,
@@ -88,7 +90,9 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width);
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max);
 
 void xa_nn_avgpool_asym8_hwc_32(
         UWORD8* __restrict__ p_out,
@@ -107,6 +111,8 @@ const   UWORD8* __restrict__ p_inp,
         pVOID    p_scratch_in,
         pVOID    p_zeros_mem,
         WORD32   *p_den_height,
-        WORD32   *p_den_width);
+        WORD32   *p_den_width,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max);
 
 #endif /* #ifndef __XA_NN_AVGPOOL_STATE_H__ */
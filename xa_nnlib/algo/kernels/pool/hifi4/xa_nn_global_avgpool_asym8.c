@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_avgpool_state.h"
+#include "xa_nnlib_err_chk.h"
+
+#define MultiplyByQuantizedMultiplierSmallerThanOneExp(prod, val, multiplier, lsh) {\
+    ae_int64 temp64_h, temp64_l;\
+    prod = AE_MULFP32X2RAS(val, multiplier);\
+    temp64_h = AE_MOVINT64_FROMINT32X2(AE_SEL32_HH(prod, ZERO));\
+    temp64_l = AE_MOVINT64_FROMINT32X2(AE_SEL32_LL(prod, ZERO));\
+    temp64_h = AE_SLAA64S(temp64_h, lsh);\
+    temp64_l = AE_SLAA64S(temp64_l, lsh);\
+    prod = AE_ROUND32X2F64SSYM(temp64_h, temp64_l);\
+}
+
+#define CLAMP_VAL(out, val, min, max){\
+    ae_int32x2 temp_max;\
+    temp_max = AE_MAX32(min, val);\
+    out = AE_MIN32(temp_max, max);\
+}
+
+#define STORE_8X4_FROM_32X4(out_ptr, val12, val34){\
+    int o1, o2, o3, o4;\
+    o1 = AE_MOVAD32_H(val12);\
+    o2 = AE_MOVAD32_L(val12);\
+    o3 = AE_MOVAD32_H(val34);\
+    o4 = AE_MOVAD32_L(val34);\
+    *out_ptr++ = (UWORD8)o1;\
+    *out_ptr++ = (UWORD8)o2;\
+    *out_ptr++ = (UWORD8)o3;\
+    *out_ptr++ = (UWORD8)o4;\
+}
+
+/* HiFi4 has no aligning load for 8 bit data, the bytes before the first 4
+ * byte boundary are collected in the alignment register 'tmp' and every
+ * AE_LA8X4U_IP merges one aligned AE_L8X4F_I with it. Gives the unsigned
+ * byte in the low 8 bits of each lane. */
+#define PRIME_8X4U(p_char, tmp) \
+    int offset_##p_char = 0, ls_##p_char, rs_##p_char; \
+    rs_##p_char = 0; \
+    ls_##p_char = 64; \
+    tmp = AE_ZERO16(); \
+    while(((unsigned int)p_char + offset_##p_char) & 3) {\
+        ae_int16x4 tmp2 = AE_MOVDA16(*(((const UWORD8 *)p_char)+offset_##p_char)); \
+        tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(tmp2), 48)); \
+        tmp = AE_MOVINT16X4_FROMINT64(AE_SLAI64(AE_MOVINT64_FROMINT16X4(tmp), 16)); \
+        tmp = AE_OR16(tmp, tmp2); \
+        rs_##p_char += 16;  \
+        ls_##p_char -= 16; \
+        offset_##p_char++; \
+    }\
+    tmp = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(tmp), ls_##p_char)); \
+
+#define AE_LA8X4U_IP(d, a, p) { \
+    ae_int16x4 d_tmp, d_tmp2; \
+    d_tmp = AE_L8X4F_I(p+offset_##p, 0); \
+    p += 4; \
+    d_tmp2 = AE_MOVINT16X4_FROMINT64(AE_SRLA64(AE_MOVINT64_FROMINT16X4(d_tmp), rs_##p+8)); \
+    d = AE_OR16(a, d_tmp2); \
+    a = AE_MOVINT16X4_FROMINT64(AE_SLAA64(AE_MOVINT64_FROMINT16X4(d_tmp), ls_##p-8)); \
+}
+
+/* Channels whose sums are kept on the stack during one pass over a batch */
+#define GLOBAL_AVGPOOL_CH_TILE 256
+
+/* Requantizes a pair of 32 bit channel sums and adds the output zero bias */
+#define REQUANTIZE_32X2(out, acc) {\
+    acc = AE_ADD32S(acc, bias_sum);\
+    MultiplyByQuantizedMultiplierSmallerThanOneExp(out, acc, multiplier, out_shift);\
+    out = AE_ADD32S(out, out_zb);\
+    CLAMP_VAL(out, out, min_asym8, max_asym8);\
+}
+
+/* Global average pooling (MEAN over height and width) of an NHWC cube.
+ * The pixels of a batch are streamed once per GLOBAL_AVGPOOL_CH_TILE
+ * channels (once for most layers), adding each pixel's channels into 32 bit
+ * per channel sums. The input zero bias is folded in once per channel and
+ * each sum is requantized exactly once. Channel runs that are not 4 byte
+ * aligned go through an emulated aligning load, at most 3 trailing channels
+ * per pixel are added one by one.
+ * out_multiplier/out_shift must include the 1/(input_height*input_width)
+ * factor along with the input to output scale ratio.
+ */
+WORD32 xa_nn_global_avgpool_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  inp_zero_bias,
+        WORD32  out_multiplier,
+        WORD32  out_shift,
+        WORD32  out_zero_bias)
+{
+    int itr_b, itr_c, itr_n, itr_t;
+    int plane_size, tile, tile_x4, aligned;
+    const UWORD8 *p_inp_b;
+    UWORD8 *p_out_t;
+    ae_int32x2 acc[GLOBAL_AVGPOOL_CH_TILE / 2];
+    WORD32 tail_sum[3];
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD8), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD8), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_zero_bias < -255 || inp_zero_bias > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+    /* Implementation dependent checks: 32 bit sums must not overflow */
+    XA_NNLIB_ARG_CHK_COND((input_height * input_width > (1 << 23)), -1);
+
+    plane_size = input_height * input_width;
+
+    ae_int32x2 ZERO = AE_ZERO32();
+    ae_int32x2 multiplier = AE_MOVDA32(out_multiplier);
+    ae_int32x2 out_zb = AE_MOVDA32(out_zero_bias);
+    ae_int32x2 bias_sum = AE_MOVDA32(plane_size * inp_zero_bias);
+    ae_int32x2 min_asym8 = AE_MOVDA32(0);
+    ae_int32x2 max_asym8 = AE_MOVDA32(255);
+    ae_int16x4 one = AE_MOVDA16(1);
+
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        p_inp_b = p_inp + itr_b * plane_size * input_channels;
+
+        for(itr_c = 0; itr_c < input_channels; itr_c += tile)
+        {
+            tile = input_channels - itr_c;
+            if(tile > GLOBAL_AVGPOOL_CH_TILE)
+            {
+                tile = GLOBAL_AVGPOOL_CH_TILE;
+            }
+            tile_x4 = tile & ~3;
+            /* Every pixel's run starts on a 4 byte boundary */
+            aligned = ((input_channels & 3) == 0) &&
+                      ((((unsigned)(p_inp_b + itr_c)) & 3) == 0);
+
+            for(itr_t = 0; itr_t < (tile_x4 >> 1); itr_t++)
+            {
+                acc[itr_t] = AE_ZERO32();
+            }
+            tail_sum[0] = tail_sum[1] = tail_sum[2] = 0;
+
+            for(itr_n = 0; itr_n < plane_size; itr_n++)
+            {
+                const UWORD8 *p_pix = p_inp_b + itr_n * input_channels + itr_c;
+                WORD8 *p_src = (WORD8 *)p_pix;
+                ae_int32x2 *p_acc = acc;
+                ae_int32x2 acc01, acc23;
+                ae_int16x4 d;
+
+                if(aligned)
+                {
+                    for(itr_t = 0; itr_t < tile_x4; itr_t += 4)
+                    {
+                        AE_L8X4F_IP(d, p_src, 4);
+                        d = AE_MOVINT16X4_FROMINT64(AE_SRLI64(AE_MOVINT64_FROMINT16X4(d), 8));
+                        acc01 = p_acc[0];
+                        acc23 = p_acc[1];
+                        AE_MULA16X4(acc01, acc23, d, one);
+                        *p_acc++ = acc01;
+                        *p_acc++ = acc23;
+                    }
+                }
+                else
+                {
+                    ae_int16x4 d_a;
+                    PRIME_8X4U(p_src, d_a);
+                    for(itr_t = 0; itr_t < tile_x4; itr_t += 4)
+                    {
+                        AE_LA8X4U_IP(d, d_a, p_src);
+                        acc01 = p_acc[0];
+                        acc23 = p_acc[1];
+                        AE_MULA16X4(acc01, acc23, d, one);
+                        *p_acc++ = acc01;
+                        *p_acc++ = acc23;
+                    }
+                }
+                for(itr_t = tile_x4; itr_t < tile; itr_t++)
+                {
+                    tail_sum[itr_t - tile_x4] += p_pix[itr_t];
+                }
+            }
+
+            p_out_t = p_out + itr_b * input_channels + itr_c;
+            for(itr_t = 0; itr_t < (tile_x4 >> 1); itr_t += 2)
+            {
+                ae_int32x2 out01, out23;
+                ae_int32x2 acc01 = acc[itr_t], acc23 = acc[itr_t + 1];
+                REQUANTIZE_32X2(out01, acc01);
+                REQUANTIZE_32X2(out23, acc23);
+                STORE_8X4_FROM_32X4(p_out_t, out01, out23);
+            }
+            for(itr_t = tile_x4; itr_t < tile; itr_t++)
+            {
+                ae_int32x2 sum, out;
+                sum = AE_MOVDA32(tail_sum[itr_t - tile_x4]);
+                REQUANTIZE_32X2(out, sum);
+                *p_out_t++ = (UWORD8)AE_MOVAD32_L(out);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_avgpool_state.h"
+#include "xa_nnlib_err_chk.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_global_avgpool_f32,(
+    FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+    WORD32  batches,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels))
+#else /* #if !HAVE_VFPU */
+
+/* Channels whose sums are kept on the stack during one pass over a batch */
+#define GLOBAL_AVGPOOL_CH_TILE 256
+
+/* Global average pooling (MEAN over height and width) of an NHWC cube.
+ * The pixels of a batch are streamed once per GLOBAL_AVGPOOL_CH_TILE
+ * channels (once for most layers), adding each pixel's channels into per
+ * channel sums two at a time, and each sum is scaled by 1/(H*W) once.
+ * Pixels need not start on an 8 byte boundary, with an odd channel count
+ * the last channel of each pixel is added on its own.
+ */
+WORD32 xa_nn_global_avgpool_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels)
+{
+    int itr_b, itr_c, itr_n, itr_t;
+    int plane_size, tile, tile_x2;
+    FLOAT32 recip_den;
+    xtfloatx2 recip_den_x2;
+    const FLOAT32 *p_inp_b;
+    xtfloatx2 acc[GLOBAL_AVGPOOL_CH_TILE / 2];
+    xtfloat tail_sum;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+
+    plane_size = input_height * input_width;
+    recip_den = XT_RECIP_S((FLOAT32)plane_size);
+    recip_den_x2 = recip_den;
+
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        p_inp_b = p_inp + itr_b * plane_size * input_channels;
+
+        for(itr_c = 0; itr_c < input_channels; itr_c += tile)
+        {
+            xtfloatx2 *p_dst;
+            ae_valign align_dst = AE_ZALIGN64();
+
+            tile = input_channels - itr_c;
+            if(tile > GLOBAL_AVGPOOL_CH_TILE)
+            {
+                tile = GLOBAL_AVGPOOL_CH_TILE;
+            }
+            tile_x2 = tile & ~1;
+
+            for(itr_t = 0; itr_t < (tile_x2 >> 1); itr_t++)
+            {
+                acc[itr_t] = XT_CONST_S(0);
+            }
+            tail_sum = XT_CONST_S(0);
+
+            for(itr_n = 0; itr_n < plane_size; itr_n++)
+            {
+                const FLOAT32 *p_pix = p_inp_b + itr_n * input_channels + itr_c;
+                xtfloatx2 *p_src = (xtfloatx2 *)p_pix;
+                xtfloatx2 *p_acc = acc;
+                ae_valign align_src = XT_LASX2PP(p_src);
+                xtfloatx2 i0;
+
+                for(itr_t = 0; itr_t < tile_x2; itr_t += 2)
+                {
+                    XT_LASX2IP(i0, align_src, p_src);
+                    *p_acc = XT_ADD_SX2(*p_acc, i0);
+                    p_acc++;
+                }
+                if(tile & 1)
+                {
+                    tail_sum = XT_ADD_S(tail_sum, p_pix[tile_x2]);
+                }
+            }
+
+            p_dst = (xtfloatx2 *)(p_out + itr_b * input_channels + itr_c);
+            for(itr_t = 0; itr_t < (tile_x2 >> 1); itr_t++)
+            {
+                xtfloatx2 out0 = XT_MUL_SX2(acc[itr_t], recip_den_x2);
+                XT_SASX2IP(out0, align_dst, p_dst);
+            }
+            XT_SASX2POSFP(align_dst, p_dst);
+            if(tile & 1)
+            {
+                p_out[itr_b * input_channels + itr_c + tile_x2] = XT_MUL_S(tail_sum, recip_den);
+            }
+        }
+    }
+
+    return 0;
+}
+#endif /* #if !HAVE_VFPU */
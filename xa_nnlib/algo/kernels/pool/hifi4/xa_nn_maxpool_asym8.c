@@ -64,7 +64,9 @@ static void maxpool_asym8_hw(
     WORD32  y_padding,
     WORD32   out_height,
     WORD32   out_width,
-    pVOID    p_scratch_in)
+    pVOID    p_scratch_in,
+    WORD32   out_activation_min,
+    WORD32   out_activation_max)
 {
     WORD16 *p_scratch = (WORD16 *)(p_scratch_in);
 
@@ -287,12 +289,14 @@ static void maxpool_asym8_hw(
         WORD16 *ptr_out1 = p_scratch + total_out_width; 
         for(itr_ow = 0; itr_ow < out_width; itr_ow++)
         {
-            p_out[itr_oh * out_width + itr_ow] = (UWORD8)AE_MOVAD16_0(*(ae_int16 *)(&ptr_out1[itr_ow * x_stride]));
+            WORD32 out = AE_MOVAD16_0(*(ae_int16 *)(&ptr_out1[itr_ow * x_stride]));
+            out = XT_MIN(out_activation_max, XT_MAX(out_activation_min, out));
+            p_out[itr_oh * out_width + itr_ow] = (UWORD8)out;
         }
     }
 }
 
-WORD32 xa_nn_maxpool_asym8(
+static WORD32 maxpool_asym8_single_batch(
         UWORD8* __restrict__ p_out,
 const   UWORD8* __restrict__ p_inp,
         WORD32  input_height,
@@ -306,34 +310,13 @@ const   UWORD8* __restrict__ p_inp,
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
-#ifdef NNLIB_V2
-        WORD32  inp_data_format,
-#endif
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
         WORD32  out_data_format,
         VOID   *p_scratch)
 {
     WORD32 err = 0;
 
-    /* NULL pointer checks */
-    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-    /* Pointer alignment checks */
-    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD8), -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD8), -1);
-    /* Basic Parameter checks */
-    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
-    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
-
-    // Different I/O formats (not supported!)
-    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
-
     if((input_channels == 1) || (out_data_format == 1))
     {
         err = xa_nn_maxpool_init(-3
@@ -372,6 +355,8 @@ const   UWORD8* __restrict__ p_inp,
                     ,out_height
                     ,out_width
                     ,p_scratch_in
+                    ,out_activation_min
+                    ,out_activation_max
                     );
         }
     }
@@ -391,7 +376,133 @@ const   UWORD8* __restrict__ p_inp,
                 ,y_padding
                 ,out_height
                 ,out_width
-                ,p_scratch_aligned);
+                ,p_scratch_aligned
+                ,out_activation_min
+                ,out_activation_max);
     }
     return 0;
 }
+
+WORD32 xa_nn_maxpool_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+#ifdef NNLIB_V2
+        WORD32  inp_data_format,
+#endif
+        WORD32  out_data_format,
+        VOID   *p_scratch)
+{
+    return xa_nn_maxpool_batch_asym8(p_out
+            ,p_inp
+            ,1
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,0
+            ,255
+#ifdef NNLIB_V2
+            ,inp_data_format
+#else
+            ,out_data_format
+#endif
+            ,out_data_format
+            ,p_scratch);
+}
+
+WORD32 xa_nn_maxpool_batch_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch)
+{
+    WORD32 err = 0;
+    int itr_b;
+    WORD32 inp_batch_size, out_batch_size;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD8), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD8), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_min < 0 || out_activation_min > 255), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 255), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+
+    // Different I/O formats (not supported!)
+    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
+
+    inp_batch_size = input_height * input_width * input_channels;
+    out_batch_size = out_height * out_width * input_channels;
+
+    /* Scratch is re-initialized for every batch, so the size given by
+     * xa_nn_maxpool_getsize for a single batch is sufficient */
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        err = maxpool_asym8_single_batch(&p_out[itr_b * out_batch_size]
+                ,&p_inp[itr_b * inp_batch_size]
+                ,input_height
+                ,input_width
+                ,input_channels
+                ,kernel_height
+                ,kernel_width
+                ,x_stride
+                ,y_stride
+                ,x_padding
+                ,y_padding
+                ,out_height
+                ,out_width
+                ,out_activation_min
+                ,out_activation_max
+                ,out_data_format
+                ,p_scratch);
+        if(err<0)
+            return err;
+    }
+
+    return 0;
+}
@@ -116,7 +116,9 @@ const   UWORD8* __restrict__ p_inp,
         WORD32   y_padding,
         WORD32   out_height,
         WORD32   out_width,
-        pVOID    p_scratch_in)
+        pVOID    p_scratch_in,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max)
 {
     WORD16 *p_scratch = (WORD16 *)(p_scratch_in);
 
@@ -361,7 +363,9 @@ const   UWORD8* __restrict__ p_inp,
                 p_dst_pad = (WORD16 *)p_dst;
                 for(i=0; i<input_channels; i++)
                 {
-                    p_out_temp[i] = (UWORD8)p_dst_pad[i];
+                    WORD32 out = p_dst_pad[i];
+                    out = XT_MIN(out_activation_max, XT_MAX(out_activation_min, out));
+                    p_out_temp[i] = (UWORD8)out;
                 }
             }
             else
@@ -369,7 +373,7 @@ const   UWORD8* __restrict__ p_inp,
                 /* If there is no valid input present, fill the output with min_value */
                 for(i = 0; i < input_channels; i++)
                 {
-                    p_out_temp[i] = (UWORD8)0x0;
+                    p_out_temp[i] = (UWORD8)out_activation_min;
                 }
             }
         }
@@ -46,6 +46,27 @@ const FLOAT32* __restrict__ p_inp,
 #endif
     WORD32  out_data_format,
     VOID *p_scratch))
+
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_maxpool_batch_f32,(
+    FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+    WORD32  batches,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    FLOAT32 out_activation_min,
+    FLOAT32 out_activation_max,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    VOID *p_scratch))
 #else /* #if !HAVE_VFPU */
 
 #define INCR_N_ROW(ptr, n) \
@@ -92,7 +113,9 @@ static void maxpool_f32_hw(
     WORD32  y_padding,
     WORD32   out_height,
     WORD32   out_width,
-    pVOID    p_scratch_in)
+    pVOID    p_scratch_in,
+    FLOAT32  out_activation_min,
+    FLOAT32  out_activation_max)
 {
     FLOAT32 *p_scratch = (FLOAT32 *)(p_scratch_in);
 
@@ -290,12 +313,13 @@ static void maxpool_f32_hw(
         FLOAT32 *ptr_out1 = p_scratch + total_out_width; 
         for(itr_ow = 0; itr_ow < out_width; itr_ow++)
         {
-            p_out[itr_oh * out_width * 1 /* out_stride */ + itr_ow * 1 /* out_stride */] = ptr_out1[itr_ow * x_stride]; 
+            xtfloat out = XT_MAX_S(ptr_out1[itr_ow * x_stride], out_activation_min);
+            p_out[itr_oh * out_width * 1 /* out_stride */ + itr_ow * 1 /* out_stride */] = XT_MIN_S(out, out_activation_max); 
         }
     }
 }
 
-WORD32 xa_nn_maxpool_f32(
+static WORD32 maxpool_f32_single_batch(
         FLOAT32* __restrict__ p_out,
 const   FLOAT32* __restrict__ p_inp,
         WORD32  input_height,
@@ -309,38 +333,13 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32  y_padding,
         WORD32  out_height,
         WORD32  out_width,
-#ifdef NNLIB_V2
-        WORD32  inp_data_format,
-#endif
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
         WORD32  out_data_format,
         VOID   *p_scratch)
 {
     WORD32 err = 0;
 
-    /* NULL pointer checks */
-    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-    /* Pointer alignment checks */
-    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
-    /* Basic Parameter checks */
-    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
-    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
-#ifdef NNLIB_V2
-    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
-
-    // Different I/O formats (not supported!)
-    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
-#endif
-    
     if((input_channels == 1) || (out_data_format == 1))
     {
         err = xa_nn_maxpool_init(-1
@@ -379,6 +378,8 @@ const   FLOAT32* __restrict__ p_inp,
                     ,out_height
                     ,out_width
                     ,p_scratch_in
+                    ,out_activation_min
+                    ,out_activation_max
                     );
         }
     }
@@ -399,9 +400,136 @@ const   FLOAT32* __restrict__ p_inp,
                 ,y_padding
                 ,out_height
                 ,out_width
-                ,p_scratch_aligned);
+                ,p_scratch_aligned
+                ,out_activation_min
+                ,out_activation_max);
     }
     return 0;
 }
+
+WORD32 xa_nn_maxpool_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+#ifdef NNLIB_V2
+        WORD32  inp_data_format,
+#endif
+        WORD32  out_data_format,
+        VOID   *p_scratch)
+{
+    return xa_nn_maxpool_batch_f32(p_out
+            ,p_inp
+            ,1
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,-INFINITY
+            ,INFINITY
+#ifdef NNLIB_V2
+            ,inp_data_format
+#else
+            ,out_data_format
+#endif
+            ,out_data_format
+            ,p_scratch);
+}
+
+WORD32 xa_nn_maxpool_batch_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch)
+{
+    WORD32 err = 0;
+    int itr_b;
+    WORD32 inp_batch_size, out_batch_size;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((batches <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+
+    // Different I/O formats (not supported!)
+    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
+
+    inp_batch_size = input_height * input_width * input_channels;
+    out_batch_size = out_height * out_width * input_channels;
+
+    /* Scratch is re-initialized for every batch, so the size given by
+     * xa_nn_maxpool_getsize for a single batch is sufficient */
+    for(itr_b = 0; itr_b < batches; itr_b++)
+    {
+        err = maxpool_f32_single_batch(&p_out[itr_b * out_batch_size]
+                ,&p_inp[itr_b * inp_batch_size]
+                ,input_height
+                ,input_width
+                ,input_channels
+                ,kernel_height
+                ,kernel_width
+                ,x_stride
+                ,y_stride
+                ,x_padding
+                ,y_padding
+                ,out_height
+                ,out_width
+                ,out_activation_min
+                ,out_activation_max
+                ,out_data_format
+                ,p_scratch);
+        if(err<0)
+            return err;
+    }
+
+    return 0;
+}
 #endif /* #if !HAVE_VFPU */
 
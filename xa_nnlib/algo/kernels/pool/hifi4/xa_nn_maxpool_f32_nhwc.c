@@ -41,7 +41,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   y_padding,
         WORD32   out_height,
         WORD32   out_width,
-        pVOID    p_scratch_in))
+        pVOID    p_scratch_in,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max))
 #else /* #if !HAVE_VFPU */
 
 #define INCR_N_PLANE_NHWC(ptr, n, plane_size) \
@@ -84,7 +86,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   y_padding,
         WORD32   out_height,
         WORD32   out_width,
-        pVOID    p_scratch_in)
+        pVOID    p_scratch_in,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max)
 {
     FLOAT32 *p_scratch = (FLOAT32 *)(p_scratch_in);
 
@@ -97,6 +101,11 @@ const   FLOAT32* __restrict__ p_inp,
     int i;
     FLOAT32 *p_dst_pad;
 
+    /* Fused activation: clamping commutes with max, so every pass along the
+     * width can clamp its partial result before storing it to the output */
+    xtfloatx2 act_min = out_activation_min;
+    xtfloatx2 act_max = out_activation_max;
+
     plane_size = input_width * input_channels;
     for(itr_oh = 0; itr_oh < out_height; itr_oh++)
     {
@@ -245,6 +254,8 @@ const   FLOAT32* __restrict__ p_inp,
 
                         temp = XT_MAX_SX2(i1, i2);
                         out = XT_MAX_SX2(temp, i3);
+                        out = XT_MAX_SX2(out, act_min);
+                        out = XT_MIN_SX2(out, act_max);
 
                         XT_SASX2IP(out, align_dst, p_dst_temp);
                     }
@@ -262,6 +273,8 @@ const   FLOAT32* __restrict__ p_inp,
 
                         temp = XT_MAX_S(i1, i2);
                         out  = XT_MAX_S(temp, i3);
+                        out  = XT_MAX_S(out, out_activation_min);
+                        out  = XT_MIN_S(out, out_activation_max);
                         ((FLOAT32 *)p_dst_temp)[0] = out;
                     }
 
@@ -285,7 +298,7 @@ const   FLOAT32* __restrict__ p_inp,
                 p_dst_pad = (FLOAT32 *)p_dst;
                 for(i = 0; i < input_channels; i++)
                 {
-                    p_dst_pad[i] = -INFINITY;
+                    p_dst_pad[i] = out_activation_min;
                 }
             }
         }
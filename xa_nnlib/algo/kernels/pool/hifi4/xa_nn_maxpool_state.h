@@ -61,7 +61,9 @@ const   FLOAT32* __restrict__ p_inp,
         WORD32   y_padding,
         WORD32   out_height,
         WORD32   out_width,
-        pVOID    p_scratch_in);
+        pVOID    p_scratch_in,
+        FLOAT32  out_activation_min,
+        FLOAT32  out_activation_max);
 
 void xa_nn_maxpool_asym8_hwc(
         UWORD8* __restrict__ p_out,
@@ -77,6 +79,8 @@ const   UWORD8* __restrict__ p_inp,
         WORD32   y_padding,
         WORD32   out_height,
         WORD32   out_width,
-        pVOID    p_scratch_in);
+        pVOID    p_scratch_in,
+        WORD32   out_activation_min,
+        WORD32   out_activation_max);
 
 #endif /* #ifndef __XA_NN_AVGPOOL_STATE_H__ */
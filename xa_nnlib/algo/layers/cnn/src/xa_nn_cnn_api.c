@@ -24,6 +24,7 @@
 #include "common_fpu.h"
 #include "xa_nnlib_cnn_api.h"
 #include "xa_nnlib_api.h"
+#include "xa_nnlib_workers.h"
 
 #define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+7))&(~7))
 #define ALIGN_SIZE(n) (((n)+7)&(~7))
@@ -148,6 +149,8 @@ typedef struct _cnn_state_t
   void *bias_ds_depth;   
   void *bias_ds_point;   
 
+  Int32 num_workers;
+
 } cnn_state_t;
 
 typedef struct _temp_mem_t 
@@ -1090,8 +1093,8 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
     CHECK_CUBE_DIMS(config->input_shape,  SHAPE_CUBE_WHD_T, XA_NNLIB_CNN_CONFIG_FATAL_INVALID_INPUT_SHAPE);
     CHECK_KERNEL_CUBE_DIMS(config->kernel_ds_depth_shape, SHAPE_CUBE_WHD_T, XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE); 
 
-    /* output data format must be 1 (WHD) */
-    if (config->output_format != 1)
+    /* output data format must be 0 (DWH) or 1 (WHD) */
+    if ((config->output_format != 0) && (config->output_format != 1))
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_OUTPUT_SHAPE;
 
     if(config->bias_ds_depth_shape.shape_type != SHAPE_VECTOR_T)
@@ -1127,6 +1130,454 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
   return XA_NNLIB_NO_ERROR;
 }
 
+/* CONV2D_DS runs the depthwise and the pointwise stage over bands of
+   DS_BAND_OUT_ROWS output rows, so only one band of the depthwise output is
+   ever held in scratch instead of the whole intermediate cube. */
+#define DS_BAND_OUT_ROWS 8
+
+static int ds_band_out_rows(xa_nnlib_cnn_init_config_t *config)
+{
+  return (config->output_height < DS_BAND_OUT_ROWS) ? config->output_height : DS_BAND_OUT_ROWS;
+}
+
+/* Input rows, including top / bottom padding, read by 'out_rows' output rows */
+static int ds_band_inp_rows(xa_nnlib_cnn_init_config_t *config, int out_rows)
+{
+  return (out_rows - 1) * config->y_stride + config->kernel_ds_depth_shape.dim.cube.height;
+}
+
+static int ds_band_depthwise_scratch_size(xa_nnlib_cnn_init_config_t *config)
+{
+  int band_rows = ds_band_out_rows(config);
+  int scratch_size;
+
+  scratch_size = xa_nn_conv2d_depthwise_getsize(ds_band_inp_rows(config, band_rows),
+                                                config->input_shape.dim.cube.width,
+                                                config->input_shape.dim.cube.depth,
+                                                config->kernel_ds_depth_shape.dim.cube.height,
+                                                config->kernel_ds_depth_shape.dim.cube.width,
+                                                config->channels_multiplier,
+                                                config->x_stride,
+                                                config->y_stride,
+                                                config->x_padding,
+                                                0,
+                                                band_rows,
+                                                config->output_width,
+                                                IO_PRECISION_BITS(config->precision),
+                                                1);   // WHD supported for all precisions
+  return ALIGN_SIZE(scratch_size);
+}
+
+/* Depthwise scratch, input band (WHD), depthwise output band (DWH) and,
+   for 8bx16b, the pointwise output band */
+static int ds_band_scratch_size(xa_nnlib_cnn_init_config_t *config)
+{
+  int bytewidth = IO_PRECISION_BYTES(config->precision);
+  int band_rows = ds_band_out_rows(config);
+  int scratch_size;
+
+  scratch_size  = ds_band_depthwise_scratch_size(config);
+  scratch_size += ALIGN_SIZE(bytewidth * config->input_shape.dim.cube.depth * ds_band_inp_rows(config, band_rows) * config->input_shape.dim.cube.width);
+  scratch_size += ALIGN_SIZE(bytewidth * band_rows * config->output_width * config->input_shape.dim.cube.depth * config->channels_multiplier);
+  if(config->precision == XA_NNLIB_CNN_8bx16b)
+    scratch_size += ALIGN_SIZE(bytewidth * band_rows * config->output_width * config->output_channels);
+
+  return scratch_size;
+}
+
+/* Output rows [row_start, row_start + row_count) */
+static int ds_process_bands(cnn_state_t *cnn, void *scratch, void *input, void *output, int row_start, int row_count)
+{
+  xa_nnlib_cnn_init_config_t *config = &cnn->config;
+  int bytewidth = IO_PRECISION_BYTES(config->precision);
+  int inp_height = config->input_shape.dim.cube.height;
+  int inp_width = config->input_shape.dim.cube.width;
+  int inp_channels = config->input_shape.dim.cube.depth;
+  int out_height = cnn->output_shape.dim.cube.height;
+  int out_width = cnn->output_shape.dim.cube.width;
+  int out_channels = cnn->output_shape.dim.cube.depth;
+  int dw_channels = inp_channels * config->channels_multiplier;
+  int out_plane = out_height * out_width;
+  /* Distance between two output pixels and between two output channels */
+  int out_offset = (config->output_format == 0) ? out_channels : 1;
+  int out_stride = (config->output_format == 0) ? 1 : out_plane;
+  int max_band_rows = ds_band_out_rows(config);
+  int row_end = row_start + row_count;
+  int band_row, band_rows, band_inp_rows, inp_row, itr_c, itr_r;
+  int err = 0;
+  char *p_dw_scratch, *p_band_inp, *p_band_dw, *p_band_out;
+
+  p_dw_scratch = (char *)scratch;
+  p_band_inp = p_dw_scratch + ds_band_depthwise_scratch_size(config);
+  p_band_dw = p_band_inp + ALIGN_SIZE(bytewidth * inp_channels * ds_band_inp_rows(config, max_band_rows) * inp_width);
+  p_band_out = p_band_dw + ALIGN_SIZE(bytewidth * max_band_rows * out_width * dw_channels);
+
+  for(band_row = row_start; band_row < row_end; band_row += band_rows)
+  {
+    band_rows = row_end - band_row;
+    if(band_rows > max_band_rows)
+      band_rows = max_band_rows;
+    band_inp_rows = ds_band_inp_rows(config, band_rows);
+
+    /* Input rows of the band, rows in the top / bottom padding are zeroed
+       so the depthwise kernel runs without y_padding */
+    for(itr_c = 0; itr_c < inp_channels; itr_c++)
+    {
+      for(itr_r = 0; itr_r < band_inp_rows; itr_r++)
+      {
+        char *p_dst = p_band_inp + (itr_c * band_inp_rows + itr_r) * inp_width * bytewidth;
+        inp_row = band_row * config->y_stride - config->y_padding + itr_r;
+        if(inp_row < 0 || inp_row >= inp_height)
+          memset(p_dst, 0, inp_width * bytewidth);
+        else
+          memcpy(p_dst, (char *)input + (itr_c * inp_height + inp_row) * inp_width * bytewidth, inp_width * bytewidth);
+      }
+    }
+
+    switch(config->precision)
+    {
+      case XA_NNLIB_CNN_16bx16b:
+      {
+        err = xa_nn_conv2d_depthwise_16x16((WORD16 *)p_band_dw,
+                                           cnn->kernel_ds_depth,
+                                           (WORD16 *)p_band_inp,
+                                           cnn->bias_ds_depth,
+                                           band_inp_rows,
+                                           inp_width,
+                                           inp_channels,
+                                           config->kernel_ds_depth_shape.dim.cube.height,
+                                           config->kernel_ds_depth_shape.dim.cube.width,
+                                           config->channels_multiplier,
+                                           config->x_stride,
+                                           config->y_stride,
+                                           config->x_padding,
+                                           0,
+                                           band_rows,
+                                           out_width,
+                                           config->acc_shift,
+                                           config->bias_shift,
+                                           1, //must be WHD
+                                           0, //must be DWH
+                                           p_dw_scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_16x16_16((WORD16 *)output + band_row * out_width * out_offset,
+                                    cnn->kernel_ds_point,
+                                    (WORD16 *)p_band_dw,
+                                    cnn->bias_ds_point,
+                                    out_channels,
+                                    dw_channels,
+                                    dw_channels,
+                                    config->acc_shift,
+                                    config->bias_shift,
+                                    band_rows * out_width,
+                                    dw_channels,
+                                    out_offset,
+                                    out_stride);
+      }
+      break;
+      case XA_NNLIB_CNN_8bx16b:
+      {
+        err = xa_nn_conv2d_depthwise_8x16((WORD16 *)p_band_dw,
+                                          cnn->kernel_ds_depth,
+                                          (WORD16 *)p_band_inp,
+                                          cnn->bias_ds_depth,
+                                          band_inp_rows,
+                                          inp_width,
+                                          inp_channels,
+                                          config->kernel_ds_depth_shape.dim.cube.height,
+                                          config->kernel_ds_depth_shape.dim.cube.width,
+                                          config->channels_multiplier,
+                                          config->x_stride,
+                                          config->y_stride,
+                                          config->x_padding,
+                                          0,
+                                          band_rows,
+                                          out_width,
+                                          config->acc_shift,
+                                          config->bias_shift,
+                                          1, //must be WHD
+                                          0, //must be DWH
+                                          p_dw_scratch);
+
+        if (err) break;
+
+        /* No 8x16 matmul, the pointwise band is planar over the band only
+           and is copied into the output */
+        err = xa_nn_conv2d_pointwise_8x16((WORD16 *)p_band_out,
+                                          cnn->kernel_ds_point,
+                                          (WORD16 *)p_band_dw,
+                                          cnn->bias_ds_point,
+                                          band_rows,
+                                          out_width,
+                                          dw_channels,
+                                          out_channels,
+                                          config->acc_shift,
+                                          config->bias_shift,
+                                          1);
+
+        if (err) break;
+
+        if(config->output_format == 1)
+        {
+          for(itr_c = 0; itr_c < out_channels; itr_c++)
+          {
+            memcpy((WORD16 *)output + itr_c * out_plane + band_row * out_width,
+                   (WORD16 *)p_band_out + itr_c * band_rows * out_width,
+                   band_rows * out_width * sizeof(WORD16));
+          }
+        }
+        else
+        {
+          WORD16 *p_dst = (WORD16 *)output + band_row * out_width * out_channels;
+          WORD16 *p_src = (WORD16 *)p_band_out;
+          for(itr_r = 0; itr_r < band_rows * out_width; itr_r++)
+          {
+            for(itr_c = 0; itr_c < out_channels; itr_c++)
+            {
+              p_dst[itr_r * out_channels + itr_c] = p_src[itr_c * band_rows * out_width + itr_r];
+            }
+          }
+        }
+      }
+      break;
+      case XA_NNLIB_CNN_8bx8b:
+      {
+        err = xa_nn_conv2d_depthwise_8x8((WORD8 *)p_band_dw,
+                                         cnn->kernel_ds_depth,
+                                         (WORD8 *)p_band_inp,
+                                         cnn->bias_ds_depth,
+                                         band_inp_rows,
+                                         inp_width,
+                                         inp_channels,
+                                         config->kernel_ds_depth_shape.dim.cube.height,
+                                         config->kernel_ds_depth_shape.dim.cube.width,
+                                         config->channels_multiplier,
+                                         config->x_stride,
+                                         config->y_stride,
+                                         config->x_padding,
+                                         0,
+                                         band_rows,
+                                         out_width,
+                                         config->acc_shift,
+                                         config->bias_shift,
+                                         1, //must be WHD
+                                         0, //must be DWH
+                                         p_dw_scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_8x8_8((WORD8 *)output + band_row * out_width * out_offset,
+                                 cnn->kernel_ds_point,
+                                 (WORD8 *)p_band_dw,
+                                 cnn->bias_ds_point,
+                                 out_channels,
+                                 dw_channels,
+                                 dw_channels,
+                                 config->acc_shift,
+                                 config->bias_shift,
+                                 band_rows * out_width,
+                                 dw_channels,
+                                 out_offset,
+                                 out_stride);
+      }
+      break;
+#if HAVE_VFPU
+      case XA_NNLIB_CNN_f32xf32:
+      {
+        err = xa_nn_conv2d_depthwise_f32((FLOAT32 *)p_band_dw,
+                                         cnn->kernel_ds_depth,
+                                         (FLOAT32 *)p_band_inp,
+                                         cnn->bias_ds_depth,
+                                         band_inp_rows,
+                                         inp_width,
+                                         inp_channels,
+                                         config->kernel_ds_depth_shape.dim.cube.height,
+                                         config->kernel_ds_depth_shape.dim.cube.width,
+                                         config->channels_multiplier,
+                                         config->x_stride,
+                                         config->y_stride,
+                                         config->x_padding,
+                                         0,
+                                         band_rows,
+                                         out_width,
+                                         1, //must be WHD
+                                         0, //must be DWH
+                                         p_dw_scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_f32xf32_f32((FLOAT32 *)output + band_row * out_width * out_offset,
+                                       cnn->kernel_ds_point,
+                                       (FLOAT32 *)p_band_dw,
+                                       cnn->bias_ds_point,
+                                       out_channels,
+                                       dw_channels,
+                                       dw_channels,
+                                       band_rows * out_width,
+                                       dw_channels,
+                                       out_offset,
+                                       out_stride);
+      }
+      break;
+#endif
+    }
+    if (err) break;
+  }
+
+  return err;
+}
+
+/* Work shared by the workers of one xa_nnlib_cnn_process call, each worker
+   uses its own scratch_size block of scratch */
+typedef struct _cnn_work_t
+{
+  cnn_state_t *cnn;
+  char *scratch;
+  int scratch_size;
+  void *input;
+  void *output;
+} cnn_work_t;
+
+/* Output channels [start, start + count) */
+static int conv2d_std_worker(void *p_ctx, int worker, int start, int count)
+{
+  cnn_work_t *work = (cnn_work_t *)p_ctx;
+  cnn_state_t *cnn = work->cnn;
+  xa_nnlib_cnn_init_config_t *config = &cnn->config;
+  void *p_scratch = work->scratch + worker * work->scratch_size;
+  int err = 0;
+
+  switch(config->precision)
+  {
+    case XA_NNLIB_CNN_16bx16b:
+    {
+      err = xa_nn_conv2d_std_range_16x16(work->output,
+                                         work->input,
+                                         cnn->kernel_std,
+                                         cnn->bias_std,
+                                         config->input_shape.dim.cube.height,
+                                         config->input_shape.dim.cube.width,
+                                         config->input_shape.dim.cube.depth,
+                                         config->kernel_std_shape.dim.cube.height,
+                                         config->kernel_std_shape.dim.cube.width,
+                                         cnn->output_shape.dim.cube.depth,
+                                         config->x_stride,
+                                         config->y_stride,
+                                         config->x_padding,
+                                         config->y_padding,
+                                         cnn->output_shape.dim.cube.height,
+                                         cnn->output_shape.dim.cube.width,
+                                         config->bias_shift,
+                                         config->acc_shift,
+                                         config->output_format,
+                                         start,
+                                         count,
+                                         p_scratch);
+    }
+    break;
+    case XA_NNLIB_CNN_8bx16b:
+    {
+      err = xa_nn_conv2d_std_range_8x16(work->output,
+                                        work->input,
+                                        cnn->kernel_std,
+                                        cnn->bias_std,
+                                        config->input_shape.dim.cube.height,
+                                        config->input_shape.dim.cube.width,
+                                        config->input_shape.dim.cube.depth,
+                                        config->kernel_std_shape.dim.cube.height,
+                                        config->kernel_std_shape.dim.cube.width,
+                                        cnn->output_shape.dim.cube.depth,
+                                        config->x_stride,
+                                        config->y_stride,
+                                        config->x_padding,
+                                        config->y_padding,
+                                        cnn->output_shape.dim.cube.height,
+                                        cnn->output_shape.dim.cube.width,
+                                        config->bias_shift,
+                                        config->acc_shift,
+                                        config->output_format,
+                                        start,
+                                        count,
+                                        p_scratch);
+    }
+    break;
+    case XA_NNLIB_CNN_8bx8b:
+    {
+      err = xa_nn_conv2d_std_range_8x8(work->output,
+                                       work->input,
+                                       cnn->kernel_std,
+                                       cnn->bias_std,
+                                       config->input_shape.dim.cube.height,
+                                       config->input_shape.dim.cube.width,
+                                       config->input_shape.dim.cube.depth,
+                                       config->kernel_std_shape.dim.cube.height,
+                                       config->kernel_std_shape.dim.cube.width,
+                                       cnn->output_shape.dim.cube.depth,
+                                       config->x_stride,
+                                       config->y_stride,
+                                       config->x_padding,
+                                       config->y_padding,
+                                       cnn->output_shape.dim.cube.height,
+                                       cnn->output_shape.dim.cube.width,
+                                       config->bias_shift,
+                                       config->acc_shift,
+                                       config->output_format,
+                                       start,
+                                       count,
+                                       p_scratch);
+    }
+    break;
+#if HAVE_VFPU
+    case XA_NNLIB_CNN_f32xf32:
+    {
+      err = xa_nn_conv2d_std_range_f32(work->output,
+                                       work->input,
+                                       cnn->kernel_std,
+                                       cnn->bias_std,
+                                       config->input_shape.dim.cube.height,
+                                       config->input_shape.dim.cube.width,
+                                       config->input_shape.dim.cube.depth,
+                                       config->kernel_std_shape.dim.cube.height,
+                                       config->kernel_std_shape.dim.cube.width,
+                                       cnn->output_shape.dim.cube.depth,
+                                       config->x_stride,
+                                       config->y_stride,
+                                       config->x_padding,
+                                       config->y_padding,
+                                       cnn->output_shape.dim.cube.height,
+                                       cnn->output_shape.dim.cube.width,
+                                       config->output_format,
+                                       start,
+                                       count,
+                                       p_scratch);
+    }
+    break;
+#else
+    case XA_NNLIB_CNN_f32xf32:
+    {
+    }
+    break;
+#endif
+  }
+
+  return err;
+}
+
+/* Output rows [start, start + count) */
+static int conv2d_ds_worker(void *p_ctx, int worker, int start, int count)
+{
+  cnn_work_t *work = (cnn_work_t *)p_ctx;
+
+  return ds_process_bands(work->cnn,
+                          work->scratch + worker * work->scratch_size,
+                          work->input,
+                          work->output,
+                          start,
+                          count);
+}
+
 Int32 xa_nnlib_cnn_get_persistent_fast(
      xa_nnlib_cnn_init_config_t *config )
 {
@@ -1146,7 +1597,7 @@ Int32 xa_nnlib_cnn_get_scratch_fast(
        xa_nnlib_cnn_init_config_t *config )
 {
   int scratch_size = 0, ret;
-  int inp_precision, out_bytewidth;
+  int inp_precision;
   CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
   
   ret = validate_config(config);
@@ -1154,7 +1605,6 @@ Int32 xa_nnlib_cnn_get_scratch_fast(
     return ret;
 
   inp_precision = IO_PRECISION_BITS(config->precision);  
-  out_bytewidth = IO_PRECISION_BYTES(config->precision);  
 
   if(config->algo == XA_NNLIB_CNN_CONV1D_STD)
   {
@@ -1176,27 +1626,31 @@ Int32 xa_nnlib_cnn_get_scratch_fast(
   }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
   {
-    scratch_size = xa_nn_conv2d_depthwise_getsize(config->input_shape.dim.cube.height,
-                                                  config->input_shape.dim.cube.width,
-                                                  config->input_shape.dim.cube.depth,
-                                                  config->kernel_ds_depth_shape.dim.cube.height,
-                                                  config->kernel_ds_depth_shape.dim.cube.width,
-                                                  config->channels_multiplier,
-                                                  config->x_stride,
-                                                  config->y_stride,
-                                                  config->x_padding,
-                                                  config->y_padding,
-                                                  config->output_height,
-                                                  config->output_width,
-                                                  inp_precision,
-                                                  1);   // WHD supported for all precisions
-    scratch_size  = ALIGN_SIZE(scratch_size);
-    scratch_size += out_bytewidth * config->output_height * config->output_width * config->input_shape.dim.cube.depth * config->channels_multiplier;  
+    scratch_size = ds_band_scratch_size(config);
   }
 
   return scratch_size;
 }
 
+Int32 xa_nnlib_cnn_get_scratch_workers(
+       xa_nnlib_cnn_init_config_t *config,
+       Int32 num_workers )
+{
+  int scratch_size;
+
+  if(num_workers < 1 || num_workers > XA_NNLIB_MAX_WORKERS)
+    return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_NUM_WORKERS;
+
+  scratch_size = xa_nnlib_cnn_get_scratch_fast(config);
+  if(scratch_size < 0)
+    return scratch_size;
+
+  if(config->algo == XA_NNLIB_CNN_CONV1D_STD)
+    return scratch_size;
+
+  return num_workers * ALIGN_SIZE(scratch_size);
+}
+
 int xa_nnlib_cnn_init(
     xa_nnlib_handle_t handle, 
     xa_nnlib_cnn_init_config_t *config )
@@ -1216,6 +1670,7 @@ int xa_nnlib_cnn_init(
   memset(cnn,0, sizeof(cnn_state_t));
 
   memcpy(&cnn->config, config, sizeof(xa_nnlib_cnn_init_config_t));
+  cnn->num_workers = 1;
  
   if(config->algo == XA_NNLIB_CNN_CONV1D_STD) 
   {
@@ -1241,7 +1696,14 @@ int xa_nnlib_cnn_init(
   }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_DS) 
   {
-    FILL_SHAPE_CUBE(cnn->output_shape, config->output_height, config->output_width, config->output_channels, SHAPE_CUBE_WHD_T) 
+    if(config->output_format == 0)
+    {
+      FILL_SHAPE_CUBE(cnn->output_shape, config->output_height, config->output_width, config->output_channels, SHAPE_CUBE_DWH_T) 
+    }
+    else //(config->output_format == 1)
+    {
+      FILL_SHAPE_CUBE(cnn->output_shape, config->output_height, config->output_width, config->output_channels, SHAPE_CUBE_WHD_T) 
+    }
   }
 
   return XA_NNLIB_NO_ERROR;
@@ -1299,6 +1761,16 @@ int xa_nnlib_cnn_set_config(
     }
     break;
 
+    case XA_NNLIB_CNN_NUM_WORKERS:
+    {
+      Int32 num_workers = *(Int32 *)params;
+
+      if(num_workers < 1 || num_workers > XA_NNLIB_MAX_WORKERS)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_NUM_WORKERS;
+      cnn->num_workers = num_workers;
+    }
+    break;
+
     default:
     return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
   }
@@ -1371,6 +1843,12 @@ int xa_nnlib_cnn_get_config(
     }
     break;
 
+    case XA_NNLIB_CNN_NUM_WORKERS:
+    {
+      *(Int32 *)params = cnn->num_workers;
+    }
+    break;
+
     default:
     return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
   }
@@ -1387,7 +1865,6 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 {
   cnn_state_t *cnn;
   xa_nnlib_cnn_init_config_t *config;
-  int inp_precision;
   int err = 0; 
 
   CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
@@ -1428,8 +1905,6 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 
   MATCH_CUBE_DIMS(p_in_shape, config->input_shape, XA_NNLIB_CNN_CONFIG_FATAL_INVALID_INPUT_SHAPE);
 
-  inp_precision = IO_PRECISION_BITS(config->precision);
-
   if(config->algo == XA_NNLIB_CNN_CONV1D_STD)
   {
     switch(config->precision)
@@ -1521,298 +1996,21 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 #endif
     }
   }
-  else if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+  else if(config->algo == XA_NNLIB_CNN_CONV2D_STD || config->algo == XA_NNLIB_CNN_CONV2D_DS)
   {
-    switch(config->precision)
-    {
-      case XA_NNLIB_CNN_16bx16b:
-      {
-        err = xa_nn_conv2d_std_16x16(output, 
-                                     input, 
-                                     cnn->kernel_std,
-                                     cnn->bias_std, 
-                                     config->input_shape.dim.cube.height,
-                                     config->input_shape.dim.cube.width,
-                                     config->input_shape.dim.cube.depth,
-                                     config->kernel_std_shape.dim.cube.height,
-                                     config->kernel_std_shape.dim.cube.width,
-                                     cnn->output_shape.dim.cube.depth,
-                                     config->x_stride,
-                                     config->y_stride,
-                                     config->x_padding,
-                                     config->y_padding,
-                                     cnn->output_shape.dim.cube.height,
-                                     cnn->output_shape.dim.cube.width,
-                                     config->bias_shift,
-                                     config->acc_shift,
-                                     config->output_format, 
-                                     scratch);
-      }
-      break;
-      case XA_NNLIB_CNN_8bx16b:
-      {
-        err = xa_nn_conv2d_std_8x16(output, 
-                                    input, 
-                                    cnn->kernel_std,
-                                    cnn->bias_std, 
-                                    config->input_shape.dim.cube.height,
-                                    config->input_shape.dim.cube.width,
-                                    config->input_shape.dim.cube.depth,
-                                    config->kernel_std_shape.dim.cube.height,
-                                    config->kernel_std_shape.dim.cube.width,
-                                    cnn->output_shape.dim.cube.depth,
-                                    config->x_stride,
-                                    config->y_stride,
-                                    config->x_padding,
-                                    config->y_padding,
-                                    cnn->output_shape.dim.cube.height,
-                                    cnn->output_shape.dim.cube.width,
-                                    config->bias_shift,
-                                    config->acc_shift,
-                                    config->output_format, 
-                                    scratch);
-      }
-      break;
-      case XA_NNLIB_CNN_8bx8b:
-      {
-        err = xa_nn_conv2d_std_8x8(output, 
-                                   input, 
-                                   cnn->kernel_std,
-                                   cnn->bias_std, 
-                                   config->input_shape.dim.cube.height,
-                                   config->input_shape.dim.cube.width,
-                                   config->input_shape.dim.cube.depth,
-                                   config->kernel_std_shape.dim.cube.height,
-                                   config->kernel_std_shape.dim.cube.width,
-                                   cnn->output_shape.dim.cube.depth,
-                                   config->x_stride,
-                                   config->y_stride,
-                                   config->x_padding,
-                                   config->y_padding,
-                                   cnn->output_shape.dim.cube.height,
-                                   cnn->output_shape.dim.cube.width,
-                                   config->bias_shift,
-                                   config->acc_shift,
-                                   config->output_format, 
-                                   scratch);
-      }
-      break;
-#if HAVE_VFPU
-      case XA_NNLIB_CNN_f32xf32:
-      {
-        err = xa_nn_conv2d_std_f32(output, 
-                                   input, 
-                                   cnn->kernel_std,
-                                   cnn->bias_std, 
-                                   config->input_shape.dim.cube.height,
-                                   config->input_shape.dim.cube.width,
-                                   config->input_shape.dim.cube.depth,
-                                   config->kernel_std_shape.dim.cube.height,
-                                   config->kernel_std_shape.dim.cube.width,
-                                   cnn->output_shape.dim.cube.depth,
-                                   config->x_stride,
-                                   config->y_stride,
-                                   config->x_padding,
-                                   config->y_padding,
-                                   cnn->output_shape.dim.cube.height,
-                                   cnn->output_shape.dim.cube.width,
-                                   config->output_format, 
-                                   scratch);
-      }
-      break;
-#else
-      case XA_NNLIB_CNN_f32xf32:
-      {
-      }
-      break;
-#endif
-    }
-  }
-  else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
-  {
-    int scratch_size;
-    void *depthwise_out_scratch; 
-
-    scratch_size = xa_nn_conv2d_depthwise_getsize(config->input_shape.dim.cube.height,
-                                                  config->input_shape.dim.cube.width,
-                                                  config->input_shape.dim.cube.depth,
-                                                  config->kernel_ds_depth_shape.dim.cube.height,
-                                                  config->kernel_ds_depth_shape.dim.cube.width,
-                                                  config->channels_multiplier,
-                                                  config->x_stride,
-                                                  config->y_stride,
-                                                  config->x_padding,
-                                                  config->y_padding,
-                                                  cnn->output_shape.dim.cube.height,
-                                                  cnn->output_shape.dim.cube.width,
-                                                  inp_precision,
-                                                  1);       //must be WHD
-    scratch_size  = ALIGN_SIZE(scratch_size);
-    depthwise_out_scratch = ((char *) scratch + scratch_size);
- 
-    switch(config->precision)
-    {
-      case XA_NNLIB_CNN_16bx16b:
-      {
-        err = xa_nn_conv2d_depthwise_16x16(depthwise_out_scratch,
-                                           cnn->kernel_ds_depth,
-                                           input,
-                                           cnn->bias_ds_depth,
-                                           config->input_shape.dim.cube.height,
-                                           config->input_shape.dim.cube.width,
-                                           config->input_shape.dim.cube.depth,
-                                           config->kernel_ds_depth_shape.dim.cube.height,
-                                           config->kernel_ds_depth_shape.dim.cube.width,
-                                           config->channels_multiplier,
-                                           config->x_stride,
-                                           config->y_stride,
-                                           config->x_padding,
-                                           config->y_padding,
-                                           cnn->output_shape.dim.cube.height,
-                                           cnn->output_shape.dim.cube.width,
-                                           config->acc_shift,
-                                           config->bias_shift,
-                                           1, //must be WHD
-                                           0, //must be DWH
-                                           scratch);
-
-        if (err) break;
-
-        err = xa_nn_conv2d_pointwise_16x16(output,
-                                           cnn->kernel_ds_point,
-                                           depthwise_out_scratch,
-                                           cnn->bias_ds_point,
-                                           cnn->output_shape.dim.cube.height,
-                                           cnn->output_shape.dim.cube.width,
-                                           config->input_shape.dim.cube.depth*config->channels_multiplier,
-                                           cnn->output_shape.dim.cube.depth,
-                                           config->acc_shift,
-                                           config->bias_shift,
-                                           config->output_format);
-      }
-      break;
-      case XA_NNLIB_CNN_8bx16b:
-      {
-        err = xa_nn_conv2d_depthwise_8x16(depthwise_out_scratch,
-                                          cnn->kernel_ds_depth,
-                                          input,
-                                          cnn->bias_ds_depth,
-                                          config->input_shape.dim.cube.height,
-                                          config->input_shape.dim.cube.width,
-                                          config->input_shape.dim.cube.depth,
-                                          config->kernel_ds_depth_shape.dim.cube.height,
-                                          config->kernel_ds_depth_shape.dim.cube.width,
-                                          config->channels_multiplier,
-                                          config->x_stride,
-                                          config->y_stride,
-                                          config->x_padding,
-                                          config->y_padding,
-                                          cnn->output_shape.dim.cube.height,
-                                          cnn->output_shape.dim.cube.width,
-                                          config->acc_shift,
-                                          config->bias_shift,
-                                          1, //must be WHD
-                                          0, //must be DWH
-                                          scratch);
-
-        if (err) break;
-
-        err = xa_nn_conv2d_pointwise_8x16(output,
-                                          cnn->kernel_ds_point,
-                                          depthwise_out_scratch,
-                                          cnn->bias_ds_point,
-                                          cnn->output_shape.dim.cube.height,
-                                          cnn->output_shape.dim.cube.width,
-                                          config->input_shape.dim.cube.depth*config->channels_multiplier,
-                                          cnn->output_shape.dim.cube.depth,
-                                          config->acc_shift,
-                                          config->bias_shift,
-                                          config->output_format); 
-      }
-      break;
-      case XA_NNLIB_CNN_8bx8b:
-      {
-        err = xa_nn_conv2d_depthwise_8x8(depthwise_out_scratch,
-                                         cnn->kernel_ds_depth,
-                                         input,
-                                         cnn->bias_ds_depth,
-                                         config->input_shape.dim.cube.height,
-                                         config->input_shape.dim.cube.width,
-                                         config->input_shape.dim.cube.depth,
-                                         config->kernel_ds_depth_shape.dim.cube.height,
-                                         config->kernel_ds_depth_shape.dim.cube.width,
-                                         config->channels_multiplier,
-                                         config->x_stride,
-                                         config->y_stride,
-                                         config->x_padding,
-                                         config->y_padding,
-                                         cnn->output_shape.dim.cube.height,
-                                         cnn->output_shape.dim.cube.width,
-                                         config->acc_shift,
-                                         config->bias_shift,
-                                         1, //must be WHD
-                                         0, //must be DWH
-                                         scratch);
-
-        if (err) break;
-
-        err = xa_nn_conv2d_pointwise_8x8(output,
-                                         cnn->kernel_ds_point,
-                                         depthwise_out_scratch,
-                                         cnn->bias_ds_point,
-                                         cnn->output_shape.dim.cube.height,
-                                         cnn->output_shape.dim.cube.width,
-                                         config->input_shape.dim.cube.depth*config->channels_multiplier,
-                                         cnn->output_shape.dim.cube.depth,
-                                         config->acc_shift,
-                                         config->bias_shift,
-                                         config->output_format); 
-      }
-      break;
-#if HAVE_VFPU
-      case XA_NNLIB_CNN_f32xf32:
-      {
-        err = xa_nn_conv2d_depthwise_f32(depthwise_out_scratch,
-                                         cnn->kernel_ds_depth,
-                                         input,
-                                         cnn->bias_ds_depth,
-                                         config->input_shape.dim.cube.height,
-                                         config->input_shape.dim.cube.width,
-                                         config->input_shape.dim.cube.depth,
-                                         config->kernel_ds_depth_shape.dim.cube.height,
-                                         config->kernel_ds_depth_shape.dim.cube.width,
-                                         config->channels_multiplier,
-                                         config->x_stride,
-                                         config->y_stride,
-                                         config->x_padding,
-                                         config->y_padding,
-                                         cnn->output_shape.dim.cube.height,
-                                         cnn->output_shape.dim.cube.width,
-                                         1, //must be WHD
-                                         0, //must be DWH
-                                         scratch);
-
-        if (err) break;
-
-        err = xa_nn_conv2d_pointwise_f32(output,
-                                         cnn->kernel_ds_point,
-                                         depthwise_out_scratch,
-                                         cnn->bias_ds_point,
-                                         cnn->output_shape.dim.cube.height,
-                                         cnn->output_shape.dim.cube.width,
-                                         config->input_shape.dim.cube.depth*config->channels_multiplier,
-                                         cnn->output_shape.dim.cube.depth,
-                                         config->output_format);
-
-      }
-      break;
-#else
-      case XA_NNLIB_CNN_f32xf32:
-      {
-      }
-      break;
-#endif
-    }
+    cnn_work_t work;
+
+    work.cnn = cnn;
+    work.scratch = (char *)scratch;
+    work.scratch_size = ALIGN_SIZE(xa_nnlib_cnn_get_scratch_fast(config));
+    work.input = input;
+    work.output = output;
+
+    /* Channel ranges start on a multiple of 4, row ranges on a band */
+    if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+      err = xa_nnlib_run_workers(conv2d_std_worker, &work, cnn->num_workers, cnn->output_shape.dim.cube.depth, 4);
+    else
+      err = xa_nnlib_run_workers(conv2d_ds_worker, &work, cnn->num_workers, cnn->output_shape.dim.cube.height, ds_band_out_rows(config));
   }
  
   if (!err) memcpy(p_out_shape, &cnn->output_shape, sizeof(xa_nnlib_shape_t));
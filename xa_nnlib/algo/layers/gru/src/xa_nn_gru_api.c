@@ -90,6 +90,7 @@ typedef struct _gru_state_t
   int bias_shift;
   int matmul_lsh;
   int tanh_lsh;
+  int unroll;
 } gru_state_t;
 
 typedef struct _temp_mem_t 
@@ -218,6 +219,10 @@ int xa_nnlib_gru_init(
   gru->bias_shift   = (config->io_Qformat + config->coeff_Qformat) - 15;
   gru->matmul_lsh = 25 - (config->coeff_Qformat + config->io_Qformat);  // Input to sigmoid function should be 6.25
   gru->tanh_lsh   = config->io_Qformat - 15;  // For Q15 to io_Qformat conversion
+  /* Row unroll of the gate matXvecs, picked once for the layer shape */
+  gru->unroll = xa_nn_matXvec_unroll_select(NULL, 0,
+      (config->precision == XA_NNLIB_GRU_8bx16b) ? 8 : 16, 16,
+      config->out_feats, config->in_feats, 1);
 
   gru->prev_h = (vect_t *)ALIGN_MEM((char *)handle + sizeof(gru_state_t));
   memset(gru->prev_h,0, config->out_feats * sizeof(vect_t));
@@ -489,7 +494,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
   if(gru->precision == XA_NNLIB_GRU_16bx16b)
   {
 
-    xa_nn_matXvec_16x16_16_sigmoid(
+    xa_nn_matXvec_16x16_16_sigmoid_unroll(
         scratch_mem->z_or_r,
         gru->weights.weights16.w_r,
         gru->weights.weights16.u_r,
@@ -504,11 +509,12 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
 
     xa_nn_elm_mul_16x16_16(scratch_mem->r_x_prev_h, scratch_mem->z_or_r, gru->prev_h, gru->out_feats);
 
-    xa_nn_matXvec_16x16_16_tanh(
+    xa_nn_matXvec_16x16_16_tanh_unroll(
         scratch_mem->h,
         gru->weights.weights16.w_h,
         gru->weights.weights16.u_h,
@@ -523,11 +529,12 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
 
     apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
 
-    xa_nn_matXvec_16x16_16_sigmoid(
+    xa_nn_matXvec_16x16_16_sigmoid_unroll(
         scratch_mem->z_or_r,
         gru->weights.weights16.w_z,
         gru->weights.weights16.u_z,
@@ -542,7 +549,8 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
 
     //h_t step
     xa_nn_vec_interpolation_q15((vect_t *)output,
@@ -554,7 +562,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
   else if(gru->precision == XA_NNLIB_GRU_8bx16b)
   {
 
-    xa_nn_matXvec_8x16_16_sigmoid(
+    xa_nn_matXvec_8x16_16_sigmoid_unroll(
         scratch_mem->z_or_r,
         gru->weights.weights8.w_r,
         gru->weights.weights8.u_r,
@@ -569,10 +577,11 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
     xa_nn_elm_mul_16x16_16(scratch_mem->r_x_prev_h, scratch_mem->z_or_r, gru->prev_h, gru->out_feats);
 
-    xa_nn_matXvec_8x16_16_tanh(
+    xa_nn_matXvec_8x16_16_tanh_unroll(
         scratch_mem->h,
         gru->weights.weights8.w_h,
         gru->weights.weights8.u_h,
@@ -587,11 +596,12 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
 
     apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
 
-    xa_nn_matXvec_8x16_16_sigmoid(
+    xa_nn_matXvec_8x16_16_sigmoid_unroll(
         scratch_mem->z_or_r,
         gru->weights.weights8.w_z,
         gru->weights.weights8.u_z,
@@ -606,7 +616,8 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->matmul_lsh,
         gru->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        gru->unroll);
 
     //h_t step
     xa_nn_vec_interpolation_q15((vect_t *)output,
@@ -23,6 +23,7 @@
 #include <xtensa/tie/xt_hifi2.h>
 #include "xa_nnlib_lstm_api.h"
 #include "xa_nnlib_api.h"
+#include "xa_nnlib_workers.h"
 
 #ifdef hifi4
 #define XA_PAD_BYTES   8 
@@ -90,6 +91,8 @@ typedef struct _lstm_state_t
   int h_lsh;
   int fXprev_c_lsh;
   int iXc_hat_lsh;
+  int num_workers;
+  int unroll;
 } lstm_state_t;
 
 typedef struct _temp_mem_t 
@@ -236,6 +239,11 @@ int xa_nnlib_lstm_init(
   lstm->fXprev_c_lsh = config->cell_Qformat - (15 + config->cell_Qformat);  // For Q15xQ25 to cell_Qformat conversion
   lstm->iXc_hat_lsh = config->cell_Qformat - (15 + 15);  // For Q15xQ15 to cell_Qformat conversion
   lstm->h_lsh = config->io_Qformat - 15;  // For Q15 to io_Qformat conversion
+  lstm->num_workers = 1;
+  /* Row unroll of the gate matXvecs, picked once for the layer shape */
+  lstm->unroll = xa_nn_matXvec_unroll_select(NULL, 0,
+      (config->precision == XA_NNLIB_LSTM_8bx16b) ? 8 : 16, 16,
+      config->out_feats, config->in_feats, 1);
 
   lstm->prev_h = (vect_t *)ALIGN_MEM((char *)handle + sizeof(lstm_state_t));
   memset(lstm->prev_h,0, config->out_feats * sizeof(vect_t));
@@ -348,6 +356,17 @@ int xa_nnlib_lstm_set_config(
       memcpy(lstm->prev_c,prev_c,lstm->out_feats * sizeof(int));
     }
     break;
+
+    case XA_NNLIB_LSTM_NUM_WORKERS:
+    {
+      int num_workers;
+      num_workers = *(int *)params;
+
+      if(num_workers < 1 || num_workers > XA_NNLIB_MAX_WORKERS)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_NUM_WORKERS;
+      lstm->num_workers = num_workers;
+    }
+    break;
     
     default:
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
@@ -482,6 +501,12 @@ int xa_nnlib_lstm_get_config(
     }
     break;
 
+    case XA_NNLIB_LSTM_NUM_WORKERS:
+    {
+      *(int *)params = lstm->num_workers;
+    }
+    break;
+
     default:
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
   }
@@ -489,72 +514,32 @@ int xa_nnlib_lstm_get_config(
   return XA_NNLIB_NO_ERROR;
 }  
 
-int xa_nnlib_lstm_process(xa_nnlib_handle_t handle, 
-    void *scratch,
-    void *input,
-    void *output,
-    xa_nnlib_shape_t *p_in_shape,
-    xa_nnlib_shape_t *p_out_shape)
+#ifdef MODEL_INT16
+/* Work shared by the workers of one xa_nnlib_lstm_process call */
+typedef struct _lstm_work_t
 {
   lstm_state_t *lstm;
   scratch_mem_t *scratch_mem;
+  void *input;
+} lstm_work_t;
+
+/* Gates, cell update and tanh(cell) of out_feats [start, start + count).
+   Every step up to the output is elementwise over out_feats, only the
+   matXvec reads all of prev_h, so disjoint ranges run concurrently and
+   prev_h / output are written once all ranges are done. */
+static int lstm_cell_worker(void *p_ctx, int worker, int start, int count)
+{
+  lstm_work_t *work = (lstm_work_t *)p_ctx;
+  lstm_state_t *lstm = work->lstm;
+  scratch_mem_t *scratch_mem = work->scratch_mem;
+  void *input = work->input;
+  int err = 0;
 
-  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
-
-  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
-
-  CHECK_IO_SHAPE(p_in_shape);
-  CHECK_IO_SHAPE(p_out_shape);
-
-  lstm = (lstm_state_t *) handle;
-
-  if(p_out_shape->dim.vector.length < lstm->out_feats)
-  {
-    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
-  }
-  
-  if(p_in_shape->dim.vector.length < lstm->in_feats)
-  {
-    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
-  }
-
-  p_in_shape->dim.vector.length = lstm->in_feats;
-  p_out_shape->dim.vector.length = lstm->out_feats;
-
-  //setup scratch
-  {
-    char *sptr = (char *)scratch;
-
-    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
-    
-    scratch_alloc(sptr, scratch_mem->f_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, lstm->out_feats);
-
-#ifdef MODEL_FLT64
-    scratch_mem->temp_mem.vec = NULL ;
-
-#elif MODEL_INT16
-    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
-  
-#endif
-  }
+  (void)worker;
 
-#ifdef MODEL_INT16
   if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
   {
-
-    xa_nn_matXvec_16x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_16x16_16_sigmoid_unroll(
         scratch_mem->f_f,
         lstm->weights.weights16.w_xf,
         lstm->weights.weights16.w_hf,
@@ -569,9 +554,12 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
-    xa_nn_matXvec_16x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_16x16_16_sigmoid_unroll(
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights16.w_xi,
         lstm->weights.weights16.w_hi,
@@ -586,9 +574,12 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
-    xa_nn_matXvec_16x16_16_tanh(
+    err |= xa_nn_matXvec_range_16x16_16_tanh_unroll(
         scratch_mem->c_hat_f_or_tanh_c_f,
         lstm->weights.weights16.w_xc,
         lstm->weights.weights16.w_hc,
@@ -603,19 +594,22 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
     vec_elem_mul_16x32plus16x16_16(
-        lstm->prev_c, 
-        scratch_mem->f_f, 
-        lstm->prev_c, 
-        scratch_mem->i_f_or_o_f, 
-        scratch_mem->c_hat_f_or_tanh_c_f, 
+        lstm->prev_c + start,
+        scratch_mem->f_f + start,
+        lstm->prev_c + start,
+        scratch_mem->i_f_or_o_f + start,
+        scratch_mem->c_hat_f_or_tanh_c_f + start,
         lstm->fXprev_c_lsh,
         lstm->iXc_hat_lsh,
-        lstm->out_feats);
+        count);
 
-    xa_nn_matXvec_16x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_16x16_16_sigmoid_unroll(
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights16.w_xo,
         lstm->weights.weights16.w_ho,
@@ -630,26 +624,19 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
-
-    xa_nn_vec_tanh_32_16(
-        scratch_mem->c_hat_f_or_tanh_c_f,
-        lstm->prev_c,
-        lstm->out_feats);
-
-    lstm_output_kernel_16x16_16(
-        (vect_t*)output,
-        lstm->prev_h,
-        scratch_mem->i_f_or_o_f,
-        scratch_mem->c_hat_f_or_tanh_c_f,
-        lstm->h_lsh,
-        lstm->out_feats);
-    
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
+
+    err |= xa_nn_vec_tanh_32_16(
+        scratch_mem->c_hat_f_or_tanh_c_f + start,
+        lstm->prev_c + start,
+        count);
   }
   else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
   {
-
-    xa_nn_matXvec_8x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_8x16_16_sigmoid_unroll(
         scratch_mem->f_f,
         lstm->weights.weights8.w_xf,
         lstm->weights.weights8.w_hf,
@@ -664,9 +651,12 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
-    xa_nn_matXvec_8x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_8x16_16_sigmoid_unroll(
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights8.w_xi,
         lstm->weights.weights8.w_hi,
@@ -681,9 +671,12 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
-    xa_nn_matXvec_8x16_16_tanh(
+    err |= xa_nn_matXvec_range_8x16_16_tanh_unroll(
         scratch_mem->c_hat_f_or_tanh_c_f,
         lstm->weights.weights8.w_xc,
         lstm->weights.weights8.w_hc,
@@ -698,19 +691,22 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
 
     vec_elem_mul_16x32plus16x16_16(
-        lstm->prev_c, 
-        scratch_mem->f_f, 
-        lstm->prev_c, 
-        scratch_mem->i_f_or_o_f, 
-        scratch_mem->c_hat_f_or_tanh_c_f, 
+        lstm->prev_c + start,
+        scratch_mem->f_f + start,
+        lstm->prev_c + start,
+        scratch_mem->i_f_or_o_f + start,
+        scratch_mem->c_hat_f_or_tanh_c_f + start,
         lstm->fXprev_c_lsh,
         lstm->iXc_hat_lsh,
-        lstm->out_feats);
+        count);
 
-    xa_nn_matXvec_8x16_16_sigmoid(
+    err |= xa_nn_matXvec_range_8x16_16_sigmoid_unroll(
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights8.w_xo,
         lstm->weights.weights8.w_ho,
@@ -725,12 +721,92 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         lstm->matmul_lsh,
         lstm->bias_shift,
         16,
-        scratch_mem->temp_mem.vec);
+        scratch_mem->temp_mem.vec,
+        start,
+        count,
+        lstm->unroll);
+
+    err |= xa_nn_vec_tanh_32_16(
+        scratch_mem->c_hat_f_or_tanh_c_f + start,
+        lstm->prev_c + start,
+        count);
+  }
 
-    xa_nn_vec_tanh_32_16(
-        scratch_mem->c_hat_f_or_tanh_c_f,
-        lstm->prev_c,
-        lstm->out_feats);
+  return err;
+}
+#endif
+
+int xa_nnlib_lstm_process(xa_nnlib_handle_t handle, 
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape)
+{
+  lstm_state_t *lstm;
+  scratch_mem_t *scratch_mem;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  lstm = (lstm_state_t *) handle;
+
+  if(p_out_shape->dim.vector.length < lstm->out_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+  
+  if(p_in_shape->dim.vector.length < lstm->in_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  p_in_shape->dim.vector.length = lstm->in_feats;
+  p_out_shape->dim.vector.length = lstm->out_feats;
+
+  //setup scratch
+  {
+    char *sptr = (char *)scratch;
+
+    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+    
+    scratch_alloc(sptr, scratch_mem->f_f, vect_t, lstm->out_feats);
+    scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, lstm->out_feats);
+    scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, lstm->out_feats);
+
+#ifdef MODEL_FLT64
+    scratch_mem->temp_mem.vec = NULL ;
+
+#elif MODEL_INT16
+    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
+  
+#endif
+  }
+
+#ifdef MODEL_INT16
+  {
+    lstm_work_t work;
+
+    work.lstm = lstm;
+    work.scratch_mem = scratch_mem;
+    work.input = input;
+
+    if (xa_nnlib_run_workers(lstm_cell_worker, &work, lstm->num_workers, lstm->out_feats, 4))
+      return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_COMBINATION;
 
     lstm_output_kernel_16x16_16(
         (vect_t*)output,
@@ -739,7 +815,6 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->c_hat_f_or_tanh_c_f,
         lstm->h_lsh,
         lstm->out_feats);
-    
   }
 #endif
   
@@ -59,6 +59,9 @@ namespace android {
 namespace nn {
 
 struct Shape;
+#ifdef HIFI_NNLIB_OPT
+struct Quant8ConvParams;
+#endif
 
 bool addFloat32(const float* in1, const Shape& shape1,
                 const float* in2, const Shape& shape2,
@@ -108,7 +111,8 @@ bool depthwiseConvQuant8(const uint8_t* inputData, const Shape& inputShape,
 #ifndef HIFI_NNLIB_OPT
                          uint8_t* outputData, const Shape& outputShape);
 #else
-                         uint8_t* outputData, const Shape& outputShape, void *p_scratch);
+                         uint8_t* outputData, const Shape& outputShape, void *p_scratch,
+                         const Quant8ConvParams* params = nullptr);
 #endif
 
 bool convFloat32(const float* inputData, const Shape& inputShape,
@@ -133,7 +137,8 @@ bool convQuant8(const uint8_t* inputData, const Shape& inputShape,
 #ifndef HIFI_NNLIB_OPT
                 uint8_t* outputData, const Shape& outputShape);
 #else
-                uint8_t* outputData, const Shape& outputShape, void *p_scratch);
+                uint8_t* outputData, const Shape& outputShape, void *p_scratch,
+                const Quant8ConvParams* params = nullptr);
 #endif
 
 bool averagePoolFloat32(const float* inputData, const Shape& inputShape,
@@ -204,6 +209,8 @@ bool relu6Quant8(const uint8_t* inputData, const Shape& inputShape,
                  uint8_t* outputData, const Shape& outputShape);
 bool logisticQuant8(const uint8_t* inputData, const Shape& inputShape,
                     uint8_t* outputData, const Shape& outputShape);
+bool tanhQuant8(const uint8_t* inputData, const Shape& inputShape,
+                uint8_t* outputData, const Shape& outputShape);
 bool softmaxQuant8(const uint8_t* inputData, const Shape& inputShape,
                    const float beta,
 #ifndef HIFI_NNLIB_OPT
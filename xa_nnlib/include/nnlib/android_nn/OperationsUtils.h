@@ -172,6 +172,33 @@ void CalculateActivationRangeFloat(int32_t activation,
                                    float* activation_min,
                                    float* activation_max);
 
+#ifdef HIFI_NNLIB_OPT
+// Output requantization and clamp range of a quant8 convolution. They only
+// depend on the operand scales and zero points, so a prepared model computes
+// them once instead of on every execution.
+struct Quant8ConvParams {
+    int32_t outputMultiplier;
+    int32_t outputShift;
+    int32_t activationMin;
+    int32_t activationMax;
+};
+
+__wur
+bool GetQuant8ConvParams(const Shape& inputShape,
+                         const Shape& filterShape,
+                         const Shape& biasShape,
+                         const Shape& outputShape,
+                         int32_t activation,
+                         Quant8ConvParams* params);
+
+// Quantizes a positive real multiplier of any magnitude to the Q31 multiplier
+// and left shift (negative for a right shift) taken by the nnlib kernels.
+__wur
+bool QuantizeMultiplierForKernel(double double_multiplier,
+                                 int32_t* quantized_multiplier,
+                                 int32_t* shift);
+#endif
+
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
 
 inline void calculateExplicitPadding(int32_t in_size, int32_t stride,
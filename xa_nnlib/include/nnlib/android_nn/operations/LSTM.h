@@ -60,6 +60,7 @@ typedef enum {
 
 #ifndef HIFI_BUILD
 #else
+#include <cstdint>
 #include <vector>
 #endif //HIFI_BUILD
 
@@ -89,6 +90,19 @@ struct LSTMParams {
 struct RunTimeOperandInfo;
 struct Shape;
 
+#ifdef HIFI_NNLIB_OPT
+// Float LSTM gate weights stored as symmetric int8 with one scale per row,
+// for the hybrid gate path (float activations quantized on the fly). Built
+// once from constant weights by LSTMCell::PrepareHybrid. Indexed by gate:
+// input, forget, cell, output; the input gate is left empty with CIFG.
+struct LSTMHybridWeights {
+  std::vector<int8_t> input_weights[4];
+  std::vector<float> input_scales[4];
+  std::vector<int8_t> recurrent_weights[4];
+  std::vector<float> recurrent_scales[4];
+};
+#endif
+
 class LSTMCell {
  public:
   LSTMCell(const android::hardware::neuralnetworks::V1_1::Operation &operation,
@@ -102,6 +116,23 @@ class LSTMCell {
                       Shape *outputShape);
   bool Eval();
 
+#ifdef HIFI_NNLIB_OPT
+  // Quantizes the gate weights of a float LSTM whose weights are constants.
+  // Returns false when the operation cannot take the hybrid path.
+  // scratch_size is the scratch the hybrid Evals need, in bytes.
+  static bool PrepareHybrid(const android::hardware::neuralnetworks::V1_1::Operation &operation,
+                            std::vector<RunTimeOperandInfo> &operands,
+                            LSTMHybridWeights *hybrid, int32_t *scratch_size);
+  // Runs the gate matXvecs of the following Evals on hybrid, which must
+  // outlive them, with the quantized input and output state in scratch
+  // (4 byte aligned, scratch_size of PrepareHybrid). nullptr goes back to
+  // the float weights.
+  void SetHybridWeights(const LSTMHybridWeights *hybrid, void *scratch) {
+    hybrid_ = hybrid;
+    hybrid_scratch_ = static_cast<int8_t *>(scratch);
+  }
+#endif
+
   // Input Tensors of size {n_batch, n_input}
   static constexpr int kInputTensor = 0;
 
@@ -151,6 +182,19 @@ class LSTMCell {
       const android::hardware::neuralnetworks::V1_1::Operation &operation,
       std::vector<RunTimeOperandInfo> &operands, uint32_t n_input,
       uint32_t n_output, uint32_t n_cell);
+#ifdef HIFI_NNLIB_OPT
+  // Quantized LSTM: asym8 input, output and weights, int32 biases and an
+  // int16 Q4.11 cell state carried in TENSOR_INT32 operands.
+  static bool CheckQuant8Params(
+      const android::hardware::neuralnetworks::V1_1::Operation &operation,
+      std::vector<RunTimeOperandInfo> &operands);
+  bool EvalQuant8();
+  bool EvalHybridGates(float *input_gate_scratch, float *forget_gate_scratch,
+                       float *cell_scratch, float *output_gate_scratch);
+
+  const LSTMHybridWeights *hybrid_ = nullptr;
+  int8_t *hybrid_scratch_ = nullptr;
+#endif
   LSTMParams params_;
 
   const RunTimeOperandInfo *input_;
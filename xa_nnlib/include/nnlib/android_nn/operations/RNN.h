@@ -83,6 +83,10 @@ class RNN {
   static constexpr int kOutputTensor = 1;
 
  private:
+#ifdef HIFI_NNLIB_OPT
+  bool EvalQuant8();
+#endif
+
   ActivationFn activation_;
 
   const RunTimeOperandInfo *input_;
@@ -32,7 +32,8 @@ typedef enum _xa_nnlib_cnn_param_id_t
     XA_NNLIB_CNN_KERNEL              = 1,             // GET/SET kernel
     XA_NNLIB_CNN_BIAS                = 2,             // GET/SET bias
     XA_NNLIB_CNN_INPUT_SHAPE         = 3,             // GET input shape information
-    XA_NNLIB_CNN_OUTPUT_SHAPE        = 4              // GET output shape information
+    XA_NNLIB_CNN_OUTPUT_SHAPE        = 4,             // GET output shape information
+    XA_NNLIB_CNN_NUM_WORKERS         = 5              // GET/SET number of workers process splits the work across
 } xa_nnlib_cnn_param_id_t;
 
 /* I/O Precision Settings */
@@ -73,6 +74,7 @@ typedef enum _xa_nnlib_fatal_config_cnn_error_code_t
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_BIAS_SHAPE        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 9),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 10),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_COMBINATION = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 11),
+    XA_NNLIB_CNN_CONFIG_FATAL_INVALID_NUM_WORKERS       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 12),
 } xa_nnlib_fatal_config_cnn_error_code_t;
 
 /************************************************************/
@@ -134,6 +136,12 @@ Int32 xa_nnlib_cnn_get_persistent_fast( xa_nnlib_cnn_init_config_t *config);
 
 Int32 xa_nnlib_cnn_get_scratch_fast( xa_nnlib_cnn_init_config_t *config);
 
+/* Scratch for process with XA_NNLIB_CNN_NUM_WORKERS set to num_workers:
+   one xa_nnlib_cnn_get_scratch_fast() sized block per worker. CONV2D_STD is
+   split over output channels and CONV2D_DS over output rows, CONV1D_STD
+   always runs on one worker. */
+Int32 xa_nnlib_cnn_get_scratch_workers( xa_nnlib_cnn_init_config_t *config, Int32 num_workers);
+
 /************************************************************/
 /* CNN Initialization Function                              */
 /************************************************************/
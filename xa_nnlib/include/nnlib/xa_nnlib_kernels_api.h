@@ -44,6 +44,9 @@
  * be SIMD (64-bit) aligned and should not overlap.
  * - p_mat2, p_vec2 can be 'NULL', but other pointers cannot be 'NULL'
  * - Variables cols1, cols2, row_stride1, row_stride2 must be multiple of 4
+ * for 16x16 and f32 kernels. 8x8, 8x16 and asym8 kernels take any value,
+ * rows that are not 4 byte aligned or not a multiple of 4 long go through a
+ * row by row path with unaligned loads
  *
  * Usage of few critical variables,
  * - acc_shift:
@@ -463,6 +466,54 @@ WORD32 xa_nn_matXvec_f32xf32_f32(
        WORD32 row_stride2                            /*!< [in] row stride for mat2 */
   );
 
+/* Hybrid matXvec: symmetric int8 matrices with one float scale per row and
+ * float vectors, quantized to symmetric int8 on the fly
+ * (xa_nn_quantize_f32_sym8). sym8xsym8_f32 takes vectors the caller
+ * quantized already, so one quantization serves several matrices; they must
+ * be 4 byte aligned. sym8xf32_f32 quantizes into p_scratch, 4 byte aligned
+ * and xa_nn_matXvec_sym8xf32_f32_getsize(cols1, cols2) bytes. p_bias may be
+ * NULL, p_mat2/p_vec2 NULL skip the second product.
+ */
+WORD32 xa_nn_matXvec_sym8xsym8_f32(
+       FLOAT32  * __restrict__ p_out,                /*!< [out] f32b result: rows x 1 */
+       const WORD8    * __restrict__ p_mat1,         /*!< [in] sym8 mat1: rows x cols1 */
+       const WORD8    * __restrict__ p_mat2,         /*!< [in] sym8 mat2: rows x cols2 */
+       const WORD8    * __restrict__ p_vec1,         /*!< [in] sym8 vec1: cols1 x 1 */
+       const WORD8    * __restrict__ p_vec2,         /*!< [in] sym8 vec2: cols2 x 1 */
+       const FLOAT32  * __restrict__ p_bias,         /*!< [in] f32b bias: rows x 1 */
+       const FLOAT32  * __restrict__ p_mat1_scale,   /*!< [in] f32b mat1 row scales: rows x 1 */
+       const FLOAT32  * __restrict__ p_mat2_scale,   /*!< [in] f32b mat2 row scales: rows x 1 */
+       FLOAT32 vec1_scale,                           /*!< [in] scale of vec1 */
+       FLOAT32 vec2_scale,                           /*!< [in] scale of vec2 */
+       WORD32 rows,                                  /*!< [in] number of rows */
+       WORD32 cols1,                                 /*!< [in] number of columns of mat1 */
+       WORD32 cols2,                                 /*!< [in] number of columns of mat2 */
+       WORD32 row_stride1,                           /*!< [in] row stride for mat1 */
+       WORD32 row_stride2                            /*!< [in] row stride for mat2 */
+  );
+
+WORD32 xa_nn_matXvec_sym8xf32_f32(
+       FLOAT32  * __restrict__ p_out,                /*!< [out] f32b result: rows x 1 */
+       const WORD8    * __restrict__ p_mat1,         /*!< [in] sym8 mat1: rows x cols1 */
+       const WORD8    * __restrict__ p_mat2,         /*!< [in] sym8 mat2: rows x cols2 */
+       const FLOAT32  * __restrict__ p_vec1,         /*!< [in] f32b vec1: cols1 x 1 */
+       const FLOAT32  * __restrict__ p_vec2,         /*!< [in] f32b vec2: cols2 x 1 */
+       const FLOAT32  * __restrict__ p_bias,         /*!< [in] f32b bias: rows x 1 */
+       const FLOAT32  * __restrict__ p_mat1_scale,   /*!< [in] f32b mat1 row scales: rows x 1 */
+       const FLOAT32  * __restrict__ p_mat2_scale,   /*!< [in] f32b mat2 row scales: rows x 1 */
+       WORD32 rows,                                  /*!< [in] number of rows */
+       WORD32 cols1,                                 /*!< [in] number of columns of mat1 */
+       WORD32 cols2,                                 /*!< [in] number of columns of mat2 */
+       WORD32 row_stride1,                           /*!< [in] row stride for mat1 */
+       WORD32 row_stride2,                           /*!< [in] row stride for mat2 */
+       pVOID p_scratch                               /*!< [in] scratch for the quantized vectors */
+  );
+
+WORD32 xa_nn_matXvec_sym8xf32_f32_getsize(
+       WORD32 cols1,                                 /*!< [in] number of columns of mat1 */
+       WORD32 cols2                                  /*!< [in] number of columns of mat2, 0 if none */
+  );
+
 WORD32 xa_nn_matXvec_batch_f32xf32_f32(
        FLOAT32  ** __restrict__ p_out,               /*!< [out] f32b result: rows x vec_count */
        FLOAT32  * __restrict__ p_mat1,               /*!< [in] f32b mat1: rows x cols1 */
@@ -473,6 +524,454 @@ WORD32 xa_nn_matXvec_batch_f32xf32_f32(
        WORD32 row_stride1,                           /*!< [in] row stride for mat1 */
        WORD32 vec_count                              /*!< [in] number of vectors: 2, 4, 2n */
   );
+
+/* Row range matXvec.
+ *
+ * xa_nn_matXvec_range_* compute rows [row_start, row_start + row_count) of
+ * the corresponding kernel. Every other argument describes the full rows x 1
+ * problem, so disjoint ranges of one call can run concurrently, sharing the
+ * same p_out and p_scratch. row_start must be a multiple of 4.
+ */
+WORD32 xa_nn_matXvec_range_16x16_16_sigmoid(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count                            /*!< [in] number of rows to compute */
+  );
+
+WORD32 xa_nn_matXvec_range_16x16_16_tanh(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count                            /*!< [in] number of rows to compute */
+  );
+
+WORD32 xa_nn_matXvec_range_8x16_16_sigmoid(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count                            /*!< [in] number of rows to compute */
+  );
+
+WORD32 xa_nn_matXvec_range_8x16_16_tanh(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count                            /*!< [in] number of rows to compute */
+  );
+
+WORD32 xa_nn_matXvec_range_f32xf32_f32(
+       FLOAT32  * __restrict__ p_out,                /*!< [out] f32b result: rows x 1 */
+       const FLOAT32  * __restrict__ p_mat1,         /*!< [in] f32b mat1: rows x cols1 */
+       const FLOAT32  * __restrict__ p_mat2,         /*!< [in] f32b mat2: rows x cols2 */
+       const FLOAT32  * __restrict__ p_vec1,         /*!< [in] f32b vec1: cols1 x 1 */
+       const FLOAT32  * __restrict__ p_vec2,         /*!< [in] f32b vec2: cols2 x 1 */
+       const FLOAT32  * __restrict__ p_bias,         /*!< [in] f32b bias: rows x 1 */
+       WORD32 rows,                                  /*!< [in] number of rows */
+       WORD32 cols1,                                 /*!< [in] number of columns of mat1 */
+       WORD32 cols2,                                 /*!< [in] number of columns of mat2 */
+       WORD32 row_stride1,                           /*!< [in] row stride for mat1 */
+       WORD32 row_stride2,                           /*!< [in] row stride for mat2 */
+       WORD32 row_start,                             /*!< [in] first row to compute, multiple of 4 */
+       WORD32 row_count                              /*!< [in] number of rows to compute */
+  );
+
+/* Row / vector unroll of the batch matXvec kernels.
+ *
+ * xa_nn_matXvec_batch_*_unroll compute the same result as the corresponding
+ * batch kernel with a block of XA_NN_MATXVEC_UNROLL_ROWS(unroll) rows x
+ * XA_NN_MATXVEC_UNROLL_VECS(unroll) vectors per inner loop. Supported values
+ * are 1, 2, 4 or 8 rows by 1, 2 or 4 vectors, with at most 8 accumulators
+ * (rows x vectors); anything else returns -1. XA_NN_MATXVEC_UNROLL_AUTO picks
+ * one at every call, xa_nn_matXvec_unroll_select() lets the caller pick once
+ * at prepare time, optionally from a tuning table generated by
+ * 'xa_nn_bench -tune'. Rows that are not 4 byte aligned or not a multiple of
+ * 4 long go to the regular batch kernel.
+ */
+#define XA_NN_MATXVEC_UNROLL_AUTO           0
+#define XA_NN_MATXVEC_UNROLL(rows, vecs)    (((rows) << 4) | (vecs))
+#define XA_NN_MATXVEC_UNROLL_ROWS(unroll)   ((unroll) >> 4)
+#define XA_NN_MATXVEC_UNROLL_VECS(unroll)   ((unroll) & 0xf)
+
+typedef struct _xa_nn_matXvec_unroll_entry_t
+{
+  WORD32 mat_precision;                       /* Bits: 8, 16 */
+  WORD32 vec_precision;                       /* Bits: 8, 16 */
+  WORD32 max_rows;                            /* Entry applies up to this many rows, 0: any */
+  WORD32 max_cols;                            /* Entry applies up to this many cols, 0: any */
+  WORD32 max_vec_count;                       /* Entry applies up to this many vectors, 0: any */
+  WORD32 unroll;                              /* XA_NN_MATXVEC_UNROLL(rows, vecs) */
+} xa_nn_matXvec_unroll_entry_t;
+
+WORD32 xa_nn_matXvec_unroll_select(
+         const xa_nn_matXvec_unroll_entry_t *p_table, /*!< [in] tuning table, first match wins, may be NULL */
+         WORD32 num_entries,                         /*!< [in] number of table entries */
+         WORD32 mat_precision,                       /*!< [in] mat1 precision in bits: 8, 16 */
+         WORD32 vec_precision,                       /*!< [in] vec1 precision in bits: 8, 16 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 vec_count                            /*!< [in] number of vectors */
+  );
+
+WORD32 xa_nn_matXvec_batch_16x16_64_unroll(
+         WORD64 ** __restrict__ p_out,               /*!< [out] array of result: rows x 1 pointers */
+         WORD16 *  __restrict__ p_mat1,              /*!< [in] 16b mat1: rows x cols1 */
+         WORD16 ** __restrict__ p_vec1,              /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 *  __restrict__ p_bias,              /*!< [in] 16b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, vecs) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_batch_8x16_64_unroll(
+         WORD64 ** __restrict__ p_out,               /*!< [out] array of result: rows x 1 pointers */
+         WORD8  *  __restrict__ p_mat1,              /*!< [in] 8b mat1: rows x cols1 */
+         WORD16 ** __restrict__ p_vec1,              /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 *  __restrict__ p_bias,              /*!< [in] 16b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, vecs) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_batch_8x8_32_unroll(
+         WORD32 ** __restrict__ p_out,               /*!< [out] array of result: rows x 1 pointers */
+         WORD8  *  __restrict__ p_mat1,              /*!< [in] 8b mat1: rows x cols1 */
+         WORD8  ** __restrict__ p_vec1,              /*!< [in] 8b vec1: cols1 x 1 */
+         WORD8  *  __restrict__ p_bias,              /*!< [in] 8b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, vecs) or _AUTO */
+  );
+
+/* Row unroll of the single vector matXvec kernels.
+ *
+ * Same result as the kernel without the _unroll suffix, with a block of
+ * XA_NN_MATXVEC_UNROLL_ROWS(unroll) rows per inner loop. unroll is
+ * XA_NN_MATXVEC_UNROLL(rows, 1) with rows 1, 2, 4 or 8, anything else
+ * returns -1. Layers pick it once with xa_nn_matXvec_unroll_select() for
+ * vec_count 1, XA_NN_MATXVEC_UNROLL_AUTO picks at every call.
+ */
+WORD32 xa_nn_matXvec_16x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] 16b mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] 16b mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_16x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] 16b mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] 16b mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_8x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] 8b mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] 8b mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_8x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] 8b mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] 8b mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_8x8_8_unroll(
+         WORD8  * __restrict__ p_out,                /*!< [out] 8b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] 8b mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] 8b mat2: rows x cols2 */
+         WORD8  * __restrict__ p_vec1,               /*!< [in] 8b vec1: cols1 x 1 */
+         WORD8  * __restrict__ p_vec2,               /*!< [in] 8b vec2: cols2 x 1 */
+         WORD8  * __restrict__ p_bias,               /*!< [in] 8b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+/* Row range form of the above, see xa_nn_matXvec_range_* */
+WORD32 xa_nn_matXvec_range_16x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count,                           /*!< [in] number of rows to compute */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_range_16x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD16 * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD16 * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count,                           /*!< [in] number of rows to compute */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_range_8x16_16_sigmoid_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count,                           /*!< [in] number of rows to compute */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+WORD32 xa_nn_matXvec_range_8x16_16_tanh_unroll(
+         WORD16 * __restrict__ p_out,                /*!< [out] 16b result: rows x 1 */
+         WORD8  * __restrict__ p_mat1,               /*!< [in] mat1: rows x cols1 */
+         WORD8  * __restrict__ p_mat2,               /*!< [in] mat2: rows x cols2 */
+         WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+         WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+         VOID   * __restrict__ p_bias,               /*!< [in] bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 bias_precision,                      /*!< [in] bias precision */
+         VOID   * __restrict__ p_scratch,            /*!< [in,out] scratch: rows x 4 bytes */
+         WORD32 row_start,                           /*!< [in] first row to compute, multiple of 4 */
+         WORD32 row_count,                           /*!< [in] number of rows to compute */
+         WORD32 unroll                               /*!< [in] XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO */
+  );
+
+/* Matrix x matrix: out = mat1 (rows x cols1) x vec1 (cols1 x vec_count) + bias.
+ *
+ * The vec_count input vectors are each cols1 contiguous elements, vector v
+ * starting at p_vec1[v * vec_offset]. The result for row r of vector v is
+ * written to p_out[v * out_offset + r * out_stride], so out_offset = rows,
+ * out_stride = 1 gives vec_count x rows and out_offset = 1,
+ * out_stride = vec_count gives rows x vec_count. Layouts where two results
+ * share an element are rejected: one of out_offset / out_stride must cover
+ * the whole extent of the other.
+ * Each loaded row of mat1 is reused across a block of vectors.
+ * 8-bit kernels accept any cols1 / row_stride1, vec_offset must be a multiple
+ * of 4. 16-bit kernels need cols1, row_stride1 and vec_offset multiples of 4.
+ */
+WORD32 xa_nn_matmul_8x8_8(
+         WORD8 * __restrict__ p_out,                 /*!< [out] result, see out_offset / out_stride */
+         const WORD8 * __restrict__ p_mat1,          /*!< [in] 8b mat1: rows x cols1 */
+         const WORD8 * __restrict__ p_vec1,          /*!< [in] 8b vectors: vec_count x cols1 */
+         const WORD8 * __restrict__ p_bias,          /*!< [in] 8b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 vec_offset,                          /*!< [in] offset from one vector to the next */
+         WORD32 out_offset,                          /*!< [in] offset from one output vector to the next */
+         WORD32 out_stride                           /*!< [in] offset from one output row to the next */
+  );
+
+WORD32 xa_nn_matmul_16x16_16(
+         WORD16 * __restrict__ p_out,                /*!< [out] result, see out_offset / out_stride */
+         const WORD16 * __restrict__ p_mat1,         /*!< [in] 16b mat1: rows x cols1 */
+         const WORD16 * __restrict__ p_vec1,         /*!< [in] 16b vectors: vec_count x cols1 */
+         const WORD16 * __restrict__ p_bias,         /*!< [in] 16b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 acc_shift,                           /*!< [in] out accumulator left shift amount */
+         WORD32 bias_shift,                          /*!< [in] bias left shift amount */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 vec_offset,                          /*!< [in] offset from one vector to the next */
+         WORD32 out_offset,                          /*!< [in] offset from one output vector to the next */
+         WORD32 out_stride                           /*!< [in] offset from one output row to the next */
+  );
+
+WORD32 xa_nn_matmul_asym8xasym8_asym8(
+         UWORD8 * __restrict__ p_out,                /*!< [out] result, see out_offset / out_stride */
+         const UWORD8 * __restrict__ p_mat1,         /*!< [in] asym8 mat1: rows x cols1 */
+         const UWORD8 * __restrict__ p_vec1,         /*!< [in] asym8 vectors: vec_count x cols1 */
+         const WORD32 * __restrict__ p_bias,         /*!< [in] 32b bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 vec_offset,                          /*!< [in] offset from one vector to the next */
+         WORD32 out_offset,                          /*!< [in] offset from one output vector to the next */
+         WORD32 out_stride,                          /*!< [in] offset from one output row to the next */
+         WORD32 mat1_zero_bias,                      /*!< [in] zero bias of mat1 */
+         WORD32 vec1_zero_bias,                      /*!< [in] zero bias of the vectors */
+         WORD32 out_multiplier,                      /*!< [in] output multiplier */
+         WORD32 out_shift,                           /*!< [in] output shift */
+         WORD32 out_zero_bias,                       /*!< [in] output zero bias */
+         WORD32 out_activation_min,                  /*!< [in] lower output clamp, 0 for none */
+         WORD32 out_activation_max                   /*!< [in] upper output clamp, 255 for none */
+  );
+
+WORD32 xa_nn_matmul_f32xf32_f32(
+         FLOAT32 * __restrict__ p_out,               /*!< [out] result, see out_offset / out_stride */
+         const FLOAT32 * __restrict__ p_mat1,        /*!< [in] f32 mat1: rows x cols1 */
+         const FLOAT32 * __restrict__ p_vec1,        /*!< [in] f32 vectors: vec_count x cols1 */
+         const FLOAT32 * __restrict__ p_bias,        /*!< [in] f32 bias: rows x 1 */
+         WORD32 rows,                                /*!< [in] number of rows */
+         WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+         WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+         WORD32 vec_count,                           /*!< [in] number of vectors */
+         WORD32 vec_offset,                          /*!< [in] offset from one vector to the next */
+         WORD32 out_offset,                          /*!< [in] offset from one output vector to the next */
+         WORD32 out_stride                           /*!< [in] offset from one output row to the next */
+  );
  
 WORD32 xa_nn_vec_sigmoid_32_32(               
     WORD32       * __restrict__ p_out,         /*!< [out] result: vec_length x 1, Q16.15 */
@@ -572,6 +1071,18 @@ WORD32 xa_nn_vec_tanh_32_8(
     WORD32       vec_length                    /*!< [in] length of vectors */
   );
 
+WORD32 xa_nn_vec_sigmoid_16_16(
+    WORD16       * __restrict__ p_out,         /*!< [out] result: vec_length x 1, Q0.15 */
+    const WORD16 * __restrict__ p_vec,         /*!< [in] input data: vec_length x 1, Q3.12 */
+    WORD32       vec_length                    /*!< [in] length of vectors */
+  );
+
+WORD32 xa_nn_vec_tanh_16_16(
+    WORD16       * __restrict__ p_out,         /*!< [out] result: vec_length x 1, Q0.15 */
+    const WORD16 * __restrict__ p_vec,         /*!< [in] input data: vec_length x 1, Q3.12 */
+    WORD32       vec_length                    /*!< [in] length of vectors */
+  );
+
 WORD32 xa_nn_vec_interpolation_q15(
     WORD16       * __restrict__ p_out,           /*!< [out] result: num_elements x 1 */
     const WORD16 * __restrict__ p_ifact,         /*!< [in] interp. factor: num_elements x 1 */
@@ -657,6 +1168,69 @@ WORD32 xa_nn_conv1d_std_f32(
     WORD32 out_data_format,
     VOID *p_handle);
 
+/* Streaming conv1d: the handle keeps the last kernel_height input rows across
+   calls. Each call consumes n_rows new input rows and writes only the output
+   rows completed by them, as [rows x out_channels], returning their count
+   (at most (n_rows + y_stride - 1) / y_stride) or -1 on error. */
+WORD32 xa_nn_conv1d_std_stream_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_std_stream_init(
+    VOID *p_handle,
+    VOID *p_kernel,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 input_zero_bias,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_std_stream_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv1d_std_stream_8x8(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv1d_std_stream_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv1d_std_stream_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    VOID *p_handle);
+
 
 WORD32 xa_nn_conv2d_std_getsize(
     WORD32 input_height,
@@ -754,6 +1328,109 @@ WORD32 xa_nn_conv2d_std_f32(
     WORD32 out_data_format,
     VOID *p_handle);
 
+/* Output channel range conv2d_std.
+ *
+ * xa_nn_conv2d_std_range_* compute output channels
+ * [out_channel_start, out_channel_start + out_channel_count) of the
+ * corresponding kernel, in either out_data_format. Every other argument
+ * describes the full problem. Disjoint ranges of one call can run
+ * concurrently, each with its own scratch of xa_nn_conv2d_std_getsize()
+ * bytes. out_channel_start must be a multiple of 4.
+ */
+WORD32 xa_nn_conv2d_std_range_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv2d_std_range_8x8(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv2d_std_range_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_handle);
+
+WORD32 xa_nn_conv2d_std_range_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_handle);
+
 WORD32 xa_nn_conv2d_pointwise_f32(
     FLOAT32* __restrict__ p_out,
     FLOAT32* __restrict__ p_kernel,
@@ -932,6 +1609,31 @@ WORD32 xa_nn_conv2d_depthwise_f32(
     WORD32  out_data_format,
     pVOID p_scratch);
 
+/* As xa_nn_conv2d_depthwise_f32, with the output clamped to
+ * [out_activation_min, out_activation_max] before it is stored. */
+WORD32 xa_nn_conv2d_depthwise_f32_act(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    FLOAT32 out_activation_min,
+    FLOAT32 out_activation_max,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    pVOID p_scratch);
+
 WORD32 xa_nn_conv2d_depthwise_8x16
     (pWORD16 __restrict__ p_out
      ,const pWORD8 __restrict__ p_kernel
@@ -1300,6 +2002,17 @@ WORD32 xa_nn_fully_connected_f32
    ,WORD32  out_depth
   );
 
+WORD32 xa_nn_fully_connected_sym8xf32_f32
+  (FLOAT32 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const FLOAT32 *__restrict__ p_weight_scale
+   ,const FLOAT32 *__restrict__ p_inp
+   ,const FLOAT32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,pVOID   p_scratch
+  );
+
 WORD32 xa_nn_fully_connected_16x16_16
   (pWORD16 __restrict__ p_out
    ,pWORD16  __restrict__ p_weight
@@ -1333,6 +2046,19 @@ WORD32 xa_nn_fully_connected_8x8_8
    ,WORD32  bias_shift
   );
 
+/* unroll: XA_NN_MATXVEC_UNROLL(rows, 1) or _AUTO, see xa_nn_matXvec_8x8_8_unroll */
+WORD32 xa_nn_fully_connected_8x8_8_unroll
+  (pWORD8 __restrict__ p_out
+   ,pWORD8  __restrict__ p_weight
+   ,pWORD8 __restrict__ p_inp
+   ,pWORD8 __restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  acc_shift
+   ,WORD32  bias_shift
+   ,WORD32  unroll
+  );
+
 #ifdef NNLIB_V2
 
 WORD32 xa_nn_vec_activation_min_max_asym8_asym8(
@@ -1363,6 +2089,20 @@ WORD32 xa_nn_conv1d_std_asym8xasym8(
     WORD32 out_data_format,
     VOID *p_scratch);
 
+WORD32 xa_nn_conv1d_std_stream_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    UWORD8* __restrict__ p_kernel,
+    WORD32* __restrict__ p_bias,
+    WORD32 n_rows,
+    WORD32 out_channels,
+    WORD32 input_zero_bias,
+    WORD32 kernel_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_handle);
+
 WORD32 xa_nn_conv2d_std_asym8xasym8(
     UWORD8* __restrict__ p_out,
     const UWORD8* __restrict__ p_inp,
@@ -1383,12 +2123,82 @@ WORD32 xa_nn_conv2d_std_asym8xasym8(
     WORD32 input_zero_bias,
     WORD32 kernel_zero_bias,
     WORD32 out_multiplier,
-    WORD32 out_shift,
-    WORD32 out_zero_bias,
-    WORD32 out_data_format,
-    VOID *p_scratch);
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_std_range_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    const UWORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 kernel_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 out_channel_start,
+    WORD32 out_channel_count,
+    VOID *p_scratch);
+
+WORD32 xa_nn_matXvec_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_mat2,
+    const UWORD8 * __restrict__ p_vec1,
+    const UWORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias
+    );
+
+/* As xa_nn_matXvec_asym8xasym8_asym8, with the requantized sum saturated to
+ * a 16 bit fixed point output (no zero point) */
+WORD32 xa_nn_matXvec_asym8xasym8_16(
+    WORD16 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_mat2,
+    const UWORD8 * __restrict__ p_vec1,
+    const UWORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift
+    );
 
-WORD32 xa_nn_matXvec_asym8xasym8_asym8(
+WORD32 xa_nn_matXvec_range_asym8xasym8_asym8(
     UWORD8 * __restrict__ p_out,
     const UWORD8 * __restrict__ p_mat1,
     const UWORD8 * __restrict__ p_mat2,
@@ -1406,9 +2216,72 @@ WORD32 xa_nn_matXvec_asym8xasym8_asym8(
     WORD32 vec2_zero_bias,
     WORD32 out_multiplier,
     WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 row_start,
+    WORD32 row_count
+    );
+
+/* Block-sparse matXvec with 1x4 weight blocks (4 consecutive columns,
+ * starting at a multiple of 4). Only blocks holding a non-zero weight are
+ * stored, CSR style: p_blk_val has 4 weights per block row after row (4 byte
+ * aligned), p_blk_col the block column divided by 4 and p_row_ptr (rows + 1
+ * entries, p_row_ptr[0] = 0) the first block of each row. Build the arrays
+ * with xa_nn_sparse_1x4_from_dense_8, sized from
+ * xa_nn_sparse_1x4_count_blocks_8. p_vec must be 4 byte aligned and is read
+ * up to cols rounded up to a multiple of 4. Output and bias semantics match
+ * xa_nn_matXvec_8x8_8 and xa_nn_matXvec_asym8xasym8_asym8 respectively. */
+WORD32 xa_nn_matXvec_sparse_1x4_8x8_8(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_blk_val,
+    const UWORD16 * __restrict__ p_blk_col,
+    const WORD32 * __restrict__ p_row_ptr,
+    const WORD8 * __restrict__ p_vec,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 acc_shift,
+    WORD32 bias_shift
+    );
+
+WORD32 xa_nn_matXvec_sparse_1x4_asym8xasym8_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_blk_val,
+    const UWORD16 * __restrict__ p_blk_col,
+    const WORD32 * __restrict__ p_row_ptr,
+    const UWORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
     WORD32 out_zero_bias
     );
 
+/* Dense 8 bit weights to the 1x4 block-sparse format. zero_value is the byte
+ * of a zero weight: 0 for 8x8 weights, the weight zero point (-mat_zero_bias)
+ * for asym8. count_blocks returns the number of blocks to size p_blk_val
+ * (4 bytes each) and p_blk_col; p_row_ptr takes rows + 1 entries. */
+WORD32 xa_nn_sparse_1x4_count_blocks_8(
+    const UWORD8 * __restrict__ p_dense,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 zero_value
+    );
+
+WORD32 xa_nn_sparse_1x4_from_dense_8(
+    UWORD8 * __restrict__ p_blk_val,
+    UWORD16 * __restrict__ p_blk_col,
+    WORD32 * __restrict__ p_row_ptr,
+    const UWORD8 * __restrict__ p_dense,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 zero_value
+    );
+
 WORD32 xa_nn_matXvec_batch_asym8xasym8_asym8(
     UWORD8 ** __restrict__ p_out,
     UWORD8 * __restrict__ p_mat1,
@@ -1450,6 +2323,36 @@ WORD32 xa_nn_conv2d_depthwise_asym8xasym8(
     WORD32  out_data_format,
     pVOID p_scratch);
 
+/* As xa_nn_conv2d_depthwise_asym8xasym8, with the output clamped to
+ * [out_activation_min, out_activation_max] before it is stored. */
+WORD32 xa_nn_conv2d_depthwise_asym8xasym8_act(
+    pUWORD8 __restrict__ p_out,
+    const UWORD8 *__restrict__ p_kernel,
+    const UWORD8 *__restrict__ p_inp,
+    const WORD32 *__restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    WORD32  kernel_zero_bias,
+    WORD32  out_multiplier,
+    WORD32  out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    pVOID p_scratch);
+
 WORD32 xa_nn_conv2d_pointwise_asym8xasym8
   (pUWORD8 __restrict__ p_out
    ,pUWORD8  __restrict__ p_kernel
@@ -1466,12 +2369,216 @@ WORD32 xa_nn_conv2d_pointwise_asym8xasym8
    ,WORD32  out_zero_bias
    ,WORD32  out_data_format);
 
+/* As xa_nn_conv2d_pointwise_asym8xasym8, with the output clamped to
+ * [out_activation_min, out_activation_max] before it is stored. */
+WORD32 xa_nn_conv2d_pointwise_asym8xasym8_act
+  (pUWORD8 __restrict__ p_out
+   ,pUWORD8  __restrict__ p_kernel
+   ,pUWORD8 __restrict__ p_inp
+   ,pWORD32 __restrict__ p_bias
+   ,WORD32  input_height
+   ,WORD32  input_width
+   ,WORD32  input_channels
+   ,WORD32  out_channels
+   ,WORD32  input_zero_bias
+   ,WORD32  kernel_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,WORD32  out_data_format);
+
+/* Inverted residual block (MobileNetV2): expand 1x1 -> depthwise -> project 1x1
+ * -> optional residual add, all NHWC.
+ *
+ * Output rows are produced in bands, only the expanded rows feeding one band
+ * are held in p_scratch, sized by xa_nn_conv2d_inv_res_getsize (precision -3
+ * for asym8, -1 for f32). p_expand_kernel may be NULL when the block has no
+ * expansion, expand_channels must then equal input_channels. The residual add
+ * needs x_stride = y_stride = 1 and out_channels = input_channels.
+ * input_channels and expand_channels must be multiples of 4.
+ */
+typedef struct _xa_nn_inv_res_stage_asym8_t
+{
+  WORD32 kernel_zero_bias;
+  WORD32 out_multiplier;
+  WORD32 out_shift;
+  WORD32 out_zero_bias;
+  WORD32 out_activation_min;
+  WORD32 out_activation_max;
+} xa_nn_inv_res_stage_asym8_t;
+
+/* Parameters of the residual add, as for xa_nn_elm_add_asym8xasym8_asym8.
+ * The input zero biases are taken from the projection output and the block input. */
+typedef struct _xa_nn_inv_res_residual_asym8_t
+{
+  WORD32 out_zero_bias;
+  WORD32 out_left_shift;
+  WORD32 out_multiplier;
+  WORD32 out_activation_min;
+  WORD32 out_activation_max;
+  WORD32 inp1_left_shift;
+  WORD32 inp1_multiplier;
+  WORD32 inp2_left_shift;
+  WORD32 inp2_multiplier;
+  WORD32 left_shift;
+} xa_nn_inv_res_residual_asym8_t;
+
+/* As xa_nn_matmul_asym8xasym8_asym8, with the clamped result added to the
+ * element of p_res at the same position (p_res is laid out as p_out) as
+ * xa_nn_elm_add_asym8xasym8_asym8 would, before it is stored. The result is
+ * the first input of the add, its zero bias is -out_zero_bias. */
+WORD32 xa_nn_matmul_asym8xasym8_asym8_residual(
+         UWORD8 * __restrict__ p_out,
+         const UWORD8 * __restrict__ p_mat1,
+         const UWORD8 * __restrict__ p_vec1,
+         const WORD32 * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 vec_count,
+         WORD32 vec_offset,
+         WORD32 out_offset,
+         WORD32 out_stride,
+         WORD32 mat1_zero_bias,
+         WORD32 vec1_zero_bias,
+         WORD32 out_multiplier,
+         WORD32 out_shift,
+         WORD32 out_zero_bias,
+         WORD32 out_activation_min,
+         WORD32 out_activation_max,
+         const UWORD8 * __restrict__ p_res,
+         WORD32 res_zero_bias,
+         const xa_nn_inv_res_residual_asym8_t *p_add);
+
+/* As xa_nn_matmul_f32xf32_f32, with the element of p_res at the same
+ * position (p_res is laid out as p_out) added to the result before it is stored. */
+WORD32 xa_nn_matmul_f32xf32_f32_residual(
+         FLOAT32 * __restrict__ p_out,
+         const FLOAT32 * __restrict__ p_mat1,
+         const FLOAT32 * __restrict__ p_vec1,
+         const FLOAT32 * __restrict__ p_bias,
+         WORD32 rows,
+         WORD32 cols1,
+         WORD32 row_stride1,
+         WORD32 vec_count,
+         WORD32 vec_offset,
+         WORD32 out_offset,
+         WORD32 out_stride,
+         const FLOAT32 * __restrict__ p_res);
+
+WORD32 xa_nn_conv2d_inv_res_getsize
+  (WORD32 input_width
+   ,WORD32 expand_channels
+   ,WORD32 out_channels
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 out_height
+   ,WORD32 out_width
+   ,WORD32 precision
+   );
+
+WORD32 xa_nn_conv2d_inv_res_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    const UWORD8* __restrict__ p_expand_kernel,
+    const WORD32* __restrict__ p_expand_bias,
+    const UWORD8* __restrict__ p_dw_kernel,
+    const WORD32* __restrict__ p_dw_bias,
+    const UWORD8* __restrict__ p_project_kernel,
+    const WORD32* __restrict__ p_project_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  expand_channels,
+    WORD32  out_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    const xa_nn_inv_res_stage_asym8_t *p_expand,      /* NULL when p_expand_kernel is NULL */
+    const xa_nn_inv_res_stage_asym8_t *p_dw,
+    const xa_nn_inv_res_stage_asym8_t *p_project,
+    const xa_nn_inv_res_residual_asym8_t *p_residual, /* NULL for no residual add */
+    pVOID p_scratch);
+
+WORD32 xa_nn_conv2d_inv_res_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_expand_kernel,
+    const FLOAT32* __restrict__ p_expand_bias,
+    const FLOAT32* __restrict__ p_dw_kernel,
+    const FLOAT32* __restrict__ p_dw_bias,
+    const FLOAT32* __restrict__ p_project_kernel,
+    const FLOAT32* __restrict__ p_project_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  expand_channels,
+    WORD32  out_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    FLOAT32 expand_activation_min,
+    FLOAT32 expand_activation_max,
+    FLOAT32 dw_activation_min,
+    FLOAT32 dw_activation_max,
+    WORD32  residual,                                 /* non-zero to add p_inp to the output */
+    pVOID p_scratch);
+
 WORD32 xa_nn_vec_activation_min_max_f32_f32(FLOAT32 * __restrict__ p_out, 
            const  FLOAT32 * __restrict__ p_vec, 
                   FLOAT32 activation_min,
                   FLOAT32 activation_max,
                   WORD32  vec_length);
 
+/* Cell activation codes of xa_nn_lstm_cell_update_f32, same values as the
+ * fused activation codes of Android NN / TensorFlow Lite */
+#define XA_NN_LSTM_CELL_ACT_NONE      0
+#define XA_NN_LSTM_CELL_ACT_RELU      1
+#define XA_NN_LSTM_CELL_ACT_RELU6     3
+#define XA_NN_LSTM_CELL_ACT_TANH      4
+#define XA_NN_LSTM_CELL_ACT_SIGMOID   6
+
+/* Elementwise part of an LSTM cell in one pass over n_batch x n_cell:
+ * peephole terms, gate sigmoids, cell activation, the cell state update with
+ * clipping and output = output gate * activation(new cell state).
+ * p_input_gate == NULL selects coupled input and forget gates (CIFG), a NULL
+ * peephole pointer skips that peephole, cell_clip <= 0 disables clipping.
+ * Gate buffers hold the pre-activations (matXvec + bias), peephole weights
+ * are n_cell long. p_out may be p_output_gate, no other buffers may overlap.
+ */
+WORD32 xa_nn_lstm_cell_update_f32(
+         FLOAT32 * __restrict__ p_cell_state_out,    /*!< [out] new cell state: n_batch x n_cell */
+         FLOAT32 * p_out,                            /*!< [out] cell output: n_batch x n_cell */
+   const FLOAT32 * __restrict__ p_input_gate,        /*!< [in] input gate, NULL for CIFG */
+   const FLOAT32 * __restrict__ p_forget_gate,       /*!< [in] forget gate: n_batch x n_cell */
+   const FLOAT32 * __restrict__ p_cell_gate,         /*!< [in] cell gate: n_batch x n_cell */
+   const FLOAT32 * p_output_gate,                    /*!< [in] output gate: n_batch x n_cell */
+   const FLOAT32 * __restrict__ p_cell_state_in,     /*!< [in] previous cell state: n_batch x n_cell */
+   const FLOAT32 * __restrict__ p_cell_to_input,     /*!< [in] input gate peephole or NULL */
+   const FLOAT32 * __restrict__ p_cell_to_forget,    /*!< [in] forget gate peephole or NULL */
+   const FLOAT32 * __restrict__ p_cell_to_output,    /*!< [in] output gate peephole or NULL */
+         FLOAT32 cell_clip,                          /*!< [in] cell state clip, <= 0 for none */
+         WORD32  cell_activation,                    /*!< [in] XA_NN_LSTM_CELL_ACT_* */
+         WORD32  n_cell,                             /*!< [in] cells per batch */
+         WORD32  n_batch                             /*!< [in] batches */
+  );
+
 WORD32 xa_nn_maxpool_asym8(
         UWORD8* __restrict__ p_out,
 const   UWORD8* __restrict__ p_inp,
@@ -1508,6 +2615,110 @@ const   UWORD8* __restrict__ p_inp,
         WORD32  out_data_format,
         VOID *p_scratch);
 
+WORD32 xa_nn_avgpool_batch_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch);
+
+WORD32 xa_nn_avgpool_batch_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch);
+
+WORD32 xa_nn_maxpool_batch_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        FLOAT32 out_activation_min,
+        FLOAT32 out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch);
+
+WORD32 xa_nn_maxpool_batch_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  out_activation_min,
+        WORD32  out_activation_max,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        VOID   *p_scratch);
+
+WORD32 xa_nn_global_avgpool_f32(
+        FLOAT32* __restrict__ p_out,
+const   FLOAT32* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels);
+
+WORD32 xa_nn_global_avgpool_asym8(
+        UWORD8* __restrict__ p_out,
+const   UWORD8* __restrict__ p_inp,
+        WORD32  batches,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  inp_zero_bias,
+        WORD32  out_multiplier,
+        WORD32  out_shift,
+        WORD32  out_zero_bias);
+
 WORD32 xa_nn_fully_connected_asym8xasym8_asym8
   (pUWORD8 __restrict__ p_out
    ,const UWORD8 *__restrict__ p_weight
@@ -1522,6 +2733,38 @@ WORD32 xa_nn_fully_connected_asym8xasym8_asym8
    ,WORD32  out_zero_bias
   );
 
+/* Fully connected on 1x4 block-sparse weights, see
+ * xa_nn_matXvec_sparse_1x4_8x8_8 for the format; p_inp must be 4 byte
+ * aligned */
+WORD32 xa_nn_fully_connected_sparse_1x4_8x8_8
+  (pWORD8 __restrict__ p_out
+   ,const WORD8 *__restrict__ p_blk_val
+   ,const UWORD16 *__restrict__ p_blk_col
+   ,const WORD32 *__restrict__ p_row_ptr
+   ,pWORD8 __restrict__ p_inp
+   ,pWORD8 __restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  acc_shift
+   ,WORD32  bias_shift
+  );
+
+WORD32 xa_nn_fully_connected_sparse_1x4_asym8xasym8_asym8
+  (UWORD8 *__restrict__ p_out
+   ,const UWORD8 *__restrict__ p_blk_val
+   ,const UWORD16 *__restrict__ p_blk_col
+   ,const WORD32 *__restrict__ p_row_ptr
+   ,const UWORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  );
+
 WORD32 xa_nn_elm_mul_f32xf32_f32(FLOAT32 * __restrict__ p_out, 
                                const FLOAT32 * __restrict__ p_inp1, 
                                const FLOAT32 * __restrict__ p_inp2, 
@@ -1580,6 +2823,55 @@ WORD32 xa_nn_elm_mul_asym8xasym8_asym8(UWORD8 * __restrict__ p_out,
                             WORD32  inp2_zero_bias,
                             WORD32  num_elm);
 
+WORD32 xa_nn_dequantize_asym8_f32(FLOAT32 * __restrict__ p_out,
+                            const UWORD8 * __restrict__ p_inp,
+                                  WORD32 inp_zero_bias,
+                                  FLOAT32 scale,
+                                  WORD32 num_elm);
+
+WORD32 xa_nn_dequantize_16_f32(FLOAT32 * __restrict__ p_out,
+                         const WORD16 * __restrict__ p_inp,
+                               FLOAT32 scale,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_quantize_f32_asym8(UWORD8 * __restrict__ p_out,
+                          const FLOAT32 * __restrict__ p_inp,
+                                FLOAT32 scale,
+                                WORD32 out_zero_bias,
+                                WORD32 num_elm);
+
+WORD32 xa_nn_quantize_f32_16(WORD16 * __restrict__ p_out,
+                       const FLOAT32 * __restrict__ p_inp,
+                             FLOAT32 scale,
+                             WORD32 num_elm);
+
+WORD32 xa_nn_quantize_f32_sym8(WORD8 * __restrict__ p_out,
+                               FLOAT32 * __restrict__ p_scale,
+                         const FLOAT32 * __restrict__ p_inp,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_requantize_asym8_asym8(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   UWORD8 * __restrict__ p_inp,
+                            WORD32  inp_zero_bias,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_requantize_asym8_16(WORD16 * __restrict__ p_out,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   UWORD8 * __restrict__ p_inp,
+                            WORD32  inp_zero_bias,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_requantize_16_asym8(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                    const   WORD16 * __restrict__ p_inp,
+                            WORD32  num_elm);
+
 WORD32 xa_nn_vec_softmax_asym8_asym8( UWORD8 * __restrict__ p_out, 
                     const   UWORD8 * __restrict__ p_vec, 
                             WORD32   diffmin,
@@ -1596,6 +2888,23 @@ WORD32 xa_nn_vec_sigmoid_asym8_asym8(UWORD8 *p_out,
                             WORD32 input_left_shift,
                             WORD32 vec_length);
 
+WORD32 xa_nn_vec_sigmoid_asym8_asym8_lut_init(UWORD8 *p_lut,
+                            WORD32 zero_point,
+                            WORD32 input_range_radius,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift);
+
+WORD32 xa_nn_vec_tanh_asym8_asym8_lut_init(UWORD8 *p_lut,
+                            WORD32 zero_point,
+                            WORD32 input_range_radius,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift);
+
+WORD32 xa_nn_vec_lut_asym8_asym8(UWORD8 * __restrict__ p_out,
+                      const UWORD8 * __restrict__ p_vec,
+                      const UWORD8 * __restrict__ p_lut,
+                            WORD32 vec_length);
+
 int get_softmax_scratch_size(int inp_precision, int out_precision, int length);
 
 WORD32 xa_nn_l2_norm_f32(
@@ -1603,6 +2912,19 @@ WORD32 xa_nn_l2_norm_f32(
     const FLOAT32 * __restrict__ p_inp,
     WORD32 num_elm);
 
+WORD32 xa_nn_l2_norm_rows_f32(
+    FLOAT32 * __restrict__ p_out,
+    const FLOAT32 * __restrict__ p_inp,
+    WORD32 rows,
+    WORD32 depth);
+
+WORD32 xa_nn_l2_norm_rows_asym8(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_inp,
+    WORD32 inp_zero_bias,
+    WORD32 rows,
+    WORD32 depth);
+
 #endif /* NNLIB_V2 */
 
 #if defined(__cplusplus)
@@ -35,7 +35,8 @@ typedef enum _xa_nnlib_lstm_param_id_t
   XA_NNLIB_LSTM_BIAS                   = 3,             // GET/SET biases
   XA_NNLIB_LSTM_INPUT_SHAPE            = 4,             // GET input shape information
   XA_NNLIB_LSTM_OUTPUT_SHAPE           = 5,             // GET output shape information
-  XA_NNLIB_LSTM_CELL_SHAPE             = 6              // GET cell shape information
+  XA_NNLIB_LSTM_CELL_SHAPE             = 6,             // GET cell shape information
+  XA_NNLIB_LSTM_NUM_WORKERS            = 7              // GET/SET number of workers process splits out_feats across, no extra scratch needed
 } xa_nnlib_lstm_param_id_t;
 
 /* I/O Precision Settings */
@@ -64,7 +65,9 @@ typedef enum _xa_nnlib_fatal_config_lstm_error_code_t
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 4),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 5),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 6),
-  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7)
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_NUM_WORKERS      = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 8),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_COMBINATION = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 9)
 } xa_nnlib_fatal_config_lstm_error_code_t;
 
 /************************************************************/
@@ -61,21 +61,84 @@
 #define PROF_ALLOCATE
 #include "xt_profiler.h"
 
+#if defined(PROFILE) && defined(NNLIB_PTHREADS)
+// gProfiler[0] and the ISS profile switch are process wide. With executions
+// in flight together, or operations on several threads, one kernel is timed
+// at a time so each cycle count covers only its own kernel.
+static std::mutex sKernelProfilerMutex;
+#define PROFILER_LOCK sKernelProfilerMutex.lock();
+#define PROFILER_UNLOCK sKernelProfilerMutex.unlock();
+#else
+#define PROFILER_LOCK
+#define PROFILER_UNLOCK
+#endif
+
 #define PROFILER_START(op) \
+    PROFILER_LOCK \
     XTPWR_PROFILER_OPEN(0, op, "", 1, NULL, 0); \
     XTPWR_PROFILER_START(0);
 
 #define PROFILER_STOP \
     XTPWR_PROFILER_STOP(0); \
     XTPWR_PROFILER_UPDATE(0); \
-    XTPWR_PROFILER_CLOSE(0, 1);
+    XTPWR_PROFILER_CLOSE(0, 1); \
+    PROFILER_UNLOCK
 
 #endif //HIFI_BUILD
 
+#include "xt_op_profiler.h"
+
+#ifdef NNLIB_PTHREADS
+#include <deque>
+#include <thread>
+#endif
 
 namespace android {
 namespace nn {
 
+// Total size of the listed operands for their current dimensions.
+static uint32_t operandListBytes(const std::vector<RunTimeOperandInfo>& operands,
+                                 const hidl_vec<uint32_t>& indexes) {
+    uint32_t bytes = 0;
+    for (uint32_t index : indexes) {
+        bytes += sizeOfData(operands[index].type, operands[index].dimensions);
+    }
+    return bytes;
+}
+
+// Multiply-accumulates done by the operation, for the operations where that
+// is the bulk of the work. Others report zero.
+static uint64_t estimateMacs(const std::vector<RunTimeOperandInfo>& operands,
+                             const Operation& operation) {
+    if (operation.inputs.size() < 2 || operation.outputs.size() < 1) {
+        return 0;
+    }
+    const RunTimeOperandInfo& filter = operands[operation.inputs[1]];
+    const RunTimeOperandInfo& output = operands[operation.outputs[0]];
+    uint64_t outputCount = 1;
+    for (uint32_t d : output.dimensions) {
+        outputCount *= d;
+    }
+    if (filter.dimensions.size() < 2) {
+        return 0;
+    }
+    switch (operation.type) {
+        case OperationType::CONV_2D:
+            // filter: [depth_out, filter_height, filter_width, depth_in]
+            return filter.dimensions.size() == 4 ?
+                   outputCount * filter.dimensions[1] * filter.dimensions[2] * filter.dimensions[3] : 0;
+        case OperationType::DEPTHWISE_CONV_2D:
+            // filter: [1, filter_height, filter_width, depth_out]
+            return filter.dimensions.size() == 4 ?
+                   outputCount * filter.dimensions[1] * filter.dimensions[2] : 0;
+        case OperationType::FULLY_CONNECTED:
+            // weights: [num_units, input_size]
+            return outputCount * filter.dimensions[1];
+        default:
+            return 0;
+    }
+}
+
 // TODO: short term, make share memory mapping and updating a utility function.
 // TODO: long term, implement mmap_fd as a hidl IMemory service.
 #ifndef HIFI_BUILD
@@ -126,6 +189,13 @@ RunTimePoolInfo::RunTimePoolInfo(uint8_t* buffer) {
     mBuffer = buffer;
 }
 
+#ifdef HIFI_BUILD
+RunTimePoolInfo::RunTimePoolInfo(uint8_t* buffer, const xt_wc_t* weightContainer) {
+    mBuffer = buffer;
+    mWeightContainer = weightContainer;
+}
+#endif //HIFI_BUILD
+
 RunTimePoolInfo::RunTimePoolInfo(RunTimePoolInfo&& other) {
     moveFrom(std::move(other));
     other.mBuffer = nullptr;
@@ -144,6 +214,9 @@ void RunTimePoolInfo::moveFrom(RunTimePoolInfo &&other) {
     mHidlMemory = std::move(other.mHidlMemory);
     mBuffer     = std::move(other.mBuffer);
     mMemory     = std::move(other.mMemory);
+#ifdef HIFI_BUILD
+    mWeightContainer = other.mWeightContainer;
+#endif //HIFI_BUILD
 }
 
 void RunTimePoolInfo::release() {
@@ -172,6 +245,9 @@ void RunTimePoolInfo::release() {
     mHidlMemory = hidl_memory();
     mMemory     = nullptr;
     mBuffer     = nullptr;
+#ifdef HIFI_BUILD
+    mWeightContainer = nullptr;
+#endif //HIFI_BUILD
 }
 
 // Making sure the output data are correctly updated after execution.
@@ -238,11 +314,15 @@ static bool setInfoAndAllocateIfNeeded(RunTimeOperandInfo* info, const Shape& sh
     info->dimensions = shape.dimensions;
     info->scale = shape.scale;
     info->zeroPoint = shape.offset;
-    if (info->lifetime == OperandLifeTime::TEMPORARY_VARIABLE && info->buffer == nullptr) {
+    if (info->lifetime == OperandLifeTime::TEMPORARY_VARIABLE) {
         uint32_t length = sizeOfData(info->type, info->dimensions);
-        info->buffer = new uint8_t[length];
-        if (info->buffer == nullptr) {
-            return false;
+        // An arena slot planned for a smaller shape is left for a heap buffer.
+        if (info->buffer == nullptr || length > info->length) {
+            info->buffer = new uint8_t[length];
+            if (info->buffer == nullptr) {
+                return false;
+            }
+            info->length = length;
         }
     }
     return true;
@@ -271,14 +351,37 @@ int CpuExecutor::run(const V1_1::Model& model, const Request& request,
 
     mModel = &model;
     mRequest = &request; // TODO check if mRequest is needed
+    mModelPoolInfos = &modelPoolInfos;
+    if (mPreparedModel != nullptr) {
+        // Waits while other executions of the model hold all the buffers
+        mBuffers = mPreparedModel->acquireBuffers();
+        if (mBuffers == nullptr) {
+            return ANEURALNETWORKS_OP_FAILED;
+        }
+    }
+#ifdef NNLIB_PTHREADS
+    const int numThreads = model.operations.size() > 1 ? sNumThreads : 1;
+    mSequential = numThreads == 1;
+#endif
     initializeRunTimeInfo(modelPoolInfos, requestPoolInfos);
+#ifdef NNLIB_PTHREADS
+    if (!mSequential) {
+        int n = runParallel(numThreads);
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            releaseBuffers();
+            return n;
+        }
+    } else
+#endif
     // The model has serialized the operation in execution order.
-    for (const auto& operation : model.operations) {
-        int n = executeOperation(operation);
+    for (size_t i = 0; i < model.operations.size(); i++) {
+        int n = runOperation(i, mBuffers != nullptr ? mBuffers->scratch.data() : nullptr);
         if (n != ANEURALNETWORKS_NO_ERROR) {
+            releaseBuffers();
             return n;
         }
     }
+    releaseBuffers();
     for (auto& runtimeInfo : modelPoolInfos) {
         runtimeInfo.update();
     }
@@ -287,12 +390,238 @@ int CpuExecutor::run(const V1_1::Model& model, const Request& request,
     }
     mModel = nullptr;
     mRequest = nullptr;
+    mModelPoolInfos = nullptr;
 #ifndef HIFI_BUILD
     VLOG(CPUEXE) << "Completed run normally";
 #endif //HIFI_BUILD
     return ANEURALNETWORKS_NO_ERROR;
 }
 
+int CpuExecutor::runOperation(size_t index, void* scratch) {
+    const Operation& operation = mModel->operations[index];
+    // Opt-in per-operation profiling, see xt_op_profiler.h
+    xt_op_prof_record_t profRecord;
+    const bool profiling = xt_op_prof_is_enabled();
+    uint32_t bytesRead = 0;
+    if (profiling) {
+        {
+            // Shapes of mOperands change as other threads of runParallel()
+            // run; the profiler has its own lock.
+#ifdef NNLIB_PTHREADS
+            std::unique_lock<std::mutex> lock;
+            if (mOperandsMutex != nullptr) {
+                lock = std::unique_lock<std::mutex>(*mOperandsMutex);
+            }
+#endif
+            bytesRead = operandListBytes(mOperands, operation.inputs);
+        }
+        xt_op_prof_begin(&profRecord, index, static_cast<int>(operation.type),
+                         getOperationName(operation.type));
+    }
+    int n = executeOperation(operation, index, scratch);
+    if (profiling) {
+        uint32_t bytesWritten;
+        uint64_t macs;
+        {
+#ifdef NNLIB_PTHREADS
+            std::unique_lock<std::mutex> lock;
+            if (mOperandsMutex != nullptr) {
+                lock = std::unique_lock<std::mutex>(*mOperandsMutex);
+            }
+#endif
+            bytesWritten = operandListBytes(mOperands, operation.outputs);
+            macs = estimateMacs(mOperands, operation);
+        }
+        xt_op_prof_end(&profRecord, bytesRead, bytesWritten, macs);
+    }
+    return n;
+}
+
+bool CpuExecutor::sUsePreparedModel = true;
+
+void CpuExecutor::setUsePreparedModel(bool use) {
+    sUsePreparedModel = use;
+}
+
+void setCpuExecutorUsePreparedModel(bool use) {
+    CpuExecutor::setUsePreparedModel(use);
+}
+
+#ifdef NNLIB_PTHREADS
+int CpuExecutor::sNumThreads = 1;
+CpuExecutor::WorkerPool CpuExecutor::sWorkerPool;
+
+CpuExecutor::WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        mStop = true;
+    }
+    mWake.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+void CpuExecutor::WorkerPool::post(std::function<void()> task, int minThreads) {
+    std::lock_guard<std::mutex> guard(mMutex);
+    while (static_cast<int>(mThreads.size()) < minThreads) {
+        mThreads.emplace_back(&WorkerPool::loop, this);
+    }
+    mTasks.push_back(std::move(task));
+    mWake.notify_one();
+}
+
+void CpuExecutor::WorkerPool::loop() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        while (!mStop && mTasks.empty()) {
+            mWake.wait(lock);
+        }
+        if (mTasks.empty()) {
+            return;
+        }
+        std::function<void()> task = std::move(mTasks.front());
+        mTasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+void CpuExecutor::setNumThreads(int numThreads) {
+    sNumThreads = std::max(numThreads, 1);
+}
+
+void setCpuExecutorNumThreads(int numThreads) {
+    CpuExecutor::setNumThreads(numThreads);
+}
+
+// An operation is ready once every operation producing one of its inputs has
+// finished. A worker takes the operation it made ready last from its own
+// queue, so a consumer tends to run on the thread that just wrote its input,
+// and steals the oldest operation of another worker when its queue is empty.
+// All the bookkeeping is done under one mutex, the operations themselves run
+// outside of it. The calling thread is worker 0, sWorkerPool runs the others;
+// worker 0 can finish the run alone when the pool is busy with another one.
+int CpuExecutor::runParallel(int numThreads) {
+    const size_t count = mModel->operations.size();
+    const uint32_t kNoOperation = UINT32_MAX;
+    std::vector<uint32_t> producer(mOperands.size(), kNoOperation);
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t out : mModel->operations[i].outputs) {
+            producer[out] = i;
+        }
+    }
+    std::vector<std::vector<uint32_t>> consumers(count);
+    std::vector<uint32_t> pending(count, 0);
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t in : mModel->operations[i].inputs) {
+            if (producer[in] != kNoOperation) {
+                consumers[producer[in]].push_back(i);
+                pending[i]++;
+            }
+        }
+    }
+
+    std::vector<std::deque<uint32_t>> queues(numThreads);
+    int nextQueue = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (pending[i] == 0) {
+            queues[nextQueue].push_back(i);
+            nextQueue = (nextQueue + 1) % numThreads;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    size_t remaining = count;
+    int result = ANEURALNETWORKS_NO_ERROR;
+    mOperandsMutex = &mutex;
+
+    auto worker = [&](int self) {
+        // The first worker uses the scratch of the execution buffers
+        std::vector<uint8_t> ownScratch;
+        void* scratch = mBuffers != nullptr ? mBuffers->scratch.data() : nullptr;
+        if (self != 0 && mPreparedModel != nullptr) {
+            ownScratch.resize(mPreparedModel->getScratchSize());
+            scratch = ownScratch.data();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        while (remaining != 0 && result == ANEURALNETWORKS_NO_ERROR) {
+            uint32_t index = kNoOperation;
+            if (!queues[self].empty()) {
+                index = queues[self].back();
+                queues[self].pop_back();
+            } else {
+                for (int k = 1; k < numThreads; k++) {
+                    std::deque<uint32_t>& victim = queues[(self + k) % numThreads];
+                    if (!victim.empty()) {
+                        index = victim.front();
+                        victim.pop_front();
+                        break;
+                    }
+                }
+            }
+            if (index == kNoOperation) {
+                wake.wait(lock);
+                continue;
+            }
+
+            lock.unlock();
+            int n = runOperation(index, scratch);
+            lock.lock();
+
+            if (n != ANEURALNETWORKS_NO_ERROR) {
+                if (result == ANEURALNETWORKS_NO_ERROR) {
+                    result = n;
+                }
+                wake.notify_all();
+                break;
+            }
+            remaining--;
+            bool madeReady = false;
+            for (uint32_t consumer : consumers[index]) {
+                if (--pending[consumer] == 0) {
+                    queues[self].push_back(consumer);
+                    madeReady = true;
+                }
+            }
+            if (madeReady || remaining == 0) {
+                wake.notify_all();
+            }
+        }
+    };
+
+    int helpers = numThreads - 1;
+    for (int t = 1; t < numThreads; t++) {
+        sWorkerPool.post([&, t] {
+            worker(t);
+            std::lock_guard<std::mutex> guard(mutex);
+            if (--helpers == 0) {
+                wake.notify_all();
+            }
+        }, numThreads - 1);
+    }
+    worker(0);
+    {
+        // The helpers use the locals of this call until they are done
+        std::unique_lock<std::mutex> lock(mutex);
+        while (helpers != 0) {
+            wake.wait(lock);
+        }
+    }
+    mOperandsMutex = nullptr;
+    return result;
+}
+#endif
+
+void CpuExecutor::releaseBuffers() {
+    if (mBuffers != nullptr) {
+        mPreparedModel->releaseBuffers(mBuffers);
+        mBuffers = nullptr;
+    }
+}
+
 bool CpuExecutor::initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& modelPoolInfos,
                                         const std::vector<RunTimePoolInfo>& requestPoolInfos) {
 #ifndef HIFI_BUILD
@@ -315,6 +644,11 @@ bool CpuExecutor::initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& mode
             case OperandLifeTime::TEMPORARY_VARIABLE:
                 to.buffer = nullptr;
                 to.numberOfUsesLeft = from.numberOfConsumers;
+                // Planned temporaries start out in their arena slot
+                if (mBuffers != nullptr && mSequential && mPreparedModel->getArenaLength(i) != 0) {
+                    to.buffer = mBuffers->arena + mPreparedModel->getArenaOffset(i);
+                    to.length = mPreparedModel->getArenaLength(i);
+                }
                 break;
             case OperandLifeTime::CONSTANT_COPY:
                 to.buffer = const_cast<uint8_t*>(&mModel->operandValues[from.location.offset]);
@@ -375,6 +709,12 @@ bool CpuExecutor::initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& mode
 }
 
 void CpuExecutor::freeNoLongerUsedOperands(const std::vector<uint32_t>& inputs) {
+#ifdef NNLIB_PTHREADS
+    std::unique_lock<std::mutex> lock;
+    if (mOperandsMutex != nullptr) {
+        lock = std::unique_lock<std::mutex>(*mOperandsMutex);
+    }
+#endif
     for (uint32_t i : inputs) {
         auto& info = mOperands[i];
         // Check if it's a static or model input/output.
@@ -384,7 +724,9 @@ void CpuExecutor::freeNoLongerUsedOperands(const std::vector<uint32_t>& inputs)
         info.numberOfUsesLeft--;
         if (info.numberOfUsesLeft == 0) {
             nnAssert(info.buffer != nullptr);
-            delete[] info.buffer;
+            if (mPreparedModel == nullptr || !mPreparedModel->isArenaBuffer(mBuffers, info.buffer)) {
+                delete[] info.buffer;
+            }
             info.buffer = nullptr;
         }
     }
@@ -429,7 +771,424 @@ static void pad_shape(const RunTimeOperandInfo& input, RunTimeOperandInfo& outpu
 }
 #endif
 
-int CpuExecutor::executeOperation(const Operation& operation) {
+// Reads the scalar parameters of CONV_2D (10 or 7 inputs) and
+// DEPTHWISE_CONV_2D (11 or 8 inputs), implicit padding is turned into
+// explicit padding.
+static void readConvParameters(const Operation& operation,
+                               const std::vector<RunTimeOperandInfo>& operands,
+                               ConvParameters* params) {
+    const hidl_vec<uint32_t>& ins = operation.inputs;
+    // DEPTHWISE_CONV_2D has the depth multiplier between strides and activation
+    const size_t extra = operation.type == OperationType::DEPTHWISE_CONV_2D ? 1 : 0;
+
+    params->depth_multiplier = 1;
+    if (ins.size() == 10 + extra) {
+        params->padding_left     = getScalarData<int32_t>(operands[ins[3]]);
+        params->padding_right    = getScalarData<int32_t>(operands[ins[4]]);
+        params->padding_top      = getScalarData<int32_t>(operands[ins[5]]);
+        params->padding_bottom   = getScalarData<int32_t>(operands[ins[6]]);
+        params->stride_width     = getScalarData<int32_t>(operands[ins[7]]);
+        params->stride_height    = getScalarData<int32_t>(operands[ins[8]]);
+        if (extra) {
+            params->depth_multiplier = getScalarData<int32_t>(operands[ins[9]]);
+        }
+        params->activation       = getScalarData<int32_t>(operands[ins[9 + extra]]);
+    } else {
+        int32_t padding_implicit = getScalarData<int32_t>(operands[ins[3]]);
+        params->stride_width     = getScalarData<int32_t>(operands[ins[4]]);
+        params->stride_height    = getScalarData<int32_t>(operands[ins[5]]);
+        if (extra) {
+            params->depth_multiplier = getScalarData<int32_t>(operands[ins[6]]);
+        }
+        params->activation       = getScalarData<int32_t>(operands[ins[6 + extra]]);
+
+        Shape inputShape = operands[ins[0]].shape();
+        Shape filterShape = operands[ins[1]].shape();
+        int32_t input_width  = getSizeOfDimension(inputShape, 2);
+        int32_t input_height = getSizeOfDimension(inputShape, 1);
+        int32_t filter_width  = getSizeOfDimension(filterShape, 2);
+        int32_t filter_height = getSizeOfDimension(filterShape, 1);
+        calculateExplicitPadding(input_width, params->stride_width,
+                                 filter_width, padding_implicit,
+                                 &params->padding_left, &params->padding_right);
+        calculateExplicitPadding(input_height, params->stride_height,
+                                 filter_height, padding_implicit,
+                                 &params->padding_top, &params->padding_bottom);
+    }
+}
+
+#ifdef HIFI_BUILD
+// Entry of the weight container holding the value of operand, nullptr when
+// the value is not in one.
+static const xt_wc_entry_t* getWeightContainerEntry(const Operand& operand,
+                                                    const std::vector<RunTimePoolInfo>& modelPoolInfos) {
+    if (operand.lifetime != OperandLifeTime::CONSTANT_REFERENCE ||
+            operand.location.poolIndex >= modelPoolInfos.size()) {
+        return nullptr;
+    }
+    const xt_wc_t* container = modelPoolInfos[operand.location.poolIndex].getWeightContainer();
+    return container != nullptr ? xt_wc_find_offset(container, operand.location.offset) : nullptr;
+}
+#endif //HIFI_BUILD
+
+#ifdef HIFI_NNLIB_OPT
+// Depth the nnlib convolution kernels want their filter padded to
+static uint32_t getPaddedFilterDepth(OperandType type, uint32_t depth) {
+    return type == OperandType::TENSOR_FLOAT32 ? ((depth+1)&(~1)) : ((depth+3)&(~3));
+}
+
+// Whether the filter operand's value sits in a weight container laid out the
+// way the kernels read it, so it can be passed to them in place.
+static bool isPrePaddedFilter(const Operand& operand, const RunTimeOperandInfo& filter,
+                              const std::vector<RunTimePoolInfo>& modelPoolInfos,
+                              uint32_t paddedDepth) {
+    const xt_wc_entry_t* entry = getWeightContainerEntry(operand, modelPoolInfos);
+    if (entry == nullptr || entry->num_dims != 4 || entry->padded_depth != paddedDepth ||
+            filter.dimensions.size() != 4) {
+        return false;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        if (entry->dims[i] != filter.dimensions[i]) {
+            return false;
+        }
+    }
+    // Padding has to be neutral for the kernels
+    return filter.type != OperandType::TENSOR_QUANT8_ASYMM || entry->zero_point == filter.zeroPoint;
+}
+
+bool CpuExecutor::isPrePaddedFilter(uint32_t operand, const Shape& paddedShape) const {
+    return mModelPoolInfos != nullptr &&
+           ::android::nn::isPrePaddedFilter(mModel->operands[operand], mOperands[operand],
+                                            *mModelPoolInfos, paddedShape.dimensions[3]);
+}
+#endif
+
+#ifdef HIFI_NNLIB_OPT
+// Does the per-run setup of a CONV_2D or DEPTHWISE_CONV_2D whose filter, bias
+// and parameters are constants of the model. Returns false when the operation
+// has to be set up at run time instead.
+static bool prepareConvolution(const Operation& operation,
+                               const std::vector<RunTimeOperandInfo>& operands,
+                               bool filterPrePadded,
+                               CpuPreparedOperation* prepared) {
+    const hidl_vec<uint32_t>& ins = operation.inputs;
+    const bool depthwise = operation.type == OperationType::DEPTHWISE_CONV_2D;
+    const size_t inCount = ins.size();
+    if (depthwise ? (inCount != 11 && inCount != 8) : (inCount != 10 && inCount != 7)) {
+        return false;
+    }
+    for (size_t i = 1; i < inCount; i++) {
+        if (operands[ins[i]].buffer == nullptr) {
+            return false;
+        }
+    }
+    const RunTimeOperandInfo& input  = operands[ins[0]];
+    const RunTimeOperandInfo& filter = operands[ins[1]];
+    const RunTimeOperandInfo& bias   = operands[ins[2]];
+    if (input.type != OperandType::TENSOR_FLOAT32 &&
+            input.type != OperandType::TENSOR_QUANT8_ASYMM) {
+        return false;
+    }
+    if (input.dimensions.size() != 4) {
+        return false;
+    }
+    for (uint32_t d : input.dimensions) {
+        if (d == 0) {
+            return false;
+        }
+    }
+
+    ConvParameters& params = prepared->conv;
+    readConvParameters(operation, operands, &params);
+
+    Shape outShape = operands[operation.outputs[0]].shape();
+    int32_t scratch_size;
+    bool success = depthwise ?
+            depthwiseConvPrepare(input.shape(), filter.shape(), bias.shape(),
+                                 params.padding_left, params.padding_right,
+                                 params.padding_top, params.padding_bottom,
+                                 params.stride_width, params.stride_height,
+                                 &outShape, scratch_size) :
+            convPrepare(input.shape(), filter.shape(), bias.shape(),
+                        params.padding_left, params.padding_right,
+                        params.padding_top, params.padding_bottom,
+                        params.stride_width, params.stride_height,
+                        &outShape, scratch_size);
+    if (!success) {
+        return false;
+    }
+
+    Shape filterShapePadded = filter.shape();
+    filterShapePadded.dimensions[3] = getPaddedFilterDepth(input.type, filterShapePadded.dimensions[3]);
+    if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
+        if (!GetQuant8ConvParams(input.shape(), filter.shape(), bias.shape(), outShape,
+                                 params.activation, &prepared->quant8)) {
+            return false;
+        }
+    }
+    if (filterPrePadded) {
+        prepared->filterMapped = filter.buffer;
+    } else {
+        prepared->filterPadded.resize(sizeOfData(filter.type, filterShapePadded.dimensions));
+        RunTimeOperandInfo filter_padded = filter;
+        filter_padded.dimensions = filterShapePadded.dimensions;
+        filter_padded.buffer = prepared->filterPadded.data();
+        pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+    }
+
+    prepared->inputDimensions = input.dimensions;
+    prepared->outShape = outShape;
+    prepared->scratchSize = scratch_size;
+    return true;
+}
+#endif
+
+constexpr size_t CpuPreparedModel::kMaxExecutionsInFlight;
+
+int CpuPreparedModel::prepare(const Model& model,
+                              const std::vector<RunTimePoolInfo>& modelPoolInfos) {
+#ifdef HIFI_BUILD
+    // Weight container entries stored with a padded depth are only readable
+    // as the filter of the convolutions, which take them padded that way.
+    for (const Operation& operation : model.operations) {
+        for (size_t i = 0; i < operation.inputs.size(); i++) {
+            const Operand& operand = model.operands[operation.inputs[i]];
+            const xt_wc_entry_t* entry = getWeightContainerEntry(operand, modelPoolInfos);
+            if (entry == nullptr || entry->padded_depth == entry->dims[entry->num_dims - 1]) {
+                continue;
+            }
+#ifdef HIFI_NNLIB_OPT
+            if (i == 1 && entry->num_dims == 4 &&
+                    (operation.type == OperationType::CONV_2D ||
+                     operation.type == OperationType::DEPTHWISE_CONV_2D) &&
+                    entry->padded_depth == getPaddedFilterDepth(operand.type, entry->dims[3])) {
+                continue;
+            }
+#endif
+            return ANEURALNETWORKS_BAD_DATA;
+        }
+    }
+#endif //HIFI_BUILD
+#ifdef HIFI_NNLIB_OPT
+    std::vector<RunTimeOperandInfo> operands(model.operands.size());
+    for (size_t i = 0; i < model.operands.size(); i++) {
+        const Operand& from = model.operands[i];
+        RunTimeOperandInfo& to = operands[i];
+        to.type = from.type;
+        to.dimensions = from.dimensions;
+        to.scale = from.scale;
+        to.zeroPoint = from.zeroPoint;
+        to.length = from.location.length;
+        to.lifetime = from.lifetime;
+        to.numberOfUsesLeft = 0;
+        to.buffer = nullptr;
+        if (from.lifetime == OperandLifeTime::CONSTANT_COPY) {
+            to.buffer = const_cast<uint8_t*>(&model.operandValues[from.location.offset]);
+        } else if (from.lifetime == OperandLifeTime::CONSTANT_REFERENCE &&
+                from.location.poolIndex < modelPoolInfos.size()) {
+            to.buffer = modelPoolInfos[from.location.poolIndex].getBuffer() + from.location.offset;
+        }
+    }
+
+    const size_t count = model.operations.size();
+    mOperations.assign(count, CpuPreparedOperation());
+    mPrepared.assign(count, false);
+    int32_t scratchSize = 0;
+    for (size_t i = 0; i < count; i++) {
+        const Operation& operation = model.operations[i];
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+        // Float LSTMs with constant weights run their gates on int8 copies
+        if (operation.type == OperationType::LSTM) {
+            mPrepared[i] = LSTMCell::PrepareHybrid(operation, operands,
+                                                   &mOperations[i].lstmHybrid,
+                                                   &mOperations[i].scratchSize);
+            if (mPrepared[i]) {
+                scratchSize = std::max(scratchSize, mOperations[i].scratchSize);
+            } else {
+                mOperations[i] = CpuPreparedOperation();
+            }
+            continue;
+        }
+#endif
+        if (operation.type != OperationType::CONV_2D &&
+                operation.type != OperationType::DEPTHWISE_CONV_2D) {
+            continue;
+        }
+        const uint32_t filter = operation.inputs.size() > 1 ? operation.inputs[1] : 0;
+        const bool filterPrePadded = operation.inputs.size() > 1 &&
+                operands[filter].dimensions.size() == 4 &&
+                isPrePaddedFilter(model.operands[filter], operands[filter], modelPoolInfos,
+                                  getPaddedFilterDepth(operands[filter].type,
+                                                       operands[filter].dimensions[3]));
+        if (prepareConvolution(operation, operands, filterPrePadded, &mOperations[i])) {
+            mPrepared[i] = true;
+            scratchSize = std::max(scratchSize, mOperations[i].scratchSize);
+        } else {
+            mOperations[i] = CpuPreparedOperation();
+        }
+    }
+    mScratchSize = scratchSize;
+#endif
+    planTemporaries(model);
+    return ANEURALNETWORKS_NO_ERROR;
+}
+
+#define ARENA_ALIGN(x) (((x) + 7) & ~static_cast<size_t>(7))
+
+// Temporaries are alive from the operation producing them to their last
+// consumer. They are placed from the largest down, each at the lowest offset
+// that does not overlap a placed temporary alive at the same time.
+void CpuPreparedModel::planTemporaries(const Model& model) {
+    const size_t operandCount = model.operands.size();
+    const uint32_t kNoOperation = UINT32_MAX;
+    std::vector<uint32_t> producer(operandCount, kNoOperation);
+    std::vector<uint32_t> lastUse(operandCount, 0);
+    for (uint32_t i = 0; i < model.operations.size(); i++) {
+        const Operation& operation = model.operations[i];
+        for (uint32_t in : operation.inputs) {
+            lastUse[in] = std::max(lastUse[in], i);
+        }
+        for (uint32_t out : operation.outputs) {
+            producer[out] = i;
+        }
+    }
+
+    struct Temporary {
+        uint32_t operand;
+        uint32_t first, last;
+        uint32_t length;
+    };
+    std::vector<Temporary> temporaries;
+    for (uint32_t i = 0; i < operandCount; i++) {
+        const Operand& operand = model.operands[i];
+        if (operand.lifetime != OperandLifeTime::TEMPORARY_VARIABLE ||
+                producer[i] == kNoOperation) {
+            continue;
+        }
+        const std::vector<uint32_t>* dimensions = &operand.dimensions;
+#ifdef HIFI_NNLIB_OPT
+        // Prepared convolutions know their output shape even when the
+        // model leaves it unspecified
+        const CpuPreparedOperation* prepared = getOperation(producer[i]);
+        if (prepared != nullptr && !prepared->outShape.dimensions.empty()) {
+            dimensions = &prepared->outShape.dimensions;
+        }
+#endif
+        if (dimensions->empty() ||
+                std::find(dimensions->begin(), dimensions->end(), 0) != dimensions->end()) {
+            continue;
+        }
+        const uint32_t length = sizeOfData(operand.type, *dimensions);
+        temporaries.push_back({i, producer[i], std::max(lastUse[i], producer[i]), length});
+    }
+    std::stable_sort(temporaries.begin(), temporaries.end(),
+                     [](const Temporary& a, const Temporary& b) { return a.length > b.length; });
+
+    mArenaSlots.assign(operandCount, ArenaSlot{0, 0});
+    size_t arenaSize = 0;
+    std::vector<std::pair<size_t, size_t>> busy;
+    for (size_t t = 0; t < temporaries.size(); t++) {
+        const Temporary& temporary = temporaries[t];
+        busy.clear();
+        for (size_t p = 0; p < t; p++) {
+            const Temporary& placed = temporaries[p];
+            if (placed.first <= temporary.last && temporary.first <= placed.last) {
+                const ArenaSlot& slot = mArenaSlots[placed.operand];
+                busy.emplace_back(slot.offset, slot.offset + slot.length);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+        size_t offset = 0;
+        for (const auto& range : busy) {
+            if (offset + temporary.length <= range.first) {
+                break;
+            }
+            offset = std::max(offset, ARENA_ALIGN(range.second));
+        }
+        mArenaSlots[temporary.operand] = ArenaSlot{static_cast<uint32_t>(offset), temporary.length};
+        arenaSize = std::max(arenaSize, offset + temporary.length);
+    }
+
+    mArenaSize = ARENA_ALIGN(arenaSize);
+    // The first execution's buffers are allocated now so that a model that is
+    // never run concurrently does not allocate while executing.
+    mExternalArena = nullptr;
+    mExternalArenaCount = 0;
+    mBuffers.clear();
+    addBuffers();
+}
+
+CpuPreparedModel::ExecutionBuffers* CpuPreparedModel::addBuffers() const {
+    std::unique_ptr<ExecutionBuffers> buffers(new ExecutionBuffers());
+    if (mExternalArena != nullptr) {
+        buffers->arena = mExternalArena + mBuffers.size() * mArenaSize;
+    } else {
+        buffers->arenaStorage.assign(mArenaSize / sizeof(uint64_t), 0);
+        buffers->arena = reinterpret_cast<uint8_t*>(buffers->arenaStorage.data());
+    }
+    buffers->scratch.assign(mScratchSize, 0);
+    mBuffers.push_back(std::move(buffers));
+    return mBuffers.back().get();
+}
+
+int CpuPreparedModel::setArena(void* buffer, size_t size) {
+    if (buffer != nullptr &&
+            (size < mArenaSize || (reinterpret_cast<uintptr_t>(buffer) & 7) != 0)) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    mExternalArena = static_cast<uint8_t*>(buffer);
+    if (buffer == nullptr) {
+        mExternalArenaCount = 0;
+    } else if (mArenaSize == 0) {
+        mExternalArenaCount = kMaxExecutionsInFlight;
+    } else {
+        mExternalArenaCount = std::min(size / mArenaSize, kMaxExecutionsInFlight);
+    }
+    mBuffers.clear();
+    addBuffers();
+    return ANEURALNETWORKS_NO_ERROR;
+}
+
+CpuPreparedModel::ExecutionBuffers* CpuPreparedModel::acquireBuffers() const {
+#ifdef NNLIB_PTHREADS
+    std::unique_lock<std::mutex> lock(mBuffersMutex);
+#endif
+    const size_t limit = mExternalArena != nullptr ? mExternalArenaCount : kMaxExecutionsInFlight;
+    while (true) {
+        for (auto& buffers : mBuffers) {
+            if (!buffers->busy) {
+                buffers->busy = true;
+                return buffers.get();
+            }
+        }
+        if (mBuffers.size() < limit) {
+            ExecutionBuffers* buffers = addBuffers();
+            buffers->busy = true;
+            return buffers;
+        }
+#ifdef NNLIB_PTHREADS
+        mBuffersReleased.wait(lock);
+#else
+        // Without threads an execution finishes before the next one starts
+        nnAssert(!"CpuPreparedModel::acquireBuffers -- all buffers busy");
+        return nullptr;
+#endif
+    }
+}
+
+void CpuPreparedModel::releaseBuffers(ExecutionBuffers* buffers) const {
+    {
+#ifdef NNLIB_PTHREADS
+        std::lock_guard<std::mutex> lock(mBuffersMutex);
+#endif
+        buffers->busy = false;
+    }
+#ifdef NNLIB_PTHREADS
+    mBuffersReleased.notify_one();
+#endif
+}
+
+int CpuExecutor::executeOperation(const Operation& operation, size_t index, void* scratch) {
     // VLOG(CPUEXE) << "CpuExecutor::executeOperation(" << toString(operation) << ")";
     const hidl_vec<uint32_t>& ins = operation.inputs;
     const hidl_vec<uint32_t>& outs = operation.outputs;
@@ -596,52 +1355,77 @@ int CpuExecutor::executeOperation(const Operation& operation) {
             }
             const RunTimeOperandInfo& input  = mOperands[ins[0]];
             const RunTimeOperandInfo& filter = mOperands[ins[1]];
-#ifdef HIFI_NNLIB_OPT
-            RunTimeOperandInfo filter_padded = mOperands[ins[1]];
-            filter_padded.buffer = NULL;
-            filter_padded.lifetime = OperandLifeTime::TEMPORARY_VARIABLE;
-#endif
             const RunTimeOperandInfo& bias   = mOperands[ins[2]];
 
-            int32_t padding_left, padding_right;
-            int32_t padding_top, padding_bottom;
-            int32_t stride_width, stride_height;
-            int32_t depth_multiplier;
-            int32_t activation;
-
-            if (inCount == 11) {
-                padding_left     = getScalarData<int32_t>(mOperands[ins[3]]);
-                padding_right    = getScalarData<int32_t>(mOperands[ins[4]]);
-                padding_top      = getScalarData<int32_t>(mOperands[ins[5]]);
-                padding_bottom   = getScalarData<int32_t>(mOperands[ins[6]]);
-                stride_width     = getScalarData<int32_t>(mOperands[ins[7]]);
-                stride_height    = getScalarData<int32_t>(mOperands[ins[8]]);
-                depth_multiplier = getScalarData<int32_t>(mOperands[ins[9]]);
-                activation       = getScalarData<int32_t>(mOperands[ins[10]]);
-            } else {
-                int32_t padding_implicit = getScalarData<int32_t>(mOperands[ins[3]]);
-                stride_width     = getScalarData<int32_t>(mOperands[ins[4]]);
-                stride_height    = getScalarData<int32_t>(mOperands[ins[5]]);
-                depth_multiplier = getScalarData<int32_t>(mOperands[ins[6]]);
-                activation       = getScalarData<int32_t>(mOperands[ins[7]]);
-
-                Shape inputShape = input.shape();
-                Shape filterShape = filter.shape();
-                int32_t input_width  = getSizeOfDimension(inputShape, 2);
-                int32_t input_height = getSizeOfDimension(inputShape, 1);
-                int32_t filter_width  = getSizeOfDimension(filterShape, 2);
-                int32_t filter_height = getSizeOfDimension(filterShape, 1);
-                calculateExplicitPadding(input_width, stride_width,
-                                         filter_width, padding_implicit,
-                                         &padding_left, &padding_right);
-                calculateExplicitPadding(input_height, stride_height,
-                                         filter_height, padding_implicit,
-                                         &padding_top, &padding_bottom);
+            ConvParameters params;
+#ifdef HIFI_NNLIB_OPT
+            const CpuPreparedOperation* prepared =
+                    mPreparedModel != nullptr ? mPreparedModel->getOperation(index) : nullptr;
+            const bool usePrepared =
+                    prepared != nullptr && prepared->inputDimensions == input.dimensions;
+            if (usePrepared) {
+                params = prepared->conv;
+            } else
+#endif
+            {
+                readConvParameters(operation, mOperands, &params);
             }
+            int32_t padding_left     = params.padding_left;
+            int32_t padding_right    = params.padding_right;
+            int32_t padding_top      = params.padding_top;
+            int32_t padding_bottom   = params.padding_bottom;
+            int32_t stride_width     = params.stride_width;
+            int32_t stride_height    = params.stride_height;
+            int32_t depth_multiplier = params.depth_multiplier;
+            int32_t activation       = params.activation;
 
             RunTimeOperandInfo& output = mOperands[outs[0]];
             Shape outShape = output.shape();
 #ifdef HIFI_NNLIB_OPT
+            if (usePrepared) {
+                // Parameters, filter padding, output shape and requantization
+                // were done when the model was prepared.
+                void *p_scratch = scratch;
+                outShape = prepared->outShape;
+                success = setInfoAndAllocateIfNeeded(&output, outShape);
+                if (input.type == OperandType::TENSOR_FLOAT32) {
+                    PROFILER_START("DEPTHWISE_CONV_2D float32");
+                    if(success) success =
+                              depthwiseConvFloat32(reinterpret_cast<const float*>(input.buffer),
+                                                   input.shape(),
+                                                   reinterpret_cast<const float*>(prepared->getFilter()),
+                                                   filter.shape(),
+                                                   reinterpret_cast<const float*>(bias.buffer),
+                                                   bias.shape(),
+                                                   padding_left, padding_right,
+                                                   padding_top, padding_bottom,
+                                                   stride_width, stride_height,
+                                                   depth_multiplier, activation,
+                                                   reinterpret_cast<float*>(output.buffer),
+                                                   outShape, p_scratch);
+                    PROFILER_STOP;
+                } else {
+                    PROFILER_START("DEPTHWISE_CONV_2D aym8");
+                    if(success) success =
+                              depthwiseConvQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
+                                                  input.shape(),
+                                                  prepared->getFilter(),
+                                                  filter.shape(),
+                                                  reinterpret_cast<const int32_t*>(bias.buffer),
+                                                  bias.shape(),
+                                                  padding_left, padding_right,
+                                                  padding_top, padding_bottom,
+                                                  stride_width, stride_height,
+                                                  depth_multiplier, activation,
+                                                  reinterpret_cast<uint8_t*>(output.buffer),
+                                                  outShape, p_scratch, &prepared->quant8);
+                    PROFILER_STOP;
+                }
+                break;
+            }
+            RunTimeOperandInfo filter_padded = filter;
+            filter_padded.buffer = NULL;
+            filter_padded.lifetime = OperandLifeTime::TEMPORARY_VARIABLE;
             Shape filterShapePadded = filter.shape();
 #endif
 
@@ -662,7 +1446,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 filter_padded.dimensions = filterShapePadded.dimensions;
                 filter_padded.scale =filterShapePadded.scale;
                 filter_padded.zeroPoint = filterShapePadded.offset;
-                filter_padded.buffer = (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
+                // Filters stored padded in a weight container are used in place
+                filter_padded.buffer = isPrePaddedFilter(ins[1], filterShapePadded) ? filter.buffer :
+                        (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
 #endif
 #ifndef HIFI_NNLIB_OPT
                 PROFILER_START("DEPTHWISE_CONV_2D float32");
@@ -682,7 +1468,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                                outShape);
                 PROFILER_STOP;
 #else
-                pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                if (filter_padded.buffer != filter.buffer) {
+                    pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                }
                 printf("Scratch %d \n", scratch_size);
                 void *p_scratch = malloc(scratch_size);
                 PROFILER_START("DEPTHWISE_CONV_2D float32");
@@ -701,7 +1489,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                                reinterpret_cast<float*>(output.buffer),
                                                outShape, p_scratch);
                 PROFILER_STOP;
-                free(filter_padded.buffer);
+                if (filter_padded.buffer != filter.buffer) {
+                    free(filter_padded.buffer);
+                }
                 free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
@@ -724,7 +1514,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 filter_padded.dimensions = filterShapePadded.dimensions;
                 filter_padded.scale =filterShapePadded.scale;
                 filter_padded.zeroPoint = filterShapePadded.offset;
-                filter_padded.buffer = (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
+                // Filters stored padded in a weight container are used in place
+                filter_padded.buffer = isPrePaddedFilter(ins[1], filterShapePadded) ? filter.buffer :
+                        (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
 #endif
 #ifndef HIFI_NNLIB_OPT
                 PROFILER_START("DEPTHWISE_CONV_2D aym8");
@@ -743,7 +1535,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                               outShape);
                 PROFILER_STOP;
 #else
-                pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                if (filter_padded.buffer != filter.buffer) {
+                    pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                }
                 printf("Scratch %d \n", scratch_size);
                 void *p_scratch = malloc(scratch_size);
                 PROFILER_START("DEPTHWISE_CONV_2D aym8");
@@ -761,7 +1555,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                               reinterpret_cast<uint8_t*>(output.buffer),
                                               outShape, p_scratch);
                 PROFILER_STOP;
-                free(filter_padded.buffer);
+                if (filter_padded.buffer != filter.buffer) {
+                    free(filter_padded.buffer);
+                }
                 free(p_scratch);
 #endif
             }
@@ -775,49 +1571,70 @@ int CpuExecutor::executeOperation(const Operation& operation) {
             }
             const RunTimeOperandInfo& input  = mOperands[ins[0]];
             const RunTimeOperandInfo& filter = mOperands[ins[1]];
-#ifdef HIFI_NNLIB_OPT
-            RunTimeOperandInfo filter_padded = mOperands[ins[1]];
-            filter_padded.buffer = NULL;
-            filter_padded.lifetime = OperandLifeTime::TEMPORARY_VARIABLE;
-#endif
             const RunTimeOperandInfo& bias   = mOperands[ins[2]];
 
-            int32_t padding_left, padding_right;
-            int32_t padding_top, padding_bottom;
-            int32_t stride_width, stride_height;
-            int32_t activation;
-
-            if (inCount == 10) {
-                padding_left     = getScalarData<int32_t>(mOperands[ins[3]]);
-                padding_right    = getScalarData<int32_t>(mOperands[ins[4]]);
-                padding_top      = getScalarData<int32_t>(mOperands[ins[5]]);
-                padding_bottom   = getScalarData<int32_t>(mOperands[ins[6]]);
-                stride_width     = getScalarData<int32_t>(mOperands[ins[7]]);
-                stride_height    = getScalarData<int32_t>(mOperands[ins[8]]);
-                activation       = getScalarData<int32_t>(mOperands[ins[9]]);
-            } else {
-                int32_t padding_implicit = getScalarData<int32_t>(mOperands[ins[3]]);
-                stride_width     = getScalarData<int32_t>(mOperands[ins[4]]);
-                stride_height    = getScalarData<int32_t>(mOperands[ins[5]]);
-                activation       = getScalarData<int32_t>(mOperands[ins[6]]);
-
-                Shape inputShape = input.shape();
-                Shape filterShape = filter.shape();
-                int32_t input_width  = getSizeOfDimension(inputShape, 2);
-                int32_t input_height = getSizeOfDimension(inputShape, 1);
-                int32_t filter_width  = getSizeOfDimension(filterShape, 2);
-                int32_t filter_height = getSizeOfDimension(filterShape, 1);
-                calculateExplicitPadding(input_width, stride_width,
-                                         filter_width, padding_implicit,
-                                         &padding_left, &padding_right);
-                calculateExplicitPadding(input_height, stride_height,
-                                         filter_height, padding_implicit,
-                                         &padding_top, &padding_bottom);
+            ConvParameters params;
+#ifdef HIFI_NNLIB_OPT
+            const CpuPreparedOperation* prepared =
+                    mPreparedModel != nullptr ? mPreparedModel->getOperation(index) : nullptr;
+            const bool usePrepared =
+                    prepared != nullptr && prepared->inputDimensions == input.dimensions;
+            if (usePrepared) {
+                params = prepared->conv;
+            } else
+#endif
+            {
+                readConvParameters(operation, mOperands, &params);
             }
+            int32_t padding_left     = params.padding_left;
+            int32_t padding_right    = params.padding_right;
+            int32_t padding_top      = params.padding_top;
+            int32_t padding_bottom   = params.padding_bottom;
+            int32_t stride_width     = params.stride_width;
+            int32_t stride_height    = params.stride_height;
+            int32_t activation       = params.activation;
 
             RunTimeOperandInfo& output = mOperands[outs[0]];
             Shape outShape = output.shape();
 #ifdef HIFI_NNLIB_OPT
+            if (usePrepared) {
+                // Parameters, filter padding, output shape and requantization
+                // were done when the model was prepared.
+                void *p_scratch = scratch;
+                outShape = prepared->outShape;
+                success = setInfoAndAllocateIfNeeded(&output, outShape);
+                if (input.type == OperandType::TENSOR_FLOAT32) {
+                    PROFILER_START("CONV_2D float32");
+                    if(success) success =
+                              convFloat32(reinterpret_cast<const float*>(input.buffer), input.shape(),
+                                          reinterpret_cast<const float*>(prepared->getFilter()), filter.shape(),
+                                          reinterpret_cast<const float*>(bias.buffer), bias.shape(),
+                                          padding_left, padding_right,
+                                          padding_top, padding_bottom,
+                                          stride_width, stride_height, activation,
+                                          reinterpret_cast<float*>(output.buffer), outShape, p_scratch);
+                    PROFILER_STOP;
+                } else {
+                    PROFILER_START("CONV_2D asym8");
+                    if(success) success =
+                              convQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
+                                         input.shape(),
+                                         prepared->getFilter(),
+                                         filter.shape(),
+                                         reinterpret_cast<const int32_t*>(bias.buffer),
+                                         bias.shape(),
+                                         padding_left, padding_right,
+                                         padding_top, padding_bottom,
+                                         stride_width, stride_height, activation,
+                                         reinterpret_cast<uint8_t*>(output.buffer),
+                                         outShape, p_scratch, &prepared->quant8);
+                    PROFILER_STOP;
+                }
+                break;
+            }
+            RunTimeOperandInfo filter_padded = filter;
+            filter_padded.buffer = NULL;
+            filter_padded.lifetime = OperandLifeTime::TEMPORARY_VARIABLE;
             Shape filterShapePadded = filter.shape();
 #endif
 
@@ -841,7 +1658,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 filter_padded.dimensions = filterShapePadded.dimensions;
                 filter_padded.scale = filterShapePadded.scale;
                 filter_padded.zeroPoint = filterShapePadded.offset;
-                filter_padded.buffer = (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
+                // Filters stored padded in a weight container are used in place
+                filter_padded.buffer = isPrePaddedFilter(ins[1], filterShapePadded) ? filter.buffer :
+                        (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
 #endif
 
 #ifndef HIFI_NNLIB_OPT
@@ -856,7 +1675,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                       reinterpret_cast<float*>(output.buffer), outShape);
                 PROFILER_STOP;
 #else
-                pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                if (filter_padded.buffer != filter.buffer) {
+                    pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                }
                 printf("Scratch %d \n", scratch_size);
                 void *p_scratch = malloc(scratch_size);
                 PROFILER_START("CONV_2D float32");
@@ -869,7 +1690,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                       stride_width, stride_height, activation,
                                       reinterpret_cast<float*>(output.buffer), outShape, p_scratch);
                 PROFILER_STOP;
-                free(filter_padded.buffer);
+                if (filter_padded.buffer != filter.buffer) {
+                    free(filter_padded.buffer);
+                }
                 free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
@@ -892,7 +1715,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 filter_padded.dimensions = filterShapePadded.dimensions;
                 filter_padded.scale =filterShapePadded.scale;
                 filter_padded.zeroPoint = filterShapePadded.offset;
-                filter_padded.buffer = (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
+                // Filters stored padded in a weight container are used in place
+                filter_padded.buffer = isPrePaddedFilter(ins[1], filterShapePadded) ? filter.buffer :
+                        (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
 #endif
 #ifndef HIFI_NNLIB_OPT
                 PROFILER_START("CONV_2D asym8");
@@ -910,7 +1735,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                      outShape);
                 PROFILER_STOP;
 #else
-                pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                if (filter_padded.buffer != filter.buffer) {
+                    pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
+                }
                 printf("Scratch %d \n", scratch_size);
                 void *p_scratch = malloc(scratch_size);
                 PROFILER_START("CONV_2D asym8");
@@ -927,7 +1754,9 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                      reinterpret_cast<uint8_t*>(output.buffer),
                                      outShape, p_scratch);
                 PROFILER_STOP;
-                free(filter_padded.buffer);
+                if (filter_padded.buffer != filter.buffer) {
+                    free(filter_padded.buffer);
+                }
                 free(p_scratch);
 #endif
             }
@@ -1432,6 +2261,21 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                       reinterpret_cast<float*>(output.buffer),
                                       outShape);
                 PROFILER_STOP;
+            } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
+#ifndef HIFI_NNLIB_OPT
+                success = genericActivationPrepare(input.shape(), &outShape) &&
+                          setInfoAndAllocateIfNeeded(&output, outShape);
+#else
+                success = genericActivationPrepare(input.shape(), &outShape, operation, scratch_size) &&
+                          setInfoAndAllocateIfNeeded(&output, outShape);
+#endif
+                PROFILER_START("TANH asym8");
+                if(success) success = 
+                          tanhQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
+                                     input.shape(),
+                                     reinterpret_cast<uint8_t*>(output.buffer),
+                                     outShape);
+                PROFILER_STOP;
             }
         } break;
         case OperationType::LOGISTIC: {
@@ -1846,6 +2690,10 @@ int CpuExecutor::executeOperation(const Operation& operation) {
             PROFILER_STOP;
         } break;
         case OperationType::LSTM: {
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+            // The operation scratch, shadowed by the LSTM scratch operand below.
+            void* opScratch = scratch;
+#endif
             RunTimeOperandInfo &scratch =
                 mOperands[outs[LSTMCell::kScratchBufferTensor]];
             RunTimeOperandInfo &outputStateOut =
@@ -1857,6 +2705,13 @@ int CpuExecutor::executeOperation(const Operation& operation) {
 
             Shape scratchShape, outputStateShape, cellStateShape, outputShape;
             LSTMCell lstm_cell(operation, mOperands);
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+            const CpuPreparedOperation* prepared =
+                    mPreparedModel != nullptr ? mPreparedModel->getOperation(index) : nullptr;
+            if (prepared != nullptr && opScratch != nullptr) {
+                lstm_cell.SetHybridWeights(&prepared->lstmHybrid, opScratch);
+            }
+#endif
 
             success = LSTMCell::Prepare(operation, mOperands,
                                         &scratchShape, &outputStateShape,
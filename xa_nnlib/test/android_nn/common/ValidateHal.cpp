@@ -426,6 +426,12 @@ static bool validateOperations(const hidl_vec<VersionedOperation>& operations,
 static bool validatePools(const hidl_vec<hidl_memory>& pools) {
     for (const hidl_memory& memory : pools) {
         const auto name = memory.name();
+#ifdef HIFI_BUILD
+        // Mapped by the runtime itself, there is no handle to pass on
+        if (name == "weight_container") {
+            continue;
+        }
+#endif //HIFI_BUILD
         if (name != "ashmem" && name != "mmap_fd") {
 #ifndef HIFI_BUILD
             LOG(ERROR) << "Unsupported memory type " << name;
@@ -46,7 +46,21 @@
 #ifndef HIFI_BUILD
 #include <android-base/macros.h>
 #endif //HIFI_BUILD
+#include <memory>
+#ifdef NNLIB_PTHREADS
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#endif
 #include <vector>
+#ifdef HIFI_BUILD
+#include "xt_weight_container.h"
+#endif //HIFI_BUILD
+#ifdef HIFI_NNLIB_OPT
+#include "operations/LSTM.h"
+#endif
 
 namespace android {
 namespace nn {
@@ -100,6 +114,11 @@ public:
 #endif //HIFI_BUILD
 
     explicit RunTimePoolInfo(uint8_t* buffer);
+#ifdef HIFI_BUILD
+    // buffer holds the weight container weightContainer, which stays owned
+    // by its memory.
+    RunTimePoolInfo(uint8_t* buffer, const xt_wc_t* weightContainer);
+#endif //HIFI_BUILD
 
     // Implement move
     RunTimePoolInfo(RunTimePoolInfo&& other);
@@ -112,6 +131,9 @@ public:
     ~RunTimePoolInfo() { release(); }
 
     uint8_t* getBuffer() const { return mBuffer; }
+#ifdef HIFI_BUILD
+    const xt_wc_t* getWeightContainer() const { return mWeightContainer; }
+#endif //HIFI_BUILD
 
     bool update() const;
 
@@ -125,15 +147,147 @@ private:
     sp<IMemory> mMemory;         // only used when hidlMemory.name() == "ashmem"
 #else
     uint8_t *mMemory;         // only used when hidlMemory.name() == "ashmem"
+    const xt_wc_t* mWeightContainer = nullptr;
 #endif //HIFI_BUILD
 };
 
 bool setRunTimePoolInfosFromHidlMemories(std::vector<RunTimePoolInfo>* poolInfos,
                                          const hidl_vec<hidl_memory>& pools);
 
+// Scalar parameters of a CONV_2D or DEPTHWISE_CONV_2D with the padding made
+// explicit
+struct ConvParameters {
+    int32_t padding_left, padding_right;
+    int32_t padding_top, padding_bottom;
+    int32_t stride_width, stride_height;
+    int32_t depth_multiplier;
+    int32_t activation;
+};
+
+#ifdef HIFI_NNLIB_OPT
+// Work of one CONV_2D or DEPTHWISE_CONV_2D that only depends on its constant
+// operands: the scalar parameters, the filter with its depth padded for the
+// nnlib kernels, the output shape, the scratch size and the quant8
+// requantization parameters.
+// A float LSTM prepared for the hybrid gate path only sets lstmHybrid and
+// scratchSize, the room for its quantized input and output state.
+struct CpuPreparedOperation {
+    // Input dimensions the state was built for. Executions with other input
+    // dimensions take the unprepared path.
+    std::vector<uint32_t> inputDimensions;
+    ConvParameters conv;
+    Shape outShape;
+    int32_t scratchSize;
+    std::vector<uint8_t> filterPadded;
+    // Set instead of filterPadded when the filter is stored padded in a
+    // weight container
+    const uint8_t* filterMapped = nullptr;
+    Quant8ConvParams quant8;  // TENSOR_QUANT8_ASYMM only
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+    LSTMHybridWeights lstmHybrid;
+#endif
+
+    const uint8_t* getFilter() const {
+        return filterMapped != nullptr ? filterMapped : filterPadded.data();
+    }
+};
+#endif
+
+// Per-model state of CpuExecutor, indexed by operation. It is built once when
+// the model is prepared so that executions only do the kernel work.
+// Operations whose filter or parameters are not constant in the model are not
+// prepared and run as before.
+// Temporaries whose size is known at preparation get a fixed offset in one
+// arena. Temporaries that are alive at the same time never share bytes.
+// Each execution holds its own arena and scratch buffer while it runs, so up
+// to kMaxExecutionsInFlight executions of one prepared model can overlap.
+class CpuPreparedModel {
+public:
+    // Two lets execution N+1 start while execution N is still running.
+    static constexpr size_t kMaxExecutionsInFlight = 2;
+
+    struct ExecutionBuffers {
+        uint8_t* arena = nullptr;
+        std::vector<uint64_t> arenaStorage;  // 8 byte aligned backing of arena, if owned
+        std::vector<uint8_t> scratch;
+        bool busy = false;
+    };
+
+    // modelPoolInfos are the memories of the model, constants referenced
+    // from them are prepared like the ones copied into the model. They must
+    // stay mapped while the prepared model is used.
+    int prepare(const Model& model, const std::vector<RunTimePoolInfo>& modelPoolInfos);
+
+    // Peak memory of the planned temporaries of one execution, in bytes. A
+    // multiple of 8.
+    size_t getArenaSize() const { return mArenaSize; }
+    // Places the temporaries in buffer instead of memory owned by the prepared
+    // model. buffer must be 8 byte aligned, hold getArenaSize() bytes for each
+    // execution that may be in flight (at most kMaxExecutionsInFlight) and
+    // outlive the executions. nullptr goes back to owned memory. Must not be
+    // called while an execution is running.
+    int setArena(void* buffer, size_t size);
+    // Owned buffers past the first one are only allocated when executions
+    // overlap. Blocks while kMaxExecutionsInFlight executions hold buffers.
+    ExecutionBuffers* acquireBuffers() const;
+    void releaseBuffers(ExecutionBuffers* buffers) const;
+    // Size of ExecutionBuffers::scratch
+    size_t getScratchSize() const { return mScratchSize; }
+    // Length 0 when the operand has no slot in the arena.
+    uint32_t getArenaOffset(uint32_t operand) const {
+        return operand < mArenaSlots.size() ? mArenaSlots[operand].offset : 0;
+    }
+    uint32_t getArenaLength(uint32_t operand) const {
+        return operand < mArenaSlots.size() ? mArenaSlots[operand].length : 0;
+    }
+    bool isArenaBuffer(const ExecutionBuffers* buffers, const uint8_t* buffer) const {
+        return mArenaSize != 0 && buffer >= buffers->arena && buffer < buffers->arena + mArenaSize;
+    }
+
+#ifdef HIFI_NNLIB_OPT
+    // nullptr when operation index was not prepared.
+    const CpuPreparedOperation* getOperation(size_t index) const {
+        return index < mOperations.size() && mPrepared[index] ? &mOperations[index] : nullptr;
+    }
+#endif
+
+private:
+    void planTemporaries(const Model& model);
+    // Appends one more set of execution buffers and returns it.
+    ExecutionBuffers* addBuffers() const;
+
+    struct ArenaSlot {
+        uint32_t offset;
+        uint32_t length;
+    };
+    std::vector<ArenaSlot> mArenaSlots;  // by operand index
+    size_t mArenaSize = 0;
+    // Sized for the largest prepared operation
+    size_t mScratchSize = 0;
+    // Owned arenas are allocated on demand when mExternalArena is nullptr.
+    uint8_t* mExternalArena = nullptr;
+    size_t mExternalArenaCount = 0;
+    mutable std::vector<std::unique_ptr<ExecutionBuffers>> mBuffers;
+#ifdef NNLIB_PTHREADS
+    mutable std::mutex mBuffersMutex;
+    mutable std::condition_variable mBuffersReleased;
+#endif
+
+#ifdef HIFI_NNLIB_OPT
+    std::vector<CpuPreparedOperation> mOperations;
+    std::vector<bool> mPrepared;
+#endif
+};
+
 // This class is used to execute a model on the CPU.
 class CpuExecutor {
 public:
+    CpuExecutor() {}
+    // preparedModel must have been prepared from the model passed to run(),
+    // and outlive the executor.
+    explicit CpuExecutor(const CpuPreparedModel* preparedModel)
+        : mPreparedModel(sUsePreparedModel ? preparedModel : nullptr) {}
+
     // Executes the model. The results will be stored at the locations
     // specified in the constructor.
     // The model must outlive the executor.  We prevent it from being modified
@@ -145,19 +299,49 @@ public:
             const std::vector<RunTimePoolInfo>& modelPoolInfos,
             const std::vector<RunTimePoolInfo>& requestPoolInfos);
 
+    // With false, executors created afterwards ignore the prepared model and
+    // run every operation the unprepared way, the reference the prepared
+    // path is tested against. Defaults to true.
+    static void setUsePreparedModel(bool use);
+
+#ifdef NNLIB_PTHREADS
+    // Number of threads the operations of one run are spread over, see
+    // runParallel(). 1, the default, runs them one by one in model order on
+    // the calling thread, the reference for bit-exact testing. Set it before
+    // starting executions.
+    static void setNumThreads(int numThreads);
+#endif
+
 private:
     bool initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& modelPoolInfos,
                                const std::vector<RunTimePoolInfo>& requestPoolInfos);
-    // Runs one operation of the graph.
-    int executeOperation(const Operation& entry);
+    // Runs the operation at index in the model, with per-operation profiling
+    // when enabled. scratch has room for mPreparedModel->getScratchSize()
+    // bytes and is not used by another operation at the same time.
+    int runOperation(size_t index, void* scratch);
+#ifdef NNLIB_PTHREADS
+    // Runs operations as soon as the operations producing their inputs have
+    // finished, on numThreads threads.
+    int runParallel(int numThreads);
+#endif
+    // Runs one operation of the graph, index is its position in the model.
+    int executeOperation(const Operation& entry, size_t index, void* scratch);
     // Decrement the usage count for the operands listed.  Frees the memory
     // allocated for any temporary variable with a count of zero.
     void freeNoLongerUsedOperands(const std::vector<uint32_t>& inputs);
+    // Hands mBuffers back to mPreparedModel.
+    void releaseBuffers();
+#ifdef HIFI_NNLIB_OPT
+    // Whether the value of the filter operand is stored with its depth padded
+    // to the depth of paddedShape, see xt_weight_container.h.
+    bool isPrePaddedFilter(uint32_t operand, const Shape& paddedShape) const;
+#endif
 
     // The model and the request that we'll execute. Only valid while run()
     // is being executed.
     const Model* mModel = nullptr;
     const Request* mRequest = nullptr;
+    const std::vector<RunTimePoolInfo>* mModelPoolInfos = nullptr;
 
     // We're copying the list of all the dimensions from the model, as
     // these may be modified when we run the operatins.  Since we're
@@ -166,8 +350,49 @@ private:
     //    std::vector<uint32_t> mDimensions;
     // Runtime information about all the operands.
     std::vector<RunTimeOperandInfo> mOperands;
+
+    const CpuPreparedModel* mPreparedModel = nullptr;
+    // Arena and scratch of mPreparedModel held for the duration of run()
+    CpuPreparedModel::ExecutionBuffers* mBuffers = nullptr;
+    // The arena plan assumes operations run in model order, a parallel run
+    // allocates its temporaries instead.
+    bool mSequential = true;
+    static bool sUsePreparedModel;
+#ifdef NNLIB_PTHREADS
+    // Guards the operand use counts and shapes during runParallel()
+    std::mutex* mOperandsMutex = nullptr;
+
+    // Threads running the workers of runParallel() other than the calling
+    // one. Shared by all executors, started on first use and kept until
+    // exit, so runs do not pay for creating threads.
+    class WorkerPool {
+    public:
+        ~WorkerPool();
+        // Queues task, first growing the pool to minThreads threads
+        void post(std::function<void()> task, int minThreads);
+
+    private:
+        void loop();
+
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::deque<std::function<void()>> mTasks;
+        std::vector<std::thread> mThreads;
+        bool mStop = false;
+    };
+
+    static int sNumThreads;
+    static WorkerPool sWorkerPool;
+#endif
 };
 
+// CpuExecutor::setUsePreparedModel() and CpuExecutor::setNumThreads() for
+// code built against the public API only, which can not include this header.
+void setCpuExecutorUsePreparedModel(bool use);
+#ifdef NNLIB_PTHREADS
+void setCpuExecutorNumThreads(int numThreads);
+#endif
+
 // Class for setting reasonable OpenMP threading settings. (OpenMP is used by
 // the Eigen matrix library.)
 //
@@ -46,7 +46,7 @@ namespace neuralnetworks {
 namespace V1_0 {
 namespace implementation {
 
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
 CallbackBase::CallbackBase() : mNotified(false) {}
 
 CallbackBase::~CallbackBase() {
@@ -131,7 +131,9 @@ void CallbackBase::join_thread_locked() {
         mThread.join();
     }
 }
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
 
+#ifndef HIFI_BUILD
 PreparedModelCallback::PreparedModelCallback() :
         mErrorStatus(ErrorStatus::GENERAL_FAILURE), mPreparedModel(nullptr) {}
 
@@ -169,14 +171,17 @@ Return<void> ExecutionCallback::notify(ErrorStatus errorStatus) {
 #else
 void  ExecutionCallback::notify(ErrorStatus errorStatus) {
     mErrorStatus = errorStatus;
+#ifdef NNLIB_PTHREADS
+    CallbackBase::notify();
+#endif //NNLIB_PTHREADS
 }
 
 #endif //HIFI_BUILD
 
 ErrorStatus ExecutionCallback::getStatus() {
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
     wait();
-#endif //HIFI_BUILD
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
     return mErrorStatus;
 }
 
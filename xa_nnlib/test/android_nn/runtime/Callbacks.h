@@ -70,7 +70,7 @@ using ::android::hardware::Return;
 using ::android::hardware::Void;
 using ::android::sp;
 
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
 /**
  * The CallbackBase class is used internally by the NeuralNetworks runtime to
  * synchronize between different threads. An asynchronous task is launched
@@ -203,7 +203,9 @@ class CallbackBase {
     std::function<bool(void)> mPostWork;
     std::thread               mThread;
 };
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
 
+#ifndef HIFI_BUILD
 /**
  * The PreparedModelCallback class is used to receive the error status of
  * preparing a model as well as the prepared model from a task executing
@@ -340,6 +342,21 @@ class ExecutionCallback : public CallbackBase,  public IExecutionCallback {
  private:
     ErrorStatus mErrorStatus;
 };
+#elif defined(NNLIB_PTHREADS)
+// HiFi build with threads: executions run asynchronously, see
+// ExecutionBuilder::startCompute.
+class ExecutionCallback : public CallbackBase {
+ public:
+    ExecutionCallback();
+    ~ExecutionCallback();
+
+    void notify(ErrorStatus status);
+
+    ErrorStatus getStatus();
+
+ private:
+    ErrorStatus mErrorStatus;
+};
 #else
 class ExecutionCallback{
  public:
@@ -398,7 +415,7 @@ class ExecutionCallback{
 
 // template function implementation(s) below this point
 
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
 template<class Rep, class Period>
 std::cv_status CallbackBase::wait_for(const std::chrono::duration<Rep,Period>& timeout_duration) {
     std::unique_lock<std::mutex> lock(mMutex);
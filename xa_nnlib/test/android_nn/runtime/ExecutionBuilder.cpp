@@ -396,6 +396,40 @@ static void asyncStartComputePartitioned(const ExecutionBuilder* executionBuilde
 #endif //#ifndef DISABLE_PARTITIONED_EXECUTION
 #endif //#ifndef HIFI_BUILD
 
+#ifdef HIFI_BUILD
+// Runs the steps of the plan in order and notifies executionCallback with the
+// result. Every execution has its own controller, so the temporaries passed
+// between steps are never shared with another execution in flight.
+static void asyncStartComputePlan(const ExecutionPlan* plan,
+                                  std::shared_ptr<ExecutionPlan::Controller> controller,
+                                  const sp<ExecutionCallback>& executionCallback) {
+    while (true) {
+        std::shared_ptr<StepExecutor> executor;
+        int n = plan->next(controller, &executor);
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            executionCallback->notify(convertResultCodeToErrorStatus(n));
+            return;
+        }
+        if (executor == nullptr) {
+            executionCallback->notify(ErrorStatus::NONE);
+            return;
+        }
+
+        sp<ExecutionCallback> stepCallback;
+        n = executor->startCompute(&stepCallback);
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            executionCallback->notify(convertResultCodeToErrorStatus(n));
+            return;
+        }
+        ErrorStatus status = stepCallback->getStatus();
+        if (status != ErrorStatus::NONE) {
+            executionCallback->notify(status);
+            return;
+        }
+    }
+}
+#endif //HIFI_BUILD
+
 int ExecutionBuilder::startCompute(sp<ExecutionCallback>* synchronizationCallback) {
 #ifndef HIFI_BUILD
     *synchronizationCallback = nullptr;
@@ -486,6 +520,27 @@ int ExecutionBuilder::startCompute(sp<ExecutionCallback>* synchronizationCallbac
         }
     }
 #endif  // DISABLE_PARTITIONED_EXECUTION
+#else
+    {
+        // The plan hands the CpuPreparedModel built at compilation to the
+        // executor. Without a usable plan, run the model unprepared below.
+        std::shared_ptr<ExecutionPlan::Controller> controller = mPlan->makeController(this);
+        if (controller != nullptr) {
+            sp<ExecutionCallback> executionCallback = new ExecutionCallback();
+#ifdef NNLIB_PTHREADS
+            // Back-to-back executions overlap: the next one can start while
+            // this one is still running, CpuPreparedModel gives each its own
+            // temporaries and scratch.
+            std::thread thread(asyncStartComputePlan, mPlan, controller, executionCallback);
+            executionCallback->bind_thread(std::move(thread));
+            *synchronizationCallback = executionCallback;
+            return ANEURALNETWORKS_NO_ERROR;
+#else
+            asyncStartComputePlan(mPlan, controller, executionCallback);
+            return convertErrorStatusToResultCode(executionCallback->getStatus());
+#endif //NNLIB_PTHREADS
+        }
+    }
 #endif //HIFI_BUILD
 
     // Run on the CPU.
@@ -554,9 +609,7 @@ StepExecutor::StepExecutor(const ExecutionBuilder* executionBuilder,
 #endif //HIFI_BUILD
     mExecutionBuilder(executionBuilder), mModel(model),
     mDriver(driver), 
-#ifndef HIFI_BUILD
     mPreparedModel(preparedModel),
-#endif //HIFI_BUILD
     mInputs(model->inputCount()), mOutputs(model->outputCount()) {}
 
 void StepExecutor::mapInputsAndOutputsTrivially() {
@@ -815,8 +868,9 @@ static void asyncStartComputeOnCpu(const Model& model, const Request& request,
 static void asyncStartComputeOnCpu(const Model& model, const Request& request,
                                    const std::vector<RunTimePoolInfo>& modelPoolInfos,
                                    const std::vector<RunTimePoolInfo>& requestPoolInfos,
-                                   const sp<ExecutionCallback>& executionCallback) {
-    CpuExecutor executor;
+                                   const sp<ExecutionCallback>& executionCallback,
+                                   const CpuPreparedModel* preparedModel) {
+    CpuExecutor executor(preparedModel);
     int err = executor.run(model, request, modelPoolInfos, requestPoolInfos);
     executionCallback->notify(convertResultCodeToErrorStatus(err));
 }
@@ -842,6 +896,12 @@ int StepExecutor::startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallba
     if (!setRunTimePoolInfosFromHidlMemories(&modelPoolInfos, model.pools)) {
         return ANEURALNETWORKS_UNMAPPABLE;
     }
+#else
+    // The memories of the model are mapped by the runtime already
+    int n = setRunTimePoolInfosFromMemories(&modelPoolInfos, mModel->getMemories());
+    if (n != ANEURALNETWORKS_NO_ERROR) {
+        return n;
+    }
 #endif //HIFI_BUILD
 
     std::vector<RunTimePoolInfo> requestPoolInfos;
@@ -881,7 +941,12 @@ int StepExecutor::startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallba
     executionCallback->bind_thread(std::move(thread));
     *synchronizationCallback = executionCallback;
 #else
-    asyncStartComputeOnCpu(model, request, modelPoolInfos, requestPoolInfos, executionCallback);
+    // Already on the execution's own thread, see ExecutionBuilder::startCompute
+    asyncStartComputeOnCpu(model, request, modelPoolInfos, requestPoolInfos, executionCallback,
+                           static_cast<const CpuPreparedModel*>(mPreparedModel));
+    if (synchronizationCallback != nullptr) {
+        *synchronizationCallback = executionCallback;
+    }
 #endif //HIFI_BUILD
 
     return ANEURALNETWORKS_NO_ERROR;
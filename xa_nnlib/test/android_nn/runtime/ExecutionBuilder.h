@@ -218,7 +218,7 @@ private:
     sp<IPreparedModel> mPreparedModel;  // nullptr if CPU execution or if bypassing ExecutionPlan
 #else
     void* mDriver;          // nullptr if CPU execution
-    void* mPreparedModel;  // nullptr if CPU execution or if bypassing ExecutionPlan
+    void* mPreparedModel;  // CpuPreparedModel of the step, nullptr if bypassing ExecutionPlan
 #endif //HIFI_BUILD
 
     // The information we'll send to the driver about the inputs and outputs.
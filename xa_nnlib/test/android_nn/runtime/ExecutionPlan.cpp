@@ -41,6 +41,7 @@
 
 #include "Callbacks.h"
 #include "CompilationBuilder.h"
+#include "CpuExecutor.h"
 #include "ExecutionBuilder.h"
 #include "Manager.h"
 #include "ModelBuilder.h"
@@ -106,8 +107,13 @@ int compile(std::shared_ptr<Device> device, const ModelBuilder* model, int32_t e
     nnAssert(device != nullptr);
     Model hidlModel;
     model->setHidlModel(&hidlModel);
+    std::vector<RunTimePoolInfo> modelPoolInfos;
+    int n = setRunTimePoolInfosFromMemories(&modelPoolInfos, model->getMemories());
+    if (n != ANEURALNETWORKS_NO_ERROR) {
+        return n;
+    }
     return device->prepareModel(hidlModel, static_cast<ExecutionPreference>(executionPreference),
-                                preparedModel);
+                                modelPoolInfos, preparedModel);
 }
 #endif //HIFI_BUILD
 
@@ -619,7 +625,10 @@ int ExecutionPlan::SimpleBody::finish(const ModelBuilder* fromModel,
 #ifndef HIFI_BUILD
     const int n = compile(mDevice, mModel, executionPreference, &mPreparedModel);
 #else
-    const int n = compile(mDevice, mModel, executionPreference, nullptr);
+    // The CPU executor keeps per-model state that does not change between
+    // executions, see CpuPreparedModel.
+    mCpuPreparedModel = std::make_shared<CpuPreparedModel>();
+    const int n = compile(mDevice, mModel, executionPreference, mCpuPreparedModel.get());
 #endif //HIFI_BUILD
     mSuccessfulFinish = (n == ANEURALNETWORKS_NO_ERROR);
     return n;
@@ -768,7 +777,7 @@ int ExecutionPlan::next(std::shared_ptr<Controller> controller,
                 simpleBody->mPreparedModel);
 #else
                 nullptr,
-                nullptr);
+                simpleBody->mCpuPreparedModel.get());
 #endif //HIFI_BUILD
             (*executor)->mapInputsAndOutputsTrivially();
             controller->mNextStepIndex = 1;
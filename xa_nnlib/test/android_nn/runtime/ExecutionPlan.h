@@ -52,6 +52,9 @@ namespace android {
 namespace nn {
 
 class CompilationBuilder;
+#ifdef HIFI_BUILD
+class CpuPreparedModel;
+#endif //HIFI_BUILD
 class Device;
 class ExecutionBuilder;
 class ExecutionPlan;
@@ -279,6 +282,8 @@ private:
         const ModelBuilder* mModel;
 #ifndef HIFI_BUILD
         sp<IPreparedModel> mPreparedModel;  // not used for CPU
+#else
+        std::shared_ptr<CpuPreparedModel> mCpuPreparedModel;
 #endif //HIFI_BUILD
     };
 
@@ -38,6 +38,7 @@
 #define LOG_TAG "Manager"
 
 #include "Manager.h"
+#include "CpuExecutor.h"
 #include "HalInterfaces.h"
 #include "Utils.h"
 
@@ -192,6 +193,7 @@ class CpuDevice : public Device {
                      std::shared_ptr<VersionedIPreparedModel>* preparedModel) override;
 #else
     int prepareModel(const Model& hidlModel, ExecutionPreference executionPreference,
+                     const std::vector<RunTimePoolInfo>& modelPoolInfos,
                      void* preparedModel) override;
 #endif //HIFI_BUILD
 
@@ -224,12 +226,16 @@ int CpuDevice::prepareModel(const Model& hidlModel, ExecutionPreference executio
 #ifndef HIFI_BUILD
                             std::shared_ptr<VersionedIPreparedModel>* preparedModel) {
 #else
+                            const std::vector<RunTimePoolInfo>& modelPoolInfos,
                             void* preparedModel) {
 #endif //HIFI_BUILD
     //*preparedModel = nullptr; //ppn
     if (!validateModel(hidlModel) || !validateExecutionPreference(executionPreference)) {
         return ANEURALNETWORKS_OP_FAILED;
     }
+    if (preparedModel != nullptr) {
+        return static_cast<CpuPreparedModel*>(preparedModel)->prepare(hidlModel, modelPoolInfos);
+    }
     return ANEURALNETWORKS_NO_ERROR;
 }
 #endif //HIFI_BUILD
@@ -55,6 +55,7 @@ namespace android {
 namespace nn {
 
 class ModelBuilder;
+class RunTimePoolInfo;
 
 #ifndef HIFI_BUILD
 class Device {
@@ -112,7 +113,9 @@ class Device {
     virtual int prepareModel(const Model& hidlModel, ExecutionPreference executionPreference,
                              std::shared_ptr<VersionedIPreparedModel>* preparedModel) = 0;
 #else
+    // modelPoolInfos map the memories of hidlModel
     virtual int prepareModel(const Model& hidlModel, ExecutionPreference executionPreference,
+                             const std::vector<RunTimePoolInfo>& modelPoolInfos,
                              void* preparedModel) = 0;
 #endif //HIFI_BUILD
 };
@@ -39,6 +39,7 @@
 
 #include "Memory.h"
 
+#include "CpuExecutor.h"
 #include "HalInterfaces.h"
 #include "Utils.h"
 
@@ -166,6 +167,41 @@ int MemoryFd::getPointer(uint8_t** buffer) const {
 }
 #endif //HIFI_BUILD
 
+#ifdef HIFI_BUILD
+MemoryWeightContainer::~MemoryWeightContainer() {
+    xt_wc_close(&mContainer);
+}
+
+int MemoryWeightContainer::open(const char* path) {
+    xt_wc_close(&mContainer);
+    mMemory = nullptr;
+    mHidlMemory = hidl_memory();
+    if (xt_wc_open(&mContainer, path) != 0) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    mMemory = const_cast<uint8_t*>(mContainer.p_base);
+    mHidlMemory = hidl_memory("weight_container", static_cast<const native_handle_t*>(nullptr),
+                              mContainer.size);
+    return ANEURALNETWORKS_NO_ERROR;
+}
+
+int setRunTimePoolInfosFromMemories(std::vector<RunTimePoolInfo>* poolInfos,
+                                    const MemoryTracker& memories) {
+    poolInfos->clear();
+    poolInfos->reserve(memories.size());
+    for (uint32_t i = 0; i < memories.size(); i++) {
+        uint8_t* buffer = nullptr;
+        int n = memories[i]->getPointer(&buffer);
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            poolInfos->clear();
+            return n;
+        }
+        poolInfos->emplace_back(buffer, memories[i]->getWeightContainer());
+    }
+    return ANEURALNETWORKS_NO_ERROR;
+}
+#endif //HIFI_BUILD
+
 uint32_t MemoryTracker::add(const Memory* memory) {
 #ifndef HIFI_BUILD
     VLOG(MODEL) << __func__ << "(" << SHOW_IF_DEBUG(memory) << ")";
@@ -44,6 +44,8 @@
 #include <cutils/native_handle.h>
 #ifndef HIFI_BUILD
 #include <sys/mman.h>
+#else
+#include "xt_weight_container.h"
 #endif //HIFI_BUILD
 #include <unordered_map>
 
@@ -51,6 +53,8 @@ namespace android {
 namespace nn {
 
 class ModelBuilder;
+class MemoryTracker;
+class RunTimePoolInfo;
 
 // Represents a memory region.
 class Memory {
@@ -80,6 +84,10 @@ public:
     }
 
     virtual bool validateSize(uint32_t offset, uint32_t length) const;
+#ifdef HIFI_BUILD
+    // nullptr unless this memory is a MemoryWeightContainer
+    virtual const xt_wc_t* getWeightContainer() const { return nullptr; }
+#endif //HIFI_BUILD
 protected:
     // The hidl_memory handle for this shared memory.  We will pass this value when
     // communicating with the drivers.
@@ -114,6 +122,27 @@ private:
     mutable uint8_t* mMapping = nullptr;
 };
 
+#ifdef HIFI_BUILD
+// A weight container file (see xt_weight_container.h) mapped read-only.
+// Operands set from one of its entries are used in place by the executor, so
+// they are neither copied into the model nor padded again for the kernels.
+class MemoryWeightContainer : public Memory {
+public:
+    MemoryWeightContainer() { mMemory = nullptr; }
+    ~MemoryWeightContainer();
+
+    MemoryWeightContainer(const MemoryWeightContainer&) = delete;
+    MemoryWeightContainer& operator=(const MemoryWeightContainer&) = delete;
+
+    int open(const char* path);
+
+    const xt_wc_t* getWeightContainer() const override { return &mContainer; }
+
+private:
+    xt_wc_t mContainer = {};
+};
+#endif //HIFI_BUILD
+
 // A utility class to accumulate mulitple Memory objects and assign each
 // a distinct index number, starting with 0.
 //
@@ -139,6 +168,13 @@ public:
     decltype(mMemories.end())   end()   { return mMemories.end(); }
 };
 
+#ifdef HIFI_BUILD
+// Pool infos of the memories of a model, in pool index order. The memories
+// are mapped already, the pool infos do not own the mappings.
+int setRunTimePoolInfosFromMemories(std::vector<RunTimePoolInfo>* poolInfos,
+                                    const MemoryTracker& memories);
+#endif //HIFI_BUILD
+
 }  // namespace nn
 }  // namespace android
 
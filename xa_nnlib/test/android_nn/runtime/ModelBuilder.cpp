@@ -257,6 +257,50 @@ int ModelBuilder::setOperandValueFromMemory(uint32_t index, const Memory* memory
     return ANEURALNETWORKS_NO_ERROR;
 }
 
+#ifdef HIFI_BUILD
+int ModelBuilder::setOperandValueFromWeightContainer(uint32_t index, const Memory* memory,
+                                                     const char* name) {
+    if (badState("setOperandValueFromWeightContainer")) {
+        return ANEURALNETWORKS_BAD_STATE;
+    }
+    if (index >= operandCount()) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    const xt_wc_t* container = memory->getWeightContainer();
+    if (container == nullptr) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    const xt_wc_entry_t* entry = xt_wc_find(container, name);
+    if (entry == nullptr) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+
+    const Operand& operand = mOperands[index];
+    uint32_t type;
+    switch (operand.type) {
+        case OperandType::TENSOR_FLOAT32:       type = XT_WC_TYPE_FLOAT32; break;
+        case OperandType::TENSOR_INT32:         type = XT_WC_TYPE_INT32;   break;
+        case OperandType::TENSOR_QUANT8_ASYMM:  type = XT_WC_TYPE_ASYM8;   break;
+        default:
+            return ANEURALNETWORKS_BAD_DATA;
+    }
+    if (entry->type != type || entry->num_dims != operand.dimensions.size()) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    for (uint32_t i = 0; i < entry->num_dims; i++) {
+        if (entry->dims[i] != operand.dimensions[i]) {
+            return ANEURALNETWORKS_BAD_DATA;
+        }
+    }
+    if (operand.type == OperandType::TENSOR_QUANT8_ASYMM &&
+            (entry->zero_point != operand.zeroPoint || entry->scale != operand.scale)) {
+        return ANEURALNETWORKS_BAD_DATA;
+    }
+    // The logical length, a padded entry extends past it
+    return setOperandValueFromMemory(index, memory, entry->offset, xt_wc_logical_length(entry));
+}
+#endif //HIFI_BUILD
+
 int ModelBuilder::addOperation(ANeuralNetworksOperationType type, uint32_t inputCount,
                                const uint32_t* inputs, uint32_t outputCount,
                                const uint32_t* outputs) {
@@ -66,6 +66,10 @@ public:
     int setOperandValue(uint32_t index, const void* buffer, size_t length);
     int setOperandValueFromMemory(uint32_t index, const Memory* memory, uint32_t offset,
                                   size_t length);
+#ifdef HIFI_BUILD
+    // The operand references the entry name of memory's weight container
+    int setOperandValueFromWeightContainer(uint32_t index, const Memory* memory, const char* name);
+#endif //HIFI_BUILD
 
     int addOperation(ANeuralNetworksOperationType type, uint32_t inputCount, const uint32_t* inputs,
                      uint32_t outputCount, const uint32_t* outputs);
@@ -51,6 +51,9 @@
 #include "Manager.h"
 #include "Memory.h"
 #include "NeuralNetworksOEM.h"
+#ifdef HIFI_BUILD
+#include "NeuralNetworksWeightContainer.h"
+#endif //HIFI_BUILD
 #include "ModelBuilder.h"
 #include "Utils.h"
 
@@ -293,6 +296,30 @@ int ANeuralNetworksMemory_createFromFd(size_t size, int prot, int fd, size_t off
 }
 #endif //HIFI_BUILD
 
+#ifdef HIFI_BUILD
+int ANeuralNetworksMemory_createFromWeightContainer(const char* path,
+                                                    ANeuralNetworksMemory** memory) {
+    if (!memory) {
+        return ANEURALNETWORKS_UNEXPECTED_NULL;
+    }
+    *memory = nullptr;
+    if (!path) {
+        return ANEURALNETWORKS_UNEXPECTED_NULL;
+    }
+    std::unique_ptr<MemoryWeightContainer> m =
+            std::unique_ptr<MemoryWeightContainer>(new (std::nothrow) MemoryWeightContainer());
+    if (m == nullptr) {
+        return ANEURALNETWORKS_OUT_OF_MEMORY;
+    }
+    int n = m->open(path);
+    if (n != ANEURALNETWORKS_NO_ERROR) {
+        return n;
+    }
+    *memory = reinterpret_cast<ANeuralNetworksMemory*>(m.release());
+    return ANEURALNETWORKS_NO_ERROR;
+}
+#endif //HIFI_BUILD
+
 void ANeuralNetworksMemory_free(ANeuralNetworksMemory* memory) {
     // No validation.  Free of nullptr is valid.
     Memory* m = reinterpret_cast<Memory*>(memory);
@@ -373,6 +400,20 @@ int ANeuralNetworksModel_setOperandValueFromMemory(ANeuralNetworksModel* model,
     return m->setOperandValueFromMemory(index, mem, offset, length);
 }
 
+#ifdef HIFI_BUILD
+int ANeuralNetworksModel_setOperandValueFromWeightContainer(ANeuralNetworksModel* model,
+                                                            int32_t index,
+                                                            const ANeuralNetworksMemory* memory,
+                                                            const char* name) {
+    if (!model || !memory || !name) {
+        return ANEURALNETWORKS_UNEXPECTED_NULL;
+    }
+    const Memory* mem = reinterpret_cast<const Memory*>(memory);
+    ModelBuilder* m = reinterpret_cast<ModelBuilder*>(model);
+    return m->setOperandValueFromWeightContainer(index, mem, name);
+}
+#endif //HIFI_BUILD
+
 int ANeuralNetworksModel_addOperation(ANeuralNetworksModel* model,
                                       ANeuralNetworksOperationType type, uint32_t inputCount,
                                       const uint32_t* inputs, uint32_t outputCount,
@@ -557,8 +598,12 @@ int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution* execution,
     // nullptr is returned. The sp is used for ref-counting purposes. Without
     // it, the HIDL service could attempt to communicate with a dead callback
     // object.
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
 #ifndef HIFI_BUILD
     std::unique_ptr<sp<ExecutionCallback>> e = std::make_unique<sp<ExecutionCallback>>();
+#else
+    std::unique_ptr<sp<ExecutionCallback>> e(new sp<ExecutionCallback>());
+#endif //HIFI_BUILD
     *event = nullptr;
 
     int n = r->startCompute(e.get());
@@ -567,18 +612,21 @@ int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution* execution,
     }
     *event = reinterpret_cast<ANeuralNetworksEvent*>(e.release());
 #else
+    // Without threads the execution has completed when startCompute returns
     int n = r->startCompute(nullptr);
     if (n != ANEURALNETWORKS_NO_ERROR) {
         return n;
     }
-#endif //HIFI_BUILD
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
     return ANEURALNETWORKS_NO_ERROR;
 }
 
 int ANeuralNetworksEvent_wait(ANeuralNetworksEvent* event) {
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
     if (event == nullptr) {
+#ifndef HIFI_BUILD
         LOG(ERROR) << "ANeuralNetworksEvent_wait passed a nullptr";
+#endif //HIFI_BUILD
         return ANEURALNETWORKS_UNEXPECTED_NULL;
     }
 
@@ -587,16 +635,16 @@ int ANeuralNetworksEvent_wait(ANeuralNetworksEvent* event) {
     return convertErrorStatusToResultCode((*e)->getStatus());
 #else
     return ANEURALNETWORKS_NO_ERROR;
-#endif //HIFI_BUILD
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
 }
 
 void ANeuralNetworksEvent_free(ANeuralNetworksEvent* event) {
-#ifndef HIFI_BUILD
+#if !defined(HIFI_BUILD) || defined(NNLIB_PTHREADS)
     // No validation.  Free of nullptr is valid.
     if (event) {
         sp<ExecutionCallback>* e = reinterpret_cast<sp<ExecutionCallback>*>(event);
         (*e)->wait();
         delete e;
     }
-#endif //HIFI_BUILD
+#endif //!HIFI_BUILD || NNLIB_PTHREADS
 }
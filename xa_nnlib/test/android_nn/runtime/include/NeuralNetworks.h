@@ -910,6 +910,15 @@ typedef enum {
      *
      * Supported tensor {@link OperandCode}:
      * * {@link ANEURALNETWORKS_TENSOR_FLOAT32}
+     * * {@link ANEURALNETWORKS_TENSOR_QUANT8_ASYMM} (HiFi builds with
+     *   HIFI_NNLIB_OPT only). The input, weights, output state and output are
+     *   TENSOR_QUANT8_ASYMM; input, output state and output have scale 1/128
+     *   and zeroPoint 128, all weights share one scale and zeroPoint. The
+     *   biases are TENSOR_INT32 with scale = weights scale / 128. The cell
+     *   state (in and out) is a TENSOR_INT32 holding int16 values with scale
+     *   1/2048 and zeroPoint 0, the scratch buffer is TENSOR_INT32. CIFG,
+     *   peephole and projection are not supported and the activation must be
+     *   Tanh.
      *
      * Inputs:
      * * 0: The input (\f$x_t\f$).
@@ -1243,6 +1252,11 @@ typedef enum {
      *
      * Supported tensor {@link OperandCode}:
      * * {@link ANEURALNETWORKS_TENSOR_FLOAT32}
+     * * {@link ANEURALNETWORKS_TENSOR_QUANT8_ASYMM} (HiFi builds with
+     *   HIFI_NNLIB_OPT only). The bias is then TENSOR_INT32 with
+     *   scale = input scale * weights scale, and hidden state (in) scale *
+     *   recurrent_weights scale must equal that scale as well. Both outputs
+     *   take the scale and zeroPoint of output.
      *
      * Inputs:
      * * 0: input.
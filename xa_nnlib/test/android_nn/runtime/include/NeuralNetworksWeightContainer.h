@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+
+#ifndef ANDROID_ML_NN_RUNTIME_NEURAL_NETWORKS_WEIGHT_CONTAINER_H
+#define ANDROID_ML_NN_RUNTIME_NEURAL_NETWORKS_WEIGHT_CONTAINER_H
+
+/*
+ * Loading of constant operands from a weight container file, see
+ * xt_weight_container.h for the format. HiFi builds only.
+ *
+ * The container is mapped read-only and its entries are used in place, so
+ * loading a model does not depend on the size of its weights and processes
+ * using the same container share its pages.
+ */
+
+#include "NeuralNetworks.h"
+
+#if __ANDROID_API__ >= __ANDROID_API_O_MR1__
+
+__BEGIN_DECLS
+
+/**
+ * Creates a memory object holding the weight container at path.
+ *
+ * The memory can be used with {@link ANeuralNetworksModel_setOperandValueFromMemory}
+ * like any other and with {@link ANeuralNetworksModel_setOperandValueFromWeightContainer}.
+ * It must outlive the models and compilations using it. Free it with
+ * {@link ANeuralNetworksMemory_free}.
+ *
+ * @param path Path of the container file.
+ * @param memory The memory object to be created.
+ *               Set to NULL if unsuccessful.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if the request completed normally,
+ *         ANEURALNETWORKS_BAD_DATA if the file is not a valid container.
+ */
+int ANeuralNetworksMemory_createFromWeightContainer(const char* path,
+                                                    ANeuralNetworksMemory** memory);
+
+/**
+ * Sets an operand to the entry of a weight container.
+ *
+ * The type and dimensions of the operand must match the entry. Entries stored
+ * with a padded depth can only be the filter of ANEURALNETWORKS_CONV_2D and
+ * ANEURALNETWORKS_DEPTHWISE_CONV_2D, padded the way the kernels read it
+ * (TENSOR_FLOAT32 to a multiple of 2, TENSOR_QUANT8_ASYMM to a multiple of 4
+ * with the zero point); other uses fail when the model is compiled.
+ *
+ * @param model The model to be modified.
+ * @param index The index of the model operand we're setting.
+ * @param memory A memory created by
+ *               {@link ANeuralNetworksMemory_createFromWeightContainer}.
+ * @param name The name of the entry.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful.
+ */
+int ANeuralNetworksModel_setOperandValueFromWeightContainer(ANeuralNetworksModel* model,
+                                                            int32_t index,
+                                                            const ANeuralNetworksMemory* memory,
+                                                            const char* name);
+
+__END_DECLS
+
+#endif  //  __ANDROID_API__ >= 27
+
+#endif  // ANDROID_ML_NN_RUNTIME_NEURAL_NETWORKS_WEIGHT_CONTAINER_H
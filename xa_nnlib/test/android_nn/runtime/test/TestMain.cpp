@@ -48,6 +48,26 @@
 #include <gtest/gtest.h>
 #endif //HIFI_BUILD
 
+#ifdef HIFI_BUILD
+#include <cstdio>
+#include <cstring>
+#ifdef NNLIB_PTHREADS
+#include <cstdlib>
+#endif //NNLIB_PTHREADS
+#include "NeuralNetworksWeightContainer.h"
+#include "xt_weight_container.h"
+
+// From CpuExecutor.h, which brings the HAL Model into the global namespace
+namespace android {
+namespace nn {
+void setCpuExecutorUsePreparedModel(bool use);
+#ifdef NNLIB_PTHREADS
+void setCpuExecutorNumThreads(int numThreads);
+#endif //NNLIB_PTHREADS
+}  // namespace nn
+}  // namespace android
+#endif //HIFI_BUILD
+
 using namespace android::nn::wrapper;
 
 #ifndef HIFI_BUILD
@@ -75,6 +95,16 @@ int main(int argc, char** argv) {
 #include "TestGenerated.cpp"
 #include "./generated/all_generated_tests_hifi.cpp"
 
+// Quantized goldens are exact unless the example defines how far they may
+// be off, e.g. when they come from a reference with other fixed point
+// sigmoid/tanh approximations than the nnlib tables
+#ifndef HIFI_QUANT8_ATOL
+#define HIFI_QUANT8_ATOL 0
+#endif
+#ifndef HIFI_INT32_ATOL
+#define HIFI_INT32_ATOL 0
+#endif
+
 using namespace all_tests;
 
 #define EXPECT_NEAR_FLOAT(g, t, range) {\
@@ -150,7 +180,7 @@ void compare_float(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t
     }
 }
 
-void compare_int32(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t &totalNumberOfErrors)
+void compare_int32(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t &totalNumberOfErrors, int32_t atol = 0)
 {
     for (auto& i : std::get<MixedTypedIndex<int32_t>::index>(filteredGolden)) 
     {
@@ -160,17 +190,18 @@ void compare_int32(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t
         for (unsigned int j = 0; j < i.second.size(); j++) {
             int32_t g = i.second[j];
             int32_t t = test_ty->second[j];
+            if (std::abs(int64_t{g} - int64_t{t}) <= atol) {
+                continue;
+            }
             if (totalNumberOfErrors < gMaximumNumberOfErrorMessages) {
                 EXPECT_EQ_INT(g, t);
             }
-            if (g != t) {
-                totalNumberOfErrors++;
-            }
+            totalNumberOfErrors++;
         }
     }
 }
 
-void compare_uint8(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t &totalNumberOfErrors)
+void compare_uint8(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t &totalNumberOfErrors, int32_t atol = 0)
 {
     for (auto& i : std::get<MixedTypedIndex<uint8_t>::index>(filteredGolden)) 
     {
@@ -180,20 +211,226 @@ void compare_uint8(MixedTyped& filteredGolden, MixedTyped& filteredTest, size_t
         for (unsigned int j = 0; j < i.second.size(); j++) {
             uint8_t g = i.second[j];
             uint8_t t = test_ty->second[j];
+            if (std::abs(int64_t{g} - int64_t{t}) <= atol) {
+                continue;
+            }
             if (totalNumberOfErrors < gMaximumNumberOfErrorMessages) {
                 EXPECT_EQ_INT(g, t);
             }
-            if (g != t) {
+            totalNumberOfErrors++;
+        }
+    }
+}
+
+// Binds the inputs of one example and test, sized for its outputs, to execution
+void setup_example(Execution& execution, MixedTyped& inputs,
+                   const MixedTyped& golden, MixedTyped& test)
+{
+    // Set all inputs
+    SET_OPERAND_BUFFERS(float, inputs, setInput);
+    SET_OPERAND_BUFFERS(int32_t, inputs, setInput);
+    SET_OPERAND_BUFFERS(uint8_t, inputs, setInput);
+
+    // Go through all typed outputs
+    resize_accordingly(golden, test);
+    SET_OPERAND_BUFFERS(float, test, setOutput);
+    SET_OPERAND_BUFFERS(int32_t, test, setOutput);
+    SET_OPERAND_BUFFERS(uint8_t, test, setOutput);
+}
+
+// Runs one example on a new execution of compilation, test gets the outputs
+Result execute_example(const Compilation& compilation, MixedTyped& inputs,
+                       const MixedTyped& golden, MixedTyped& test)
+{
+    Execution execution(&compilation);
+
+    setup_example(execution, inputs, golden, test);
+    return execution.compute();
+}
+
+// A VALID 2x2 CONV_2D over a 1x3x3x3 input with 2 output channels. The filter
+// depth of 3 is padded to 4 in the weight container, both for float and asym8.
+struct ContainerConvTest {
+    const char* filterName;
+    const char* biasName;
+    Type type;
+    Type biasType;
+    float inputScale, filterScale, outputScale;
+    int32_t inputZero, filterZero, outputZero;
+    const void* input;
+    size_t inputSize;
+    const void* filter;
+    size_t filterSize;
+    const void* bias;
+    size_t biasSize;
+    size_t outputSize;
+};
+
+static const char* kWeightContainerPath = "ann_weight_container_test.bin";
+
+static float kContainerInputF32[27] = {
+     0.5f, -1.0f,  0.25f,  1.5f, -0.75f,  2.0f, -0.5f,  0.125f, 1.0f,
+    -2.0f,  0.75f, -0.25f, 0.5f,  1.25f, -1.5f,  0.0f,  -1.0f,  0.375f,
+     1.0f,  0.5f, -0.125f, -1.25f, 0.25f, 0.75f, -0.5f,  2.0f, -0.625f};
+static float kContainerFilterF32[24] = {
+     0.25f, -0.5f,  1.0f,  -0.75f, 0.5f,  0.125f, 1.5f,  -1.0f,
+    -0.25f,  0.75f, -1.25f, 0.5f, -0.5f,  1.0f,  0.25f, -0.125f,
+     0.5f,  -1.5f,  0.75f, 0.25f, -1.0f,  0.5f,  1.25f, -0.75f};
+static float kContainerBiasF32[2] = {0.5f, -0.25f};
+static uint8_t kContainerInputQ8[27] = {
+    10, 200, 37, 128, 0, 255, 64, 91, 13, 177, 42, 250, 99, 3, 141,
+    78, 222, 56, 189, 120, 7, 164, 33, 211, 86, 150, 240};
+static uint8_t kContainerFilterQ8[24] = {
+    1, 9, 17, 250, 3, 128, 66, 190, 45, 12, 255, 0,
+    99, 140, 7, 230, 31, 88, 160, 5, 201, 74, 119, 52};
+static int32_t kContainerBiasQ8[2] = {-300, 1200};
+
+// Builds the conv of t into model, its filter and bias from the entries of
+// container when it is not null, with setOperandValue otherwise
+static bool create_container_conv_model(Model* model, const ContainerConvTest& t,
+                                        const ANeuralNetworksMemory* container)
+{
+    static int32_t padding = ANEURALNETWORKS_PADDING_VALID;
+    static int32_t stride = 1;
+    static int32_t activation = ANEURALNETWORKS_FUSED_NONE;
+    OperandType scalarType(Type::INT32, {});
+    OperandType inputType(t.type, {1, 3, 3, 3}, t.inputScale, t.inputZero);
+    OperandType filterType(t.type, {2, 2, 2, 3}, t.filterScale, t.filterZero);
+    OperandType biasType(t.biasType, {2}, t.inputScale * t.filterScale);
+    OperandType outputType(t.type, {1, 2, 2, 2}, t.outputScale, t.outputZero);
+
+    auto input = model->addOperand(&inputType);
+    auto filter = model->addOperand(&filterType);
+    auto bias = model->addOperand(&biasType);
+    auto pad = model->addOperand(&scalarType);
+    auto strideW = model->addOperand(&scalarType);
+    auto strideH = model->addOperand(&scalarType);
+    auto act = model->addOperand(&scalarType);
+    auto output = model->addOperand(&outputType);
+    if (container == nullptr) {
+        model->setOperandValue(filter, t.filter, t.filterSize);
+        model->setOperandValue(bias, t.bias, t.biasSize);
+    } else if (ANeuralNetworksModel_setOperandValueFromWeightContainer(
+                       model->getHandle(), filter, container, t.filterName) != ANEURALNETWORKS_NO_ERROR ||
+               ANeuralNetworksModel_setOperandValueFromWeightContainer(
+                       model->getHandle(), bias, container, t.biasName) != ANEURALNETWORKS_NO_ERROR) {
+        return false;
+    }
+    model->setOperandValue(pad, &padding, sizeof(padding));
+    model->setOperandValue(strideW, &stride, sizeof(stride));
+    model->setOperandValue(strideH, &stride, sizeof(stride));
+    model->setOperandValue(act, &activation, sizeof(activation));
+    model->addOperation(ANEURALNETWORKS_CONV_2D, {input, filter, bias, pad, strideW, strideH, act},
+                        {output});
+    model->identifyInputsAndOutputs({input}, {output});
+    return model->finish() == Result::NO_ERROR;
+}
+
+static Result run_container_conv_model(const Model& model, const ContainerConvTest& t,
+                                       std::vector<uint8_t>& output)
+{
+    Compilation compilation(&model);
+    compilation.finish();
+    Execution execution(&compilation);
+    output.assign(t.outputSize, 0);
+    execution.setInput(0, t.input, t.inputSize);
+    execution.setOutput(0, output.data(), output.size());
+    return execution.compute();
+}
+
+// Round trip through the weight container: the filters and biases of the
+// convs are written with the container writer, loaded back through
+// ANeuralNetworksMemory_createFromWeightContainer and the outputs have to
+// match the models using setOperandValue bit for bit, prepared and not. The
+// container also holds an entry of depth 0, stored as padding only.
+static size_t run_weight_container_test()
+{
+    const ContainerConvTest tests[2] = {
+        {"conv_f32_filter", "conv_f32_bias", Type::TENSOR_FLOAT32, Type::TENSOR_FLOAT32,
+         0.0f, 0.0f, 0.0f, 0, 0, 0,
+         kContainerInputF32, sizeof(kContainerInputF32),
+         kContainerFilterF32, sizeof(kContainerFilterF32),
+         kContainerBiasF32, sizeof(kContainerBiasF32), 8 * sizeof(float)},
+        {"conv_q8_filter", "conv_q8_bias", Type::TENSOR_QUANT8_ASYMM, Type::TENSOR_INT32,
+         0.5f, 0.5f, 1.0f, 10, 3, 20,
+         kContainerInputQ8, sizeof(kContainerInputQ8),
+         kContainerFilterQ8, sizeof(kContainerFilterQ8),
+         kContainerBiasQ8, sizeof(kContainerBiasQ8), 8 * sizeof(uint8_t)},
+    };
+    const uint32_t filterDims[4] = {2, 2, 2, 3};
+    const uint32_t biasDims[1] = {2};
+    const uint32_t emptyDims[2] = {2, 0};
+    size_t totalNumberOfErrors = 0;
+
+    printf("Weight container round trip\n");
+    xt_wc_writer_t writer;
+    xt_wc_writer_init(&writer);
+    int err = 0;
+    for (const ContainerConvTest& t : tests) {
+        bool quant = t.type == Type::TENSOR_QUANT8_ASYMM;
+        err |= xt_wc_writer_add(&writer, t.filterName,
+                                quant ? XT_WC_TYPE_ASYM8 : XT_WC_TYPE_FLOAT32,
+                                4, filterDims, 4, t.filterScale, t.filterZero, t.filter);
+        err |= xt_wc_writer_add(&writer, t.biasName,
+                                quant ? XT_WC_TYPE_INT32 : XT_WC_TYPE_FLOAT32,
+                                1, biasDims, 0, t.inputScale * t.filterScale, 0, t.bias);
+    }
+    err |= xt_wc_writer_add(&writer, "empty", XT_WC_TYPE_FLOAT32, 2, emptyDims, 4,
+                            0.0f, 0, kContainerFilterF32);
+    err |= xt_wc_writer_save(&writer, kWeightContainerPath);
+    xt_wc_writer_free(&writer);
+
+    ANeuralNetworksMemory* container = nullptr;
+    if (err != 0 || ANeuralNetworksMemory_createFromWeightContainer(kWeightContainerPath, &container) !=
+            ANEURALNETWORKS_NO_ERROR) {
+        printf("Unable to write or load weight container '%s'\n", kWeightContainerPath);
+        totalNumberOfErrors++;
+    } else {
+        for (const ContainerConvTest& t : tests) {
+            Model copied, referenced;
+            if (!create_container_conv_model(&copied, t, nullptr) ||
+                    !create_container_conv_model(&referenced, t, container)) {
+                printf("Unable to create model from '%s'\n", t.filterName);
                 totalNumberOfErrors++;
+                continue;
+            }
+            for (int prepared = 0; prepared < 2; prepared++) {
+                std::vector<uint8_t> expected, actual;
+                android::nn::setCpuExecutorUsePreparedModel(prepared != 0);
+                if (run_container_conv_model(copied, t, expected) != Result::NO_ERROR ||
+                        run_container_conv_model(referenced, t, actual) != Result::NO_ERROR ||
+                        memcmp(expected.data(), actual.data(), expected.size()) != 0) {
+                    printf("Mismatch: %s %s\n", t.filterName, prepared ? "prepared" : "unprepared");
+                    totalNumberOfErrors++;
+                }
             }
         }
+        ANeuralNetworksMemory_free(container);
     }
+    remove(kWeightContainerPath);
+    EXPECT_EQ_FINAL(size_t{0}, totalNumberOfErrors);
+    return totalNumberOfErrors;
 }
 
-int main(void) 
+int main(int argc, char** argv)
 {
     Model model;
 
+#ifdef NNLIB_PTHREADS
+    // -num_threads N runs independent operations of the model on N threads,
+    // except for the reference run, so the parallel runs are checked bit for
+    // bit against a sequential one
+    int numThreads = 1;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "-num_threads") == 0) {
+            numThreads = atoi(argv[++i]);
+        }
+    }
+#else
+    (void)argc;
+    (void)argv;
+#endif //NNLIB_PTHREADS
+
     /* Library name version etc print */
     fprintf(stderr, "\n--------------------------------------------------------\n");
     fprintf(stderr, "HiFi NN Library Android NN API Testbench\n");
@@ -205,6 +442,8 @@ int main(void)
     fprintf(stderr, "\n");
 
 
+    run_weight_container_test();
+
     printf("Creating model\n");
     CreateModel(&model);
     model.finish();
@@ -223,6 +462,18 @@ int main(void)
     float fpAtol = !model.isRelaxed() ? 1e-5f : 5.0f * 0.0009765625f;
     // Set the relative tolerance to be 5ULP of the corresponding FP precision.
     float fpRtol = !model.isRelaxed() ? 5.0f * 1.1920928955078125e-7f : 5.0f * 0.0009765625f;
+#ifdef HIFI_FLOAT_ATOL
+    // The example defines how far its float goldens may be off
+    fpAtol = HIFI_FLOAT_ATOL;
+#endif
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+    // The prepared model runs float LSTMs with constant weights on int8
+    // copies of the weights, the unprepared reference on the float ones:
+    // both are within the golden tolerance, not equal
+    const float preparedAtol = 2.0f * fpAtol, preparedRtol = 2.0f * fpRtol;
+#else
+    const float preparedAtol = 0.0f, preparedRtol = 0.0f;
+#endif
 
     for (auto& example : examples) {
 
@@ -232,63 +483,86 @@ int main(void)
         MixedTyped inputs = example.first;
         const MixedTyped& golden = example.second;
 
-        printf("Executing \n");
-        Execution execution(&compilation);
-
-        // Set all inputs
-#if 0
-        for_all(inputs, [&execution](int idx, const void* p, size_t s) {
-                const void* buffer = s == 0 ? nullptr : p;
-                ASSERT_EQ(Result::NO_ERROR, execution.setInput(idx, buffer, s));
-                });
-#else
-        SET_OPERAND_BUFFERS(float, inputs, setInput);
-        SET_OPERAND_BUFFERS(int32_t, inputs, setInput);
-        SET_OPERAND_BUFFERS(uint8_t, inputs, setInput);
-#endif
-
-        MixedTyped test;
-        // Go through all typed outputs
-        resize_accordingly(golden, test);
-
-#ifndef HIFI_BUILD
-        for_all(test, [&execution](int idx, void* p, size_t s) {
-                void* buffer = s == 0 ? nullptr : p;
-                ASSERT_EQ(Result::NO_ERROR, execution.setOutput(idx, buffer, s));
-                });
-#else
-        SET_OPERAND_BUFFERS(float, test, setOutput);
-        SET_OPERAND_BUFFERS(int32_t, test, setOutput);
-        SET_OPERAND_BUFFERS(uint8_t, test, setOutput);
-#endif //HIFI_BUILD
-
-        Result r = execution.compute();
-
-#ifndef HIFI_BUILD
-        ASSERT_EQ(Result::NO_ERROR, r);
-#else //HIFI_BUILD
-        (void)r;
-#endif
-
-        // Filter out don't cares
-#ifndef HIFI_BUILD
-        MixedTyped filteredGolden = filter(golden, is_ignored);
-        MixedTyped filteredTest = filter(test, is_ignored);
-#else
+        // Reference run: the executor ignores the model prepared at
+        // compilation and sets every operation up at run time
+        printf("Executing unprepared\n");
+        MixedTyped reference;
+        android::nn::setCpuExecutorUsePreparedModel(false);
+#ifdef NNLIB_PTHREADS
+        android::nn::setCpuExecutorNumThreads(1);
+#endif //NNLIB_PTHREADS
+        Result r = execute_example(compilation, inputs, golden, reference);
+        android::nn::setCpuExecutorUsePreparedModel(true);
+#ifdef NNLIB_PTHREADS
+        android::nn::setCpuExecutorNumThreads(numThreads);
+        if (numThreads > 1) {
+            printf("Running on %d threads\n", numThreads);
+        }
+#endif //NNLIB_PTHREADS
+        size_t totalNumberOfErrors = r != Result::NO_ERROR ? 1 : 0;
         MixedTyped filteredGolden = filter(golden);
-        MixedTyped filteredTest = filter(test);
-#endif //HIFI_BUILD
-
-        // We want "close-enough" results for float
-#ifndef HIFI_BUILD
-        compare(filteredGolden, filteredTest, fpAtol, fpRtol);
-#else
-        size_t totalNumberOfErrors = 0;
-        compare_float(filteredGolden, filteredTest, totalNumberOfErrors, fpAtol, fpRtol);
-        compare_int32(filteredGolden, filteredTest, totalNumberOfErrors);
-        compare_uint8(filteredGolden, filteredTest, totalNumberOfErrors);
+        MixedTyped filteredReference = filter(reference);
+        compare_float(filteredGolden, filteredReference, totalNumberOfErrors, fpAtol, fpRtol);
+        compare_int32(filteredGolden, filteredReference, totalNumberOfErrors, HIFI_INT32_ATOL);
+        compare_uint8(filteredGolden, filteredReference, totalNumberOfErrors, HIFI_QUANT8_ATOL);
         EXPECT_EQ_FINAL(size_t{0}, totalNumberOfErrors);
-#endif //HIFI_BUILD
+
+        // The prepared model is run twice: the second execution reuses the
+        // prepared filters and the arena of the first one. Both have to
+        // match the reference bit for bit (float outputs of hybrid LSTMs
+        // within preparedAtol).
+        for (int run = 0; run < 2; run++) {
+            printf("Executing prepared, run %d\n", run + 1);
+            MixedTyped test;
+            r = execute_example(compilation, inputs, golden, test);
+            totalNumberOfErrors = r != Result::NO_ERROR ? 1 : 0;
+
+            // Filter out don't cares
+            MixedTyped filteredTest = filter(test);
+
+            // We want "close-enough" results for float
+            compare_float(filteredGolden, filteredTest, totalNumberOfErrors, fpAtol, fpRtol);
+            compare_int32(filteredGolden, filteredTest, totalNumberOfErrors, HIFI_INT32_ATOL);
+            compare_uint8(filteredGolden, filteredTest, totalNumberOfErrors, HIFI_QUANT8_ATOL);
+            // and the same results as the unprepared path
+            compare_float(filteredReference, filteredTest, totalNumberOfErrors, preparedAtol, preparedRtol);
+            compare_int32(filteredReference, filteredTest, totalNumberOfErrors);
+            compare_uint8(filteredReference, filteredTest, totalNumberOfErrors);
+            EXPECT_EQ_FINAL(size_t{0}, totalNumberOfErrors);
+        }
+
+#ifdef NNLIB_PTHREADS
+        // Two executions in flight: the second one is started before waiting
+        // on the first, so they overlap on the prepared model's two arenas.
+        // Each has to match the reference as the runs above.
+        {
+            printf("Executing prepared, 2 in flight\n");
+            Execution execution0(&compilation);
+            Execution execution1(&compilation);
+            MixedTyped test0, test1;
+            Event event0, event1;
+            setup_example(execution0, inputs, golden, test0);
+            setup_example(execution1, inputs, golden, test1);
+            Result r0 = execution0.startCompute(&event0);
+            Result r1 = execution1.startCompute(&event1);
+            if (r0 == Result::NO_ERROR) r0 = event0.wait();
+            if (r1 == Result::NO_ERROR) r1 = event1.wait();
+
+            MixedTyped* tests[2] = {&test0, &test1};
+            Result results[2] = {r0, r1};
+            for (int run = 0; run < 2; run++) {
+                totalNumberOfErrors = results[run] != Result::NO_ERROR ? 1 : 0;
+                MixedTyped filteredTest = filter(*tests[run]);
+                compare_float(filteredGolden, filteredTest, totalNumberOfErrors, fpAtol, fpRtol);
+                compare_int32(filteredGolden, filteredTest, totalNumberOfErrors, HIFI_INT32_ATOL);
+                compare_uint8(filteredGolden, filteredTest, totalNumberOfErrors, HIFI_QUANT8_ATOL);
+                compare_float(filteredReference, filteredTest, totalNumberOfErrors, preparedAtol, preparedRtol);
+                compare_int32(filteredReference, filteredTest, totalNumberOfErrors);
+                compare_uint8(filteredReference, filteredTest, totalNumberOfErrors);
+                EXPECT_EQ_FINAL(size_t{0}, totalNumberOfErrors);
+            }
+        }
+#endif //NNLIB_PTHREADS
         exampleNo++;
     }
 
@@ -509,6 +509,16 @@ namespace all_tests {
 #include "generated/examples_hifi/lstm.example.cpp"
 // Generated model constructor
 #include "generated/models/lstm.model.cpp"
+#elif defined HIFI_LSTM_HYBRID
+// Generated lstm_hybrid test
+#include "generated/examples_hifi/lstm_hybrid.example.cpp"
+// Generated model constructor
+#include "generated/models/lstm_hybrid.model.cpp"
+#elif defined HIFI_LSTM_QUANT8
+// Generated lstm_quant8 test
+#include "generated/examples_hifi/lstm_quant8.example.cpp"
+// Generated model constructor
+#include "generated/models/lstm_quant8.model.cpp"
 #elif defined HIFI_LSTM_STATE2
 // Generated lstm_state2 test
 #include "generated/examples_hifi/lstm_state2.example.cpp"
@@ -689,6 +699,16 @@ namespace all_tests {
 #include "generated/examples_hifi/rnn_state.example.cpp"
 // Generated model constructor
 #include "generated/models/rnn_state.model.cpp"
+#elif defined HIFI_RNN_QUANT8
+// Generated rnn_quant8 test
+#include "generated/examples_hifi/rnn_quant8.example.cpp"
+// Generated model constructor
+#include "generated/models/rnn_quant8.model.cpp"
+#elif defined HIFI_RNN_QUANT8_TANH
+// Generated rnn_quant8_tanh test
+#include "generated/examples_hifi/rnn_quant8_tanh.example.cpp"
+// Generated model constructor
+#include "generated/models/rnn_quant8_tanh.model.cpp"
 #elif defined HIFI_SOFTMAX_FLOAT_1
 // Generated softmax_float_1 test
 #include "generated/examples_hifi/softmax_float_1.example.cpp"
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+//Do not modify
+//Generated by ./examples_hifi.py using ../examples/lstm_hybrid.example.cpp
+
+// The lstm and lstm_state examples as two batches of an LSTM with constant
+// weights. With HYBRID_LSTM=1 its gates run on int8 copies of the weights,
+// a few 1e-3 off the float goldens.
+#ifdef HIFI_NNLIB_HYBRID_LSTM
+#define HIFI_FLOAT_ATOL 0.005f
+#endif
+
+std::vector<MixedTypedExample>& get_examples() {
+
+    Float32Operands inputs_float, outputs_float;
+    Int32Operands inputs_int32, outputs_int32;
+    Quant8Operands inputs_quant8, outputs_quant8;
+    MixedTyped inputs, outputs;
+    MixedTypedExample eg;
+    static std::vector<MixedTypedExample> examples;
+
+    inputs_float[0] = {2.0f, 3.0f, 3.0f, 4.0f};
+    inputs_float[1] = {};
+    inputs_float[2] = {};
+    inputs_float[3] = {};
+    inputs_float[4] = {};
+    inputs_float[5] = {};
+    inputs_float[6] = {0.0f, 0.0f, 0.0f, 0.0f, -0.0297319f, 0.122947f, 0.208851f, -0.153588f};
+    inputs_float[7] = {0.0f, 0.0f, 0.0f, 0.0f, -0.145439f, 0.157475f, 0.293663f, -0.277353f};
+
+    outputs_float[0] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    outputs_float[1] = {-0.0297319f, 0.122947f, 0.208851f, -0.153588f, -0.0371611f, 0.125073f, 0.411934f, -0.208605f};
+    outputs_float[2] = {-0.145439f, 0.157475f, 0.293663f, -0.277353f, -0.287121f, 0.148115f, 0.556837f, -0.388276f};
+    outputs_float[3] = {-0.02973187f, 0.1229473f, 0.20885126f, -0.15358765f, -0.03716109f, 0.12507336f, 0.41193449f, -0.20860538f};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    return examples;
+};
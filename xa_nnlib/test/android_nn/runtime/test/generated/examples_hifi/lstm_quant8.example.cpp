@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+//Do not modify
+//Generated by ./examples_hifi.py using ../examples/lstm_quant8.example.cpp
+
+// The golden comes from TFLite's quantized LstmCell, whose gemmlowp
+// sigmoid/tanh differ from the nnlib tables in the last bits: allow one
+// step of the output and two of the Q4.11 cell state.
+#define HIFI_QUANT8_ATOL 1
+#define HIFI_INT32_ATOL 2
+
+std::vector<MixedTypedExample>& get_examples() {
+
+    Float32Operands inputs_float, outputs_float;
+    Int32Operands inputs_int32, outputs_int32;
+    Quant8Operands inputs_quant8, outputs_quant8;
+    MixedTyped inputs, outputs;
+    MixedTypedExample eg;
+    static std::vector<MixedTypedExample> examples;
+
+    inputs_quant8[0] = {54, 145, 197, 160, 27, 236, 111, 107, 190, 226};
+    inputs_quant8[1] = {24, 153, 11, 219, 152, 170, 157, 92, 80, 18, 191, 94, 223, 52, 116, 140, 8, 70, 65, 50, 2, 3, 124, 62, 77, 242, 61, 141, 242, 216};
+    inputs_quant8[2] = {25, 129, 21, 51, 108, 250, 81, 164, 31, 140, 22, 138, 32, 172, 148, 232, 222, 111, 87, 13, 107, 126, 223, 218, 117, 52, 221, 44, 223, 239};
+    inputs_quant8[3] = {66, 62, 121, 50, 66, 113, 118, 162, 51, 183, 167, 104, 135, 187, 98, 176, 107, 160, 155, 168, 209, 37, 196, 127, 232, 143, 39, 207, 6, 134};
+    inputs_quant8[4] = {147, 41, 47, 229, 204, 243, 72, 113, 48, 153, 213, 185, 191, 161, 30, 59, 173, 143, 233, 168, 31, 208, 64, 39, 238, 83, 73, 27, 207, 57};
+    inputs_quant8[5] = {172, 159, 1, 16, 36, 204, 11, 244, 76, 98, 38, 200, 181, 83, 89, 62, 88, 235, 107, 64, 199, 218, 45, 150, 156, 61, 228, 222, 68, 60, 254, 224, 194, 242, 93, 94};
+    inputs_quant8[6] = {116, 170, 131, 155, 116, 183, 167, 201, 80, 196, 216, 60, 192, 238, 130, 75, 89, 14, 115, 6, 163, 68, 35, 26, 150, 98, 253, 87, 107, 229, 102, 209, 129, 43, 204, 236};
+    inputs_quant8[7] = {155, 187, 81, 48, 144, 239, 226, 148, 58, 88, 250, 147, 179, 40, 185, 84, 159, 97, 192, 134, 187, 42, 44, 24, 74, 6, 220, 75, 96, 222, 151, 225, 10, 62, 85, 220};
+    inputs_quant8[8] = {210, 53, 153, 103, 57, 167, 218, 175, 208, 190, 54, 78, 227, 46, 69, 39, 198, 157, 224, 175, 146, 84, 65, 180, 154, 58, 128, 88, 100, 197, 224, 60, 188, 193, 71, 64};
+    inputs_quant8[9] = {};
+    inputs_quant8[10] = {};
+    inputs_quant8[11] = {};
+    inputs_int32[12] = {9587, -23184, 3841, -1543, 7736, 148};
+    inputs_int32[13] = {-32510, 28667, -37035, 33925, -7904, 15812};
+    inputs_int32[14] = {19030, -1854, -27589, -36874, 22452, 1657};
+    inputs_int32[15] = {-13773, -8808, -3924, -21856, -15217, 22848};
+    inputs_quant8[16] = {};
+    inputs_int32[17] = {};
+    inputs_quant8[18] = {128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128};
+    inputs_int32[19] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    outputs_int32[0] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    outputs_quant8[1] = {142, 125, 100, 110, 135, 127, 136, 127, 107, 115, 143, 123};
+    outputs_int32[2] = {920, -176, -839, -894, 440, -14, 214, -29, -750, -663, 756, -123};
+    outputs_quant8[3] = {142, 125, 100, 110, 135, 127, 136, 127, 107, 115, 143, 123};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    inputs_quant8[0] = {147, 130, 160, 199, 198, 186, 122, 188, 102, 38};
+    inputs_quant8[1] = {24, 153, 11, 219, 152, 170, 157, 92, 80, 18, 191, 94, 223, 52, 116, 140, 8, 70, 65, 50, 2, 3, 124, 62, 77, 242, 61, 141, 242, 216};
+    inputs_quant8[2] = {25, 129, 21, 51, 108, 250, 81, 164, 31, 140, 22, 138, 32, 172, 148, 232, 222, 111, 87, 13, 107, 126, 223, 218, 117, 52, 221, 44, 223, 239};
+    inputs_quant8[3] = {66, 62, 121, 50, 66, 113, 118, 162, 51, 183, 167, 104, 135, 187, 98, 176, 107, 160, 155, 168, 209, 37, 196, 127, 232, 143, 39, 207, 6, 134};
+    inputs_quant8[4] = {147, 41, 47, 229, 204, 243, 72, 113, 48, 153, 213, 185, 191, 161, 30, 59, 173, 143, 233, 168, 31, 208, 64, 39, 238, 83, 73, 27, 207, 57};
+    inputs_quant8[5] = {172, 159, 1, 16, 36, 204, 11, 244, 76, 98, 38, 200, 181, 83, 89, 62, 88, 235, 107, 64, 199, 218, 45, 150, 156, 61, 228, 222, 68, 60, 254, 224, 194, 242, 93, 94};
+    inputs_quant8[6] = {116, 170, 131, 155, 116, 183, 167, 201, 80, 196, 216, 60, 192, 238, 130, 75, 89, 14, 115, 6, 163, 68, 35, 26, 150, 98, 253, 87, 107, 229, 102, 209, 129, 43, 204, 236};
+    inputs_quant8[7] = {155, 187, 81, 48, 144, 239, 226, 148, 58, 88, 250, 147, 179, 40, 185, 84, 159, 97, 192, 134, 187, 42, 44, 24, 74, 6, 220, 75, 96, 222, 151, 225, 10, 62, 85, 220};
+    inputs_quant8[8] = {210, 53, 153, 103, 57, 167, 218, 175, 208, 190, 54, 78, 227, 46, 69, 39, 198, 157, 224, 175, 146, 84, 65, 180, 154, 58, 128, 88, 100, 197, 224, 60, 188, 193, 71, 64};
+    inputs_quant8[9] = {};
+    inputs_quant8[10] = {};
+    inputs_quant8[11] = {};
+    inputs_int32[12] = {9587, -23184, 3841, -1543, 7736, 148};
+    inputs_int32[13] = {-32510, 28667, -37035, 33925, -7904, 15812};
+    inputs_int32[14] = {19030, -1854, -27589, -36874, 22452, 1657};
+    inputs_int32[15] = {-13773, -8808, -3924, -21856, -15217, 22848};
+    inputs_quant8[16] = {};
+    inputs_int32[17] = {};
+    inputs_quant8[18] = {82, 98, 159, 82, 175, 141, 130, 89, 99, 149, 135, 93};
+    inputs_int32[19] = {1988, -702, -1241, 2356, 2276, -2159, -2201, 2079, 409, -126, -231, 485};
+
+    outputs_int32[0] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    outputs_quant8[1] = {148, 118, 102, 150, 165, 66, 130, 167, 96, 116, 137, 143};
+    outputs_int32[2] = {746, -507, -858, 1147, 2158, -2064, 115, 1656, -850, -1130, 692, 333};
+    outputs_quant8[3] = {148, 118, 102, 150, 165, 66, 130, 167, 96, 116, 137, 143};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    return examples;
+};
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+//Do not modify
+//Generated by ./examples_hifi.py using ../examples/rnn_quant8.example.cpp
+
+std::vector<MixedTypedExample>& get_examples() {
+
+    Float32Operands inputs_float, outputs_float;
+    Int32Operands inputs_int32, outputs_int32;
+    Quant8Operands inputs_quant8, outputs_quant8;
+    MixedTyped inputs, outputs;
+    MixedTypedExample eg;
+    static std::vector<MixedTypedExample> examples;
+
+    inputs_quant8[0] = {138, 185, 180, 130, 150, 86, 183, 107, 143, 95};
+    inputs_quant8[1] = {84, 171, 35, 207, 24, 91, 130, 162, 112, 185, 133, 20, 170, 10, 220, 177, 59, 181, 98, 173, 38, 167, 234, 87, 17, 38, 101, 196, 99, 109};
+    inputs_quant8[2] = {144, 35, 220, 150, 121, 176, 166, 22, 237, 102, 0, 132, 81, 72, 109, 77, 204, 197, 76, 217, 227, 167, 232, 104, 185, 79, 189, 32, 8, 75, 77, 8, 112, 197, 56, 102};
+    inputs_int32[3] = {-323, -178, 274, -180, 87, -381};
+    inputs_quant8[4] = {100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100};
+
+    outputs_quant8[0] = {100, 174, 100, 128, 134, 100, 243, 100, 100, 100, 182, 100};
+    outputs_quant8[1] = {100, 174, 100, 128, 134, 100, 243, 100, 100, 100, 182, 100};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    inputs_quant8[0] = {86, 130, 114, 126, 117, 194, 157, 189, 93, 100};
+    inputs_quant8[1] = {84, 171, 35, 207, 24, 91, 130, 162, 112, 185, 133, 20, 170, 10, 220, 177, 59, 181, 98, 173, 38, 167, 234, 87, 17, 38, 101, 196, 99, 109};
+    inputs_quant8[2] = {144, 35, 220, 150, 121, 176, 166, 22, 237, 102, 0, 132, 81, 72, 109, 77, 204, 197, 76, 217, 227, 167, 232, 104, 185, 79, 189, 32, 8, 75, 77, 8, 112, 197, 56, 102};
+    inputs_int32[3] = {-323, -178, 274, -180, 87, -381};
+    inputs_quant8[4] = {115, 107, 158, 106, 165, 142, 122, 159, 170, 157, 100, 117};
+
+    outputs_quant8[0] = {244, 100, 128, 255, 100, 100, 100, 108, 100, 255, 100, 100};
+    outputs_quant8[1] = {244, 100, 128, 255, 100, 100, 100, 108, 100, 255, 100, 100};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    return examples;
+};
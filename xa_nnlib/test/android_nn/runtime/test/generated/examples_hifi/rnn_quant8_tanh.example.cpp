@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and 
+* not with any other processors and platforms, subject to
+* the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+//Do not modify
+//Generated by ./examples_hifi.py using ../examples/rnn_quant8_tanh.example.cpp
+
+// The golden is the float RNN on the dequantized operands, requantized:
+// the nnlib tanh table is allowed one step of the output off it.
+#define HIFI_QUANT8_ATOL 1
+
+std::vector<MixedTypedExample>& get_examples() {
+
+    Float32Operands inputs_float, outputs_float;
+    Int32Operands inputs_int32, outputs_int32;
+    Quant8Operands inputs_quant8, outputs_quant8;
+    MixedTyped inputs, outputs;
+    MixedTypedExample eg;
+    static std::vector<MixedTypedExample> examples;
+
+    inputs_quant8[0] = {204, 159, 183, 194, 19, 146, 61, 234, 192, 63};
+    inputs_quant8[1] = {168, 197, 247, 67, 78, 63, 231, 129, 141, 37, 195, 196, 19, 83, 170, 72, 2, 58, 76, 1, 34, 195, 199, 101, 167, 148, 249, 97, 179, 115};
+    inputs_quant8[2] = {229, 232, 54, 50, 170, 127, 198, 65, 96, 193, 84, 55, 135, 147, 78, 21, 144, 136, 177, 91, 144, 176, 247, 24, 52, 228, 29, 148, 38, 25, 249, 214, 83, 147, 226, 129};
+    inputs_int32[3] = {647, -1102, -1571, 2699, 2616, -2148};
+    inputs_quant8[4] = {128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128};
+
+    outputs_quant8[0] = {236, 212, 74, 160, 104, 201, 210, 115, 9, 203, 135, 57};
+    outputs_quant8[1] = {236, 212, 74, 160, 104, 201, 210, 115, 9, 203, 135, 57};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    inputs_quant8[0] = {25, 9, 124, 44, 127, 176, 216, 2, 205, 35};
+    inputs_quant8[1] = {168, 197, 247, 67, 78, 63, 231, 129, 141, 37, 195, 196, 19, 83, 170, 72, 2, 58, 76, 1, 34, 195, 199, 101, 167, 148, 249, 97, 179, 115};
+    inputs_quant8[2] = {229, 232, 54, 50, 170, 127, 198, 65, 96, 193, 84, 55, 135, 147, 78, 21, 144, 136, 177, 91, 144, 176, 247, 24, 52, 228, 29, 148, 38, 25, 249, 214, 83, 147, 226, 129};
+    inputs_int32[3] = {647, -1102, -1571, 2699, 2616, -2148};
+    inputs_quant8[4] = {161, 53, 178, 168, 182, 143, 128, 139, 185, 91, 51, 187};
+
+    outputs_quant8[0] = {12, 67, 7, 255, 15, 5, 46, 202, 233, 39, 23, 204};
+    outputs_quant8[1] = {12, 67, 7, 255, 15, 5, 46, 202, 233, 39, 23, 204};
+    inputs = std::make_tuple(inputs_float, inputs_int32, inputs_quant8);
+    outputs = std::make_tuple(outputs_float, outputs_int32, outputs_quant8);
+
+    eg = std::make_pair(inputs, outputs);
+
+    examples.push_back(eg);
+    inputs_float.clear();
+    outputs_float.clear();
+    inputs_int32.clear();
+    outputs_int32.clear();
+    inputs_quant8.clear();
+    outputs_quant8.clear();
+
+    return examples;
+};
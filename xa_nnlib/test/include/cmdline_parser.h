@@ -50,6 +50,13 @@
           continue;\
         }
 
+#define ARGTYPE_ONETIME_CONFIG_F32( _switch, _param)            \
+    if(strcmp((argv[argidx]), _switch) == 0) {             \
+          _param = (float)atof(argv[argidx+1]);  \
+          argidx++;\
+          continue;\
+        }
+
 #define ARGTYPE_CONFIG(_flag, _switch, _param)                \
     if(strcmp((argv[argidx]), _switch) == 0) {             \
           _param = atoi(argv[argidx+1]);  \
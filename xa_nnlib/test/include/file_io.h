@@ -34,6 +34,8 @@ int load_conv1d_std_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, b
     buf1D_t *p_bias, int input_channels, int input_width, int input_channelsXwidth_pad);
 int load_conv2d_ds_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_kernel,
     buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point);
+int load_inv_res_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_kernel_expand,
+    buf1D_t *p_bias_expand, buf1D_t *p_kernel, buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point);
 int load_activation_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp); 
 int load_pool_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp);
 int load_norm_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp);
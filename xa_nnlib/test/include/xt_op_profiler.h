@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XT_OP_PROFILER_H__
+#define __XT_OP_PROFILER_H__
+
+/* Per-operator profiling for the model runtimes (tf_micro_lite
+   MicroInterpreter and android_nn CpuExecutor).
+
+   Profiling is off until xt_op_prof_enable() hands over a record ring, so the
+   runtimes only pay one branch per operator when it is not used. Each
+   operator produces one record holding its index in the model, opcode,
+   start/stop timestamps, bytes read/written and an estimate of its MACs.
+   When the ring is full the oldest records are overwritten. An optional
+   callback sees every record as it is completed.
+
+   Timestamps are CCOUNT cycles on Xtensa and CLOCK_MONOTONIC nanoseconds
+   elsewhere, see XT_OP_PROF_TIME_UNIT.
+
+   Built with NNLIB_PTHREADS, every call but xt_op_prof_is_enabled() takes
+   one process-wide lock, so operators running on different threads can
+   record into the same ring.
+   xt_op_prof_get() returns a pointer into the ring; read it only while no
+   operators are being recorded. */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __XTENSA__
+#define XT_OP_PROF_TIME_UNIT "cycles"
+#else
+#define XT_OP_PROF_TIME_UNIT "ns"
+#endif
+
+typedef struct _xt_op_prof_record_t
+{
+  int32_t     op_index;       /* Position of the operator in execution order */
+  int32_t     opcode;         /* Runtime specific operator code */
+  const char *op_name;        /* Static string, may be NULL */
+  uint64_t    start;
+  uint64_t    stop;
+  uint32_t    bytes_read;     /* Sum of input tensor sizes */
+  uint32_t    bytes_written;  /* Sum of output tensor sizes */
+  uint64_t    macs;           /* 0 for operators without a MAC estimate */
+} xt_op_prof_record_t;
+
+typedef void (*xt_op_prof_callback_t)(const xt_op_prof_record_t *p_rec, void *p_user);
+
+/* Starts recording into p_ring (capacity records, owned by the caller) and
+   drops any previous records. */
+void xt_op_prof_enable(xt_op_prof_record_t *p_ring, int capacity);
+void xt_op_prof_disable(void);
+int  xt_op_prof_is_enabled(void);
+void xt_op_prof_set_callback(xt_op_prof_callback_t callback, void *p_user);
+void xt_op_prof_clear(void);
+
+uint64_t xt_op_prof_timestamp(void);
+
+/* Runtime side: begin() fills in the identity and start time, end() stamps
+   the stop time and commits the record to the ring. */
+void xt_op_prof_begin(xt_op_prof_record_t *p_rec, int op_index, int opcode, const char *op_name);
+void xt_op_prof_end(xt_op_prof_record_t *p_rec, uint32_t bytes_read, uint32_t bytes_written, uint64_t macs);
+
+/* Number of records held and access to them, oldest first */
+int xt_op_prof_count(void);
+const xt_op_prof_record_t *xt_op_prof_get(int idx);
+
+/* One header line plus one line per record */
+int xt_op_prof_dump_csv(FILE *fp);
+/* Chrome trace event JSON (chrome://tracing, Perfetto). ticks_per_us
+   converts timestamps to microseconds, e.g. the core clock in MHz for
+   cycles or 1000 for ns. */
+int xt_op_prof_dump_chrome_trace(FILE *fp, double ticks_per_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XT_OP_PROFILER_H__ */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XT_WEIGHT_CONTAINER_H__
+#define __XT_WEIGHT_CONTAINER_H__
+
+/* Weight container: one file holding the constant tensors of a model laid
+   out the way the nnlib kernels read them, so a runtime can map the file
+   read-only and hand the tensors to the xa_nn_* calls without copying.
+
+   File layout (little endian):
+     xt_wc_header_t
+     xt_wc_entry_t[num_entries]
+     data of each entry, starting at entry.offset
+
+   Every entry's data starts at a multiple of XT_WC_ALIGN from the start of
+   the file. Tensors whose innermost dimension the kernels want padded (conv
+   filters: float32 to a multiple of 2, asym8 to a multiple of 4) are stored
+   with that dimension padded to padded_depth, padding is 0 for float and
+   zero_point for asym8. dims always hold the logical shape.
+
+   On hosts xt_wc_open() maps the file with mmap, so loading does not depend
+   on the size of the model and every process using the file shares its
+   pages. On Xtensa there is no mmap, xt_wc_open() reads the file into memory
+   and containers linked into or placed in memory by the application are
+   opened with xt_wc_init(). */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define XT_WC_MAGIC        0x43574E58u  /* "XNWC" */
+#define XT_WC_VERSION      1
+#define XT_WC_ALIGN        64
+#define XT_WC_NAME_LENGTH  32
+#define XT_WC_MAX_DIMS     4
+
+typedef enum _xt_wc_type_t
+{
+  XT_WC_TYPE_RAW     = 0,   /* Opaque bytes, dims[0] is the length */
+  XT_WC_TYPE_FLOAT32 = 1,
+  XT_WC_TYPE_INT32   = 2,
+  XT_WC_TYPE_ASYM8   = 3,
+  XT_WC_TYPE_INT8    = 4,
+  XT_WC_TYPE_INT16   = 5
+} xt_wc_type_t;
+
+typedef struct _xt_wc_header_t
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t num_entries;
+  uint32_t size;            /* Bytes in the file */
+} xt_wc_header_t;
+
+typedef struct _xt_wc_entry_t
+{
+  char     name[XT_WC_NAME_LENGTH];   /* NUL terminated */
+  uint32_t type;                      /* xt_wc_type_t */
+  uint32_t num_dims;
+  uint32_t dims[XT_WC_MAX_DIMS];      /* Logical shape, outermost first */
+  uint32_t padded_depth;              /* Stored innermost dimension */
+  int32_t  zero_point;
+  float    scale;
+  uint32_t offset;                    /* Of the data, from the start of the file */
+  uint32_t length;                    /* Stored bytes */
+  uint32_t reserved;
+} xt_wc_entry_t;
+
+typedef struct _xt_wc_t
+{
+  const uint8_t       *p_base;
+  uint32_t             size;
+  const xt_wc_entry_t *p_entries;     /* Sorted by offset */
+  uint32_t             num_entries;
+  void                *p_owned;       /* Mapped or allocated by xt_wc_open() */
+} xt_wc_t;
+
+/* Checks the header and the entry table of the container at p_buffer, which
+   must be XT_WC_ALIGN aligned and stay valid while p_wc is used. Returns 0,
+   or -1 when the container is malformed. */
+int xt_wc_init(xt_wc_t *p_wc, const void *p_buffer, uint32_t size);
+/* Maps (hosts) or reads (Xtensa) the container at path. Returns 0 or -1. */
+int xt_wc_open(xt_wc_t *p_wc, const char *path);
+/* Releases what xt_wc_open() acquired, the data is invalid afterwards. */
+void xt_wc_close(xt_wc_t *p_wc);
+
+/* NULL when there is no such entry */
+const xt_wc_entry_t *xt_wc_find(const xt_wc_t *p_wc, const char *name);
+/* Entry whose data starts at offset from the start of the container */
+const xt_wc_entry_t *xt_wc_find_offset(const xt_wc_t *p_wc, uint32_t offset);
+const void *xt_wc_data(const xt_wc_t *p_wc, const xt_wc_entry_t *p_entry);
+
+int xt_wc_type_size(uint32_t type);
+/* Bytes of the entry with its innermost dimension not padded */
+uint32_t xt_wc_logical_length(const xt_wc_entry_t *p_entry);
+
+/* Writing, for the tools that produce containers. Entries are added in
+   order with their logical (unpadded) data, which must stay valid until
+   xt_wc_writer_save(). padded_depth 0 stores them dense. Returns 0 or -1. */
+typedef struct _xt_wc_writer_t
+{
+  xt_wc_entry_t *p_entries;
+  const void   **pp_data;
+  uint32_t       num_entries;
+  uint32_t       capacity;
+} xt_wc_writer_t;
+
+void xt_wc_writer_init(xt_wc_writer_t *p_writer);
+int  xt_wc_writer_add(xt_wc_writer_t *p_writer, const char *name, uint32_t type,
+                      uint32_t num_dims, const uint32_t *p_dims, uint32_t padded_depth,
+                      float scale, int32_t zero_point, const void *p_data);
+int  xt_wc_writer_save(const xt_wc_writer_t *p_writer, const char *path);
+void xt_wc_writer_free(xt_wc_writer_t *p_writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XT_WEIGHT_CONTAINER_H__ */
@@ -243,6 +243,54 @@ int load_conv2d_ds_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, bu
   return 0;
 }
 
+/* Inverted residual block inputs, p_kernel_expand and p_bias_expand are NULL
+   for a block without expansion */
+int load_inv_res_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_kernel_expand,
+    buf1D_t *p_bias_expand, buf1D_t *p_kernel, buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point)
+{
+  if(write_file)
+  {
+    /* Set random input data */
+    set_rand_inp_buf1D(p_inp);
+    if(p_kernel_expand)
+    {
+      set_rand_inp_buf1D(p_kernel_expand);
+      set_rand_inp_buf1D(p_bias_expand);
+    }
+    set_rand_inp_buf1D(p_kernel);
+    set_rand_inp_buf1D(p_bias);
+    set_rand_inp_buf1D(p_kernel_point);
+    set_rand_inp_buf1D(p_bias_point);
+
+    /* Write input data into file */
+    write_buf1D_to_file(fptr_inp, p_inp);
+    if(p_kernel_expand)
+    {
+      write_buf1D_to_file(fptr_inp, p_kernel_expand);
+      write_buf1D_to_file(fptr_inp, p_bias_expand);
+    }
+    write_buf1D_to_file(fptr_inp, p_kernel);
+    write_buf1D_to_file(fptr_inp, p_bias);
+    write_buf1D_to_file(fptr_inp, p_kernel_point);
+    write_buf1D_to_file(fptr_inp, p_bias_point);
+  }
+  else
+  {
+    /* Read input data from file */
+    read_buf1D_from_file(fptr_inp, p_inp);
+    if(p_kernel_expand)
+    {
+      read_buf1D_from_file(fptr_inp, p_kernel_expand);
+      read_buf1D_from_file(fptr_inp, p_bias_expand);
+    }
+    read_buf1D_from_file(fptr_inp, p_kernel);
+    read_buf1D_from_file(fptr_inp, p_bias);
+    read_buf1D_from_file(fptr_inp, p_kernel_point);
+    read_buf1D_from_file(fptr_inp, p_bias_point);
+  }
+  return 0;
+}
+
 int load_pool_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp) 
 {  
   if(write_file)                                                                     
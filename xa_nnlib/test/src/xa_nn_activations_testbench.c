@@ -65,6 +65,11 @@ typedef struct _test_config_t
   int activation_min; // used in relu_asym8/f32 (activation_min_max)
   int activation_max; // used in relu_asym8/f32
   char activation[MAX_ACTIVATION_NAME_LENGTH];
+  int lstm_batch;      // lstm_cell: batches, num_elements = lstm_batch x cells
+  int lstm_cifg;       // lstm_cell: coupled input and forget gates
+  int lstm_peephole;   // lstm_cell: peephole weights
+  int lstm_cell_clip;  // lstm_cell: cell state clip, 0 for none
+  int lstm_activation; // lstm_cell: XA_NN_LSTM_CELL_ACT_* code
   int frames;
   int write_file;
   char read_inp_file_name[MAX_FILE_NAME_LENGTH];
@@ -91,6 +96,11 @@ int default_config(test_config_t *p_cfg)
     p_cfg->activation_min = 0; 
     p_cfg->activation_max = 255; 
     strcpy(p_cfg->activation,"sigmoid");
+    p_cfg->lstm_batch = 1;
+    p_cfg->lstm_cifg = 0;
+    p_cfg->lstm_peephole = 0;
+    p_cfg->lstm_cell_clip = 0;
+    p_cfg->lstm_activation = 4;
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
     p_cfg->read_inp_file_name[0] = '\0';
@@ -134,6 +144,11 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-activation_min",p_cfg->activation_min);
     ARGTYPE_ONETIME_CONFIG("-activation_max",p_cfg->activation_max);
     ARGTYPE_STRING("-activation",p_cfg->activation, MAX_ACTIVATION_NAME_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("-lstm_batch",p_cfg->lstm_batch);
+    ARGTYPE_ONETIME_CONFIG("-lstm_cifg",p_cfg->lstm_cifg);
+    ARGTYPE_ONETIME_CONFIG("-lstm_peephole",p_cfg->lstm_peephole);
+    ARGTYPE_ONETIME_CONFIG("-lstm_cell_clip",p_cfg->lstm_cell_clip);
+    ARGTYPE_ONETIME_CONFIG("-lstm_activation",p_cfg->lstm_activation);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, MAX_FILE_NAME_LENGTH);
@@ -156,7 +171,7 @@ void show_usage(void)
     printf("\t-inp_precision : 16, 32 or -1(single prec float); Default=32\n");
     printf("\t-out_precision : 16, 32, or -1(single prec float); Default=32\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-activation: sigmoid, tanh, relu, relu1, relu6 or softmax; Default=sigmoid\n");
+    printf("\t-activation: sigmoid, tanh, relu, relu1, relu6, softmax, sigmoid_lut (asym8), tanh_lut (asym8) or lstm_cell (f32); Default=sigmoid\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading input \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -173,6 +188,17 @@ void show_usage(void)
     printf("\t-activation_min: asym8 input data activation min; Default=0\n");
     printf("\t-input_range_radius: sigmoid_asym8 input parameter; Default=128\n");
     printf("\t-zero_point: sigmoid_asym8 input parameter; Default=0\n");
+    printf("\t =====================================\n ");
+    printf("\t ===== lstm_cell specific parameters =====\n ");
+    printf("\t =====================================\n ");
+    printf("\t lstm_cell reads the input, forget, cell and output gates and the cell state (num_elements each),\n");
+    printf("\t then the input, forget and output peepholes (num_elements / lstm_batch each). It writes the new\n");
+    printf("\t cell state and the output, -verify 1 checks them against the unfused sequence of kernels.\n");
+    printf("\t-lstm_batch: batches, num_elements / lstm_batch cells each; Default=1\n");
+    printf("\t-lstm_cifg: 1 for coupled input and forget gates; Default=0\n");
+    printf("\t-lstm_peephole: 1 to use the peepholes; Default=0\n");
+    printf("\t-lstm_cell_clip: cell state clip, 0 for none; Default=0\n");
+    printf("\t-lstm_activation: 0 none, 1 relu, 3 relu6, 4 tanh, 6 sigmoid; Default=4\n");
 }
 
 #ifdef NNLIB_V2
@@ -197,6 +223,35 @@ void show_usage(void)
     printf("unsupported basic operation\n"); return -1;}
 #endif
 
+#ifdef NNLIB_V2
+#define LUT_ASYM8(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL "_lut") && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    UWORD8 lut[256];\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_asym8_asym8_lut_init\
+                (\
+                    lut,\
+                    cfg.zero_point,\
+                    cfg.input_range_radius,\
+                    cfg.input_multiplier,\
+                    cfg.input_left_shift\
+                );\
+        if(!err)\
+            err = xa_nn_vec_lut_asym8_asym8\
+                (\
+                    (unsigned char *) p_out->p,\
+                    (unsigned char *) p_inp->p,\
+                    lut,\
+                    cfg.num_elements\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+#else
+#define LUT_ASYM8(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL "_lut") && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    printf("unsupported basic operation\n"); return -1;}
+#endif
+
 #ifdef NNLIB_V2
 #define RELU_ASYM8_FN(IPREC, OPREC, ACTIVATION) \
     if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
@@ -295,6 +350,128 @@ void show_usage(void)
       err = 0;\
     }
 
+#ifdef NNLIB_V2
+/* Layout of the lstm_cell input buffer, see show_usage() */
+#define LSTM_CELL_INPUT_GATE(p, n, nc)      (p)
+#define LSTM_CELL_FORGET_GATE(p, n, nc)     ((p) + (n))
+#define LSTM_CELL_CELL_GATE(p, n, nc)       ((p) + 2*(n))
+#define LSTM_CELL_OUTPUT_GATE(p, n, nc)     ((p) + 3*(n))
+#define LSTM_CELL_CELL_STATE(p, n, nc)      ((p) + 4*(n))
+#define LSTM_CELL_CELL_TO_INPUT(p, n, nc)   ((p) + 5*(n))
+#define LSTM_CELL_CELL_TO_FORGET(p, n, nc)  ((p) + 5*(n) + (nc))
+#define LSTM_CELL_CELL_TO_OUTPUT(p, n, nc)  ((p) + 5*(n) + 2*(nc))
+
+static int lstm_cell_activation(FLOAT32 *p_out, const FLOAT32 *p_inp, int activation, int n)
+{
+  switch(activation)
+  {
+    case XA_NN_LSTM_CELL_ACT_NONE:
+      memcpy(p_out, p_inp, n * sizeof(FLOAT32));
+      return 0;
+    case XA_NN_LSTM_CELL_ACT_RELU:
+      return xa_nn_vec_activation_min_max_f32_f32(p_out, p_inp, 0.0f, 3.402823466e+38f, n);
+    case XA_NN_LSTM_CELL_ACT_RELU6:
+      return xa_nn_vec_activation_min_max_f32_f32(p_out, p_inp, 0.0f, 6.0f, n);
+    case XA_NN_LSTM_CELL_ACT_TANH:
+      return xa_nn_vec_tanh_f32_f32(p_out, p_inp, n);
+    case XA_NN_LSTM_CELL_ACT_SIGMOID:
+      return xa_nn_vec_sigmoid_f32_f32(p_out, p_inp, n);
+    default:
+      return -1;
+  }
+}
+
+/* Reference for xa_nn_lstm_cell_update_f32: the cell update as the separate
+ * kernel calls the Android NN LSTM made before the fused kernel, with out of
+ * place sigmoid/tanh. p_scratch holds 5 x num_elements floats. */
+static int lstm_cell_update_unfused(FLOAT32 *p_out, const FLOAT32 *p_inp,
+                                    FLOAT32 *p_scratch, const test_config_t *p_cfg)
+{
+  const int n = p_cfg->num_elements;
+  const int n_cell = n / p_cfg->lstm_batch;
+  const FLOAT32 *p_cell_state_in = LSTM_CELL_CELL_STATE(p_inp, n, n_cell);
+  FLOAT32 *p_cell_state_out = p_out;
+  FLOAT32 *x = p_scratch;
+  FLOAT32 *input_gate = p_scratch + n;
+  FLOAT32 *forget_gate = p_scratch + 2*n;
+  FLOAT32 *cell_gate = p_scratch + 3*n;
+  FLOAT32 *output_gate = p_scratch + 4*n;
+  int b, i, err = 0;
+
+  if(!p_cfg->lstm_cifg)
+  {
+    memcpy(x, LSTM_CELL_INPUT_GATE(p_inp, n, n_cell), n * sizeof(FLOAT32));
+    for(b = 0; b < p_cfg->lstm_batch && p_cfg->lstm_peephole; b++)
+    {
+      err |= xa_nn_elm_mul_acc_f32xf32_f32(x + b*n_cell, LSTM_CELL_CELL_TO_INPUT(p_inp, n, n_cell),
+          p_cell_state_in + b*n_cell, n_cell);
+    }
+    err |= xa_nn_vec_sigmoid_f32_f32(input_gate, x, n);
+  }
+
+  memcpy(x, LSTM_CELL_FORGET_GATE(p_inp, n, n_cell), n * sizeof(FLOAT32));
+  for(b = 0; b < p_cfg->lstm_batch && p_cfg->lstm_peephole; b++)
+  {
+    err |= xa_nn_elm_mul_acc_f32xf32_f32(x + b*n_cell, LSTM_CELL_CELL_TO_FORGET(p_inp, n, n_cell),
+        p_cell_state_in + b*n_cell, n_cell);
+  }
+  err |= xa_nn_vec_sigmoid_f32_f32(forget_gate, x, n);
+  if(p_cfg->lstm_cifg)
+  {
+    for(i = 0; i < n; i++)
+    {
+      input_gate[i] = 1.0f - forget_gate[i];
+    }
+  }
+
+  err |= lstm_cell_activation(cell_gate, LSTM_CELL_CELL_GATE(p_inp, n, n_cell), p_cfg->lstm_activation, n);
+  err |= xa_nn_elm_mul_f32xf32_f32(x, forget_gate, p_cell_state_in, n);
+  err |= xa_nn_elm_mul_acc_f32xf32_f32(x, input_gate, cell_gate, n);
+  if(p_cfg->lstm_cell_clip > 0)
+  {
+    err |= xa_nn_vec_activation_min_max_f32_f32(p_cell_state_out, x,
+        -(FLOAT32)p_cfg->lstm_cell_clip, (FLOAT32)p_cfg->lstm_cell_clip, n);
+  }
+  else
+  {
+    memcpy(p_cell_state_out, x, n * sizeof(FLOAT32));
+  }
+
+  memcpy(x, LSTM_CELL_OUTPUT_GATE(p_inp, n, n_cell), n * sizeof(FLOAT32));
+  for(b = 0; b < p_cfg->lstm_batch && p_cfg->lstm_peephole; b++)
+  {
+    err |= xa_nn_elm_mul_acc_f32xf32_f32(x + b*n_cell, LSTM_CELL_CELL_TO_OUTPUT(p_inp, n, n_cell),
+        p_cell_state_out + b*n_cell, n_cell);
+  }
+  err |= xa_nn_vec_sigmoid_f32_f32(output_gate, x, n);
+  err |= lstm_cell_activation(cell_gate, p_cell_state_out, p_cfg->lstm_activation, n);
+  err |= xa_nn_elm_mul_f32xf32_f32(p_out + n, output_gate, cell_gate, n);
+
+  return err;
+}
+
+#define LSTM_CELL_F32_FN(IPREC, OPREC) \
+    if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,"lstm_cell")) {\
+      const FLOAT32 *p_in = (const FLOAT32 *)p_inp->p;\
+      const int n = cfg.num_elements, n_cell = n / cfg.lstm_batch;\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_lstm_cell_update_f32( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *)p_out->p + n, \
+          cfg.lstm_cifg ? NULL : LSTM_CELL_INPUT_GATE(p_in, n, n_cell), \
+          LSTM_CELL_FORGET_GATE(p_in, n, n_cell), LSTM_CELL_CELL_GATE(p_in, n, n_cell), \
+          LSTM_CELL_OUTPUT_GATE(p_in, n, n_cell), LSTM_CELL_CELL_STATE(p_in, n, n_cell), \
+          (cfg.lstm_peephole && !cfg.lstm_cifg) ? LSTM_CELL_CELL_TO_INPUT(p_in, n, n_cell) : NULL, \
+          cfg.lstm_peephole ? LSTM_CELL_CELL_TO_FORGET(p_in, n, n_cell) : NULL, \
+          cfg.lstm_peephole ? LSTM_CELL_CELL_TO_OUTPUT(p_in, n, n_cell) : NULL, \
+          (FLOAT32)cfg.lstm_cell_clip, cfg.lstm_activation, n_cell, cfg.lstm_batch);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+#else
+#define LSTM_CELL_F32_FN(IPREC, OPREC) \
+    if((IPREC == p_inp->precision) && !strcmp(cfg.activation,"lstm_cell")) {\
+        printf("unsupported activation\n"); return -1;} 
+#endif
+
 #if XCHAL_HAVE_HIFI4_VFPU
 #define PROCESS_ACTIVATION \
     ACTIVATION_FN(32, 32, sigmoid) \
@@ -307,15 +484,20 @@ void show_usage(void)
     else ACTIVATION_FN(32, 16, tanh) \
     else ACTIVATION_FN(32, 8, sigmoid) \
     else ACTIVATION_FN(32, 8, tanh) \
+    else ACTIVATION_FN(16, 16, sigmoid) \
+    else ACTIVATION_FN(16, 16, tanh) \
     else ACTIVATION_FN_F32(-1, -1, sigmoid) \
     else ACTIVATION_FN_F32(-1, -1, tanh) \
     else RELU_F32_FN(-1, -1, relu) \
     else RELU_F32_FN(-1, -1, relu1) \
     else RELU_F32_FN(-1, -1, relu6) \
     else ACTIVATION_FN_F32(-1, -1, softmax) \
+    else LSTM_CELL_F32_FN(-1, -1) \
     else RELU_ASYM8_FN(-3, -3, relu)\
     else SOFTMAX_ASYM8(softmax, -3, -3) \
     else SIGMOID_ASYM8(sigmoid, -3, -3) \
+    else LUT_ASYM8(sigmoid, -3, -3) \
+    else LUT_ASYM8(tanh, -3, -3) \
     else {  printf("unsupported activation\n"); return -1;} 
 #else
 #define PROCESS_ACTIVATION \
@@ -329,9 +511,13 @@ void show_usage(void)
     else ACTIVATION_FN(32, 16, tanh) \
     else ACTIVATION_FN(32, 8, sigmoid) \
     else ACTIVATION_FN(32, 8, tanh) \
+    else ACTIVATION_FN(16, 16, sigmoid) \
+    else ACTIVATION_FN(16, 16, tanh) \
     else RELU_ASYM8_FN(-3, -3, relu)\
     else SOFTMAX_ASYM8(softmax, -3, -3) \
     else SIGMOID_ASYM8(sigmoid, -3, -3) \
+    else LUT_ASYM8(sigmoid, -3, -3) \
+    else LUT_ASYM8(tanh, -3, -3) \
     else {  printf("unsupported activation\n"); return -1;} 
 #endif
 
@@ -358,6 +544,8 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_scratch;
   int scratch_size;
 #endif
+  int inp_size, out_size;
+  int lstm_cell;
 
   if(default_config(&cfg))
   {
@@ -376,6 +564,22 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
 
+  // lstm_cell reads the gates, the cell state and the peepholes, and writes
+  // the new cell state and the output
+  lstm_cell = !strcmp(cfg.activation, "lstm_cell");
+  inp_size = cfg.num_elements;
+  out_size = cfg.num_elements;
+  if(lstm_cell)
+  {
+    if(cfg.lstm_batch <= 0 || cfg.num_elements % cfg.lstm_batch)
+    {
+      printf("lstm_cell: num_elements must be a multiple of lstm_batch\n");
+      return -1;
+    }
+    inp_size = 5 * cfg.num_elements + 3 * (cfg.num_elements / cfg.lstm_batch);
+    out_size = 2 * cfg.num_elements;
+  }
+
   // Set profiler name 
   if((cfg.inp_precision == -1) || (cfg.out_precision == -1))
   {
@@ -421,17 +625,19 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open output file
   fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
-  // Open reference file if verify flag is enabled
+  // Open reference file if verify flag is enabled, lstm_cell computes its
+  // reference with the unfused kernels instead
   if(cfg.verify)
   {
-    ptr_ref =  create_buf1D(cfg.num_elements, cfg.out_precision); 
+    ptr_ref =  create_buf1D(out_size, cfg.out_precision); 
     
-    fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
+    if(!lstm_cell)
+      fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
   }
 
   // Allocate Memory
-  p_inp = create_buf1D(cfg.num_elements, cfg.inp_precision); VALIDATE_PTR(p_inp);
-  p_out = create_buf1D(cfg.num_elements, cfg.out_precision); VALIDATE_PTR(p_out);
+  p_inp = create_buf1D(inp_size, cfg.inp_precision); VALIDATE_PTR(p_inp);
+  p_out = create_buf1D(out_size, cfg.out_precision); VALIDATE_PTR(p_out);
 
 #ifdef NNLIB_V2
   if(!strcmp(cfg.activation,"softmax") && (cfg.inp_precision == -3) && (cfg.out_precision == -3))
@@ -439,6 +645,10 @@ int xa_nn_main_process(int argc, char *argv[])
       scratch_size = get_softmax_scratch_size(cfg.inp_precision, cfg.out_precision, cfg.num_elements);
       p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
   }
+  if(lstm_cell && cfg.verify)
+  {
+      p_scratch = create_buf1D(5 * cfg.num_elements, -1); VALIDATE_PTR(p_scratch);
+  }
 #endif
   
   
@@ -469,6 +679,18 @@ int xa_nn_main_process(int argc, char *argv[])
     // If verify flag enabled, compare output against reference
     if(cfg.verify)
     {
+#ifdef NNLIB_V2
+      if(lstm_cell)
+      {
+        if(lstm_cell_update_unfused((FLOAT32 *)ptr_ref->p, (const FLOAT32 *)p_inp->p,
+               (FLOAT32 *)p_scratch->p, &cfg))
+        {
+          printf("lstm_cell: unfused reference failed\n");
+          break;
+        }
+      }
+      else
+#endif
       read_buf1D_from_file(fptr_ref, ptr_ref);
       pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify);
     }
@@ -486,10 +708,17 @@ int xa_nn_main_process(int argc, char *argv[])
   // Free all buffers
   free_buf1D(p_inp);
   free_buf1D(p_out);
+#ifdef NNLIB_V2
+  if(lstm_cell && cfg.verify)
+  {
+    free_buf1D(p_scratch);
+  }
+#endif
 
   if(cfg.verify)
   {
-    fclose(fptr_ref);
+    if(!lstm_cell)
+      fclose(fptr_ref);
     free_buf1D(ptr_ref);
   }
   
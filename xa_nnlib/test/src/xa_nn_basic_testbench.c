@@ -63,6 +63,7 @@ typedef struct _test_config_t
   int  input2_left_shift;
   int  input2_multiplier;
   int  left_shift;
+  float scale;
 #endif
   int  io_length;
   int  frames;
@@ -95,6 +96,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->input2_left_shift = 0;
     p_cfg->input2_multiplier = 0x7fff;
     p_cfg->left_shift = 0;
+    p_cfg->scale = 1.0f;
     p_cfg->io_length  = 1024;
     p_cfg->io_precision = -1;
     p_cfg->frames   = 2;  
@@ -143,6 +145,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-input2_left_shift",p_cfg->input2_left_shift);                     
     ARGTYPE_ONETIME_CONFIG("-input2_multiplier",p_cfg->input2_multiplier);                
     ARGTYPE_ONETIME_CONFIG("-left_shift",p_cfg->left_shift);                           
+    ARGTYPE_ONETIME_CONFIG_F32("-scale",p_cfg->scale);
     ARGTYPE_ONETIME_CONFIG("-io_length",p_cfg->io_length);                           
     ARGTYPE_ONETIME_CONFIG("-io_precision",p_cfg->io_precision);                        
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
@@ -166,9 +169,10 @@ void show_usage(void)
 {
     printf ("Usage xt-run <binary> [Options]\n");
     printf("\t-io_length: input/output vector length; Default=1024\n");
-    printf("\t-io_precision: -3 (asym8),  -1 (single prec float); Default=-1\n");
+    printf("\t-io_precision: -3 (asym8), 16 (16-bit), -1 (single prec float); Default=-1\n");
+    printf("\t               For quantize / dequantize, precision of the quantized side\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: add, sub, mul, mul_acc, div, floor; Default=""elem_add""\n");
+    printf("\t-kernel_name: add, sub, mul, mul_acc, div, floor, requantize, quantize, dequantize; Default=""elem_add""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp1_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_inp2_file_name: Full filename for reading inputs (order - inp) \n");
@@ -192,6 +196,7 @@ void show_usage(void)
     printf ("\t-input2_left_shift: input2_left_shift(Only needed in add_asym8); Default=0\n");          
     printf ("\t-input2_multiplier: input2_multiplier(Only needed in add_asym8); Default=0x7fff\n");   
     printf ("\t-left_shift: global left_shift(Only needed in add_asym8); Default=0\n");
+    printf ("\t-scale: quantization scale(Only needed in quantize, dequantize); Default=1.0\n");
 }
 
 #define BASIC_FLOAT32(KERNEL, IPREC, OPREC) \
@@ -264,9 +269,79 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define REQUANTIZE_ASYM8(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == cfg.io_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8_asym8\
+                (\
+                    (unsigned char *) p_out->p,\
+                    cfg.output_zero_bias,\
+                    cfg.output_left_shift,\
+                    cfg.output_multiplier,\
+                    (unsigned char *) p_inp1->p,\
+                    cfg.input1_zero_bias,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define QUANTIZE_ASYM8(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (OPREC == cfg.io_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32_asym8\
+                (\
+                    (unsigned char *) p_out->p,\
+                    (FLOAT32 *) p_inp1->p,\
+                    cfg.scale,\
+                    cfg.output_zero_bias,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
 
+#define QUANTIZE_16(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (OPREC == cfg.io_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32_16\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (FLOAT32 *) p_inp1->p,\
+                    cfg.scale,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define DEQUANTIZE_ASYM8(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == cfg.io_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8_f32\
+                (\
+                    (FLOAT32 *) p_out->p,\
+                    (unsigned char *) p_inp1->p,\
+                    cfg.input1_zero_bias,\
+                    cfg.scale,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define DEQUANTIZE_16(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == cfg.io_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_16_f32\
+                (\
+                    (FLOAT32 *) p_out->p,\
+                    (WORD16 *) p_inp1->p,\
+                    cfg.scale,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+/* Float kernels, chained in front of the integer-only ones below */
 #if (XCHAL_HAVE_HIFI4_VFPU || XCHAL_HAVE_HIFI5_VFPU)
-#define PROCESS_BASIC_FUNC \
+#define PROCESS_BASIC_FUNC_F32 \
     BASIC_FLOAT32(elm_mul, -1, -1) \
     else BASIC_FLOAT32(elm_add, -1, -1) \
     else BASIC_FLOAT32(elm_sub, -1, -1) \
@@ -274,14 +349,22 @@ void show_usage(void)
     else BASIC_FLOAT32(elm_mul_acc, -1, -1) \
     else BASIC_FLOAT32(elm_div, -1, -1) \
     else FLOOR_F32(elm_floor, -1, -1) \
-    else MUL_ASYM8(elm_mul, -3, -3) \
-    else ADD_ASYM8(elm_add, -3, -3) \
-    else {  printf("unsupported basic operation\n"); return -1;}
+    else QUANTIZE_ASYM8(quantize, -1, -3) \
+    else QUANTIZE_16(quantize, -1, 16) \
+    else DEQUANTIZE_ASYM8(dequantize, -3, -1) \
+    else DEQUANTIZE_16(dequantize, 16, -1) \
+    else
 #else
-#define PROCESS_BASIC_FUNC \
-    {  printf("unsupported basic operation\n"); return -1;}
+#define PROCESS_BASIC_FUNC_F32
 #endif
 
+#define PROCESS_BASIC_FUNC \
+    PROCESS_BASIC_FUNC_F32 \
+    MUL_ASYM8(elm_mul, -3, -3) \
+    else ADD_ASYM8(elm_add, -3, -3) \
+    else REQUANTIZE_ASYM8(requantize, -3, -3) \
+    else {  printf("unsupported basic operation\n"); return -1;}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -292,6 +375,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
 
   test_config_t cfg;
+  int inp_precision, out_precision;
 
   buf1D_t *p_inp1;
   buf1D_t *p_inp2;
@@ -320,28 +404,44 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
 
+  // quantize and dequantize convert between float and io_precision
+  inp_precision = cfg.io_precision;
+  out_precision = cfg.io_precision;
+  if(!strcmp(cfg.kernel_name, "quantize"))
+  {
+    inp_precision = -1;
+  }
+  else if(!strcmp(cfg.kernel_name, "dequantize"))
+  {
+    out_precision = -1;
+  }
+
   // Set profiler name 
   if(cfg.io_precision == -1)
   {
     sprintf(profiler_name, "%s_f32", cfg.kernel_name);
-    
-    // If VFPU is not supported, return
-    if(!XCHAL_HAVE_HIFI4_VFPU)
-    {
-      printf("%s: NOT TESTED\n", profiler_name);
-      return 0;
-    }
   }
   else if(cfg.io_precision == -3)
   {
     sprintf(profiler_name, "%s_asym8", cfg.kernel_name);
   }
+  else if(cfg.io_precision == 16)
+  {
+    sprintf(profiler_name, "%s_16", cfg.kernel_name);
+  }
   else
   {
-      printf("Precision not asym8 or float\n");
+      printf("Precision not asym8, 16 or float\n");
       return -1;
   }
 
+  // If VFPU is not supported, return
+  if(((inp_precision == -1) || (out_precision == -1)) && !XCHAL_HAVE_HIFI4_VFPU)
+  {
+    printf("%s: NOT TESTED\n", profiler_name);
+    return 0;
+  }
+
   // Set profiler parameters
   sprintf(profiler_params, "N=%d", cfg.io_length);
 
@@ -369,15 +469,15 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open reference file if verify flag is enabled
   if(cfg.verify)
   {
-    ptr_ref =  create_buf1D(cfg.io_length, cfg.io_precision); 
+    ptr_ref =  create_buf1D(cfg.io_length, out_precision); 
     
     fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
   }
 
   // Allocate Memory
-  p_inp1 = create_buf1D(cfg.io_length, cfg.io_precision); VALIDATE_PTR(p_inp1);
-  p_inp2 = create_buf1D(cfg.io_length, cfg.io_precision); VALIDATE_PTR(p_inp2);
-  p_out = create_buf1D(cfg.io_length, cfg.io_precision); VALIDATE_PTR(p_out);
+  p_inp1 = create_buf1D(cfg.io_length, inp_precision); VALIDATE_PTR(p_inp1);
+  p_inp2 = create_buf1D(cfg.io_length, inp_precision); VALIDATE_PTR(p_inp2);
+  p_out = create_buf1D(cfg.io_length, out_precision); VALIDATE_PTR(p_out);
   
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, cfg.io_length, "cyc/point", 0);
 
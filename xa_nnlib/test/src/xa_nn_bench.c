@@ -0,0 +1,934 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Kernel microbenchmark: sweeps a fixed set of shapes over every kernel
+   family, times each (kernel, shape) pair over several repetitions and
+   writes one JSON record per pair. With -baseline, the minimum time of each
+   record is compared against the record with the same id in an earlier
+   result file and the program exits with 1 if any of them regressed by more
+   than -threshold percent. -tune instead writes a matXvec unroll tuning
+   table, see run_tune().
+
+   Times are CCOUNT cycles on Xtensa and nanoseconds elsewhere (see
+   xt_op_profiler.h), so results are only comparable within one target. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "xt_op_profiler.h"
+
+#define BENCH_ALIGNMENT     8
+#define MAX_ID_LENGTH       128
+#define MAX_BASELINE_RECS   512
+#define DEFAULT_REPS        10
+#define DEFAULT_THRESHOLD   5.0
+
+typedef struct _bench_shape_t
+{
+  /* matXvec: h = rows, c = cols. Vector kernels: w = vector length. */
+  int h, w, c;
+  int kh, kw;
+  int oc;           /* Output channels, channel multiplier for depthwise */
+  int stride;
+  int pad;
+} bench_shape_t;
+
+typedef struct _bench_bufs_t
+{
+  void *p_inp, *p_inp2, *p_kernel, *p_bias, *p_out, *p_scratch;
+  int inp_bytes, inp2_bytes, kernel_bytes, bias_bytes, out_bytes, scratch_bytes;
+  int out_h, out_w;
+  double work;      /* MACs, or elements for kernels without MACs */
+} bench_bufs_t;
+
+typedef enum _bench_family_t
+{
+  FAMILY_MATXVEC = 0,
+  FAMILY_CONV1D,
+  FAMILY_CONV2D,
+  FAMILY_DEPTHWISE,
+  FAMILY_POINTWISE,
+  FAMILY_POOL,
+  FAMILY_ACTIVATION,
+  FAMILY_ELEMENTWISE,
+  FAMILY_SOFTMAX,
+  FAMILY_COUNT
+} bench_family_t;
+
+typedef struct _bench_kernel_t
+{
+  const char *name;
+  bench_family_t family;
+  int precision;    /* 8, 16, 32, -1 (float) or -3 (asym8) */
+  int inp_size;     /* Element sizes in bytes */
+  int kernel_size;
+  int bias_size;
+  int out_size;
+  WORD32 (*run)(bench_bufs_t *p_bufs, const bench_shape_t *p_shape);
+} bench_kernel_t;
+
+typedef struct _bench_baseline_t
+{
+  char id[MAX_ID_LENGTH];
+  double min;
+} bench_baseline_t;
+
+/* Shape sweeps, one table per family */
+
+static const bench_shape_t matXvec_shapes[] =
+{
+  /* h=rows, c=cols */
+  { 16,  0,   64, 0, 0, 0, 0, 0},
+  { 64,  0,  256, 0, 0, 0, 0, 0},
+  {256,  0,  256, 0, 0, 0, 0, 0},
+  {256,  0, 1024, 0, 0, 0, 0, 0},
+  /* Tall-skinny, kept last so -tune entries stay in ascending row order */
+  {1024, 0,   16, 0, 0, 0, 0, 0},
+};
+
+static const bench_shape_t conv1d_shapes[] =
+{
+  { 49, 40,  1, 10, 0,  8, 2, 4},
+  {100, 16,  8,  3, 0, 32, 1, 1},
+};
+
+static const bench_shape_t conv2d_shapes[] =
+{
+  { 16, 16,  8,  3, 3, 16, 1, 1},
+  { 32, 32, 16,  3, 3, 32, 2, 1},
+  { 49, 10,  1, 10, 8,  8, 2, 4},
+};
+
+static const bench_shape_t depthwise_shapes[] =
+{
+  { 32, 32, 32,  3, 3,  1, 1, 1},
+  { 16, 16, 64,  3, 3,  1, 2, 1},
+  { 25,  5, 64,  3, 3,  1, 1, 1},
+};
+
+static const bench_shape_t pointwise_shapes[] =
+{
+  { 16, 16,  32, 0, 0,  64, 0, 0},
+  {  8,  8, 128, 0, 0, 128, 0, 0},
+  { 25,  5,  64, 0, 0,  64, 0, 0},
+};
+
+static const bench_shape_t pool_shapes[] =
+{
+  { 32, 32, 16,  2, 2,  0, 2, 0},
+  { 16, 16, 64,  3, 3,  0, 2, 1},
+  { 25,  5, 64, 25, 5,  0, 1, 0},
+};
+
+static const bench_shape_t vector_shapes[] =
+{
+  {  0,   256, 0, 0, 0, 0, 0, 0},
+  {  0,  4096, 0, 0, 0, 0, 0, 0},
+  {  0, 32768, 0, 0, 0, 0, 0, 0},
+};
+
+#define SHAPES(tbl) tbl, (int)(sizeof(tbl) / sizeof(tbl[0]))
+
+static const struct
+{
+  const char *name;
+  const bench_shape_t *p_shapes;
+  int num_shapes;
+} families[FAMILY_COUNT] =
+{
+  {"matXvec",     SHAPES(matXvec_shapes)},
+  {"conv1d",      SHAPES(conv1d_shapes)},
+  {"conv2d",      SHAPES(conv2d_shapes)},
+  {"depthwise",   SHAPES(depthwise_shapes)},
+  {"pointwise",   SHAPES(pointwise_shapes)},
+  {"pool",        SHAPES(pool_shapes)},
+  {"activation",  SHAPES(vector_shapes)},
+  {"elementwise", SHAPES(vector_shapes)},
+  {"softmax",     SHAPES(vector_shapes)},
+};
+
+/* Quantization parameters shared by the asym8 kernels, chosen to keep the
+   arithmetic in range rather than to match a real model */
+#define ASYM8_INP_ZB      (-128)
+#define ASYM8_KER_ZB      (-127)
+#define ASYM8_OUT_ZB      128
+#define ASYM8_OUT_MULT    0x40000000
+#define ASYM8_OUT_SHIFT   (-8)
+
+/* Kernel wrappers */
+
+static WORD32 run_matXvec_8x8_8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_8x8_8((WORD8 *)b->p_out, (WORD8 *)b->p_kernel, NULL,
+      (WORD8 *)b->p_inp, NULL, (WORD8 *)b->p_bias, s->h, s->c, 0, s->c, 0, 0, 0);
+}
+
+static WORD32 run_matXvec_16x16_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_16x16_16((WORD16 *)b->p_out, (WORD16 *)b->p_kernel, NULL,
+      (WORD16 *)b->p_inp, NULL, (WORD16 *)b->p_bias, s->h, s->c, 0, s->c, 0, -15, 0);
+}
+
+static WORD32 run_matXvec_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_f32xf32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_kernel, NULL,
+      (FLOAT32 *)b->p_inp, NULL, (FLOAT32 *)b->p_bias, s->h, s->c, 0, s->c, 0);
+}
+
+static WORD32 run_matXvec_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_asym8xasym8_asym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_kernel, NULL,
+      (UWORD8 *)b->p_inp, NULL, (WORD32 *)b->p_bias, s->h, s->c, 0, s->c, 0,
+      ASYM8_KER_ZB, 0, ASYM8_INP_ZB, 0, ASYM8_OUT_MULT, ASYM8_OUT_SHIFT, ASYM8_OUT_ZB);
+}
+
+static WORD32 run_matXvec_asym8_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_asym8xasym8_16((WORD16 *)b->p_out, (UWORD8 *)b->p_kernel, NULL,
+      (UWORD8 *)b->p_inp, NULL, (WORD32 *)b->p_bias, s->h, s->c, 0, s->c, 0,
+      ASYM8_KER_ZB, 0, ASYM8_INP_ZB, 0, ASYM8_OUT_MULT, ASYM8_OUT_SHIFT);
+}
+
+/* The float bias doubles as the per-row weight scales */
+static WORD32 run_matXvec_sym8xf32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_sym8xf32_f32((FLOAT32 *)b->p_out, (WORD8 *)b->p_kernel, NULL,
+      (FLOAT32 *)b->p_inp, NULL, (FLOAT32 *)b->p_bias, (FLOAT32 *)b->p_bias, NULL,
+      s->h, s->c, 0, s->c, 0, b->p_scratch);
+}
+
+static WORD32 run_conv1d_std_8x8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv1d_std_8x8((WORD8 *)b->p_out, (WORD8 *)b->p_inp, (WORD8 *)b->p_kernel,
+      (WORD8 *)b->p_bias, s->h, s->w, s->c, s->kh, s->oc, s->stride, s->pad,
+      b->out_h, 0, -7, 1, b->p_scratch);
+}
+
+static WORD32 run_conv1d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv1d_std_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_kernel,
+      (FLOAT32 *)b->p_bias, s->h, s->w, s->c, s->kh, s->oc, s->stride, s->pad,
+      b->out_h, 1, b->p_scratch);
+}
+
+static WORD32 run_conv2d_std_8x8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_8x8((WORD8 *)b->p_out, (WORD8 *)b->p_inp, (WORD8 *)b->p_kernel,
+      (WORD8 *)b->p_bias, s->h, s->w, s->c, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, b->out_h, b->out_w, 0, -7, 0, b->p_scratch);
+}
+
+static WORD32 run_conv2d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_kernel,
+      (FLOAT32 *)b->p_bias, s->h, s->w, s->c, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, b->out_h, b->out_w, 0, b->p_scratch);
+}
+
+static WORD32 run_conv2d_std_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_asym8xasym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_inp, (UWORD8 *)b->p_kernel,
+      (WORD32 *)b->p_bias, s->h, s->w, s->c, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, b->out_h, b->out_w, ASYM8_INP_ZB, ASYM8_KER_ZB,
+      ASYM8_OUT_MULT, ASYM8_OUT_SHIFT, ASYM8_OUT_ZB, 0, b->p_scratch);
+}
+
+static WORD32 run_depthwise_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_depthwise_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_kernel, (FLOAT32 *)b->p_inp,
+      (FLOAT32 *)b->p_bias, s->h, s->w, s->c, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, b->out_h, b->out_w, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_depthwise_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_depthwise_asym8xasym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_kernel, (UWORD8 *)b->p_inp,
+      (WORD32 *)b->p_bias, s->h, s->w, s->c, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, b->out_h, b->out_w, ASYM8_INP_ZB, ASYM8_KER_ZB,
+      ASYM8_OUT_MULT, ASYM8_OUT_SHIFT, ASYM8_OUT_ZB, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_pointwise_8x8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_8x8((WORD8 *)b->p_out, (WORD8 *)b->p_kernel, (WORD8 *)b->p_inp,
+      (WORD8 *)b->p_bias, s->h, s->w, s->c, s->oc, -7, 0, 1);
+}
+
+static WORD32 run_pointwise_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_kernel, (FLOAT32 *)b->p_inp,
+      (FLOAT32 *)b->p_bias, s->h, s->w, s->c, s->oc, 1);
+}
+
+static WORD32 run_pointwise_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_asym8xasym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_kernel, (UWORD8 *)b->p_inp,
+      (WORD32 *)b->p_bias, s->h, s->w, s->c, s->oc, ASYM8_INP_ZB, ASYM8_KER_ZB,
+      ASYM8_OUT_MULT, ASYM8_OUT_SHIFT, ASYM8_OUT_ZB, 1);
+}
+
+static WORD32 run_maxpool_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_maxpool_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, s->h, s->w, s->c,
+      s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_avgpool_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_avgpool_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, s->h, s->w, s->c,
+      s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_maxpool_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_maxpool_asym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_inp, s->h, s->w, s->c,
+      s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_avgpool_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_avgpool_asym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_inp, s->h, s->w, s->c,
+      s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0, b->p_scratch);
+}
+
+static WORD32 run_sigmoid_32_32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_sigmoid_32_32((WORD32 *)b->p_out, (WORD32 *)b->p_inp, s->w);
+}
+
+static WORD32 run_tanh_32_32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_tanh_32_32((WORD32 *)b->p_out, (WORD32 *)b->p_inp, s->w);
+}
+
+static WORD32 run_relu_32_32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_relu_32_32((WORD32 *)b->p_out, (WORD32 *)b->p_inp, 1 << 15, s->w);
+}
+
+static WORD32 run_sigmoid_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_sigmoid_f32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, s->w);
+}
+
+static WORD32 run_tanh_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_tanh_f32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, s->w);
+}
+
+static WORD32 run_elm_add_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_add_f32xf32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_inp2, s->w);
+}
+
+static WORD32 run_elm_mul_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_mul_f32xf32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_inp2, s->w);
+}
+
+static WORD32 run_elm_add_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_add_asym8xasym8_asym8((UWORD8 *)b->p_out, ASYM8_OUT_ZB, -20, ASYM8_OUT_MULT, 0, 255,
+      (UWORD8 *)b->p_inp, ASYM8_INP_ZB, -1, ASYM8_OUT_MULT,
+      (UWORD8 *)b->p_inp2, ASYM8_INP_ZB, -1, ASYM8_OUT_MULT, 20, s->w);
+}
+
+static WORD32 run_elm_mul_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_mul_asym8xasym8_asym8((UWORD8 *)b->p_out, ASYM8_OUT_ZB, ASYM8_OUT_SHIFT, ASYM8_OUT_MULT, 0, 255,
+      (UWORD8 *)b->p_inp, ASYM8_INP_ZB, (UWORD8 *)b->p_inp2, ASYM8_INP_ZB, s->w);
+}
+
+static WORD32 run_softmax_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_softmax_f32_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, s->w);
+}
+
+static WORD32 run_softmax_asym8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_softmax_asym8_asym8((UWORD8 *)b->p_out, (UWORD8 *)b->p_inp, -248, 23, 0x40000000,
+      s->w, b->p_scratch);
+}
+
+static const bench_kernel_t kernels[] =
+{
+  /* name                      family              prec inp ker bias out  run */
+  {"matXvec_8x8_8",            FAMILY_MATXVEC,        8, 1, 1, 1, 1, run_matXvec_8x8_8},
+  {"matXvec_16x16_16",         FAMILY_MATXVEC,       16, 2, 2, 2, 2, run_matXvec_16x16_16},
+  {"matXvec_f32xf32_f32",      FAMILY_MATXVEC,       -1, 4, 4, 4, 4, run_matXvec_f32},
+  {"matXvec_asym8xasym8_asym8",FAMILY_MATXVEC,       -3, 1, 1, 4, 1, run_matXvec_asym8},
+  {"matXvec_asym8xasym8_16",   FAMILY_MATXVEC,       -3, 1, 1, 4, 2, run_matXvec_asym8_16},
+  {"matXvec_sym8xf32_f32",     FAMILY_MATXVEC,       -1, 4, 1, 4, 4, run_matXvec_sym8xf32},
+  {"conv1d_std_8x8",           FAMILY_CONV1D,         8, 1, 1, 1, 1, run_conv1d_std_8x8},
+  {"conv1d_std_f32",           FAMILY_CONV1D,        -1, 4, 4, 4, 4, run_conv1d_std_f32},
+  {"conv2d_std_8x8",           FAMILY_CONV2D,         8, 1, 1, 1, 1, run_conv2d_std_8x8},
+  {"conv2d_std_f32",           FAMILY_CONV2D,        -1, 4, 4, 4, 4, run_conv2d_std_f32},
+  {"conv2d_std_asym8xasym8",   FAMILY_CONV2D,        -3, 1, 1, 4, 1, run_conv2d_std_asym8},
+  {"conv2d_depthwise_f32",     FAMILY_DEPTHWISE,     -1, 4, 4, 4, 4, run_depthwise_f32},
+  {"conv2d_depthwise_asym8xasym8", FAMILY_DEPTHWISE, -3, 1, 1, 4, 1, run_depthwise_asym8},
+  {"conv2d_pointwise_8x8",     FAMILY_POINTWISE,      8, 1, 1, 1, 1, run_pointwise_8x8},
+  {"conv2d_pointwise_f32",     FAMILY_POINTWISE,     -1, 4, 4, 4, 4, run_pointwise_f32},
+  {"conv2d_pointwise_asym8xasym8", FAMILY_POINTWISE, -3, 1, 1, 4, 1, run_pointwise_asym8},
+  {"maxpool_f32",              FAMILY_POOL,          -1, 4, 0, 0, 4, run_maxpool_f32},
+  {"avgpool_f32",              FAMILY_POOL,          -1, 4, 0, 0, 4, run_avgpool_f32},
+  {"maxpool_asym8",            FAMILY_POOL,          -3, 1, 0, 0, 1, run_maxpool_asym8},
+  {"avgpool_asym8",            FAMILY_POOL,          -3, 1, 0, 0, 1, run_avgpool_asym8},
+  {"vec_sigmoid_32_32",        FAMILY_ACTIVATION,    32, 4, 0, 0, 4, run_sigmoid_32_32},
+  {"vec_tanh_32_32",           FAMILY_ACTIVATION,    32, 4, 0, 0, 4, run_tanh_32_32},
+  {"vec_relu_32_32",           FAMILY_ACTIVATION,    32, 4, 0, 0, 4, run_relu_32_32},
+  {"vec_sigmoid_f32_f32",      FAMILY_ACTIVATION,    -1, 4, 0, 0, 4, run_sigmoid_f32},
+  {"vec_tanh_f32_f32",         FAMILY_ACTIVATION,    -1, 4, 0, 0, 4, run_tanh_f32},
+  {"elm_add_f32xf32_f32",      FAMILY_ELEMENTWISE,   -1, 4, 0, 0, 4, run_elm_add_f32},
+  {"elm_mul_f32xf32_f32",      FAMILY_ELEMENTWISE,   -1, 4, 0, 0, 4, run_elm_mul_f32},
+  {"elm_add_asym8xasym8_asym8",FAMILY_ELEMENTWISE,   -3, 1, 0, 0, 1, run_elm_add_asym8},
+  {"elm_mul_asym8xasym8_asym8",FAMILY_ELEMENTWISE,   -3, 1, 0, 0, 1, run_elm_mul_asym8},
+  {"vec_softmax_f32_f32",      FAMILY_SOFTMAX,       -1, 4, 0, 0, 4, run_softmax_f32},
+  {"vec_softmax_asym8_asym8",  FAMILY_SOFTMAX,       -3, 1, 0, 0, 1, run_softmax_asym8},
+};
+
+static int out_dim(int in, int k, int stride, int pad)
+{
+  return (in + 2 * pad - k) / stride + 1;
+}
+
+/* Sizes every buffer of one (kernel, shape) pair and the work it does */
+static void size_buffers(bench_bufs_t *b, const bench_kernel_t *k, const bench_shape_t *s)
+{
+  int out_elms = 0;
+  memset(b, 0, sizeof(*b));
+  switch(k->family)
+  {
+    case FAMILY_MATXVEC:
+      b->inp_bytes = s->c * k->inp_size;
+      b->kernel_bytes = s->h * s->c * k->kernel_size;
+      b->bias_bytes = s->h * k->bias_size;
+      out_elms = s->h;
+      b->work = (double)s->h * s->c;
+      /* Hybrid kernel: int8 weights, float vector quantized into scratch */
+      if(k->precision == -1 && k->kernel_size == 1)
+        b->scratch_bytes = xa_nn_matXvec_sym8xf32_f32_getsize(s->c, 0);
+      break;
+    case FAMILY_CONV1D:
+      b->out_h = out_dim(s->h, s->kh, s->stride, s->pad);
+      b->inp_bytes = s->h * s->w * s->c * k->inp_size;
+      b->kernel_bytes = s->oc * s->kh * s->w * s->c * k->kernel_size;
+      b->bias_bytes = s->oc * k->bias_size;
+      out_elms = b->out_h * s->oc;
+      b->work = (double)out_elms * s->kh * s->w * s->c;
+      b->scratch_bytes = xa_nn_conv1d_std_getsize(s->kh, s->w, s->c, k->precision);
+      break;
+    case FAMILY_CONV2D:
+      b->out_h = out_dim(s->h, s->kh, s->stride, s->pad);
+      b->out_w = out_dim(s->w, s->kw, s->stride, s->pad);
+      b->inp_bytes = s->h * s->w * s->c * k->inp_size;
+      b->kernel_bytes = s->oc * s->kh * s->kw * s->c * k->kernel_size;
+      b->bias_bytes = s->oc * k->bias_size;
+      out_elms = b->out_h * b->out_w * s->oc;
+      b->work = (double)out_elms * s->kh * s->kw * s->c;
+      b->scratch_bytes = xa_nn_conv2d_std_getsize(s->h, s->c, s->kh, s->kw, s->stride, s->pad,
+          b->out_h, k->precision);
+      break;
+    case FAMILY_DEPTHWISE:
+      b->out_h = out_dim(s->h, s->kh, s->stride, s->pad);
+      b->out_w = out_dim(s->w, s->kw, s->stride, s->pad);
+      b->inp_bytes = s->h * s->w * s->c * k->inp_size;
+      b->kernel_bytes = s->kh * s->kw * s->c * s->oc * k->kernel_size;
+      b->bias_bytes = s->c * s->oc * k->bias_size;
+      out_elms = b->out_h * b->out_w * s->c * s->oc;
+      b->work = (double)out_elms * s->kh * s->kw;
+      b->scratch_bytes = xa_nn_conv2d_depthwise_getsize(s->h, s->w, s->c, s->kh, s->kw, s->oc,
+          s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, k->precision, 0);
+      break;
+    case FAMILY_POINTWISE:
+      b->inp_bytes = s->h * s->w * s->c * k->inp_size;
+      b->kernel_bytes = s->oc * s->c * k->kernel_size;
+      b->bias_bytes = s->oc * k->bias_size;
+      out_elms = s->h * s->w * s->oc;
+      b->work = (double)out_elms * s->c;
+      break;
+    case FAMILY_POOL:
+      b->out_h = out_dim(s->h, s->kh, s->stride, s->pad);
+      b->out_w = out_dim(s->w, s->kw, s->stride, s->pad);
+      b->inp_bytes = s->h * s->w * s->c * k->inp_size;
+      out_elms = b->out_h * b->out_w * s->c;
+      b->work = out_elms;
+      if(!strncmp(k->name, "maxpool", 7))
+        b->scratch_bytes = xa_nn_maxpool_getsize(s->c, k->precision, k->precision, s->h, s->w,
+            s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0);
+      else
+        b->scratch_bytes = xa_nn_avgpool_getsize(s->c, k->precision, k->precision, s->h, s->w,
+            s->kh, s->kw, s->stride, s->stride, s->pad, s->pad, b->out_h, b->out_w, 0, 0);
+      break;
+    case FAMILY_ELEMENTWISE:
+      b->inp2_bytes = s->w * k->inp_size;
+      /* fall through */
+    case FAMILY_ACTIVATION:
+    case FAMILY_SOFTMAX:
+      b->inp_bytes = s->w * k->inp_size;
+      out_elms = s->w;
+      b->work = s->w;
+      if(k->family == FAMILY_SOFTMAX && k->precision == -3)
+        b->scratch_bytes = get_softmax_scratch_size(-3, -3, s->w);
+      break;
+    default:
+      break;
+  }
+  b->out_bytes = out_elms * k->out_size;
+}
+
+static void *alloc_fill(int bytes, int is_float)
+{
+  void *p;
+  int i;
+  if(bytes <= 0)
+    return NULL;
+  /* Round up so that vectorized tails never read past the allocation */
+  bytes = (bytes + BENCH_ALIGNMENT - 1) & ~(BENCH_ALIGNMENT - 1);
+  p = malloc(bytes);
+  if(p == NULL)
+    return NULL;
+  if(is_float)
+  {
+    for(i = 0; i < bytes / 4; i++)
+      ((FLOAT32 *)p)[i] = (FLOAT32)((rand() & 0xff) - 128) / 128.0f;
+  }
+  else
+  {
+    for(i = 0; i < bytes; i++)
+      ((UWORD8 *)p)[i] = (UWORD8)rand();
+  }
+  return p;
+}
+
+static void free_buffers(bench_bufs_t *b)
+{
+  free(b->p_inp);
+  free(b->p_inp2);
+  free(b->p_kernel);
+  free(b->p_bias);
+  free(b->p_out);
+  free(b->p_scratch);
+}
+
+static int alloc_buffers(bench_bufs_t *b, const bench_kernel_t *k)
+{
+  int is_float = (k->precision == -1);
+  b->p_inp = alloc_fill(b->inp_bytes, is_float);
+  b->p_inp2 = alloc_fill(b->inp2_bytes, is_float);
+  b->p_kernel = alloc_fill(b->kernel_bytes, is_float);
+  b->p_bias = alloc_fill(b->bias_bytes, is_float);
+  b->p_out = alloc_fill(b->out_bytes, 0);
+  b->p_scratch = alloc_fill(b->scratch_bytes, 0);
+  if((b->inp_bytes && !b->p_inp) || (b->inp2_bytes && !b->p_inp2) ||
+     (b->kernel_bytes && !b->p_kernel) || (b->bias_bytes && !b->p_bias) ||
+     (b->out_bytes && !b->p_out) || (b->scratch_bytes && !b->p_scratch))
+  {
+    free_buffers(b);
+    return -1;
+  }
+  return 0;
+}
+
+static void format_id(char *p_id, const bench_kernel_t *k, const bench_shape_t *s)
+{
+  switch(k->family)
+  {
+    case FAMILY_MATXVEC:
+      sprintf(p_id, "%s/%dx%d", k->name, s->h, s->c);
+      break;
+    case FAMILY_POINTWISE:
+      sprintf(p_id, "%s/%dx%dx%d_oc%d", k->name, s->h, s->w, s->c, s->oc);
+      break;
+    case FAMILY_ACTIVATION:
+    case FAMILY_ELEMENTWISE:
+    case FAMILY_SOFTMAX:
+      sprintf(p_id, "%s/%d", k->name, s->w);
+      break;
+    default:
+      sprintf(p_id, "%s/%dx%dx%d_k%dx%d_oc%d_s%d_p%d", k->name, s->h, s->w, s->c,
+          s->kh, s->kw, s->oc, s->stride, s->pad);
+      break;
+  }
+}
+
+/* Baseline files are our own output, one record per line, so a line scan for
+   the id and min fields is enough */
+static int load_baseline(const char *p_path, bench_baseline_t *p_recs, int max_recs)
+{
+  FILE *fp = fopen(p_path, "r");
+  char line[1024];
+  int count = 0;
+  if(fp == NULL)
+    return -1;
+  while(count < max_recs && fgets(line, sizeof(line), fp) != NULL)
+  {
+    char *p_id = strstr(line, "\"id\":\"");
+    char *p_min = strstr(line, "\"min\":");
+    char *p_end;
+    if(p_id == NULL || p_min == NULL)
+      continue;
+    p_id += 6;
+    p_end = strchr(p_id, '"');
+    if(p_end == NULL || p_end - p_id >= MAX_ID_LENGTH)
+      continue;
+    memcpy(p_recs[count].id, p_id, p_end - p_id);
+    p_recs[count].id[p_end - p_id] = '\0';
+    p_recs[count].min = atof(p_min + 6);
+    count++;
+  }
+  fclose(fp);
+  return count;
+}
+
+static const bench_baseline_t *find_baseline(const bench_baseline_t *p_recs, int count, const char *p_id)
+{
+  int i;
+  for(i = 0; i < count; i++)
+  {
+    if(!strcmp(p_recs[i].id, p_id))
+      return &p_recs[i];
+  }
+  return NULL;
+}
+
+/* -tune: times every row / vector unroll of the batch matXvec kernels on the
+   matXvec shapes and writes the fastest one per (precision, shape, vector
+   count) as a xa_nn_matXvec_unroll_entry_t table for
+   xa_nn_matXvec_unroll_select(). Entries are in ascending shape order, so
+   the first one that bounds a query is the closest measured shape. The
+   vector count 1 entries are also what the single vector _unroll kernels
+   select from, so they only list blocks of one vector. */
+
+static const int tune_vec_counts[] = {1, 2, 4};
+
+static const WORD32 tune_unrolls[] =
+{
+  XA_NN_MATXVEC_UNROLL(1, 1), XA_NN_MATXVEC_UNROLL(1, 2), XA_NN_MATXVEC_UNROLL(1, 4),
+  XA_NN_MATXVEC_UNROLL(2, 1), XA_NN_MATXVEC_UNROLL(2, 2), XA_NN_MATXVEC_UNROLL(2, 4),
+  XA_NN_MATXVEC_UNROLL(4, 1), XA_NN_MATXVEC_UNROLL(4, 2), XA_NN_MATXVEC_UNROLL(8, 1),
+};
+
+static const struct
+{
+  int mat_precision, vec_precision;   /* Bits, bias has vec_precision */
+  int out_size;
+} tune_precisions[] =
+{
+  { 8,  8, 4},
+  { 8, 16, 8},
+  {16, 16, 8},
+};
+
+#define MAX_TUNE_VECS 4
+
+static WORD32 run_matXvec_unroll(int prec, void **pp_out, void *p_mat, void **pp_vec, void *p_bias,
+    const bench_shape_t *s, int vec_count, WORD32 unroll)
+{
+  switch(prec)
+  {
+    case 0:
+      return xa_nn_matXvec_batch_8x8_32_unroll((WORD32 **)pp_out, (WORD8 *)p_mat, (WORD8 **)pp_vec,
+          (WORD8 *)p_bias, s->h, s->c, s->c, -7, 0, vec_count, unroll);
+    case 1:
+      return xa_nn_matXvec_batch_8x16_64_unroll((WORD64 **)pp_out, (WORD8 *)p_mat, (WORD16 **)pp_vec,
+          (WORD16 *)p_bias, s->h, s->c, s->c, -7, 0, vec_count, unroll);
+    default:
+      return xa_nn_matXvec_batch_16x16_64_unroll((WORD64 **)pp_out, (WORD16 *)p_mat, (WORD16 **)pp_vec,
+          (WORD16 *)p_bias, s->h, s->c, s->c, -15, 0, vec_count, unroll);
+  }
+}
+
+static int run_tune(const char *p_path, int reps)
+{
+  FILE *fp = fopen(p_path, "w");
+  int p, sh, v, u, i, r;
+  if(fp == NULL)
+  {
+    printf("Unable to open %s\n", p_path);
+    return -1;
+  }
+
+  fprintf(fp, "/* Generated by xa_nn_bench -tune, min of %d reps in %s */\n", reps, XT_OP_PROF_TIME_UNIT);
+  fprintf(fp, "static const xa_nn_matXvec_unroll_entry_t xa_nn_matXvec_unroll_table[] =\n{\n");
+  fprintf(fp, "  /* mat vec max_rows max_cols max_vecs unroll */\n");
+
+  for(p = 0; p < (int)(sizeof(tune_precisions) / sizeof(tune_precisions[0])); p++)
+  {
+    int mat_size = tune_precisions[p].mat_precision / 8;
+    int vec_size = tune_precisions[p].vec_precision / 8;
+
+    for(sh = 0; sh < (int)(sizeof(matXvec_shapes) / sizeof(matXvec_shapes[0])); sh++)
+    {
+      const bench_shape_t *p_shape = &matXvec_shapes[sh];
+      void *p_mat = alloc_fill(p_shape->h * p_shape->c * mat_size, 0);
+      void *p_bias = alloc_fill(p_shape->h * vec_size, 0);
+      void *p_vec[MAX_TUNE_VECS], *p_out[MAX_TUNE_VECS];
+      int ok = (p_mat != NULL && p_bias != NULL);
+
+      for(i = 0; i < MAX_TUNE_VECS; i++)
+      {
+        p_vec[i] = alloc_fill(p_shape->c * vec_size, 0);
+        p_out[i] = alloc_fill(p_shape->h * tune_precisions[p].out_size, 0);
+        ok = ok && p_vec[i] != NULL && p_out[i] != NULL;
+      }
+
+      for(v = 0; ok && v < (int)(sizeof(tune_vec_counts) / sizeof(tune_vec_counts[0])); v++)
+      {
+        int vec_count = tune_vec_counts[v];
+        WORD32 best_unroll = 0;
+        double best = 0;
+
+        for(u = 0; u < (int)(sizeof(tune_unrolls) / sizeof(tune_unrolls[0])); u++)
+        {
+          double min = 0;
+          /* A vector block wider than the batch only times the tail loop */
+          if(XA_NN_MATXVEC_UNROLL_VECS(tune_unrolls[u]) > vec_count)
+            continue;
+          /* Warm-up run, also catches argument errors before timing */
+          if(run_matXvec_unroll(p, p_out, p_mat, p_vec, p_bias, p_shape, vec_count, tune_unrolls[u]) != 0)
+            continue;
+          for(r = 0; r < reps; r++)
+          {
+            uint64_t start = xt_op_prof_timestamp();
+            double t;
+            run_matXvec_unroll(p, p_out, p_mat, p_vec, p_bias, p_shape, vec_count, tune_unrolls[u]);
+            t = (double)(xt_op_prof_timestamp() - start);
+            min = (r == 0 || t < min) ? t : min;
+          }
+          if(best_unroll == 0 || min < best)
+          {
+            best = min;
+            best_unroll = tune_unrolls[u];
+          }
+        }
+        if(best_unroll == 0)
+        {
+          fprintf(stderr, "tune %dx%d/%dx%d vecs %d: no variant ran\n", tune_precisions[p].mat_precision,
+              tune_precisions[p].vec_precision, p_shape->h, p_shape->c, vec_count);
+          continue;
+        }
+        fprintf(fp, "  {%2d, %2d, %4d, %4d, %d, XA_NN_MATXVEC_UNROLL(%d, %d)}, /* %.0f */\n",
+            tune_precisions[p].mat_precision, tune_precisions[p].vec_precision,
+            p_shape->h, p_shape->c, vec_count,
+            XA_NN_MATXVEC_UNROLL_ROWS(best_unroll), XA_NN_MATXVEC_UNROLL_VECS(best_unroll), best);
+      }
+
+      if(!ok)
+        fprintf(stderr, "tune %dx%d/%dx%d: setup failed\n", tune_precisions[p].mat_precision,
+            tune_precisions[p].vec_precision, p_shape->h, p_shape->c);
+      free(p_mat);
+      free(p_bias);
+      for(i = 0; i < MAX_TUNE_VECS; i++)
+      {
+        free(p_vec[i]);
+        free(p_out[i]);
+      }
+    }
+  }
+
+  fprintf(fp, "};\n");
+  fclose(fp);
+  return 0;
+}
+
+static void show_usage(void)
+{
+  printf("Usage xt-run <binary> [Options]\n");
+  printf("\t-reps: number of timed repetitions per shape; Default=%d\n", DEFAULT_REPS);
+  printf("\t-filter: only run kernels whose name or family contains this string\n");
+  printf("\t-out: JSON result file; Default=stdout\n");
+  printf("\t-baseline: JSON result file of an earlier run to compare against\n");
+  printf("\t-threshold: regression threshold in percent on min time; Default=%.1f\n", DEFAULT_THRESHOLD);
+  printf("\t-tune: write a matXvec unroll tuning table to this file instead of benchmarking\n");
+  printf("\t-h: help\n");
+}
+
+int main(int argc, char *argv[])
+{
+  int reps = DEFAULT_REPS;
+  double threshold = DEFAULT_THRESHOLD;
+  const char *p_filter = NULL;
+  const char *p_out_path = NULL;
+  const char *p_base_path = NULL;
+  const char *p_tune_path = NULL;
+  static bench_baseline_t baseline[MAX_BASELINE_RECS];
+  int num_baseline = 0;
+  int num_regressions = 0;
+  int first = 1;
+  uint64_t *p_ticks;
+  FILE *fp;
+  int i, k, sh, r;
+
+  for(i = 1; i < argc; i++)
+  {
+    if(!strcmp(argv[i], "-h"))
+    {
+      show_usage();
+      return 0;
+    }
+    else if(!strcmp(argv[i], "-reps") && i + 1 < argc)
+      reps = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-filter") && i + 1 < argc)
+      p_filter = argv[++i];
+    else if(!strcmp(argv[i], "-out") && i + 1 < argc)
+      p_out_path = argv[++i];
+    else if(!strcmp(argv[i], "-baseline") && i + 1 < argc)
+      p_base_path = argv[++i];
+    else if(!strcmp(argv[i], "-threshold") && i + 1 < argc)
+      threshold = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-tune") && i + 1 < argc)
+      p_tune_path = argv[++i];
+    else
+    {
+      printf("Invalid argument: %s\n", argv[i]);
+      show_usage();
+      return -1;
+    }
+  }
+  if(reps <= 0)
+    reps = DEFAULT_REPS;
+
+  if(p_tune_path != NULL)
+  {
+    srand(0);
+    return run_tune(p_tune_path, reps) ? -1 : 0;
+  }
+
+  if(p_base_path != NULL)
+  {
+    num_baseline = load_baseline(p_base_path, baseline, MAX_BASELINE_RECS);
+    if(num_baseline < 0)
+    {
+      printf("Unable to open baseline %s\n", p_base_path);
+      return -1;
+    }
+  }
+
+  fp = (p_out_path != NULL) ? fopen(p_out_path, "w") : stdout;
+  if(fp == NULL)
+  {
+    printf("Unable to open %s\n", p_out_path);
+    return -1;
+  }
+
+  p_ticks = (uint64_t *)malloc(reps * sizeof(uint64_t));
+  if(p_ticks == NULL)
+    return -1;
+
+  srand(0);
+  fprintf(fp, "{\"unit\":\"%s\",\"reps\":%d,\"results\":[", XT_OP_PROF_TIME_UNIT, reps);
+
+  for(k = 0; k < (int)(sizeof(kernels) / sizeof(kernels[0])); k++)
+  {
+    const bench_kernel_t *p_kernel = &kernels[k];
+    const char *p_family = families[p_kernel->family].name;
+
+    if(p_filter != NULL && !strstr(p_kernel->name, p_filter) && !strstr(p_family, p_filter))
+      continue;
+
+    for(sh = 0; sh < families[p_kernel->family].num_shapes; sh++)
+    {
+      const bench_shape_t *p_shape = &families[p_kernel->family].p_shapes[sh];
+      const bench_baseline_t *p_base;
+      bench_bufs_t bufs;
+      char id[MAX_ID_LENGTH];
+      double mean = 0, var = 0, min, max, bytes;
+      WORD32 status;
+
+      format_id(id, p_kernel, p_shape);
+      size_buffers(&bufs, p_kernel, p_shape);
+      if(bufs.scratch_bytes < 0 || alloc_buffers(&bufs, p_kernel) != 0)
+      {
+        fprintf(stderr, "%s: setup failed\n", id);
+        continue;
+      }
+
+      /* Warm-up run, also catches argument errors before timing */
+      status = p_kernel->run(&bufs, p_shape);
+      for(r = 0; r < reps && status == 0; r++)
+      {
+        uint64_t start = xt_op_prof_timestamp();
+        p_kernel->run(&bufs, p_shape);
+        p_ticks[r] = xt_op_prof_timestamp() - start;
+      }
+      free_buffers(&bufs);
+
+      fprintf(fp, "%s\n{\"id\":\"%s\",\"kernel\":\"%s\",\"family\":\"%s\",\"status\":%d",
+          first ? "" : ",", id, p_kernel->name, p_family, (int)status);
+      first = 0;
+      if(status != 0)
+      {
+        fprintf(fp, "}");
+        fprintf(stderr, "%s: kernel returned %d\n", id, (int)status);
+        continue;
+      }
+
+      min = max = (double)p_ticks[0];
+      for(r = 0; r < reps; r++)
+      {
+        double t = (double)p_ticks[r];
+        mean += t;
+        min = (t < min) ? t : min;
+        max = (t > max) ? t : max;
+      }
+      mean /= reps;
+      for(r = 0; r < reps; r++)
+        var += ((double)p_ticks[r] - mean) * ((double)p_ticks[r] - mean);
+      var /= reps;
+      bytes = (double)bufs.inp_bytes + bufs.inp2_bytes + bufs.kernel_bytes + bufs.bias_bytes + bufs.out_bytes;
+
+      fprintf(fp, ",\"work\":%.0f,\"work_unit\":\"%s\",\"bytes\":%.0f"
+          ",\"mean\":%.1f,\"min\":%.1f,\"max\":%.1f,\"stddev\":%.2f"
+          ",\"per_work\":%.4f,\"bytes_per_unit\":%.4f",
+          bufs.work, (p_kernel->family <= FAMILY_POINTWISE) ? "mac" : "elm", bytes,
+          mean, min, max, sqrt(var), min / bufs.work, (min > 0) ? bytes / min : 0.0);
+
+      p_base = find_baseline(baseline, num_baseline, id);
+      if(p_base != NULL && p_base->min > 0)
+      {
+        double ratio = min / p_base->min;
+        int regressed = ratio > 1.0 + threshold / 100.0;
+        fprintf(fp, ",\"baseline_min\":%.1f,\"ratio\":%.4f,\"regression\":%s",
+            p_base->min, ratio, regressed ? "true" : "false");
+        if(regressed)
+        {
+          fprintf(stderr, "REGRESSION %s: %.1f -> %.1f %s (%+.1f%%)\n", id,
+              p_base->min, min, XT_OP_PROF_TIME_UNIT, (ratio - 1.0) * 100.0);
+          num_regressions++;
+        }
+      }
+      fprintf(fp, "}");
+    }
+  }
+
+  fprintf(fp, "\n]}\n");
+  if(fp != stdout)
+    fclose(fp);
+  free(p_ticks);
+
+  if(p_base_path != NULL)
+    fprintf(stderr, "%d regression(s) over %.1f%% against %s\n", num_regressions, threshold, p_base_path);
+
+  return num_regressions ? 1 : 0;
+}
@@ -159,6 +159,7 @@ typedef struct _test_config_t
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_out_file_name[XA_MAX_CMD_LINE_LENGTH];
   int verify;
+  int num_workers;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -195,6 +196,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_inp_file_name[0]='\0';
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
+    p_cfg->num_workers = 1;
 
     return 0;
   }
@@ -247,6 +249,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
+    ARGTYPE_ONETIME_CONFIG("-num_workers",p_cfg->num_workers);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -371,6 +374,7 @@ void show_usage(void)
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp, kernel, bias, (kernel_point, bias_point for conv2d_depth kernel)) \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
+    printf("\t-num_workers: XA_NNLIB_CNN_NUM_WORKERS to split process across, output must match a single worker; Default=1\n");
 }
 
 
@@ -578,7 +582,10 @@ int xa_nn_main_process(int argc, char *argv[])
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", persistent_size);
       return persistent_size;
     }
-    scratch_size = xa_nnlib_cnn_get_scratch_fast(&cnn_cfg);   
+    if(cfg.num_workers > 1)
+      scratch_size = xa_nnlib_cnn_get_scratch_workers(&cnn_cfg, cfg.num_workers);
+    else
+      scratch_size = xa_nnlib_cnn_get_scratch_fast(&cnn_cfg);   
     if(scratch_size < 0)
     {
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", scratch_size);
@@ -609,6 +616,16 @@ int xa_nn_main_process(int argc, char *argv[])
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
       return err;
     }
+
+    if(cfg.num_workers > 1)
+    {
+      err = xa_nnlib_cnn_set_config(cnn_handle, XA_NNLIB_CNN_NUM_WORKERS, &cfg.num_workers);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+        return err;
+      }
+    }
   }
   
   /* Set up kernel and bias pointers */
@@ -82,6 +82,31 @@ typedef struct _test_config_t
   int out_multiplier;
   int out_shift;
   int out_zero_bias;
+  int out_activation_min;
+  int out_activation_max;
+  int expand_channels;
+  int residual;
+  int expand_out_multiplier;
+  int expand_out_shift;
+  int expand_out_zero_bias;
+  int expand_activation_min;
+  int expand_activation_max;
+  int dw_out_multiplier;
+  int dw_out_shift;
+  int dw_out_zero_bias;
+  int dw_activation_min;
+  int dw_activation_max;
+  int add_out_zero_bias;
+  int add_out_left_shift;
+  int add_out_multiplier;
+  int add_activation_min;
+  int add_activation_max;
+  int add_inp1_left_shift;
+  int add_inp1_multiplier;
+  int add_inp2_left_shift;
+  int add_inp2_multiplier;
+  int add_left_shift;
+  int out_channel_slices;
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
@@ -126,6 +151,31 @@ int default_config(test_config_t *p_cfg)
     p_cfg->out_multiplier = 0x40000000;
     p_cfg->out_shift = -8;
     p_cfg->out_zero_bias = 128;
+    p_cfg->out_activation_min = 0;
+    p_cfg->out_activation_max = 255;
+    p_cfg->expand_channels = 0;
+    p_cfg->residual = 0;
+    p_cfg->out_channel_slices = 0;
+    p_cfg->expand_out_multiplier = 0x40000000;
+    p_cfg->expand_out_shift = -8;
+    p_cfg->expand_out_zero_bias = 128;
+    p_cfg->expand_activation_min = 0;
+    p_cfg->expand_activation_max = 255;
+    p_cfg->dw_out_multiplier = 0x40000000;
+    p_cfg->dw_out_shift = -8;
+    p_cfg->dw_out_zero_bias = 128;
+    p_cfg->dw_activation_min = 0;
+    p_cfg->dw_activation_max = 255;
+    p_cfg->add_out_zero_bias = 128;
+    p_cfg->add_out_left_shift = -20;
+    p_cfg->add_out_multiplier = 0x40000000;
+    p_cfg->add_activation_min = 0;
+    p_cfg->add_activation_max = 255;
+    p_cfg->add_inp1_left_shift = 0;
+    p_cfg->add_inp1_multiplier = 0x40000000;
+    p_cfg->add_inp2_left_shift = 0;
+    p_cfg->add_inp2_multiplier = 0x40000000;
+    p_cfg->add_left_shift = 20;
     strcpy(p_cfg->kernel_name, "conv2d_std");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
@@ -186,6 +236,31 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-out_multiplier",p_cfg->out_multiplier);
     ARGTYPE_ONETIME_CONFIG("-out_shift",p_cfg->out_shift);
     ARGTYPE_ONETIME_CONFIG("-out_zero_bias",p_cfg->out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_min",p_cfg->out_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_max",p_cfg->out_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-expand_channels",p_cfg->expand_channels);
+    ARGTYPE_ONETIME_CONFIG("-residual",p_cfg->residual);
+    ARGTYPE_ONETIME_CONFIG("-out_channel_slices",p_cfg->out_channel_slices);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_multiplier",p_cfg->expand_out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_shift",p_cfg->expand_out_shift);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_zero_bias",p_cfg->expand_out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-expand_activation_min",p_cfg->expand_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-expand_activation_max",p_cfg->expand_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_multiplier",p_cfg->dw_out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_shift",p_cfg->dw_out_shift);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_zero_bias",p_cfg->dw_out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-dw_activation_min",p_cfg->dw_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-dw_activation_max",p_cfg->dw_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-add_out_zero_bias",p_cfg->add_out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-add_out_left_shift",p_cfg->add_out_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-add_out_multiplier",p_cfg->add_out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-add_activation_min",p_cfg->add_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-add_activation_max",p_cfg->add_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-add_inp1_left_shift",p_cfg->add_inp1_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-add_inp1_multiplier",p_cfg->add_inp1_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-add_inp2_left_shift",p_cfg->add_inp2_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-add_inp2_multiplier",p_cfg->add_inp2_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-add_left_shift",p_cfg->add_left_shift);
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
@@ -233,17 +308,44 @@ void show_usage(void)
     printf("\t-out_multiplier: output multiplier in Q31 format for asym8, 0x0 to 0x7fffffff; Default=0x40000000\n");
     printf("\t-out_shift: output shift for asym8, 31 to -31; Default=-8\n");
     printf("\t-out_zero_bias: output zero bias for asym8, 0 to 255; Default=128\n");
+    printf("\t-out_activation_min: output clamp minimum for asym8 conv2d_point, 0 to 255; Default=0\n");
+    printf("\t-out_activation_max: output clamp maximum for asym8 conv2d_point, 0 to 255; Default=255\n");
+    printf("\t-expand_channels: conv2d_inv_res expanded channels, 0 for a block without expansion; Default=0\n");
+    printf("\t-residual: conv2d_inv_res, 1 to add the input to the output; Default=0\n");
+    printf("\t-expand_out_multiplier, -expand_out_shift, -expand_out_zero_bias: conv2d_inv_res expansion output quantization; Default=0x40000000, -8, 128\n");
+    printf("\t-expand_activation_min, -expand_activation_max: conv2d_inv_res expansion clamp (also used for f32); Default=0, 255\n");
+    printf("\t-dw_out_multiplier, -dw_out_shift, -dw_out_zero_bias: conv2d_inv_res depthwise output quantization; Default=0x40000000, -8, 128\n");
+    printf("\t-dw_activation_min, -dw_activation_max: conv2d_inv_res depthwise clamp (also used for f32); Default=0, 255\n");
+    printf("\t-add_out_zero_bias, -add_out_left_shift, -add_out_multiplier: conv2d_inv_res residual add output quantization; Default=128, -20, 0x40000000\n");
+    printf("\t-add_activation_min, -add_activation_max: conv2d_inv_res residual add output clamp; Default=0, 255\n");
+    printf("\t-add_inp1_left_shift, -add_inp1_multiplier: conv2d_inv_res residual add projection scaling; Default=0, 0x40000000\n");
+    printf("\t-add_inp2_left_shift, -add_inp2_multiplier: conv2d_inv_res residual add input scaling; Default=0, 0x40000000\n");
+    printf("\t-add_left_shift: conv2d_inv_res residual add input left shift; Default=20\n");
 #endif /* NNLIB_V2 */
+    printf("\t-out_channel_slices: conv2d_std, N > 0 also computes the output in N output channel ranges with xa_nn_conv2d_std_range_* and checks it matches; Default=0\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: conv2d_std, conv2d_depth, conv1d_std; Default="" : conv2d_std\n");
+    printf("\t-kernel_name: conv2d_std, conv2d_depth, conv2d_point, conv2d_inv_res, conv1d_std, conv1d_std_stream; Default="" : conv2d_std\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
-    printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
+    printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)), for conv2d_inv_res - input, (expand kernel, expand bias), depthwise kernel, depthwise bias, project kernel, project bias \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
-    printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
+    printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)), for conv2d_inv_res - input, (expand kernel, expand bias), depthwise kernel, depthwise bias, project kernel, project bias \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
 }
 
+/* Output channel range of slice SLICE of N_SLICES, ranges start on a
+   multiple of 4 the way the CNN layer splits conv2d_std across workers */
+#define CONV_RANGE_SLICE(SLICE, N_SLICES, START, COUNT) \
+  { \
+    int n_granules_ = (cfg.out_channels + 3) >> 2; \
+    int end_ = (((SLICE) + 1) * n_granules_ / (N_SLICES)) * 4; \
+    START = ((SLICE) * n_granules_ / (N_SLICES)) * 4; \
+    COUNT = (end_ < cfg.out_channels ? end_ : cfg.out_channels) - START; \
+  }
+
+#define CONV_RANGE_NUM_SLICES \
+  (cfg.out_channel_slices < ((cfg.out_channels + 3) >> 2) ? cfg.out_channel_slices : ((cfg.out_channels + 3) >> 2))
+
 #define CONV_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -253,6 +355,18 @@ void show_usage(void)
         cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
         cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
     XTPWR_PROFILER_STOP(0);\
+    if(!err && cfg.out_channel_slices > 0) {\
+      int slice, start, count, n_slices = CONV_RANGE_NUM_SLICES;\
+      for(slice = 0; slice < n_slices && !err; slice++) {\
+        CONV_RANGE_SLICE(slice, n_slices, start, count);\
+        err = xa_nn_##KERNEL##_range_##KPREC##x##IPREC ( \
+            (WORD##OPREC *)p_range_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+            cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+            cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+            cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, start, count, p_scratch);\
+      }\
+      range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+    }\
   }
 
 #ifdef NNLIB_V2
@@ -266,6 +380,19 @@ void show_usage(void)
         cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
         cfg.out_data_format, p_scratch);\
     XTPWR_PROFILER_STOP(0);\
+    if(!err && cfg.out_channel_slices > 0) {\
+      int slice, start, count, n_slices = CONV_RANGE_NUM_SLICES;\
+      for(slice = 0; slice < n_slices && !err; slice++) {\
+        CONV_RANGE_SLICE(slice, n_slices, start, count);\
+        err = xa_nn_##KERNEL##_range_asym8xasym8 ( \
+            (UWORD8 *)p_range_out->p, (UWORD8 *) p_inp->p, (UWORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+            cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+            cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+            cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+            cfg.out_data_format, start, count, p_scratch);\
+      }\
+      range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+    }\
   }
 #else
 #define CONV_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
@@ -313,6 +440,68 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+/* Streaming conv1d is fed one input row per call, as a keyword spotter
+   sliding its window by one feature frame would, and must end up with the
+   same out_height rows as conv1d_std */
+#define CONV1D_STREAM_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    int row, ret, out_rows = 0;\
+    err = xa_nn_conv1d_std_stream_init(p_scratch, p_kernel->p, cfg.kernel_height, cfg.input_width, cfg.input_channels, \
+        cfg.y_stride, cfg.y_padding, 0, IPREC);\
+    err |= (cfg.out_data_format != 0);\
+    XTPWR_PROFILER_START(0);\
+    for(row = 0; row < cfg.input_height && out_rows < cfg.out_height && !err; row++) {\
+      ret = xa_nn_##KERNEL##_##KPREC##x##IPREC ( \
+          &((WORD##OPREC *)p_out->p)[out_rows * cfg.out_channels], &((WORD##IPREC *)p_inp->p)[row * cfg.input_width * cfg.input_channels], \
+          (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, 1, cfg.out_channels, \
+          cfg.bias_shift, cfg.acc_shift, p_scratch);\
+      if(ret < 0) err = ret; else out_rows += ret;\
+    }\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && out_rows != cfg.out_height) err = -1;\
+  }
+
+#ifdef NNLIB_V2
+#define CONV1D_STREAM_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    int row, ret, out_rows = 0;\
+    err = xa_nn_conv1d_std_stream_init(p_scratch, p_kernel->p, cfg.kernel_height, cfg.input_width, cfg.input_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.input_zero_bias, IPREC);\
+    err |= (cfg.out_data_format != 0);\
+    XTPWR_PROFILER_START(0);\
+    for(row = 0; row < cfg.input_height && out_rows < cfg.out_height && !err; row++) {\
+      ret = xa_nn_##KERNEL##_asym8xasym8 ( \
+          &((UWORD8 *)p_out->p)[out_rows * cfg.out_channels], &((UWORD8 *)p_inp->p)[row * cfg.input_width * cfg.input_channels], \
+          (UWORD8 *) p_kernel->p, (WORD32 *)p_bias->p, 1, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, p_scratch);\
+      if(ret < 0) err = ret; else out_rows += ret;\
+    }\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && out_rows != cfg.out_height) err = -1;\
+  }
+#else
+#define CONV1D_STREAM_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
+#endif /* NNLIB_V2 */
+
+#define CONV1D_STREAM_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    int row, ret, out_rows = 0;\
+    err = xa_nn_conv1d_std_stream_init(p_scratch, p_kernel->p, cfg.kernel_height, cfg.input_width, cfg.input_channels, \
+        cfg.y_stride, cfg.y_padding, 0, IPREC);\
+    err |= (cfg.out_data_format != 0);\
+    XTPWR_PROFILER_START(0);\
+    for(row = 0; row < cfg.input_height && out_rows < cfg.out_height && !err; row++) {\
+      ret = xa_nn_##KERNEL##_f32 ( \
+          &((FLOAT32 *)p_out->p)[out_rows * cfg.out_channels], &((FLOAT32 *)p_inp->p)[row * cfg.input_width * cfg.input_channels], \
+          (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, 1, cfg.out_channels, p_scratch);\
+      if(ret < 0) err = ret; else out_rows += ret;\
+    }\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && out_rows != cfg.out_height) err = -1;\
+  }
+
 #define CONV_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -322,6 +511,18 @@ void show_usage(void)
         cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
         cfg.out_data_format, p_scratch);\
     XTPWR_PROFILER_STOP(0);\
+    if(!err && cfg.out_channel_slices > 0) {\
+      int slice, start, count, n_slices = CONV_RANGE_NUM_SLICES;\
+      for(slice = 0; slice < n_slices && !err; slice++) {\
+        CONV_RANGE_SLICE(slice, n_slices, start, count);\
+        err = xa_nn_##KERNEL##_range_f32 ( \
+            (FLOAT32 *)p_range_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+            cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+            cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+            cfg.out_data_format, start, count, p_scratch);\
+      }\
+      range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+    }\
   }
 
 #ifdef NNLIB_V2
@@ -451,6 +652,161 @@ void show_usage(void)
     printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
 #endif /* NNLIB_V2 */
 
+#define CONV_POINT_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_pointwise_##KPREC##x##IPREC ( \
+        (WORD##OPREC *) p_out->p, (WORD##KPREC *) p_kernel->p, (WORD##IPREC *) p_inp->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+        cfg.acc_shift, cfg.bias_shift, \
+        cfg.out_data_format); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_POINT_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_pointwise_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *) p_inp->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, cfg.out_data_format); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#ifdef NNLIB_V2
+/* The plain asym8 entry point is the [0, 255] case of the _act one, call it
+   directly when no clamp is requested so that both are exercised */
+#define CONV_POINT_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    if(cfg.out_activation_min == 0 && cfg.out_activation_max == 255) \
+      err = xa_nn_conv2d_pointwise_asym8xasym8 ( \
+          (UWORD8 *) p_out->p, (UWORD8 *) p_kernel->p, (UWORD8 *) p_inp->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format); \
+    else \
+      err = xa_nn_conv2d_pointwise_asym8xasym8_act ( \
+          (UWORD8 *) p_out->p, (UWORD8 *) p_kernel->p, (UWORD8 *) p_inp->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max, \
+          cfg.out_data_format); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+#else
+#define CONV_POINT_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
+#endif /* NNLIB_V2 */
+
+#ifdef NNLIB_V2
+/* The fused block is checked against the unfused pointwise, depthwise,
+   pointwise and elementwise add chain besides the reference output */
+#define INV_RES_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    xa_nn_inv_res_stage_asym8_t expand = {cfg.kernel_zero_bias, cfg.expand_out_multiplier, cfg.expand_out_shift, \
+        cfg.expand_out_zero_bias, cfg.expand_activation_min, cfg.expand_activation_max}; \
+    xa_nn_inv_res_stage_asym8_t dw = {cfg.kernel_zero_bias, cfg.dw_out_multiplier, cfg.dw_out_shift, \
+        cfg.dw_out_zero_bias, cfg.dw_activation_min, cfg.dw_activation_max}; \
+    xa_nn_inv_res_stage_asym8_t project = {cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, \
+        cfg.out_zero_bias, cfg.out_activation_min, cfg.out_activation_max}; \
+    xa_nn_inv_res_residual_asym8_t add = {cfg.add_out_zero_bias, cfg.add_out_left_shift, cfg.add_out_multiplier, \
+        cfg.add_activation_min, cfg.add_activation_max, cfg.add_inp1_left_shift, cfg.add_inp1_multiplier, \
+        cfg.add_inp2_left_shift, cfg.add_inp2_multiplier, cfg.add_left_shift}; \
+    UWORD8 *p_dw_inp = cfg.expand_channels ? (UWORD8 *)p_exp_out->p : (UWORD8 *)p_inp->p; \
+    WORD32 dw_inp_zero_bias = cfg.expand_channels ? -cfg.expand_out_zero_bias : cfg.input_zero_bias; \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_inv_res_asym8xasym8 ( \
+        (UWORD8 *)p_out->p, (UWORD8 *)p_inp->p, \
+        cfg.expand_channels ? (UWORD8 *)p_kernel_expand->p : NULL, cfg.expand_channels ? (WORD32 *)p_bias_expand->p : NULL, \
+        (UWORD8 *)p_kernel->p, (WORD32 *)p_bias->p, (UWORD8 *)p_kernel_point->p, (WORD32 *)p_bias_point->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, expand_channels, cfg.out_channels, \
+        cfg.kernel_height, cfg.kernel_width, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, \
+        cfg.out_height, cfg.out_width, cfg.input_zero_bias, \
+        cfg.expand_channels ? &expand : NULL, &dw, &project, cfg.residual ? &add : NULL, p_scratch); \
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && cfg.expand_channels) \
+      err = xa_nn_conv2d_pointwise_asym8xasym8_act ( \
+          (UWORD8 *)p_exp_out->p, (UWORD8 *)p_kernel_expand->p, (UWORD8 *)p_inp->p, (WORD32 *)p_bias_expand->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, expand_channels, \
+          cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.expand_out_multiplier, cfg.expand_out_shift, cfg.expand_out_zero_bias, \
+          cfg.expand_activation_min, cfg.expand_activation_max, 0); \
+    if(!err) \
+      err = xa_nn_conv2d_depthwise_asym8xasym8 ( \
+          (UWORD8 *)p_pre_act->p, (UWORD8 *)p_kernel->p, p_dw_inp, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, expand_channels, cfg.kernel_height, cfg.kernel_width, 1, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          dw_inp_zero_bias, cfg.kernel_zero_bias, cfg.dw_out_multiplier, cfg.dw_out_shift, cfg.dw_out_zero_bias, \
+          0, 0, p_scratch); \
+    if(!err) \
+      err = xa_nn_vec_activation_min_max_asym8_asym8 ( \
+          (UWORD8 *)p_dw_out->p, (UWORD8 *)p_pre_act->p, cfg.dw_activation_min, cfg.dw_activation_max, dw_out_size); \
+    if(!err) \
+      err = xa_nn_conv2d_pointwise_asym8xasym8_act ( \
+          cfg.residual ? (UWORD8 *)p_proj_out->p : (UWORD8 *)p_chain_out->p, (UWORD8 *)p_kernel_point->p, \
+          (UWORD8 *)p_dw_out->p, (WORD32 *)p_bias_point->p, \
+          cfg.out_height, cfg.out_width, expand_channels, cfg.out_channels, \
+          -cfg.dw_out_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max, 0); \
+    if(!err && cfg.residual) \
+      err = xa_nn_elm_add_asym8xasym8_asym8 ( \
+          (UWORD8 *)p_chain_out->p, cfg.add_out_zero_bias, cfg.add_out_left_shift, cfg.add_out_multiplier, \
+          cfg.add_activation_min, cfg.add_activation_max, \
+          (UWORD8 *)p_proj_out->p, -cfg.out_zero_bias, cfg.add_inp1_left_shift, cfg.add_inp1_multiplier, \
+          (UWORD8 *)p_inp->p, cfg.input_zero_bias, cfg.add_inp2_left_shift, cfg.add_inp2_multiplier, \
+          cfg.add_left_shift, out_size); \
+    chain_match = !err && compare_buf1D(p_chain_out, p_out, 1); \
+  }
+
+#define INV_RES_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    FLOAT32 *p_dw_inp = cfg.expand_channels ? (FLOAT32 *)p_exp_out->p : (FLOAT32 *)p_inp->p; \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_inv_res_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *)p_inp->p, \
+        cfg.expand_channels ? (FLOAT32 *)p_kernel_expand->p : NULL, cfg.expand_channels ? (FLOAT32 *)p_bias_expand->p : NULL, \
+        (FLOAT32 *)p_kernel->p, (FLOAT32 *)p_bias->p, (FLOAT32 *)p_kernel_point->p, (FLOAT32 *)p_bias_point->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, expand_channels, cfg.out_channels, \
+        cfg.kernel_height, cfg.kernel_width, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, \
+        cfg.out_height, cfg.out_width, \
+        (FLOAT32)cfg.expand_activation_min, (FLOAT32)cfg.expand_activation_max, \
+        (FLOAT32)cfg.dw_activation_min, (FLOAT32)cfg.dw_activation_max, cfg.residual, p_scratch); \
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && cfg.expand_channels) \
+      err = xa_nn_conv2d_pointwise_f32 ( \
+          (FLOAT32 *)p_pre_act->p, (FLOAT32 *)p_kernel_expand->p, (FLOAT32 *)p_inp->p, (FLOAT32 *)p_bias_expand->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, expand_channels, 0); \
+    if(!err && cfg.expand_channels) \
+      err = xa_nn_vec_activation_min_max_f32_f32 ( \
+          (FLOAT32 *)p_exp_out->p, (FLOAT32 *)p_pre_act->p, \
+          (FLOAT32)cfg.expand_activation_min, (FLOAT32)cfg.expand_activation_max, p_exp_out->length); \
+    if(!err) \
+      err = xa_nn_conv2d_depthwise_f32 ( \
+          (FLOAT32 *)p_pre_act->p, (FLOAT32 *)p_kernel->p, p_dw_inp, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, expand_channels, cfg.kernel_height, cfg.kernel_width, 1, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          0, 0, p_scratch); \
+    if(!err) \
+      err = xa_nn_vec_activation_min_max_f32_f32 ( \
+          (FLOAT32 *)p_dw_out->p, (FLOAT32 *)p_pre_act->p, \
+          (FLOAT32)cfg.dw_activation_min, (FLOAT32)cfg.dw_activation_max, dw_out_size); \
+    if(!err) \
+      err = xa_nn_conv2d_pointwise_f32 ( \
+          cfg.residual ? (FLOAT32 *)p_proj_out->p : (FLOAT32 *)p_chain_out->p, (FLOAT32 *)p_kernel_point->p, \
+          (FLOAT32 *)p_dw_out->p, (FLOAT32 *)p_bias_point->p, \
+          cfg.out_height, cfg.out_width, expand_channels, cfg.out_channels, 0); \
+    if(!err && cfg.residual) \
+      err = xa_nn_elm_add_f32xf32_f32 ( \
+          (FLOAT32 *)p_chain_out->p, (FLOAT32 *)p_proj_out->p, (FLOAT32 *)p_inp->p, out_size); \
+    chain_match = !err && compare_buf1D(p_chain_out, p_out, 1); \
+  }
+#else
+#define INV_RES_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
+#define INV_RES_KERNEL_F_FN INV_RES_KERNEL_ASYM8_FN
+#endif /* NNLIB_V2 */
+
 #if XCHAL_HAVE_HIFI4_VFPU
 #define PROCESS_CONV \
     if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
@@ -459,15 +815,27 @@ void show_usage(void)
     else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
     else if CONV_KERNEL_F_FN(conv2d_std, -1, -1, -1, -1) \
     else if CONV_DS_KERNEL_F_FN(conv2d_depth, -1, -1, -1, -1) \
+    else if CONV_POINT_KERNEL_F_FN(conv2d_point, -1, -1, -1, -1) \
+    else if INV_RES_KERNEL_F_FN(conv2d_inv_res, -1, -1, -1, -1) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
     else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,8,16,16,16) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,16,16,16,16) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,8,8,8,8) \
+    else if CONV_POINT_KERNEL_ASYM8_FN(conv2d_point,-3,-3,-3,32) \
+    else if INV_RES_KERNEL_ASYM8_FN(conv2d_inv_res,-3,-3,-3,32) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else if CONV1D_KERNEL_F_FN(conv1d_std, -1, -1, -1, -1) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 8, 16, 16, 16) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 8, 8, 8, 8) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 16, 16, 16, 16) \
+    else if CONV1D_STREAM_KERNEL_ASYM8_FN(conv1d_std_stream, -3, -3, -3, 32) \
+    else if CONV1D_STREAM_KERNEL_F_FN(conv1d_std_stream, -1, -1, -1, -1) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
 #else
 #define PROCESS_CONV \
@@ -479,10 +847,19 @@ void show_usage(void)
     else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
     else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,8,16,16,16) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,16,16,16,16) \
+    else if CONV_POINT_KERNEL_FN(conv2d_point,8,8,8,8) \
+    else if CONV_POINT_KERNEL_ASYM8_FN(conv2d_point,-3,-3,-3,32) \
+    else if INV_RES_KERNEL_ASYM8_FN(conv2d_inv_res,-3,-3,-3,32) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 8, 16, 16, 16) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 8, 8, 8, 8) \
+    else if CONV1D_STREAM_KERNEL_FN(conv1d_std_stream, 16, 16, 16, 16) \
+    else if CONV1D_STREAM_KERNEL_ASYM8_FN(conv1d_std_stream, -3, -3, -3, 32) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
 #endif
 
@@ -501,6 +878,9 @@ int xa_nn_main_process(int argc, char *argv[])
   int input_channelsXwidth_pad;
   int kernel_point_size, dw_out_size;
   int bias_size, bias_point_size;
+  int expand_channels;
+  int chain_match = 1;
+  int range_match = 1;
 
   test_config_t cfg;
 
@@ -510,6 +890,13 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_bias;
   buf1D_t *p_bias_point;
   buf1D_t *p_dw_out;
+  buf1D_t *p_kernel_expand = NULL;
+  buf1D_t *p_bias_expand = NULL;
+  buf1D_t *p_exp_out = NULL;
+  buf1D_t *p_proj_out = NULL;
+  buf1D_t *p_pre_act = NULL;
+  buf1D_t *p_chain_out = NULL;
+  buf1D_t *p_range_out = NULL;
   buf1D_t *p_out;
   buf1D_t *p_ref;
 
@@ -533,6 +920,8 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  expand_channels = cfg.expand_channels ? cfg.expand_channels : cfg.input_channels;
+
   if(!strcmp(cfg.kernel_name,"conv2d_std"))
   {
     inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
@@ -572,7 +961,28 @@ int xa_nn_main_process(int argc, char *argv[])
     bias_size = cfg.channels_multiplier * cfg.input_channels;
     bias_point_size = cfg.out_channels;
   }
-  else if(!strcmp(cfg.kernel_name,"conv1d_std"))
+  else if(!strcmp(cfg.kernel_name,"conv2d_point"))
+  {
+    /* 1x1 kernel over the whole input, output has the input's height and width */
+    inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+    kernel_size = cfg.input_channels;
+    input_channels_pad = cfg.input_channels;
+    kernel_size_pad = cfg.input_channels;
+    bias_size = cfg.out_channels;
+    out_size = cfg.input_height * cfg.input_width * cfg.out_channels;
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+  {
+    /* NHWC throughout, the depthwise kernel is kernel_height x kernel_width x expand_channels */
+    inp_size          = cfg.input_height  * cfg.input_width  * cfg.input_channels;
+    kernel_size       = cfg.kernel_height * cfg.kernel_width * expand_channels;
+    dw_out_size       = cfg.out_height    * cfg.out_width    * expand_channels;
+    kernel_point_size = cfg.out_channels  * expand_channels;
+    out_size          = cfg.out_height    * cfg.out_width    * cfg.out_channels;
+    bias_size = expand_channels;
+    bias_point_size = cfg.out_channels;
+  }
+  else if(!strcmp(cfg.kernel_name,"conv1d_std") || !strcmp(cfg.kernel_name,"conv1d_std_stream"))
   {
     inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
     kernel_size = cfg.kernel_height * cfg.input_width * cfg.input_channels;
@@ -637,11 +1047,21 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  if(!strcmp(cfg.kernel_name,"conv1d_std"))
+  if(!strcmp(cfg.kernel_name,"conv1d_std") || !strcmp(cfg.kernel_name,"conv1d_std_stream"))
   {
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, out_channels=%d, out_height=%d", 
       cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, cfg.out_height);
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_point"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, out_channels=%d, out_data_format=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, cfg.out_data_format);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, expand_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, out_height=%d, out_width=%d, residual=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.expand_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.out_height, cfg.out_width, cfg.residual);
+  }
   else
   {
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, out_height=%d, out_width=%d", 
@@ -679,10 +1099,14 @@ int xa_nn_main_process(int argc, char *argv[])
   // Allocate Memory
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
-  if(!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv1d_std"))
+  if(!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv2d_point") || !strcmp(cfg.kernel_name,"conv1d_std") || !strcmp(cfg.kernel_name,"conv1d_std_stream"))
   {
     p_kernel = create_buf1D(cfg.out_channels*kernel_size_pad, cfg.kernel_precision);    VALIDATE_PTR(p_kernel);
     p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+    if(!strcmp(cfg.kernel_name,"conv2d_std") && cfg.out_channel_slices > 0)
+    {
+      p_range_out = create_buf1D(out_size, cfg.out_precision);                       VALIDATE_PTR(p_range_out);
+    }
 
     XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
   }
@@ -703,6 +1127,38 @@ int xa_nn_main_process(int argc, char *argv[])
     XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, total_conv2d_depth_MACS, "MACs/cyc", 1);
     XTPWR_PROFILER_OPEN(1, profiler_name_1, profiler_params, total_conv2d_point_MACS, "MACs/cyc", 1);
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+  {
+    if(cfg.expand_channels)
+    {
+      p_kernel_expand = create_buf1D(expand_channels*cfg.input_channels, cfg.kernel_precision);  VALIDATE_PTR(p_kernel_expand);
+      p_bias_expand = create_buf1D(expand_channels, cfg.bias_precision);                         VALIDATE_PTR(p_bias_expand);
+      p_exp_out = create_buf1D(cfg.input_height*cfg.input_width*expand_channels, cfg.out_precision); VALIDATE_PTR(p_exp_out);
+    }
+    p_kernel = create_buf1D(kernel_size, cfg.kernel_precision);                  VALIDATE_PTR(p_kernel);
+    p_bias = create_buf1D(bias_size, cfg.bias_precision);                        VALIDATE_PTR(p_bias);
+    p_kernel_point = create_buf1D(kernel_point_size, cfg.kernel_precision);      VALIDATE_PTR(p_kernel_point);
+    p_bias_point = create_buf1D(bias_point_size, cfg.bias_precision);            VALIDATE_PTR(p_bias_point);
+    /* Intermediate tensors of the unfused chain, p_pre_act holds the expansion
+       or depthwise output before its activation */
+    int pre_act_size = cfg.input_height * cfg.input_width * expand_channels;
+    if(dw_out_size > pre_act_size)
+      pre_act_size = dw_out_size;
+    p_pre_act = create_buf1D(pre_act_size, cfg.out_precision);                   VALIDATE_PTR(p_pre_act);
+    p_dw_out = create_buf1D(dw_out_size, cfg.out_precision);                     VALIDATE_PTR(p_dw_out);
+    p_chain_out = create_buf1D(out_size, cfg.out_precision);                     VALIDATE_PTR(p_chain_out);
+    if(cfg.residual)
+    {
+      p_proj_out = create_buf1D(out_size, cfg.out_precision);                    VALIDATE_PTR(p_proj_out);
+    }
+
+    int total_inv_res_MACS = (
+       (cfg.expand_channels ? expand_channels * cfg.input_channels * cfg.input_height * cfg.input_width : 0) /* MACs in expansion */
+       + (expand_channels * cfg.out_height * cfg.out_width * cfg.kernel_height * cfg.kernel_width)              /* MACs in depthwise */
+       + (cfg.out_channels * expand_channels * cfg.out_height * cfg.out_width)                                  /* MACs in projection */
+       );
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, total_inv_res_MACS, "MACs/cyc", 1);
+  }
   
   // Init
   WORD32 scratch_size=0;
@@ -747,10 +1203,54 @@ int xa_nn_main_process(int argc, char *argv[])
 #endif
     PRINT_VAR(scratch_size)
   }
+#ifdef NNLIB_V2
+  else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+  {
+    /* Shared by the fused block and the depthwise of the unfused chain */
+    WORD32 dw_scratch_size =
+      xa_nn_conv2d_depthwise_getsize
+      (cfg.input_height
+       ,cfg.input_width
+       ,expand_channels
+       ,cfg.kernel_height
+       ,cfg.kernel_width
+       ,1
+       ,cfg.x_stride
+       ,cfg.y_stride
+       ,cfg.x_padding
+       ,cfg.y_padding
+       ,cfg.out_height
+       ,cfg.out_width
+       ,cfg.inp_precision
+       ,0
+      );
+    scratch_size =
+      xa_nn_conv2d_inv_res_getsize
+      (cfg.input_width
+       ,expand_channels
+       ,cfg.out_channels
+       ,cfg.kernel_height
+       ,cfg.kernel_width
+       ,cfg.x_stride
+       ,cfg.y_stride
+       ,cfg.x_padding
+       ,cfg.out_height
+       ,cfg.out_width
+       ,cfg.inp_precision
+      );
+    if(dw_scratch_size > scratch_size)
+      scratch_size = dw_scratch_size;
+    PRINT_VAR(scratch_size)
+  }
+#endif
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
     scratch_size = xa_nn_conv1d_std_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(scratch_size)
   }
+  else if(!strcmp(cfg.kernel_name,"conv1d_std_stream"))
+  {
+    scratch_size = xa_nn_conv1d_std_stream_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(scratch_size)
+  }
 
   p_scratch = (xa_nnlib_handle_t)malloc(scratch_size); PRINT_PTR(p_scratch)
 
@@ -760,11 +1260,13 @@ int xa_nn_main_process(int argc, char *argv[])
   for(frame = 0; frame < cfg.frames; frame++)
   {
     // If write_file enabled, generate random data for input, else read from file
-    if(!strcmp(cfg.kernel_name,"conv2d_std"))
+    if(!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv2d_point"))
       load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, input_channels_pad);
     else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
       load_conv2d_ds_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, p_kernel_point, p_bias_point);
-    else if(!strcmp(cfg.kernel_name,"conv1d_std"))
+    else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+      load_inv_res_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel_expand, p_bias_expand, p_kernel, p_bias, p_kernel_point, p_bias_point);
+    else if(!strcmp(cfg.kernel_name,"conv1d_std") || !strcmp(cfg.kernel_name,"conv1d_std_stream"))
       load_conv1d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, cfg.input_width, input_channelsXwidth_pad);
 
     // Call the cnn kernel_name specified on command line
@@ -791,11 +1293,11 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify);
+      pass_count += compare_buf1D(p_ref, p_out, cfg.verify) && chain_match && range_match;
     }
     else
     {
-      pass_count += !err;
+      pass_count += !err && chain_match && range_match;
     }
   }
 
@@ -813,12 +1315,34 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf1D(p_kernel);
   free_buf1D(p_bias);
   free_buf1D(p_out);
+  if(p_range_out)
+  {
+    free_buf1D(p_range_out);
+  }
   if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
     free_buf1D(p_kernel_point);
     free_buf1D(p_bias_point);
     free_buf1D(p_dw_out);
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_inv_res"))
+  {
+    if(cfg.expand_channels)
+    {
+      free_buf1D(p_kernel_expand);
+      free_buf1D(p_bias_expand);
+      free_buf1D(p_exp_out);
+    }
+    free_buf1D(p_kernel_point);
+    free_buf1D(p_bias_point);
+    free_buf1D(p_pre_act);
+    free_buf1D(p_dw_out);
+    free_buf1D(p_chain_out);
+    if(cfg.residual)
+    {
+      free_buf1D(p_proj_out);
+    }
+  }
 
   if(cfg.verify)
   {
@@ -125,6 +125,7 @@ void show_usage(void)
   printf("--mat_prec:    \t Coefficient precision (Default=16)                        \t  Must be 8 or 16\n");
   printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16\n");
   printf("--verify:      \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--num_workers: \t XA_NNLIB_LSTM_NUM_WORKERS (Default=1)         \t  Range: 1-8, output must match a single worker\n");
   printf("--input_file:  \t File containing input shape\n");
   printf("--filter_path: \t Path where file containing filter are stored\n");
   printf("--output_file: \t File to which output will be written\n");
@@ -383,6 +384,7 @@ int compare_cell(int *p_dut, int *p_ref, int len)
 
 int default_config(xa_nnlib_lstm_init_config_t *config, 
     int *verify_flag,
+    int *num_workers,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -404,6 +406,7 @@ int default_config(xa_nnlib_lstm_init_config_t *config,
     config->io_Qformat = 12;
     config->cell_Qformat = 25;
     *verify_flag=1;
+    *num_workers=1;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -424,6 +427,7 @@ void parse_arguments(int argc, char** argv,
     xa_nnlib_lstm_init_config_t *config, 
     int *show_help,
     int *verify_flag,
+    int *num_workers,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -449,6 +453,7 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_ONETIME_CONFIG("--num_workers",*num_workers);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
     ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
@@ -497,6 +502,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char prev_c_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
   int show_help = 0;
   int verify_pass = 1;
+  int num_workers;
 #ifdef VERIFY
   FILE *output_ref_file;
   FILE *cell_ref_file;
@@ -510,6 +516,7 @@ int xa_nn_main_process(int argc, char *argv[])
   /* Set default configurations */
   if(default_config(&config,
         &verify_flag,
+        &num_workers,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -538,6 +545,7 @@ int xa_nn_main_process(int argc, char *argv[])
         &config,
         &show_help,
         &verify_flag,
+        &num_workers,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -600,6 +608,14 @@ int xa_nn_main_process(int argc, char *argv[])
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
       return err;
     }
+
+    err = xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_NUM_WORKERS, &num_workers);
+
+    if(XA_NNLIB_NO_ERROR != err)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+      return err;
+    }
   }
 
   /* Set weights and biases for LSTM */
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <time.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
@@ -77,7 +78,17 @@ typedef struct _test_config_t
   char write_out_file_name[XA_MAX_CMD_LINE_LENGTH];
   int verify;
   int batch;
+  char unroll[MAX_ACTIVATION_NAME_LENGTH];
   int fc;
+  int matmul;
+  int vec_offset;
+  int out_offset;
+  int out_stride;
+  int out_activation_min;
+  int out_activation_max;
+  int row_slices;
+  int hybrid;
+  int sparse;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -115,7 +126,17 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
     p_cfg->batch = 0;
+    p_cfg->unroll[0] = '\0';
     p_cfg->fc = 0;
+    p_cfg->matmul = 0;
+    p_cfg->vec_offset = 0;
+    p_cfg->out_offset = 0;
+    p_cfg->out_stride = 0;
+    p_cfg->out_activation_min = 0;
+    p_cfg->out_activation_max = 255;
+    p_cfg->row_slices = 0;
+    p_cfg->hybrid = 0;
+    p_cfg->sparse = 0;
 
     return 0;
   }
@@ -169,7 +190,17 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-batch",p_cfg->batch);
+    ARGTYPE_STRING("-unroll",p_cfg->unroll, MAX_ACTIVATION_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-fc",p_cfg->fc);
+    ARGTYPE_ONETIME_CONFIG("-matmul",p_cfg->matmul);
+    ARGTYPE_ONETIME_CONFIG("-vec_offset",p_cfg->vec_offset);
+    ARGTYPE_ONETIME_CONFIG("-out_offset",p_cfg->out_offset);
+    ARGTYPE_ONETIME_CONFIG("-out_stride",p_cfg->out_stride);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_min",p_cfg->out_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_max",p_cfg->out_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-row_slices",p_cfg->row_slices);
+    ARGTYPE_ONETIME_CONFIG("-hybrid",p_cfg->hybrid);
+    ARGTYPE_ONETIME_CONFIG("-sparse",p_cfg->sparse);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -181,8 +212,8 @@ void show_usage(void)
 {
     printf ("Usage xt-run <binary> [Options]\n");
     printf("\t-rows : rows of mat1; Default=32\n");
-    printf("\t-cols1 : columns of mat1 and rows of mat2; should be multiple of 4; Default=32\n");
-    printf("\t-cols2 : columns of mat2; should be multiple of 4; Default=32\n");
+    printf("\t-cols1 : columns of mat1 and rows of mat2; multiple of 4 for 16 bit and float matrices; Default=32\n");
+    printf("\t-cols2 : columns of mat2; multiple of 4 for 16 bit and float matrices; Default=32\n");
     printf("\t-row_stride1 : row stride for mat1; Default=32\n");
     printf("\t-row_stride2 : row stride for mat2; Default=32\n");
     printf("\t-vec_count : vec count for time batching; Default=1\n");
@@ -211,8 +242,237 @@ void show_usage(void)
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-batch: Flag to check time batching; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-unroll: with -batch 1, call xa_nn_matXvec_batch_*_unroll for 8x8_32, 8x16_64 and 16x16_64; auto or <rows>x<vecs> e.g. 2x4; Default="" : regular batch kernel\n");
     printf("\t-fc: Flag for fully connected; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-matmul: Flag for matmul (vec_count vectors); 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-vec_offset: matmul offset from one input vector to the next; Default=0 : cols1\n");
+    printf("\t-out_offset: matmul offset from one output vector to the next; Default=0 : rows\n");
+    printf("\t-out_stride: matmul offset from one output row to the next; Default=0 : 1\n");
+#ifdef NNLIB_V2
+    printf("\t-out_activation_min: matmul asym8 lower output clamp; Default=0\n");
+    printf("\t-out_activation_max: matmul asym8 upper output clamp; Default=255\n");
+#endif /* NNLIB_V2 */
+    printf("\t-row_slices: 16x16_16 and 8x16_16 sigmoid/tanh, f32 and asym8 matXvec, N > 0 also computes the output in N row ranges with xa_nn_matXvec_range_* and checks it matches; Default=0\n");
+#ifdef NNLIB_V2
+    printf("\t-hybrid: f32 matXvec and fully connected, 1 also runs the sym8 weight kernels on per row quantized copies of the matrices and checks they are within the quantization error of the f32 output; Default=0\n");
+    printf("\t-sparse: 8x8_8 and asym8 matXvec, 1 also zeroes 1x4 blocks of a copy of mat1, converts it with xa_nn_sparse_1x4_from_dense_8 and checks xa_nn_matXvec_sparse_1x4_* matches the dense kernel on it bit for bit; Default=0\n");
+#endif /* NNLIB_V2 */
+}
+
+#ifdef NNLIB_V2
+/* Per row sym8 copy of a f32 matrix, rows x cols with row stride cols, the
+   way LSTMCell::PrepareHybrid quantizes constant weights */
+static int quantize_rows_sym8(WORD8 *p_q, FLOAT32 *p_scale, buf2D_t *p_mat, int cols)
+{
+  int r;
+  for(r = 0; r < p_mat->rows; r++)
+  {
+    if(xa_nn_quantize_f32_sym8(p_q + r * cols, p_scale + r,
+          (FLOAT32 *)p_mat->p + r * p_mat->row_offset, cols))
+      return -1;
+  }
+  return 0;
+}
+
+static FLOAT32 max_abs_f32(const FLOAT32 *p, int n)
+{
+  int i;
+  FLOAT32 m = 0.0f;
+  for(i = 0; i < n; i++)
+    m = fabsf(p[i]) > m ? fabsf(p[i]) : m;
+  return m;
+}
+
+/* Checks a hybrid output against the f32 one. With weights and vectors
+   rounded to the nearest of 127 levels of their max, each product is off by
+   at most max|w| * max|x| / 127, so row r may be off by
+   cols * max|mat[r]| * max|vec| / 127 per matrix. */
+static int hybrid_within_tolerance(const char *name, const FLOAT32 *p_hybrid, const FLOAT32 *p_ref,
+    buf2D_t *p_mat1, buf1D_t *p_vec1, int cols1, buf2D_t *p_mat2, buf1D_t *p_vec2, int cols2)
+{
+  int r, fails = 0;
+  FLOAT32 vec1_max = max_abs_f32((FLOAT32 *)p_vec1->p, cols1);
+  FLOAT32 vec2_max = p_mat2 ? max_abs_f32((FLOAT32 *)p_vec2->p, cols2) : 0.0f;
+  FLOAT32 max_err = 0.0f;
+  for(r = 0; r < p_mat1->rows; r++)
+  {
+    FLOAT32 tol = cols1 * max_abs_f32((FLOAT32 *)p_mat1->p + r * p_mat1->row_offset, cols1) * vec1_max;
+    FLOAT32 err = fabsf(p_hybrid[r] - p_ref[r]);
+    if(p_mat2)
+      tol += cols2 * max_abs_f32((FLOAT32 *)p_mat2->p + r * p_mat2->row_offset, cols2) * vec2_max;
+    /* Margin for the rounding of the f32 sums */
+    tol = tol * (1.01f / 127) + 1e-6f * fabsf(p_ref[r]);
+    if(err > tol)
+    {
+      if(fails++ < 5)
+        printf("%s: row %d: %f vs f32 %f, tolerance %f\n", name, r, p_hybrid[r], p_ref[r], tol);
+    }
+    max_err = err > max_err ? err : max_err;
+  }
+  printf("%s: max error %g\n", name, max_err);
+  return fails == 0;
+}
+
+/* Runs xa_nn_matXvec_sym8xf32_f32, xa_nn_matXvec_sym8xsym8_f32 on vectors
+   from xa_nn_quantize_f32_sym8 (or xa_nn_fully_connected_sym8xf32_f32 with
+   -fc 1) and checks them against the f32 output in p_out */
+static int hybrid_matches(const test_config_t *p_cfg, buf2D_t *p_mat1, buf1D_t *p_vec1,
+    buf2D_t *p_mat2, buf1D_t *p_vec2, buf1D_t *p_bias, buf1D_t *p_out)
+{
+  int rows = p_cfg->rows, cols1 = p_cfg->cols1, cols2 = p_cfg->fc ? 0 : p_cfg->cols2;
+  int scratch_size = xa_nn_matXvec_sym8xf32_f32_getsize(cols1, cols2);
+  WORD8 *p_mat1_q = (WORD8 *)malloc(rows * cols1);
+  WORD8 *p_mat2_q = (WORD8 *)malloc(rows * (cols2 ? cols2 : 1));
+  FLOAT32 *p_mat1_scale = (FLOAT32 *)malloc(rows * sizeof(FLOAT32));
+  FLOAT32 *p_mat2_scale = (FLOAT32 *)malloc(rows * sizeof(FLOAT32));
+  FLOAT32 *p_hybrid_out = (FLOAT32 *)malloc(rows * sizeof(FLOAT32));
+  WORD8 *p_scratch = (WORD8 *)malloc(scratch_size);
+  int match = 0;
+
+  if(!p_mat1_q || !p_mat2_q || !p_mat1_scale || !p_mat2_scale || !p_hybrid_out || !p_scratch ||
+     quantize_rows_sym8(p_mat1_q, p_mat1_scale, p_mat1, cols1) ||
+     (cols2 && quantize_rows_sym8(p_mat2_q, p_mat2_scale, p_mat2, cols2)))
+  {
+    printf("hybrid: setup failed\n");
+  }
+  else if(p_cfg->fc)
+  {
+    match = !xa_nn_fully_connected_sym8xf32_f32(p_hybrid_out, p_mat1_q, p_mat1_scale,
+          (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_bias->p, cols1, rows, p_scratch) &&
+      hybrid_within_tolerance("fully_connected_sym8xf32_f32", p_hybrid_out, (FLOAT32 *)p_out->p,
+          p_mat1, p_vec1, cols1, NULL, NULL, 0);
+  }
+  else
+  {
+    /* Vectors quantized apart, 4 byte aligned as sym8xsym8_f32 needs */
+    WORD8 *p_vec1_q = p_scratch;
+    WORD8 *p_vec2_q = p_scratch + ((cols1 + 3) & ~3);
+    FLOAT32 vec1_scale, vec2_scale;
+
+    match = !xa_nn_matXvec_sym8xf32_f32(p_hybrid_out, p_mat1_q, p_mat2_q,
+          (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_vec2->p, (FLOAT32 *)p_bias->p,
+          p_mat1_scale, p_mat2_scale, rows, cols1, cols2, cols1, cols2, p_scratch) &&
+      hybrid_within_tolerance("matXvec_sym8xf32_f32", p_hybrid_out, (FLOAT32 *)p_out->p,
+          p_mat1, p_vec1, cols1, p_mat2, p_vec2, cols2);
+
+    match = !xa_nn_quantize_f32_sym8(p_vec1_q, &vec1_scale, (FLOAT32 *)p_vec1->p, cols1) &&
+      !xa_nn_quantize_f32_sym8(p_vec2_q, &vec2_scale, (FLOAT32 *)p_vec2->p, cols2) &&
+      !xa_nn_matXvec_sym8xsym8_f32(p_hybrid_out, p_mat1_q, p_mat2_q, p_vec1_q, p_vec2_q,
+          (FLOAT32 *)p_bias->p, p_mat1_scale, p_mat2_scale, vec1_scale, vec2_scale,
+          rows, cols1, cols2, cols1, cols2) &&
+      hybrid_within_tolerance("matXvec_sym8xsym8_f32", p_hybrid_out, (FLOAT32 *)p_out->p,
+          p_mat1, p_vec1, cols1, p_mat2, p_vec2, cols2) && match;
+  }
+
+  free(p_mat1_q);
+  free(p_mat2_q);
+  free(p_mat1_scale);
+  free(p_mat2_scale);
+  free(p_hybrid_out);
+  free(p_scratch);
+  return match;
+}
+
+/* Block of a row of the sparse test copy of mat1 that keeps its weights:
+   one in three, none on row 1 so a row without blocks is covered */
+#define SPARSE_KEEP_BLK(ROW, BLK) ((ROW) != 1 && ((ROW) + (BLK)) % 3 == 0)
+
+/* Zeroes 1x4 blocks of a copy of mat1 (zero_value is the byte of a zero
+   weight: 0 for 8x8, the weight zero point for asym8), runs the dense kernel
+   on it without mat2 and checks xa_nn_matXvec_sparse_1x4_* on the blocks
+   from xa_nn_sparse_1x4_from_dense_8 gives the same bytes */
+static int sparse_matches(const test_config_t *p_cfg, buf2D_t *p_mat1, buf1D_t *p_vec1, buf1D_t *p_bias)
+{
+  int rows = p_cfg->rows, cols = p_cfg->cols1, stride = p_mat1->row_offset;
+  int asym8 = (p_cfg->mat_precision == -3);
+  int zero_value = asym8 ? -p_cfg->mat1_zero_bias : 0;
+  int cols_4 = (cols + 3) & ~3;
+  int r, c, num_blk, match = 0;
+  UWORD8 *p_dense = (UWORD8 *)malloc(rows * stride);
+  /* Vector read up to a multiple of 4; the padding has to be ignored */
+  UWORD8 *p_vec = (UWORD8 *)malloc(cols_4);
+  UWORD8 *p_dense_out = (UWORD8 *)malloc(rows);
+  UWORD8 *p_sparse_out = (UWORD8 *)malloc(rows);
+  WORD32 *p_row_ptr = (WORD32 *)malloc((rows + 1) * sizeof(WORD32));
+  UWORD8 *p_blk_val = NULL;
+  UWORD16 *p_blk_col = NULL;
+
+  if(!p_dense || !p_vec || !p_dense_out || !p_sparse_out || !p_row_ptr)
+  {
+    printf("sparse: allocation failed\n");
+    goto sparse_exit;
+  }
+  for(r = 0; r < rows; r++)
+  {
+    for(c = 0; c < stride; c++)
+    {
+      UWORD8 w = ((UWORD8 *)p_mat1->p)[r * stride + c];
+      p_dense[r * stride + c] = SPARSE_KEEP_BLK(r, c >> 2) ? w : (UWORD8)zero_value;
+    }
+  }
+  memcpy(p_vec, p_vec1->p, cols);
+  memset(p_vec + cols, 0x5a, cols_4 - cols);
+
+  num_blk = xa_nn_sparse_1x4_count_blocks_8(p_dense, rows, cols, stride, zero_value);
+  p_blk_val = (UWORD8 *)malloc(4 * (num_blk > 0 ? num_blk : 1));
+  p_blk_col = (UWORD16 *)malloc(sizeof(UWORD16) * (num_blk > 0 ? num_blk : 1));
+  if(num_blk < 0 || !p_blk_val || !p_blk_col ||
+     xa_nn_sparse_1x4_from_dense_8(p_blk_val, p_blk_col, p_row_ptr, p_dense, rows, cols, stride, zero_value))
+  {
+    printf("sparse: conversion failed\n");
+    goto sparse_exit;
+  }
+  printf("sparse: %d of %d blocks\n", num_blk, rows * (cols_4 >> 2));
+
+  if(asym8)
+  {
+    match = !xa_nn_matXvec_asym8xasym8_asym8(p_dense_out, p_dense, NULL, p_vec, NULL, (WORD32 *)p_bias->p,
+          rows, cols, 0, stride, 0,
+          p_cfg->mat1_zero_bias, 0, p_cfg->inp1_zero_bias, 0, p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias) &&
+      !xa_nn_matXvec_sparse_1x4_asym8xasym8_asym8(p_sparse_out, p_blk_val, p_blk_col, p_row_ptr, p_vec, (WORD32 *)p_bias->p,
+          rows, cols, p_cfg->mat1_zero_bias, p_cfg->inp1_zero_bias, p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias);
+  }
+  else
+  {
+    match = !xa_nn_matXvec_8x8_8((WORD8 *)p_dense_out, (WORD8 *)p_dense, NULL, (WORD8 *)p_vec, NULL, (WORD8 *)p_bias->p,
+          rows, cols, 0, stride, 0, p_cfg->acc_shift, p_cfg->bias_shift) &&
+      !xa_nn_matXvec_sparse_1x4_8x8_8((WORD8 *)p_sparse_out, (WORD8 *)p_blk_val, p_blk_col, p_row_ptr, (WORD8 *)p_vec, (WORD8 *)p_bias->p,
+          rows, cols, p_cfg->acc_shift, p_cfg->bias_shift);
+  }
+  if(!match)
+  {
+    printf("sparse: kernel returned error\n");
+  }
+  else if(memcmp(p_dense_out, p_sparse_out, rows))
+  {
+    printf("sparse: output differs from the dense kernel\n");
+    match = 0;
+  }
+
+sparse_exit:
+  free(p_dense);
+  free(p_vec);
+  free(p_dense_out);
+  free(p_sparse_out);
+  free(p_row_ptr);
+  free(p_blk_val);
+  free(p_blk_col);
+  return match;
 }
+#endif /* NNLIB_V2 */
+
+/* Row range of slice SLICE of N_SLICES, ranges start on a multiple of 4
+   the way the LSTM layer splits out_feats across workers */
+#define MATXVEC_RANGE_SLICE(SLICE, N_SLICES, START, COUNT) \
+  { \
+    int n_granules_ = (cfg.rows + 3) >> 2; \
+    int end_ = (((SLICE) + 1) * n_granules_ / (N_SLICES)) * 4; \
+    START = ((SLICE) * n_granules_ / (N_SLICES)) * 4; \
+    COUNT = (end_ < cfg.rows ? end_ : cfg.rows) - START; \
+  }
+
+#define MATXVEC_RANGE_NUM_SLICES \
+  (cfg.row_slices < ((cfg.rows + 3) >> 2) ? cfg.row_slices : ((cfg.rows + 3) >> 2))
 
 #define MAT_VEC_MUL_FN(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
@@ -233,11 +493,36 @@ void show_usage(void)
           cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
           cfg.mat1_zero_bias, cfg.mat2_zero_bias, cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
       XTPWR_PROFILER_STOP(0);\
+      if(!err && cfg.row_slices > 0) {\
+        int slice, start, count, n_slices = MATXVEC_RANGE_NUM_SLICES;\
+        for(slice = 0; slice < n_slices && !err; slice++) {\
+          MATXVEC_RANGE_SLICE(slice, n_slices, start, count);\
+          err = xa_nn_matXvec_range_asym8xasym8_asym8 ( \
+              (UWORD8 *)p_range_out->p, (UWORD8 *) p_mat1->p, (UWORD8 *) p_mat2->p, (UWORD8 *)p_vec1->p, (UWORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
+              cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+              cfg.mat1_zero_bias, cfg.mat2_zero_bias, cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+              start, count);\
+        }\
+        range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+      }\
+    }
+
+#define MAT_VEC_MUL_FN_ASYM8_16(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matXvec_asym8xasym8_16 ( \
+          (WORD16 *)p_out->p, (UWORD8 *) p_mat1->p, (UWORD8 *) p_mat2->p, (UWORD8 *)p_vec1->p, (UWORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+          cfg.mat1_zero_bias, cfg.mat2_zero_bias, cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift);\
+      XTPWR_PROFILER_STOP(0);\
     }
 #else
 #define MAT_VEC_MUL_FN_ASYM8(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
      printf("unsupported multiplication\n"); return -1;} 
+#define MAT_VEC_MUL_FN_ASYM8_16(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+     printf("unsupported multiplication\n"); return -1;} 
 #endif /* NNLIB_V2 */
 
 #define MAT_VEC_MUL_FC_FN(MPREC, VPREC, OPREC) \
@@ -257,7 +542,7 @@ void show_usage(void)
       err = xa_nn_fully_connected_asym8xasym8_asym8 ( \
           (UWORD8 *)p_out->p, (UWORD8 *) p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
           cfg.cols1, cfg.rows, \
-          cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+          cfg.inp1_zero_bias, cfg.mat1_zero_bias, \
           cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
       XTPWR_PROFILER_STOP(0);\
     }
@@ -276,6 +561,46 @@ void show_usage(void)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_MUL_FN(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matmul_##MPREC##x##VPREC##_##OPREC ( \
+          (WORD##OPREC *)p_out->p, (WORD##MPREC *) p_mat1->p, (WORD##VPREC *)p_vec1->p, (WORD##MPREC *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.acc_shift, cfg.bias_shift, \
+          cfg.vec_count, cfg.vec_offset, cfg.out_offset, cfg.out_stride);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#ifdef NNLIB_V2
+#define MAT_MUL_FN_ASYM8(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matmul_asym8xasym8_asym8 ( \
+          (UWORD8 *)p_out->p, (UWORD8 *) p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.vec_count, cfg.vec_offset, cfg.out_offset, cfg.out_stride, \
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+#else
+#define MAT_MUL_FN_ASYM8(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+     printf("unsupported multiplication\n"); return -1;} 
+#endif /* NNLIB_V2 */
+
+#define MAT_MUL_FN_F32(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matmul_f32xf32_f32 ( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *) p_mat1->p, (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.vec_count, cfg.vec_offset, cfg.out_offset, cfg.out_stride);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define MAT_VEC_MUL_FN_BATCH(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
@@ -288,10 +613,17 @@ void show_usage(void)
         *((WORD##VPREC **) pp_vec1 + i) =  ((WORD##VPREC *)p_vec1->p + i*cfg.cols1);\
         *((WORD##OPREC **) pp_out + i) = ((WORD##OPREC *)p_out->p + i*cfg.rows);\
       }\
-      err = xa_nn_matXvec_batch_##MPREC##x##VPREC##_##OPREC ( \
-          (WORD##OPREC **)pp_out, (WORD##MPREC *) p_mat1->p, (WORD##VPREC **)pp_vec1, (VOID *)p_bias->p, \
-          cfg.rows, cfg.cols1, p_mat1->row_offset, \
-          cfg.acc_shift, cfg.bias_shift, cfg.vec_count);\
+      if(cfg.unroll[0]) {\
+        err = xa_nn_matXvec_batch_##MPREC##x##VPREC##_##OPREC##_unroll ( \
+            (WORD##OPREC **)pp_out, (WORD##MPREC *) p_mat1->p, (WORD##VPREC **)pp_vec1, (VOID *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, \
+            cfg.acc_shift, cfg.bias_shift, cfg.vec_count, unroll);\
+      } else {\
+        err = xa_nn_matXvec_batch_##MPREC##x##VPREC##_##OPREC ( \
+            (WORD##OPREC **)pp_out, (WORD##MPREC *) p_mat1->p, (WORD##VPREC **)pp_vec1, (VOID *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, \
+            cfg.acc_shift, cfg.bias_shift, cfg.vec_count);\
+      }\
       free(pp_vec1);\
       free(pp_out);\
       XTPWR_PROFILER_STOP(0);\
@@ -336,6 +668,30 @@ void show_usage(void)
       XTPWR_PROFILER_STOP(0);\
     }
 
+/* MAT_VEC_MUL_ACTIVATION_FN for the kernels that have a row range version */
+#define MAT_VEC_MUL_ACTIVATION_RANGE_FN(MPREC, VPREC, OPREC, ACTIVATION) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matXvec_##MPREC##x##VPREC##_##OPREC##_##ACTIVATION ( \
+          (WORD##OPREC *)p_out->p, (WORD##MPREC *) p_mat1->p, (WORD##MPREC *) p_mat2->p, (WORD##VPREC *)p_vec1->p, (WORD##VPREC *)p_vec2->p, (VOID *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+          cfg.acc_shift, cfg.bias_shift, cfg.bias_precision, \
+          (VOID *)p_scratch->p);\
+      XTPWR_PROFILER_STOP(0);\
+      if(!err && cfg.row_slices > 0) {\
+        int slice, start, count, n_slices = MATXVEC_RANGE_NUM_SLICES;\
+        for(slice = 0; slice < n_slices && !err; slice++) {\
+          MATXVEC_RANGE_SLICE(slice, n_slices, start, count);\
+          err = xa_nn_matXvec_range_##MPREC##x##VPREC##_##OPREC##_##ACTIVATION ( \
+              (WORD##OPREC *)p_range_out->p, (WORD##MPREC *) p_mat1->p, (WORD##MPREC *) p_mat2->p, (WORD##VPREC *)p_vec1->p, (WORD##VPREC *)p_vec2->p, (VOID *)p_bias->p, \
+              cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+              cfg.acc_shift, cfg.bias_shift, cfg.bias_precision, \
+              (VOID *)p_scratch->p, start, count);\
+        }\
+        range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+      }\
+    }
+
 #define MAT_VEC_MUL_FN_F32(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
@@ -343,6 +699,16 @@ void show_usage(void)
           (FLOAT32 *)p_out->p, (FLOAT32 *) p_mat1->p, (FLOAT32 *) p_mat2->p, (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_vec2->p, (FLOAT32 *)p_bias->p, \
           cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset); \
       XTPWR_PROFILER_STOP(0);\
+      if(!err && cfg.row_slices > 0) {\
+        int slice, start, count, n_slices = MATXVEC_RANGE_NUM_SLICES;\
+        for(slice = 0; slice < n_slices && !err; slice++) {\
+          MATXVEC_RANGE_SLICE(slice, n_slices, start, count);\
+          err = xa_nn_matXvec_range_f32xf32_f32 ( \
+              (FLOAT32 *)p_range_out->p, (FLOAT32 *) p_mat1->p, (FLOAT32 *) p_mat2->p, (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_vec2->p, (FLOAT32 *)p_bias->p, \
+              cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, start, count); \
+        }\
+        range_match = !err && compare_buf1D(p_range_out, p_out, 1);\
+      }\
     }
 
 #define MAT_VEC_MUL_FN_F32_BATCH(MPREC, VPREC, OPREC) \
@@ -378,13 +744,13 @@ void show_usage(void)
 
 #if XCHAL_HAVE_HIFI4_VFPU 
 #define PROCESS_MATXVEC \
-    MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, sigmoid) \
-    else MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, tanh) \
+    MAT_VEC_MUL_ACTIVATION_RANGE_FN(16, 16, 16, sigmoid) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(16, 16, 16, tanh) \
     else MAT_VEC_MUL_FN(16, 16, 16) \
     else MAT_VEC_MUL_FN(16, 16, 32) \
     else MAT_VEC_MUL_FN(16, 16, 64) \
-    else MAT_VEC_MUL_ACTIVATION_FN(8, 16, 16, sigmoid) \
-    else MAT_VEC_MUL_ACTIVATION_FN(8, 16, 16, tanh) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(8, 16, 16, sigmoid) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(8, 16, 16, tanh) \
     else MAT_VEC_MUL_FN(8, 16, 16) \
     else MAT_VEC_MUL_FN(8, 16, 32) \
     else MAT_VEC_MUL_FN(8, 16, 64) \
@@ -394,19 +760,20 @@ void show_usage(void)
     else MAT_VEC_MUL_FN(8, 8, 16) \
     else MAT_VEC_MUL_FN(8, 8, 32) \
     else MAT_VEC_MUL_FN_ASYM8(-3, -3, -3) \
+    else MAT_VEC_MUL_FN_ASYM8_16(-3, -3, 16) \
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, sigmoid) \
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, tanh) \
     else MAT_VEC_MUL_FN_F32(-1, -1, -1) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #else
 #define PROCESS_MATXVEC \
-    MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, sigmoid) \
-    else MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, tanh) \
+    MAT_VEC_MUL_ACTIVATION_RANGE_FN(16, 16, 16, sigmoid) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(16, 16, 16, tanh) \
     else MAT_VEC_MUL_FN(16, 16, 16) \
     else MAT_VEC_MUL_FN(16, 16, 32) \
     else MAT_VEC_MUL_FN(16, 16, 64) \
-    else MAT_VEC_MUL_ACTIVATION_FN(8, 16, 16, sigmoid) \
-    else MAT_VEC_MUL_ACTIVATION_FN(8, 16, 16, tanh) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(8, 16, 16, sigmoid) \
+    else MAT_VEC_MUL_ACTIVATION_RANGE_FN(8, 16, 16, tanh) \
     else MAT_VEC_MUL_FN(8, 16, 16) \
     else MAT_VEC_MUL_FN(8, 16, 32) \
     else MAT_VEC_MUL_FN(8, 16, 64) \
@@ -416,6 +783,7 @@ void show_usage(void)
     else MAT_VEC_MUL_FN(8, 8, 16) \
     else MAT_VEC_MUL_FN(8, 8, 32) \
     else MAT_VEC_MUL_FN_ASYM8(-3, -3, -3) \
+    else MAT_VEC_MUL_FN_ASYM8_16(-3, -3, 16) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #endif
 
@@ -452,6 +820,20 @@ void show_usage(void)
     else MAT_VEC_MUL_FN_ASYM8_BATCH(-3, -3, -3) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #endif
+#if XCHAL_HAVE_HIFI4_VFPU 
+#define PROCESS_MATMUL \
+    MAT_MUL_FN(16, 16, 16) \
+    else MAT_MUL_FN(8, 8, 8) \
+    else MAT_MUL_FN_ASYM8(-3, -3, -3) \
+    else MAT_MUL_FN_F32(-1, -1, -1) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+#else
+#define PROCESS_MATMUL \
+    MAT_MUL_FN(16, 16, 16) \
+    else MAT_MUL_FN(8, 8, 8) \
+    else MAT_MUL_FN_ASYM8(-3, -3, -3) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+#endif
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -459,6 +841,9 @@ int xa_nn_main_process(int argc, char *argv[])
   int err = 0;
   //int i;
   int pass_count=0;
+  int range_match = 1;
+  int hybrid_match = 1;
+  int sparse_match = 1;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
 
@@ -470,6 +855,7 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_vec2;
   buf1D_t *p_bias;
   buf1D_t *p_out;
+  buf1D_t *p_range_out = NULL;
   buf1D_t *p_scratch;
   buf1D_t *ptr_ref;
   int scratch_size = 0;
@@ -477,6 +863,7 @@ int xa_nn_main_process(int argc, char *argv[])
   FILE *fptr_inp;
   FILE *fptr_out;
   FILE *fptr_ref;
+  WORD32 unroll = XA_NN_MATXVEC_UNROLL_AUTO;
 
   if(default_config(&cfg))
   {
@@ -494,6 +881,67 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  if(cfg.unroll[0])
+  {
+    int unroll_rows, unroll_vecs;
+    if(!cfg.batch || (cfg.mat_precision != 8 && cfg.mat_precision != 16))
+    {
+      printf("-unroll is supported with -batch 1 for 8x8_32, 8x16_64 and 16x16_64 only\n");
+      return -1;
+    }
+    if(sscanf(cfg.unroll, "%dx%d", &unroll_rows, &unroll_vecs) == 2)
+    {
+      unroll = XA_NN_MATXVEC_UNROLL(unroll_rows, unroll_vecs);
+    }
+    else if(strcmp(cfg.unroll, "auto"))
+    {
+      printf("Invalid -unroll: %s\n", cfg.unroll);
+      return -1;
+    }
+  }
+
+  if(cfg.hybrid && (cfg.mat_precision != -1 || cfg.inp_precision != -1 || cfg.out_precision != -1 ||
+        cfg.batch || cfg.matmul || cfg.activation[0]))
+  {
+    printf("-hybrid is supported for f32 matXvec and fully connected without activation only\n");
+    return -1;
+  }
+  if(cfg.sparse && !(cfg.mat_precision == cfg.inp_precision && cfg.inp_precision == cfg.out_precision &&
+        (cfg.mat_precision == 8 || cfg.mat_precision == -3) &&
+        !cfg.batch && !cfg.matmul && !cfg.fc && !cfg.activation[0]))
+  {
+    printf("-sparse is supported for 8x8_8 and asym8 matXvec without activation only\n");
+    return -1;
+  }
+#ifndef NNLIB_V2
+  if(cfg.hybrid || cfg.sparse)
+  {
+    printf("-hybrid and -sparse need NNLIB_V2\n");
+    return -1;
+  }
+#endif /* NNLIB_V2 */
+
+  if(cfg.matmul == 1)
+  {
+    /* Default layout: vectors back to back, vec_count x rows output */
+    if(cfg.vec_offset == 0)
+    {
+      cfg.vec_offset = cfg.cols1;
+    }
+    if(cfg.out_offset == 0 && cfg.out_stride == 0)
+    {
+      cfg.out_offset = cfg.rows;
+      cfg.out_stride = 1;
+    }
+    /* Output buffer holds rows x vec_count elements */
+    if((cfg.vec_count - 1) * cfg.out_offset + (cfg.rows - 1) * cfg.out_stride >= cfg.rows * cfg.vec_count ||
+       cfg.vec_offset < cfg.cols1)
+    {
+      printf("matmul: vec_offset or output layout out of range\n");
+      return -1;
+    }
+  }
+
   if(cfg.fc == 1){
     /* In fully connected apis, row_stride is equal to cols, thus setting
      * membank_padding to 0. */
@@ -506,6 +954,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.fc == 1){
       sprintf(profiler_name,"fully_connected_f32");
     }
+    else if(cfg.matmul == 1){
+      sprintf(profiler_name,"matmul_f32xf32_f32");
+    }
     else{
       sprintf(profiler_name,"matXvec%s_f32xf32_f32",(cfg.batch)? "_batch": "");
     }
@@ -522,8 +973,12 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.fc == 1){
       sprintf(profiler_name,"fully_connected_asym8xasym8_asym8");
     }
+    else if(cfg.matmul == 1){
+      sprintf(profiler_name,"matmul_asym8xasym8_asym8");
+    }
     else{
-      sprintf(profiler_name,"matXvec%s_asym8xasym8_asym8",(cfg.batch)? "_batch": "");
+      sprintf(profiler_name,"matXvec%s_asym8xasym8_%s",(cfg.batch)? "_batch": "",
+          (cfg.out_precision == 16)? "16": "asym8");
     }
     // If VFPU is not supported, return
     if(!XCHAL_HAVE_HIFI4_VFPU)
@@ -538,6 +993,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.fc == 1){
       sprintf(profiler_name, "fully_connected_%dx%d_%d",cfg.mat_precision, cfg.inp_precision, cfg.out_precision); 
     }
+    else if(cfg.matmul == 1){
+      sprintf(profiler_name, "matmul_%dx%d_%d",cfg.mat_precision, cfg.inp_precision, cfg.out_precision); 
+    }
     else{
       sprintf(profiler_name, "matXvec%s_%dx%d_%d",(cfg.batch)? "_batch" : "",cfg.mat_precision, cfg.inp_precision, cfg.out_precision); 
     }
@@ -546,9 +1004,21 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_name,"%s_%s",profiler_name,cfg.activation);
   }
+  if(cfg.unroll[0])
+  {
+    sprintf(profiler_name,"%s_unroll_%s",profiler_name,cfg.unroll);
+  }
+  if(cfg.hybrid)
+  {
+    sprintf(profiler_name,"%s_hybrid",profiler_name);
+  }
+  if(cfg.sparse)
+  {
+    sprintf(profiler_name,"%s_sparse",profiler_name);
+  }
   
   // Set profiler parameters
-  if(cfg.batch == 1){
+  if(cfg.batch == 1 || cfg.matmul == 1){
     sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d", 
       cfg.rows, cfg.cols1, cfg.bias_precision,cfg.vec_count);
   }
@@ -589,17 +1059,21 @@ int xa_nn_main_process(int argc, char *argv[])
 
   // Allocate Memory
   p_mat1 = create_buf2D(cfg.rows, cfg.cols1, cfg.row_stride1, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat1);
-  p_vec1 = create_buf1D(cfg.cols1*cfg.vec_count, cfg.inp_precision);                                      VALIDATE_PTR(p_vec1);
+  p_vec1 = create_buf1D(((cfg.matmul == 1) ? cfg.vec_offset : cfg.cols1)*cfg.vec_count, cfg.inp_precision); VALIDATE_PTR(p_vec1);
   p_mat2 = create_buf2D(cfg.rows, cfg.cols2, cfg.row_stride2, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat2);
   p_vec2 = create_buf1D(cfg.cols2, cfg.inp_precision);                                                    VALIDATE_PTR(p_vec2);
   p_bias = create_buf1D(cfg.rows, cfg.bias_precision);                                                    VALIDATE_PTR(p_bias);
   p_out = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                                        VALIDATE_PTR(p_out);
   p_scratch = create_buf1D(scratch_size, 8);                                                              VALIDATE_PTR(p_scratch);
+  if(cfg.row_slices > 0)
+  {
+    p_range_out = create_buf1D(cfg.rows, cfg.out_precision);                                              VALIDATE_PTR(p_range_out);
+  }
 
   if(cfg.inp_precision == cfg.out_precision && (!strcmp(cfg.activation, "sigmoid") || !strcmp(cfg.activation, "tanh"))){
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
-  if(cfg.batch == 1){
+  if(cfg.batch == 1 || cfg.matmul == 1){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1 * cfg.vec_count), "MACs/cyc", 1);
   }
   else if(cfg.fc == 1){
@@ -620,6 +1094,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.batch == 1){
         PROCESS_MATXVEC_BATCH;
     }
+    else if(cfg.matmul == 1){
+        PROCESS_MATMUL;
+    }
     else if(cfg.fc == 1){
         PROCESS_MATXVEC_FC;
     }
@@ -637,6 +1114,17 @@ int xa_nn_main_process(int argc, char *argv[])
     XTPWR_PROFILER_UPDATE(0);
     XTPWR_PROFILER_PRINT(0);
 
+#ifdef NNLIB_V2
+    if(cfg.hybrid)
+    {
+      hybrid_match = hybrid_matches(&cfg, p_mat1, p_vec1, p_mat2, p_vec2, p_bias, p_out);
+    }
+    if(cfg.sparse)
+    {
+      sparse_match = sparse_matches(&cfg, p_mat1, p_vec1, p_bias);
+    }
+#endif /* NNLIB_V2 */
+
     // Write output into file
     
     write_buf1D_to_file(fptr_out, p_out);
@@ -645,11 +1133,11 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, ptr_ref);
-      pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify);
+      pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify) && range_match && hybrid_match && sparse_match;
     }
     else
     {
-      pass_count += !err;
+      pass_count += !err && range_match && hybrid_match && sparse_match;
     }
   }
 
@@ -666,6 +1154,8 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf1D(p_vec2);
   free_buf1D(p_bias);
   free_buf1D(p_out);
+  if(p_range_out)
+    free_buf1D(p_range_out);
   free_buf1D(p_scratch);
 
   if(cfg.verify)
@@ -54,6 +54,8 @@ typedef struct _test_config_t
 
   int help;
   int num_elms;
+  int rows;
+  int inp_zero_bias;
   int inp_precision;
   int out_precision;
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
@@ -73,6 +75,8 @@ int default_config(test_config_t *p_cfg)
 
     p_cfg->help     = 0;
     p_cfg->num_elms = 256;
+    p_cfg->rows = 1;
+    p_cfg->inp_zero_bias = -128;
     p_cfg->inp_precision = 16;
     p_cfg->out_precision = 16;
     strcpy(p_cfg->kernel_name, "l2_norm");
@@ -108,6 +112,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_INDICATE("-help", p_cfg->help);
     ARGTYPE_INDICATE("-h", p_cfg->help);
     ARGTYPE_ONETIME_CONFIG("-num_elms",p_cfg->num_elms);
+    ARGTYPE_ONETIME_CONFIG("-rows",p_cfg->rows);
+    ARGTYPE_ONETIME_CONFIG("-inp_zero_bias",p_cfg->inp_zero_bias);
     ARGTYPE_ONETIME_CONFIG("-inp_precision",p_cfg->inp_precision);
     ARGTYPE_ONETIME_CONFIG("-out_precision",p_cfg->out_precision);
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
@@ -129,10 +135,12 @@ void show_usage(void)
 {
     printf ("Usage xt-run <binary> [Options]\n");
     printf("\t-num_elms: Number of elements; Default=256\n");
-    printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
-    printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
+    printf("\t-rows: Number of rows num_elms is split into (l2_norm_rows); Default=1\n");
+    printf("\t-inp_zero_bias: Input zero bias for asym8 (l2_norm_rows); Default=-128\n");
+    printf("\t-inp_precision: 8, 16, -1(single prec float), -3(asym8); Default=16\n");
+    printf("\t-out_precision: 8, 16, -1(single prec float), -3(asym8); Default=16\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: l2_norm; Default=""l2_norm""\n");
+    printf("\t-kernel_name: l2_norm, l2_norm_rows; Default=""l2_norm""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -150,13 +158,34 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define L2_NORM_ROWS_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, \
+        cfg.rows, cfg.num_elms/cfg.rows); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define L2_NORM_ROWS_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8 ( \
+        (UWORD8 *)p_out->p, (UWORD8 *) p_inp->p, \
+        cfg.inp_zero_bias, cfg.rows, cfg.num_elms/cfg.rows); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if XCHAL_HAVE_HIFI4_VFPU
 #define PROCESS_NORM \
     L2_NORM_KERNEL_F_FN(l2_norm, -1, -1) \
+    else L2_NORM_ROWS_KERNEL_F_FN(l2_norm_rows, -1, -1) \
+    else L2_NORM_ROWS_KERNEL_ASYM8_FN(l2_norm_rows, -3, -3) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #else
 #define PROCESS_NORM \
-    {  printf("unsupported pooling operation\n"); return -1;}
+    L2_NORM_ROWS_KERNEL_ASYM8_FN(l2_norm_rows, -3, -3) \
+    else {  printf("unsupported pooling operation\n"); return -1;}
 #endif
 
 int xa_nn_main_process(int argc, char *argv[])
@@ -204,7 +233,12 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     strcpy(profiler_name,cfg.kernel_name);
   }
-  if(cfg.inp_precision == -1)
+  if(cfg.inp_precision == -3)
+  {
+    sprintf(profiler_params, "_asym8");
+    strcat(profiler_name, profiler_params);
+  }
+  else if(cfg.inp_precision == -1)
   {
     sprintf(profiler_params, "_f32");
     strcat(profiler_name, profiler_params);
@@ -224,7 +258,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  sprintf(profiler_params, "num_elms=%d", cfg.num_elms);
+  sprintf(profiler_params, "num_elms=%d rows=%d", cfg.num_elms, cfg.rows);
 
   // Open input file
   if(cfg.write_file)
@@ -257,7 +291,7 @@ int xa_nn_main_process(int argc, char *argv[])
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
   
-  if(!strcmp(cfg.kernel_name,"l2_norm"))
+  if(!strcmp(cfg.kernel_name,"l2_norm") || !strcmp(cfg.kernel_name,"l2_norm_rows"))
     num_ops = 2*cfg.num_elms;   // First calculated square root of energy and then divide input by it
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
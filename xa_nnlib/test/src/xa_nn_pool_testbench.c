@@ -85,6 +85,9 @@ typedef struct _test_config_t
   int y_padding;
   int out_height;
   int out_width;
+  int batches;
+  int activation_min;
+  int activation_max;
   int acc_shift;
   int out_data_format;
   int inp_precision;
@@ -117,6 +120,9 @@ int default_config(test_config_t *p_cfg)
     p_cfg->y_padding = 2;
     p_cfg->out_height = 16;
     p_cfg->out_width = 16;
+    p_cfg->batches = 1;
+    p_cfg->activation_min = 0;
+    p_cfg->activation_max = 255;
     p_cfg->acc_shift = -7;
     p_cfg->out_data_format = 1;
     p_cfg->inp_precision = 16;
@@ -165,6 +171,9 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-y_padding",p_cfg->y_padding);
     ARGTYPE_ONETIME_CONFIG("-out_height",p_cfg->out_height);
     ARGTYPE_ONETIME_CONFIG("-out_width",p_cfg->out_width);
+    ARGTYPE_ONETIME_CONFIG("-batches",p_cfg->batches);
+    ARGTYPE_ONETIME_CONFIG("-activation_min",p_cfg->activation_min);
+    ARGTYPE_ONETIME_CONFIG("-activation_max",p_cfg->activation_max);
     ARGTYPE_ONETIME_CONFIG("-acc_shift",p_cfg->acc_shift);
     ARGTYPE_ONETIME_CONFIG("-out_data_format",p_cfg->out_data_format);
     ARGTYPE_ONETIME_CONFIG("-inp_precision",p_cfg->inp_precision);
@@ -199,12 +208,15 @@ void show_usage(void)
     printf("\t-y_padding: top padding in width dimension; Default=2\n");
     printf("\t-out_height: output height; Default=16\n");
     printf("\t-out_width: output width; Default=16\n");
+    printf("\t-batches: number of batches (avgpool_batch, maxpool_batch, global_avgpool only); Default=1\n");
+    printf("\t-activation_min: fused activation lower bound (avgpool_batch, maxpool_batch only); Default=0\n");
+    printf("\t-activation_max: fused activation upper bound (avgpool_batch, maxpool_batch only); Default=255\n");
     printf("\t-acc_shift: accumulator left shift; Default=-7\n");
     printf("\t-out_data_format: data format; Default=1 (WHD)\n");
     printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
     printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: avgpool, maxpool; Default=""avgpool""\n");
+    printf("\t-kernel_name: avgpool, maxpool, avgpool_batch, maxpool_batch, global_avgpool; Default=""avgpool""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -326,6 +338,71 @@ void show_usage(void)
   }
 #endif
 
+#ifdef NNLIB_V2
+#define POOL_BATCH_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, cfg.batches, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        (FLOAT32)cfg.activation_min, (FLOAT32)cfg.activation_max, \
+        cfg.inp_data_format, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define POOL_BATCH_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8( \
+        (UWORD8 *)p_out->p, (UWORD8 *)p_inp->p, cfg.batches, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.activation_min, cfg.activation_max, \
+        cfg.inp_data_format, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define GLOBAL_POOL_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, cfg.batches, \
+        cfg.input_height, cfg.input_width, cfg.input_channels);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+/* Requantization parameters fold in the 1/(height*width) averaging factor,
+   input and output share scale and zero point. As in
+   QuantizeMultiplierSmallerThanOne, 1/plane = q * 2^-(shift-1) with q in
+   [0.5, 1) rounded to Q31. */
+#define GLOBAL_POOL_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    int plane = cfg.input_height * cfg.input_width, shift = 0;\
+    while((1 << shift) < plane) shift++;\
+    WORD32 out_multiplier = (WORD32)(((double)(1 << shift) / plane) * 1073741824.0 + 0.5);\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8( \
+        (UWORD8 *)p_out->p, (UWORD8 *)p_inp->p, cfg.batches, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, \
+        -128, out_multiplier, 1 - shift, 128);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+#else
+#define POOL_BATCH_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
+  if(0) {\
+  }
+#define POOL_BATCH_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
+  if(0) {\
+  }
+#define GLOBAL_POOL_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
+  if(0) {\
+  }
+#define GLOBAL_POOL_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
+  if(0) {\
+  }
+#endif
+
 #if XCHAL_HAVE_HIFI4_VFPU
 #define PROCESS_POOL \
     AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
@@ -336,6 +413,12 @@ void show_usage(void)
     else MAXPOOL_KERNEL_F_FN(maxpool, -1, -1) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else POOL_BATCH_KERNEL_F_FN(avgpool_batch, -1, -1) \
+    else POOL_BATCH_KERNEL_F_FN(maxpool_batch, -1, -1) \
+    else POOL_BATCH_KERNEL_ASYM8_FN(avgpool_batch, -3, -3) \
+    else POOL_BATCH_KERNEL_ASYM8_FN(maxpool_batch, -3, -3) \
+    else GLOBAL_POOL_KERNEL_F_FN(global_avgpool, -1, -1) \
+    else GLOBAL_POOL_KERNEL_ASYM8_FN(global_avgpool, -3, -3) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #else
 #define PROCESS_POOL \
@@ -345,6 +428,9 @@ void show_usage(void)
     else MAXPOOL_KERNEL_FN(maxpool, 16, 16) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else POOL_BATCH_KERNEL_ASYM8_FN(avgpool_batch, -3, -3) \
+    else POOL_BATCH_KERNEL_ASYM8_FN(maxpool_batch, -3, -3) \
+    else GLOBAL_POOL_KERNEL_ASYM8_FN(global_avgpool, -3, -3) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #endif
 
@@ -386,8 +472,8 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
-  inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
-  out_size = cfg.out_height * cfg.out_width * cfg.input_channels;
+  inp_size = cfg.batches * cfg.input_height * cfg.input_width * cfg.input_channels;
+  out_size = cfg.batches * cfg.out_height * cfg.out_width * cfg.input_channels;
 
   // Set profiler name 
   if(cfg.kernel_name[0])
@@ -425,8 +511,8 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_height=%d, out_width=%d", 
-      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_height, cfg.out_width);
+  sprintf(profiler_params, "batches=%d, input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_height=%d, out_width=%d", 
+      cfg.batches, cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_height, cfg.out_width);
 
   // Open input file
   if(cfg.write_file)
@@ -458,10 +544,12 @@ int xa_nn_main_process(int argc, char *argv[])
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
 
-  if(!strcmp(cfg.kernel_name,"avgpool"))
+  if(!strcmp(cfg.kernel_name,"avgpool") || !strcmp(cfg.kernel_name,"avgpool_batch"))
     num_ops = out_size * (1 + cfg.kernel_height * cfg.kernel_width);
-  else if(!strcmp(cfg.kernel_name,"maxpool"))
+  else if(!strcmp(cfg.kernel_name,"maxpool") || !strcmp(cfg.kernel_name,"maxpool_batch"))
     num_ops = out_size * cfg.kernel_height * cfg.kernel_width;
+  else if(!strcmp(cfg.kernel_name,"global_avgpool"))
+    num_ops = inp_size + out_size;
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
 
@@ -469,7 +557,7 @@ int xa_nn_main_process(int argc, char *argv[])
   WORD32 scratch_size = 0;
 
   // Get persistent size and allocate 
-  if(!strcmp(cfg.kernel_name,"avgpool"))
+  if(!strcmp(cfg.kernel_name,"avgpool") || !strcmp(cfg.kernel_name,"avgpool_batch"))
   {
 #ifndef NNLIB_V2
       scratch_size = xa_nn_avgpool_getsize(cfg.inp_precision
@@ -499,7 +587,7 @@ int xa_nn_main_process(int argc, char *argv[])
               ,cfg.out_data_format);
 #endif
   }
-  else if(!strcmp(cfg.kernel_name,"maxpool"))
+  else if(!strcmp(cfg.kernel_name,"maxpool") || !strcmp(cfg.kernel_name,"maxpool_batch"))
   {
 #ifndef NNLIB_V2
       scratch_size = xa_nn_maxpool_getsize(cfg.inp_precision
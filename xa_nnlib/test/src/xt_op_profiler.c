@@ -0,0 +1,251 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xt_op_profiler.h"
+
+#ifndef __XTENSA__
+#include <time.h>
+#endif
+
+#ifdef NNLIB_PTHREADS
+#include <pthread.h>
+/* One lock for the whole profiler: runtimes may execute operators (and
+   whole executions) on several threads, and all of them share the ring,
+   the callback and the extended cycle counter below. */
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+#define PROF_LOCK()   pthread_mutex_lock(&g_lock)
+#define PROF_UNLOCK() pthread_mutex_unlock(&g_lock)
+#else
+#define PROF_LOCK()
+#define PROF_UNLOCK()
+#endif
+
+static xt_op_prof_record_t *gp_ring = NULL;
+static int g_capacity = 0;
+static int g_head = 0;       /* Next slot to write */
+static int g_count = 0;
+static xt_op_prof_callback_t g_callback = NULL;
+static void *gp_callback_user = NULL;
+/* Mirrors gp_ring != NULL, written under the lock; an aligned int is read
+   in one access, so xt_op_prof_is_enabled() checks it without locking and
+   operators pay nothing for the profiler while it is off */
+static volatile int g_enabled = 0;
+
+#ifdef __XTENSA__
+/* CCOUNT is 32 bits, extend it so long runs do not wrap */
+static uint32_t g_last_ccount = 0;
+static uint64_t g_ccount_high = 0;
+#endif
+
+void xt_op_prof_enable(xt_op_prof_record_t *p_ring, int capacity)
+{
+  if(p_ring == NULL || capacity <= 0)
+  {
+    xt_op_prof_disable();
+    return;
+  }
+  PROF_LOCK();
+  gp_ring = p_ring;
+  g_capacity = capacity;
+  g_head = 0;
+  g_count = 0;
+  g_enabled = 1;
+  PROF_UNLOCK();
+}
+
+void xt_op_prof_disable(void)
+{
+  PROF_LOCK();
+  g_enabled = 0;
+  gp_ring = NULL;
+  g_capacity = 0;
+  g_head = 0;
+  g_count = 0;
+  PROF_UNLOCK();
+}
+
+int xt_op_prof_is_enabled(void)
+{
+  return g_enabled;
+}
+
+void xt_op_prof_set_callback(xt_op_prof_callback_t callback, void *p_user)
+{
+  PROF_LOCK();
+  g_callback = callback;
+  gp_callback_user = p_user;
+  PROF_UNLOCK();
+}
+
+void xt_op_prof_clear(void)
+{
+  PROF_LOCK();
+  g_head = 0;
+  g_count = 0;
+  PROF_UNLOCK();
+}
+
+/* Caller holds the lock */
+static uint64_t prof_timestamp(void)
+{
+#ifdef __XTENSA__
+  uint32_t ccount;
+  __asm__ volatile ("rsr.ccount %0" : "=r" (ccount));
+  if(ccount < g_last_ccount)
+  {
+    g_ccount_high += ((uint64_t)1 << 32);
+  }
+  g_last_ccount = ccount;
+  return g_ccount_high | ccount;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+uint64_t xt_op_prof_timestamp(void)
+{
+  uint64_t ts;
+  PROF_LOCK();
+  ts = prof_timestamp();
+  PROF_UNLOCK();
+  return ts;
+}
+
+void xt_op_prof_begin(xt_op_prof_record_t *p_rec, int op_index, int opcode, const char *op_name)
+{
+  p_rec->op_index = op_index;
+  p_rec->opcode = opcode;
+  p_rec->op_name = op_name;
+  p_rec->bytes_read = 0;
+  p_rec->bytes_written = 0;
+  p_rec->macs = 0;
+  p_rec->stop = 0;
+  p_rec->start = xt_op_prof_timestamp();
+}
+
+void xt_op_prof_end(xt_op_prof_record_t *p_rec, uint32_t bytes_read, uint32_t bytes_written, uint64_t macs)
+{
+  xt_op_prof_callback_t callback;
+  void *p_user;
+
+  PROF_LOCK();
+  p_rec->stop = prof_timestamp();
+  p_rec->bytes_read = bytes_read;
+  p_rec->bytes_written = bytes_written;
+  p_rec->macs = macs;
+
+  if(gp_ring == NULL)
+  {
+    PROF_UNLOCK();
+    return;
+  }
+
+  gp_ring[g_head] = *p_rec;
+  g_head = (g_head + 1) % g_capacity;
+  if(g_count < g_capacity)
+    g_count++;
+
+  callback = g_callback;
+  p_user = gp_callback_user;
+  PROF_UNLOCK();
+
+  /* Outside the lock, so the callback may use the profiler API; with
+     several threads it may run concurrently with itself */
+  if(callback != NULL)
+    callback(p_rec, p_user);
+}
+
+int xt_op_prof_count(void)
+{
+  int count;
+  PROF_LOCK();
+  count = g_count;
+  PROF_UNLOCK();
+  return count;
+}
+
+/* Caller holds the lock */
+static const xt_op_prof_record_t *prof_get(int idx)
+{
+  if(gp_ring == NULL || idx < 0 || idx >= g_count)
+    return NULL;
+  /* Oldest record sits at g_head once the ring has wrapped */
+  return &gp_ring[(g_head - g_count + idx + g_capacity) % g_capacity];
+}
+
+const xt_op_prof_record_t *xt_op_prof_get(int idx)
+{
+  const xt_op_prof_record_t *p_rec;
+  PROF_LOCK();
+  p_rec = prof_get(idx);
+  PROF_UNLOCK();
+  return p_rec;
+}
+
+int xt_op_prof_dump_csv(FILE *fp)
+{
+  int i;
+  if(fp == NULL)
+    return -1;
+  fprintf(fp, "op_index,opcode,op_name,start_%s,duration_%s,bytes_read,bytes_written,macs\n",
+      XT_OP_PROF_TIME_UNIT, XT_OP_PROF_TIME_UNIT);
+  PROF_LOCK();
+  for(i = 0; i < g_count; i++)
+  {
+    const xt_op_prof_record_t *p_rec = prof_get(i);
+    fprintf(fp, "%d,%d,%s,%llu,%llu,%u,%u,%llu\n",
+        (int)p_rec->op_index, (int)p_rec->opcode, p_rec->op_name ? p_rec->op_name : "",
+        (unsigned long long)p_rec->start, (unsigned long long)(p_rec->stop - p_rec->start),
+        (unsigned)p_rec->bytes_read, (unsigned)p_rec->bytes_written,
+        (unsigned long long)p_rec->macs);
+  }
+  PROF_UNLOCK();
+  return 0;
+}
+
+int xt_op_prof_dump_chrome_trace(FILE *fp, double ticks_per_us)
+{
+  int i;
+  uint64_t origin;
+  if(fp == NULL || ticks_per_us <= 0)
+    return -1;
+  PROF_LOCK();
+  origin = g_count ? prof_get(0)->start : 0;
+  fprintf(fp, "{\"traceEvents\":[");
+  for(i = 0; i < g_count; i++)
+  {
+    const xt_op_prof_record_t *p_rec = prof_get(i);
+    fprintf(fp, "%s\n{\"name\":\"%s\",\"cat\":\"op\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+        "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"op_index\":%d,\"opcode\":%d,"
+        "\"bytes_read\":%u,\"bytes_written\":%u,\"macs\":%llu}}",
+        i ? "," : "", p_rec->op_name ? p_rec->op_name : "op",
+        (double)(p_rec->start - origin) / ticks_per_us,
+        (double)(p_rec->stop - p_rec->start) / ticks_per_us,
+        (int)p_rec->op_index, (int)p_rec->opcode,
+        (unsigned)p_rec->bytes_read, (unsigned)p_rec->bytes_written,
+        (unsigned long long)p_rec->macs);
+  }
+  fprintf(fp, "\n]}\n");
+  PROF_UNLOCK();
+  return 0;
+}
@@ -0,0 +1,375 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xt_weight_container.h"
+
+#ifndef __XTENSA__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define ALIGN_UP(x) (((x) + XT_WC_ALIGN - 1) & ~(uint32_t)(XT_WC_ALIGN - 1))
+
+int xt_wc_type_size(uint32_t type)
+{
+  switch(type)
+  {
+    case XT_WC_TYPE_RAW:
+    case XT_WC_TYPE_ASYM8:
+    case XT_WC_TYPE_INT8:
+      return 1;
+    case XT_WC_TYPE_INT16:
+      return 2;
+    case XT_WC_TYPE_FLOAT32:
+    case XT_WC_TYPE_INT32:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+/* Bytes of an entry whose innermost dimension is depth, 0 on overflow */
+static uint32_t entry_length(const xt_wc_entry_t *p_entry, uint32_t depth)
+{
+  uint64_t length = (uint64_t)xt_wc_type_size(p_entry->type) * depth;
+  uint32_t i;
+  for(i = 0; i + 1 < p_entry->num_dims; i++)
+    length *= p_entry->dims[i];
+  return length > 0xFFFFFFFFu ? 0 : (uint32_t)length;
+}
+
+uint32_t xt_wc_logical_length(const xt_wc_entry_t *p_entry)
+{
+  return entry_length(p_entry, p_entry->dims[p_entry->num_dims - 1]);
+}
+
+int xt_wc_init(xt_wc_t *p_wc, const void *p_buffer, uint32_t size)
+{
+  const xt_wc_header_t *p_header = (const xt_wc_header_t *)p_buffer;
+  const xt_wc_entry_t *p_entries;
+  uint32_t i, table_end, prev_end;
+
+  memset(p_wc, 0, sizeof(*p_wc));
+  if(p_buffer == NULL || ((uintptr_t)p_buffer & (XT_WC_ALIGN - 1)) != 0)
+    return -1;
+  if(size < sizeof(xt_wc_header_t))
+    return -1;
+  if(p_header->magic != XT_WC_MAGIC || p_header->version != XT_WC_VERSION)
+    return -1;
+  if(p_header->size > size)
+    return -1;
+  size = p_header->size;
+  if(p_header->num_entries > (size - sizeof(xt_wc_header_t)) / sizeof(xt_wc_entry_t))
+    return -1;
+  table_end = sizeof(xt_wc_header_t) + p_header->num_entries * sizeof(xt_wc_entry_t);
+
+  p_entries = (const xt_wc_entry_t *)(p_header + 1);
+  prev_end = table_end;
+  for(i = 0; i < p_header->num_entries; i++)
+  {
+    const xt_wc_entry_t *p_entry = &p_entries[i];
+    if(memchr(p_entry->name, 0, XT_WC_NAME_LENGTH) == NULL)
+      return -1;
+    if(xt_wc_type_size(p_entry->type) == 0)
+      return -1;
+    if(p_entry->num_dims < 1 || p_entry->num_dims > XT_WC_MAX_DIMS)
+      return -1;
+    if(p_entry->padded_depth < p_entry->dims[p_entry->num_dims - 1])
+      return -1;
+    if(p_entry->length != entry_length(p_entry, p_entry->padded_depth))
+      return -1;
+    if((p_entry->offset & (XT_WC_ALIGN - 1)) != 0 || p_entry->offset < prev_end)
+      return -1;
+    if(p_entry->offset > size || p_entry->length > size - p_entry->offset)
+      return -1;
+    prev_end = p_entry->offset + p_entry->length;
+  }
+
+  p_wc->p_base = (const uint8_t *)p_buffer;
+  p_wc->size = size;
+  p_wc->p_entries = p_entries;
+  p_wc->num_entries = p_header->num_entries;
+  return 0;
+}
+
+int xt_wc_open(xt_wc_t *p_wc, const char *path)
+{
+#ifndef __XTENSA__
+  struct stat st;
+  void *p_map;
+  int fd;
+
+  memset(p_wc, 0, sizeof(*p_wc));
+  fd = open(path, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  if(fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > 0xFFFFFFFFu)
+  {
+    close(fd);
+    return -1;
+  }
+  /* The mapping holds its own reference to the file */
+  p_map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(p_map == MAP_FAILED)
+    return -1;
+  if(xt_wc_init(p_wc, p_map, (uint32_t)st.st_size) != 0)
+  {
+    munmap(p_map, (size_t)st.st_size);
+    return -1;
+  }
+  p_wc->p_owned = p_map;
+  /* Unmapping needs the file size, the header may declare less */
+  p_wc->size = (uint32_t)st.st_size;
+  return 0;
+#else
+  FILE *fp;
+  long size;
+  uint8_t *p_alloc, *p_buffer;
+
+  memset(p_wc, 0, sizeof(*p_wc));
+  fp = fopen(path, "rb");
+  if(fp == NULL)
+    return -1;
+  if(fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) <= 0 || fseek(fp, 0, SEEK_SET) != 0)
+  {
+    fclose(fp);
+    return -1;
+  }
+  p_alloc = (uint8_t *)malloc((size_t)size + XT_WC_ALIGN);
+  if(p_alloc == NULL)
+  {
+    fclose(fp);
+    return -1;
+  }
+  p_buffer = (uint8_t *)(((uintptr_t)p_alloc + XT_WC_ALIGN - 1) & ~(uintptr_t)(XT_WC_ALIGN - 1));
+  if(fread(p_buffer, 1, (size_t)size, fp) != (size_t)size ||
+      xt_wc_init(p_wc, p_buffer, (uint32_t)size) != 0)
+  {
+    fclose(fp);
+    free(p_alloc);
+    return -1;
+  }
+  fclose(fp);
+  p_wc->p_owned = p_alloc;
+  return 0;
+#endif
+}
+
+void xt_wc_close(xt_wc_t *p_wc)
+{
+  if(p_wc->p_owned != NULL)
+  {
+#ifndef __XTENSA__
+    munmap(p_wc->p_owned, p_wc->size);
+#else
+    free(p_wc->p_owned);
+#endif
+  }
+  memset(p_wc, 0, sizeof(*p_wc));
+}
+
+const xt_wc_entry_t *xt_wc_find(const xt_wc_t *p_wc, const char *name)
+{
+  uint32_t i;
+  for(i = 0; i < p_wc->num_entries; i++)
+  {
+    if(strncmp(p_wc->p_entries[i].name, name, XT_WC_NAME_LENGTH) == 0)
+      return &p_wc->p_entries[i];
+  }
+  return NULL;
+}
+
+const xt_wc_entry_t *xt_wc_find_offset(const xt_wc_t *p_wc, uint32_t offset)
+{
+  uint32_t lo = 0, hi = p_wc->num_entries;
+  while(lo < hi)
+  {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if(p_wc->p_entries[mid].offset < offset)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if(lo < p_wc->num_entries && p_wc->p_entries[lo].offset == offset)
+    return &p_wc->p_entries[lo];
+  return NULL;
+}
+
+const void *xt_wc_data(const xt_wc_t *p_wc, const xt_wc_entry_t *p_entry)
+{
+  return p_wc->p_base + p_entry->offset;
+}
+
+void xt_wc_writer_init(xt_wc_writer_t *p_writer)
+{
+  memset(p_writer, 0, sizeof(*p_writer));
+}
+
+int xt_wc_writer_add(xt_wc_writer_t *p_writer, const char *name, uint32_t type,
+                     uint32_t num_dims, const uint32_t *p_dims, uint32_t padded_depth,
+                     float scale, int32_t zero_point, const void *p_data)
+{
+  xt_wc_entry_t *p_entry;
+  uint32_t i;
+
+  if(name == NULL || strlen(name) >= XT_WC_NAME_LENGTH || p_data == NULL)
+    return -1;
+  if(xt_wc_type_size(type) == 0 || num_dims < 1 || num_dims > XT_WC_MAX_DIMS)
+    return -1;
+  if(padded_depth != 0 && padded_depth < p_dims[num_dims - 1])
+    return -1;
+
+  if(p_writer->num_entries == p_writer->capacity)
+  {
+    uint32_t capacity = p_writer->capacity ? 2 * p_writer->capacity : 16;
+    xt_wc_entry_t *p_entries = (xt_wc_entry_t *)realloc(p_writer->p_entries,
+        capacity * sizeof(xt_wc_entry_t));
+    const void **pp_data;
+    if(p_entries == NULL)
+      return -1;
+    p_writer->p_entries = p_entries;
+    pp_data = (const void **)realloc((void *)p_writer->pp_data, capacity * sizeof(void *));
+    if(pp_data == NULL)
+      return -1;
+    p_writer->pp_data = pp_data;
+    p_writer->capacity = capacity;
+  }
+
+  p_entry = &p_writer->p_entries[p_writer->num_entries];
+  memset(p_entry, 0, sizeof(*p_entry));
+  strcpy(p_entry->name, name);
+  p_entry->type = type;
+  p_entry->num_dims = num_dims;
+  for(i = 0; i < num_dims; i++)
+    p_entry->dims[i] = p_dims[i];
+  p_entry->padded_depth = padded_depth ? padded_depth : p_dims[num_dims - 1];
+  p_entry->zero_point = zero_point;
+  p_entry->scale = scale;
+  p_entry->length = entry_length(p_entry, p_entry->padded_depth);
+  if(p_entry->length == 0)
+  {
+    /* 0 also reports an overflow: accept it only for an empty tensor */
+    uint32_t empty = (p_entry->padded_depth == 0);
+    for(i = 0; i + 1 < num_dims; i++)
+      empty |= (p_dims[i] == 0);
+    if(!empty)
+      return -1;
+  }
+  p_writer->pp_data[p_writer->num_entries++] = p_data;
+  return 0;
+}
+
+/* Writes the entry's rows with their innermost dimension padded */
+static int write_padded(FILE *fp, const xt_wc_entry_t *p_entry, const uint8_t *p_data)
+{
+  uint32_t elem = (uint32_t)xt_wc_type_size(p_entry->type);
+  uint32_t depth = p_entry->dims[p_entry->num_dims - 1];
+  uint32_t row = depth * elem;
+  uint32_t pad = (p_entry->padded_depth - depth) * elem;
+  uint32_t rows = 1;
+  uint8_t pad_bytes[64];
+  uint32_t i;
+
+  /* Count rows from the outer dims: with depth 0 a row is all padding */
+  if(row + pad == 0)
+    return 0;
+  for(i = 0; i + 1 < p_entry->num_dims; i++)
+    rows *= p_entry->dims[i];
+
+  /* Asymmetric types pad with their zero point so padded taps add nothing */
+  if(p_entry->type == XT_WC_TYPE_ASYM8 || p_entry->type == XT_WC_TYPE_INT8)
+    memset(pad_bytes, (uint8_t)p_entry->zero_point, sizeof(pad_bytes));
+  else
+    memset(pad_bytes, 0, sizeof(pad_bytes));
+
+  for(i = 0; i < rows; i++)
+  {
+    uint32_t left = pad;
+    if(fwrite(p_data + (size_t)i * row, 1, row, fp) != row)
+      return -1;
+    while(left > 0)
+    {
+      uint32_t n = left < sizeof(pad_bytes) ? left : sizeof(pad_bytes);
+      if(fwrite(pad_bytes, 1, n, fp) != n)
+        return -1;
+      left -= n;
+    }
+  }
+  return 0;
+}
+
+int xt_wc_writer_save(const xt_wc_writer_t *p_writer, const char *path)
+{
+  static const uint8_t zeros[XT_WC_ALIGN] = {0};
+  xt_wc_header_t header;
+  uint32_t i, offset;
+  FILE *fp;
+  int ret = 0;
+
+  offset = sizeof(xt_wc_header_t) + p_writer->num_entries * sizeof(xt_wc_entry_t);
+  for(i = 0; i < p_writer->num_entries; i++)
+  {
+    offset = ALIGN_UP(offset);
+    p_writer->p_entries[i].offset = offset;
+    offset += p_writer->p_entries[i].length;
+  }
+
+  header.magic = XT_WC_MAGIC;
+  header.version = XT_WC_VERSION;
+  header.num_entries = p_writer->num_entries;
+  header.size = offset;
+
+  fp = fopen(path, "wb");
+  if(fp == NULL)
+    return -1;
+  if(fwrite(&header, sizeof(header), 1, fp) != 1)
+    ret = -1;
+  if(ret == 0 && p_writer->num_entries &&
+      fwrite(p_writer->p_entries, sizeof(xt_wc_entry_t), p_writer->num_entries, fp) != p_writer->num_entries)
+    ret = -1;
+  offset = sizeof(xt_wc_header_t) + p_writer->num_entries * sizeof(xt_wc_entry_t);
+  for(i = 0; ret == 0 && i < p_writer->num_entries; i++)
+  {
+    const xt_wc_entry_t *p_entry = &p_writer->p_entries[i];
+    if(p_entry->offset > offset &&
+        fwrite(zeros, 1, p_entry->offset - offset, fp) != p_entry->offset - offset)
+      ret = -1;
+    else if(write_padded(fp, p_entry, (const uint8_t *)p_writer->pp_data[i]) != 0)
+      ret = -1;
+    offset = p_entry->offset + p_entry->length;
+  }
+  if(fclose(fp) != 0)
+    ret = -1;
+  return ret;
+}
+
+void xt_wc_writer_free(xt_wc_writer_t *p_writer)
+{
+  free(p_writer->p_entries);
+  free((void *)p_writer->pp_data);
+  xt_wc_writer_init(p_writer);
+}
@@ -163,7 +163,8 @@ void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
 #endif
 #ifdef HIFI_NNLIB_OPT
-  uint8 *kernel;
+  const uint8 *kernel;
+  uint8 *kernel_padded = NULL;
   const uint8 *flt = GetTensorData<uint8_t>(filter);
   int i, j;
   int kh, kw, kc, kc_pad;
@@ -210,15 +211,20 @@ void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
   kw = GetTensorShape(filter).Dims(2);
   kc = GetTensorShape(filter).Dims(3);
   kc_pad = (GetTensorShape(filter).Dims(3)+3)&(~3);
-  kernel = (uint8 *)malloc(kh*kw*kc_pad);
-  /* Pad kernel depth to be multiple of 4 as required by NNLib */
-  for(i = 0; i < kh*kw; i++) {
-    for(j = 0; j < kc; j++) {
-      kernel[i*kc_pad+j] = flt[i*kc+j];
-    }
-    for(; j < kc_pad; j++) {
-      kernel[i*kc_pad+j] = (uint8_t)filter->params.zero_point;
+  /* Pad kernel depth to be multiple of 4 as required by NNLib, a kernel that
+     is a multiple already is read in place from the model */
+  kernel = flt;
+  if(kc_pad != kc) {
+    kernel_padded = (uint8 *)malloc(kh*kw*kc_pad);
+    for(i = 0; i < kh*kw; i++) {
+      for(j = 0; j < kc; j++) {
+        kernel_padded[i*kc_pad+j] = flt[i*kc+j];
+      }
+      for(; j < kc_pad; j++) {
+        kernel_padded[i*kc_pad+j] = (uint8_t)filter->params.zero_point;
+      }
     }
+    kernel = kernel_padded;
   }
 #endif
 
@@ -276,6 +282,8 @@ void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
               0,
               p_scratch);
   }
+  free(kernel_padded);
+  free(p_scratch);
 #endif
 
 #ifdef PROFILE
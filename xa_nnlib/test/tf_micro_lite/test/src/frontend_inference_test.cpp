@@ -35,6 +35,10 @@
 #include "tensorflow/lite/experimental/micro/micro_interpreter.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
+#include "xt_op_profiler.h"
+#include "xt_weight_container.h"
+
+#include <cstdlib>
 
 
 #define WINDOW_SIZE 320
@@ -46,12 +50,37 @@
 
 extern "C" {
 int frontendprocess_inference(void *in, void *out);
+int frontendprocess_inference_container(void *in, void *out, const char *container_path);
+int write_model_container(const char *path);
 }
 
 extern unsigned int yes_wav_len;
 extern unsigned char yes_wav[];
 
+// Set XT_MODEL_CONTAINER to the path of a weight container to run the model
+// stored in its "tflite_model" entry instead of the built-in one.
 int frontendprocess_inference(void *in, void *out) {
+  return frontendprocess_inference_container(in, out, getenv("XT_MODEL_CONTAINER"));
+}
+
+// Writes the built-in model to a weight container at path, as its
+// "tflite_model" entry
+int write_model_container(const char *path) {
+  xt_wc_writer_t writer;
+  const uint32_t length = g_tiny_conv_model_data_len;
+  xt_wc_writer_init(&writer);
+  int err = xt_wc_writer_add(&writer, "tflite_model", XT_WC_TYPE_RAW, 1, &length, 0,
+                             0.0f, 0, g_tiny_conv_model_data);
+  if (err == 0) {
+    err = xt_wc_writer_save(&writer, path);
+  }
+  xt_wc_writer_free(&writer);
+  return err;
+}
+
+// Runs the model of the weight container at container_path, the built-in
+// model when it is NULL. The container is mapped, not read.
+int frontendprocess_inference_container(void *in, void *out, const char *container_path) {
 
 /****File Read upto 1Second audio data***/   
   short *audiobuffer = (short*)in;
@@ -63,22 +92,39 @@ int frontendprocess_inference(void *in, void *out) {
 /***********Frontendprocess*************/
   tflite::MicroErrorReporter micro_error_reporter;
   tflite::ErrorReporter* error_reporter = &micro_error_reporter;
-  uint8_t yes_calculated_data[g_yes_power_spectrum_data_size];
-  for(int j=0;j<SIGNAL_CHANNEL_IMAGE_HEIGHT;j++){
-    TfLiteStatus yes_status = Preprocess(
-    error_reporter, (short*)(audiobuffer+j*WINDOW_SIZE), g_yes_30ms_sample_data_size,
-    g_yes_power_spectrum_data_size, yes_calculated_data);
-    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, yes_status);
-    for (i = 0; i < SIGNAL_CHANNEL_IMAGE_WIDTH; ++i) {
-      audio_spectrogram[SIGNAL_CHANNEL_IMAGE_WIDTH*j+i] = yes_calculated_data[i];
-    }
+  // Feed the audio in 10ms chunks, as a capture driver would deliver it.
+  StreamingPreprocessor preprocessor;
+  const int audio_size =
+      (SIGNAL_CHANNEL_IMAGE_HEIGHT - 1) * WINDOW_SIZE + g_yes_30ms_sample_data_size;
+  const int chunk_size = SAMPLE_RATE / 100;
+  for (int j = 0; j < audio_size; j += chunk_size) {
+    int count = audio_size - j;
+    if (count > chunk_size) count = chunk_size;
+    preprocessor.Feed((short*)(audiobuffer + j), count);
   }
+  TF_LITE_MICRO_EXPECT_EQ(SIGNAL_CHANNEL_IMAGE_HEIGHT, preprocessor.ColumnCount());
+  preprocessor.GetSpectrogram(audio_spectrogram);
  
 
 /***********inference*******************/
+  const unsigned char* model_data = g_tiny_conv_model_data;
+  xt_wc_t model_container = {};
+  if (container_path != nullptr) {
+    const xt_wc_entry_t* entry = nullptr;
+    if (xt_wc_open(&model_container, container_path) == 0) {
+      entry = xt_wc_find(&model_container, "tflite_model");
+    }
+    if (entry == nullptr || entry->type != XT_WC_TYPE_RAW) {
+      error_reporter->Report("No tflite_model in weight container %s\n", container_path);
+      xt_wc_close(&model_container);
+      return -1;
+    }
+    model_data = static_cast<const unsigned char*>(xt_wc_data(&model_container, entry));
+  }
+
   // Map the model into a usable data structure. This doesn't involve any
   // copying or parsing, it's a very lightweight operation.
-  const tflite::Model* model = ::tflite::GetModel(g_tiny_conv_model_data);
+  const tflite::Model* model = ::tflite::GetModel(model_data);
   if (model->version() != TFLITE_SCHEMA_VERSION) {
     error_reporter->Report(
         "Model provided is schema version %d not equal "
@@ -117,8 +163,21 @@ int frontendprocess_inference(void *in, void *out) {
     input->data.uint8[i] = yes_features_data[i];
   }
 
+  // Set XT_OP_PROFILE in the environment to get a per-op breakdown as CSV.
+  const int kMaxOpRecords = 32;
+  static xt_op_prof_record_t op_records[kMaxOpRecords];
+  const bool op_profile = (getenv("XT_OP_PROFILE") != nullptr);
+  if (op_profile) {
+    xt_op_prof_enable(op_records, kMaxOpRecords);
+  }
+
   // Run the model on this input and make sure it succeeds.
   TfLiteStatus invoke_status = interpreter.Invoke();
+
+  if (op_profile) {
+    xt_op_prof_dump_csv(stdout);
+    xt_op_prof_disable();
+  }
   if (invoke_status != kTfLiteOk) {
     error_reporter->Report("Invoke failed\n");
   }
@@ -153,6 +212,7 @@ int frontendprocess_inference(void *in, void *out) {
   out_ptr[i++] = yes_score;
   out_ptr[i++] = no_score;
   error_reporter->Report("Ran successfully\n");
+  xt_wc_close(&model_container);
 
 #ifndef HIFI_WARNINGS
   return 0;
@@ -52,6 +52,7 @@ limitations under the License.
 #include "tensorflow/lite/experimental/micro/examples/micro_speech/preprocessor.h"
 
 #include <cmath>
+#include <cstring>
 #define M_PI 3.14159265358979323846264338327950288
 
 namespace {
@@ -157,85 +158,69 @@ void CalculatePeriodicHann(int window_length, int16_t* window_function) {
 #include "hifi_common.h"
 #include "fft_twiddles32x32.h"
 
-TfLiteStatus Preprocess(tflite::ErrorReporter* error_reporter,
-                        const int16_t* input, int input_size, int output_size,
-                        uint8_t* output) {
-  // Ensure our input and output data arrays are valid.
-  if (input_size > kInputSize) {
-    error_reporter->Report("Input size %d larger than %d", input_size,
-                           kInputSize);
-    return kTfLiteError;
-  }
-  if (output_size != kOutputSize) {
-    error_reporter->Report("Requested output size %d doesn't match %d",
-                           output_size, kOutputSize);
-    return kTfLiteError;
-  }
-
-  // Pre-calculate the window function we'll be applying to the input data.
-  // In a real application, we'd calculate this table once in an initialization
-  // function and store it for repeated reuse.
-  // q1.15 format.
-  int16_t window_function[kInputSize];
-  CalculatePeriodicHann(input_size, window_function);
-
-  // Apply the window function to our time series input, and pad it with zeroes
-  // to the next power of two.
-  int32_t fixed_input[kInputSize];
-  for (int i = 0; i < kInputSize; ++i) {
-    if (i < input_size) {
-      // input is int16_t.  Treat as q1.15 fixed point value in range [-1,1)
-      // window_function is also q1.15 fixed point number
-      fixed_input[i] =
-          Q1_15_FixedMultiply_Q2_30(input[i], window_function[i]);
-    } else {
-      fixed_input[i] = 0;
-    }
-  }
+extern const fft_handle_t rfft32_512;
 
-  // Pull the frequency data from the time series sample.
-  // Calculated in q10.22 format from q2.30 inputs.
+namespace {
 
-  int32_t fourier_values[kInputSize];
-#if 1 //to enable hifi3 optimized FFT
-  extern const fft_handle_t rfft32_512;
-  int scale_option = 3;
-  fft_handle_t h = rfft32_512;
+// Computes x / kAverageWindowSize with a reciprocal multiply instead of a
+// division. Truncates toward zero, so results match the '/' operator for
+// every int32 input.
+inline int32_t DivideByAverageWindow(int32_t x) {
+  const uint32_t magnitude =
+      (x < 0) ? (0u - static_cast<uint32_t>(x)) : static_cast<uint32_t>(x);
+  const uint32_t quotient = static_cast<uint32_t>(
+      (static_cast<uint64_t>(magnitude) * 0xAAAAAAABu) >> 34);
+  return (x < 0) ? -static_cast<int32_t>(quotient)
+                 : static_cast<int32_t>(quotient);
+}
 
-  int ret = fft_real32x32(fourier_values, fixed_input, h, scale_option);
-#ifndef HIFI_WARNINGS
-  (void)ret;
-#endif
-  for (int i = 0; i < kInputSize; ++i)
-      fourier_values[i] = fourier_values[i]<<1;
-#else
-  CalculateDiscreteFourierTransform(fixed_input, kInputSize, fourier_values);
-#endif
-  // We have the complex numbers giving us information about each frequency++++
-  // band, but all we want to know is how strong each frequency is, so calculate
-  // the squared magnitude by adding together the squares of each component.
-  int32_t power_spectrum[kInputSize / 2];
-  for (int i = 0; i < (kInputSize / 2); ++i) {
-    const int32_t real = fourier_values[(i * 2) + 0];
-    const int32_t imaginary = fourier_values[(i * 2) + 1];
-    // q10.22 results
-    power_spectrum[i] =
-        Q10_22_FixedMultiply_Q10_22(real, real) +
-        Q10_22_FixedMultiply_Q10_22(imaginary, imaginary);
+// Applies the q1.15 window to up to kInputSize samples, writing q2.30 values
+// zero-padded to kInputSize. fixed_input must be 8-byte aligned.
+void ApplyWindow(const int16_t* input, int input_size,
+                 const int16_t* window_function, int32_t* fixed_input) {
+  const ae_int16x4* p_in = reinterpret_cast<const ae_int16x4*>(input);
+  const ae_int16x4* p_win = reinterpret_cast<const ae_int16x4*>(window_function);
+  ae_int32x2* p_out = reinterpret_cast<ae_int32x2*>(fixed_input);
+  ae_valign in_align = AE_LA64_PP(p_in);
+  ae_valign win_align = AE_LA64_PP(p_win);
+  int i;
+  for (i = 0; i < (input_size & ~3); i += 4) {
+    ae_int16x4 samples, weights;
+    ae_int32x2 prod_hi, prod_lo;
+    AE_LA16X4_IP(samples, in_align, p_in);
+    AE_LA16X4_IP(weights, win_align, p_win);
+    AE_MUL16X4(prod_hi, prod_lo, samples, weights);
+    AE_S32X2_IP(prod_hi, p_out, sizeof(ae_int32x2));
+    AE_S32X2_IP(prod_lo, p_out, sizeof(ae_int32x2));
   }
+  for (; i < input_size; ++i) {
+    fixed_input[i] = Q1_15_FixedMultiply_Q2_30(input[i], window_function[i]);
+  }
+  for (; i < kInputSize; ++i) {
+    fixed_input[i] = 0;
+  }
+}
 
-
-  // Finally, reduce the size of the output by averaging together six adjacent
-  // frequencies into each slot, producing an array of 43 values.
-  // Power_spectrum numbers are q10.22.  Divide by kAverageWindowSize inside
-  // loop to prevent overflow.
+// Turns the interleaved q10.22 spectrum into kOutputSize quantized bands.
+// Each bin's squared magnitude is formed from one 32x2 load and summed
+// straight into its band, so no intermediate power spectrum is stored.
+void CalculateBandFeatures(const int32_t* fourier_values, uint8_t* output) {
+  const ae_int32x2* p_bin = reinterpret_cast<const ae_int32x2*>(fourier_values);
   for (int i = 0; i < kOutputSize; ++i) {
+    int bins = (kInputSize / 2) - (i * kAverageWindowSize);
+    if (bins > kAverageWindowSize) {
+      bins = kAverageWindowSize;
+    }
     int32_t average = 0;
-    for (int j = 0; j < kAverageWindowSize; ++j) {
-      const int index = (i * kAverageWindowSize) + j;
-      if (index < (kInputSize / 2)) {
-        average += power_spectrum[index] / kAverageWindowSize;
-      }
+    for (int j = 0; j < bins; ++j) {
+      ae_int32x2 bin;
+      AE_L32X2_IP(bin, p_bin, sizeof(ae_int32x2));
+      // Undo the FFT scaling and keep the top bits of each q10.22 component,
+      // exactly as Q10_22_FixedMultiply_Q10_22 does.
+      bin = AE_SRAI32(AE_SLAI32(bin, 1), 11);
+      ae_int64 power = AE_ADD64(AE_MUL32_HH(bin, bin), AE_MUL32_LL(bin, bin));
+      average += DivideByAverageWindow(
+          AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(power)));
     }
     // Quantize the result into eight bits, effectively multiplying by two.
     // The 127.5 constant here has to match the features_max value defined in
@@ -262,8 +247,117 @@ TfLiteStatus Preprocess(tflite::ErrorReporter* error_reporter,
     }
     output[i] = quantized_average;
   }
-#ifdef HIFI_WARNINGS
+}
+
+// Windows one frame, pulls the frequency data from it and reduces it to
+// kOutputSize features.
+void CalculateFrameFeatures(const int16_t* input, int input_size,
+                            const int16_t* window_function, uint8_t* output) {
+  int32_t fixed_input[kInputSize] __attribute__((aligned(8)));
+  // The real FFT returns kInputSize / 2 + 1 complex values.
+  int32_t fourier_values[kInputSize + 2] __attribute__((aligned(8)));
+
+  ApplyWindow(input, input_size, window_function, fixed_input);
+
+  // Calculated in q10.22 format from q2.30 inputs.
+#if 1 //to enable hifi3 optimized FFT
+  int scale_option = 3;
+  int ret = fft_real32x32(fourier_values, fixed_input, rfft32_512, scale_option);
   (void)ret;
+#else
+  CalculateDiscreteFourierTransform(fixed_input, kInputSize, fourier_values);
+  for (int i = 0; i < kInputSize; ++i)
+      fourier_values[i] = fourier_values[i]>>1;
 #endif
+
+  CalculateBandFeatures(fourier_values, output);
+}
+
+}  // namespace
+
+TfLiteStatus Preprocess(tflite::ErrorReporter* error_reporter,
+                        const int16_t* input, int input_size, int output_size,
+                        uint8_t* output) {
+  // Ensure our input and output data arrays are valid.
+  if (input_size > kInputSize) {
+    error_reporter->Report("Input size %d larger than %d", input_size,
+                           kInputSize);
+    return kTfLiteError;
+  }
+  if (output_size != kOutputSize) {
+    error_reporter->Report("Requested output size %d doesn't match %d",
+                           output_size, kOutputSize);
+    return kTfLiteError;
+  }
+
+  // The window function only depends on the input size, so keep the last one
+  // around instead of recalculating it for every frame.
+  // q1.15 format.
+  static int16_t window_function[kInputSize] __attribute__((aligned(8)));
+  static int window_length = 0;
+  if (window_length != input_size) {
+    CalculatePeriodicHann(input_size, window_function);
+    window_length = input_size;
+  }
+
+  CalculateFrameFeatures(input, input_size, window_function, output);
   return kTfLiteOk;
 }
+
+StreamingPreprocessor::StreamingPreprocessor() {
+  static_assert(kFeatureWidth == kOutputSize, "feature width mismatch");
+  static_assert(kWindowSize <= kInputSize, "window larger than FFT size");
+  static_assert(kHopSize <= kWindowSize, "hop larger than window");
+  CalculatePeriodicHann(kWindowSize, window_function_);
+  Reset();
+}
+
+void StreamingPreprocessor::Reset() {
+  history_size_ = 0;
+  next_row_ = 0;
+  rows_filled_ = 0;
+  memset(features_, 0, sizeof(features_));
+}
+
+int StreamingPreprocessor::Feed(const int16_t* input, int input_size) {
+  int new_columns = 0;
+  while (input_size > 0) {
+    int count = kWindowSize - history_size_;
+    if (count > input_size) {
+      count = input_size;
+    }
+    memcpy(history_ + history_size_, input, count * sizeof(int16_t));
+    history_size_ += count;
+    input += count;
+    input_size -= count;
+
+    if (history_size_ == kWindowSize) {
+      CalculateFrameFeatures(history_, kWindowSize, window_function_,
+                             features_[next_row_]);
+      next_row_ = (next_row_ + 1) % kFeatureCount;
+      if (rows_filled_ < kFeatureCount) {
+        ++rows_filled_;
+      }
+      // Keep the overlap with the next window.
+      memmove(history_, history_ + kHopSize,
+              (kWindowSize - kHopSize) * sizeof(int16_t));
+      history_size_ = kWindowSize - kHopSize;
+      ++new_columns;
+    }
+  }
+  return new_columns;
+}
+
+void StreamingPreprocessor::GetSpectrogram(uint8_t* output) const {
+  // Rows that have not been computed yet read as silence, so the newest
+  // column is always the last one.
+  const int empty_rows = kFeatureCount - rows_filled_;
+  memset(output, 0, empty_rows * kFeatureWidth);
+  output += empty_rows * kFeatureWidth;
+  int row = (next_row_ + empty_rows) % kFeatureCount;
+  for (int i = 0; i < rows_filled_; ++i) {
+    memcpy(output, features_[row], kFeatureWidth);
+    output += kFeatureWidth;
+    row = (row + 1) % kFeatureCount;
+  }
+}
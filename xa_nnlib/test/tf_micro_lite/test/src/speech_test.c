@@ -79,6 +79,8 @@ extern "C" {
 int preprocessor_test(void *in, void *out);
 int micro_speech_test(void *in, void *out);
 int frontendprocess_inference(void *in, void *out);
+int frontendprocess_inference_container(void *in, void *out, const char *container_path);
+int write_model_container(const char *path);
 #if defined(__cplusplus)
 }
 #endif
@@ -129,6 +131,21 @@ int xa_tf_micro_lite_main_process(int argc, char **argv)
   printf("frontend inference running\n");
   frontendprocess_inference(input, output);
 
+  /* Round trip of the model through a weight container, the scores have
+     to match the built-in model's */
+  printf("frontend inference from weight container running\n");
+  {
+    static const char container_path[] = "tf_micro_model_container_test.bin";
+    short scores[NO_INDEX + 1];
+    int i, err = write_model_container(container_path);
+    if(err == 0)
+      err = frontendprocess_inference_container(input, scores, container_path);
+    for(i = SILENCE_INDEX; i <= NO_INDEX && err == 0; i++)
+      err = (scores[i] != output[i]);
+    remove(container_path);
+    printf("weight container round trip %s\n", err == 0 ? "passed" : "failed");
+  }
+
   printf("frontend running\n");
   preprocessor_test(input, output);
   
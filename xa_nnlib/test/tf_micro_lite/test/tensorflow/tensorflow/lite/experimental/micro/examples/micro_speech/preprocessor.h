@@ -49,4 +49,40 @@ TfLiteStatus Preprocess(tflite::ErrorReporter* error_reporter,
                         const int16_t* input, int input_size, int output_size,
                         uint8_t* output);
 
+// Streaming version of Preprocess() for continuous audio. PCM samples can be
+// fed in chunks of any length; every time a full window is available one new
+// feature column is calculated and appended to a ring holding the last
+// kFeatureCount columns, so each hop only costs a single frame. The window
+// function is calculated once at construction.
+class StreamingPreprocessor {
+ public:
+  static constexpr int kWindowSize = 480;  // 30ms at 16KHz.
+  static constexpr int kHopSize = 320;     // 20ms at 16KHz.
+  static constexpr int kFeatureWidth = 43;
+  static constexpr int kFeatureCount = 49;
+
+  StreamingPreprocessor();
+
+  // Drops any buffered audio and all calculated columns.
+  void Reset();
+
+  // Consumes input_size samples and returns the number of new columns.
+  int Feed(const int16_t* input, int input_size);
+
+  // Number of valid columns in the ring, at most kFeatureCount.
+  int ColumnCount() const { return rows_filled_; }
+
+  // Writes kFeatureCount x kFeatureWidth features, oldest column first.
+  // Columns not yet calculated are zero and come before the valid ones.
+  void GetSpectrogram(uint8_t* output) const;
+
+ private:
+  int16_t window_function_[kWindowSize] __attribute__((aligned(8)));
+  int16_t history_[kWindowSize] __attribute__((aligned(8)));
+  int history_size_;
+  uint8_t features_[kFeatureCount][kFeatureWidth];
+  int next_row_;
+  int rows_filled_;
+};
+
 #endif  // TENSORFLOW_LITE_EXPERIMENTAL_MICRO_EXAMPLES_MICRO_SPEECH_PREPROCESSOR_H_
@@ -37,6 +37,7 @@ limitations under the License.
 
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
 #include "tensorflow/lite/experimental/micro/compatibility.h"
+#include "xt_op_profiler.h"
 
 namespace tflite {
 namespace {
@@ -68,6 +69,52 @@ const char* OpNameFromRegistration(const TfLiteRegistration* registration) {
   }
 }
 
+// Total size of the tensors listed, skipping optional (-1) entries.
+uint32_t TensorListBytes(const TfLiteContext& context,
+                         const TfLiteIntArray* tensor_list) {
+  uint32_t bytes = 0;
+  for (int n = 0; n < tensor_list->size; ++n) {
+    if (tensor_list->data[n] >= 0) {
+      bytes += context.tensors[tensor_list->data[n]].bytes;
+    }
+  }
+  return bytes;
+}
+
+int TensorElementCount(const TfLiteTensor& tensor) {
+  int count = 1;
+  for (int d = 0; d < tensor.dims->size; ++d) {
+    count *= tensor.dims->data[d];
+  }
+  return count;
+}
+
+// Multiply-accumulates done by the op, for the ops where that is the bulk of
+// the work. Others report zero.
+uint64_t EstimateMacs(const TfLiteContext& context, BuiltinOperator op_type,
+                      const TfLiteNode& node) {
+  if (node.inputs->size < 2 || node.outputs->size < 1) {
+    return 0;
+  }
+  const TfLiteTensor& filter = context.tensors[node.inputs->data[1]];
+  const TfLiteTensor& output = context.tensors[node.outputs->data[0]];
+  const uint64_t output_count = TensorElementCount(output);
+  switch (op_type) {
+    case BuiltinOperator_CONV_2D:
+      // filter: [out_channels, kernel_height, kernel_width, in_channels]
+      return output_count *
+             (TensorElementCount(filter) / filter.dims->data[0]);
+    case BuiltinOperator_DEPTHWISE_CONV_2D:
+      // filter: [1, kernel_height, kernel_width, out_channels]
+      return output_count * filter.dims->data[1] * filter.dims->data[2];
+    case BuiltinOperator_FULLY_CONNECTED:
+      // weights: [units, input_depth]
+      return output_count * filter.dims->data[filter.dims->size - 1];
+    default:
+      return 0;
+  }
+}
+
 void ReportOpError(struct TfLiteContext* context, const char* format, ...) {
   MicroInterpreter* interpreter =
       static_cast<MicroInterpreter*>(context->impl_);
@@ -290,7 +337,18 @@ TfLiteStatus MicroInterpreter::Invoke() {
     }
 
     if (registration->invoke) {
+      xt_op_prof_record_t prof_record;
+      const bool profiling = xt_op_prof_is_enabled();
+      if (profiling) {
+        xt_op_prof_begin(&prof_record, i, registration->builtin_code,
+                         OpNameFromRegistration(registration));
+      }
       TfLiteStatus invoke_status = registration->invoke(&context_, &node);
+      if (profiling) {
+        xt_op_prof_end(&prof_record, TensorListBytes(context_, inputs_array),
+                       TensorListBytes(context_, outputs_array),
+                       EstimateMacs(context_, op_type, node));
+      }
       if (invoke_status != kTfLiteOk) {
         error_reporter_->Report(
             "Node %s (number %d) failed to invoke with status %d",